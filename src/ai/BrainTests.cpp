@@ -519,6 +519,47 @@ void testSpeciation() {
     TestReporter::pass();
 }
 
+void testParallelEvolutionDeterminism() {
+    TestReporter::startTest("Parallel Evolution Determinism");
+
+    auto fitness = [](const NEATGenome& g) {
+        return static_cast<float>(g.getComplexity());
+    };
+
+    // Same seed, serial vs. thread pool: identical genomes and innovations
+    auto runPopulation = [&](bool parallel) {
+        NEATPopulation population(60, 3, 2, 42u);
+        population.parallel = parallel;
+        population.mutationParams.addNodeProb = 0.2f;
+        population.mutationParams.addConnectionProb = 0.3f;
+        for (int gen = 0; gen < 10; gen++) {
+            population.evaluateFitness(fitness);
+            population.evolve();
+        }
+
+        std::vector<int> signature;
+        for (const auto& genome : population.getGenomes()) {
+            for (const auto& conn : genome.getConnections()) {
+                signature.push_back(conn.innovation);
+                signature.push_back(conn.fromNode);
+                signature.push_back(conn.toNode);
+            }
+            signature.push_back(-1);
+        }
+        return signature;
+    };
+
+    std::vector<int> serial = runPopulation(false);
+    std::vector<int> parallel = runPopulation(true);
+
+    assert(serial == parallel);
+    for (int id : parallel) {
+        assert(!InnovationTracker::isProvisionalId(id));
+    }
+
+    TestReporter::pass();
+}
+
 // ============================================================================
 // Integration Tests
 // ============================================================================
@@ -692,6 +733,7 @@ void runAllTests() {
     // Evolution Tests
     testEvolutionImprovesFitness();
     testSpeciation();
+    testParallelEvolutionDeterminism();
 
     // Integration Tests
     testCreatureBrainInterface();
@@ -16,6 +16,9 @@ CreatureBrainInterface::CreatureBrainInterface()
 
 void CreatureBrainInterface::initialize(BrainType type, int inputSize, int outputSize) {
     m_brainType = type;
+    m_lastOutput = MotorOutput();
+    m_lastInput = SensoryInput();
+    m_stats = Statistics();
 
     if (type == BrainType::LEGACY_STEERING) {
         // No brain needed - will use steering behaviors
@@ -31,7 +34,12 @@ void CreatureBrainInterface::initialize(BrainType type, int inputSize, int outpu
     } else if (type == BrainType::NEAT_EVOLVED) {
         // Create minimal NEAT genome
         m_genome.createMinimal(inputSize, outputSize, rng);
-        m_brain = std::make_unique<CreatureBrain>();
+        // Reuse the existing brain allocation when re-initializing a recycled interface
+        if (m_brain) {
+            m_brain->reset();
+        } else {
+            m_brain = std::make_unique<CreatureBrain>();
+        }
         m_brain->initializeFromGenome(m_genome);
     }
 }
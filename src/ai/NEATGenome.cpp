@@ -1,4 +1,5 @@
 #include "NEATGenome.h"
+#include "../utils/ThreadPool.h"
 #include <algorithm>
 #include <queue>
 #include <set>
@@ -13,6 +14,10 @@ namespace ai {
 void NEATGenome::createMinimal(int numInputs, int numOutputs, std::mt19937& rng) {
     m_nodes.clear();
     m_connections.clear();
+    // A recycled genome must not carry its previous owner's evaluation
+    m_fitness = 0.0f;
+    m_adjustedFitness = 0.0f;
+    m_speciesId = -1;
     m_inputCount = numInputs;
     m_outputCount = numOutputs;
 
@@ -44,10 +49,12 @@ void NEATGenome::createMinimal(int numInputs, int numOutputs, std::mt19937& rng)
             for (int outId : outputIds) {
                 int innovation = tracker.getConnectionInnovation(inputNode.id, outId);
                 float weight = weightDist(rng);
-                m_connections.emplace_back(innovation, inputNode.id, outId, weight, true, false);
+                insertConnection(innovation, inputNode.id, outId, weight, true, false);
             }
         }
     }
+
+    refreshTopologySignature();
 }
 
 // ============================================================================
@@ -124,6 +131,10 @@ void NEATGenome::mutate(std::mt19937& rng, const MutationParams& params) {
     if (prob(rng) < params.optimizeEfficiencyProb) {
         optimizeForEfficiency(rng, params.efficiencyPruneThreshold);
     }
+
+    if (!m_topologyValid) {
+        refreshTopologySignature();
+    }
 }
 
 void NEATGenome::mutateWeights(std::mt19937& rng, float perturbChance,
@@ -189,12 +200,14 @@ void NEATGenome::mutateAddConnection(std::mt19937& rng, bool allowRecurrent) {
         auto& tracker = InnovationTracker::instance();
         int innovation = tracker.getConnectionInnovation(fromId, toId);
         float weight = weightDist(rng);
-        m_connections.emplace_back(innovation, fromId, toId, weight, true, isRecurrent);
+        insertConnection(innovation, fromId, toId, weight, true, isRecurrent);
         return;
     }
 }
 
 void NEATGenome::mutateAddNode(std::mt19937& rng) {
+    m_topologyValid = false;
+
     // Get enabled connections
     std::vector<size_t> enabledIndices;
     for (size_t i = 0; i < m_connections.size(); i++) {
@@ -208,10 +221,9 @@ void NEATGenome::mutateAddNode(std::mt19937& rng) {
     // Select random connection to split
     std::uniform_int_distribution<size_t> dist(0, enabledIndices.size() - 1);
     size_t connIdx = enabledIndices[dist(rng)];
-    ConnectionGene& oldConn = m_connections[connIdx];
-
-    // Disable old connection
-    oldConn.enabled = false;
+    // Disable old connection (work on a copy: the emplace_backs below may reallocate)
+    m_connections[connIdx].enabled = false;
+    const ConnectionGene oldConn = m_connections[connIdx];
 
     // Create new node
     auto& tracker = InnovationTracker::instance();
@@ -243,14 +255,16 @@ void NEATGenome::mutateAddNode(std::mt19937& rng) {
     // Create two new connections
     // Connection 1: from original source to new node (weight = 1.0)
     int innov1 = tracker.getConnectionInnovation(oldConn.fromNode, newNodeId);
-    m_connections.emplace_back(innov1, oldConn.fromNode, newNodeId, 1.0f, true, false);
+    insertConnection(innov1, oldConn.fromNode, newNodeId, 1.0f, true, false);
 
     // Connection 2: from new node to original target (weight = old weight)
     int innov2 = tracker.getConnectionInnovation(newNodeId, oldConn.toNode);
-    m_connections.emplace_back(innov2, newNodeId, oldConn.toNode, oldConn.weight, true, false);
+    insertConnection(innov2, newNodeId, oldConn.toNode, oldConn.weight, true, false);
 }
 
 void NEATGenome::mutateToggleEnable(std::mt19937& rng) {
+    m_topologyValid = false;
+
     if (m_connections.empty()) return;
 
     std::uniform_int_distribution<size_t> dist(0, m_connections.size() - 1);
@@ -327,6 +341,8 @@ void NEATGenome::mutatePlasticity(std::mt19937& rng) {
 // ============================================================================
 
 void NEATGenome::mutateAddModule(std::mt19937& rng, int moduleSize) {
+    m_topologyValid = false;
+
     if (moduleSize < 2) moduleSize = 2;
     if (moduleSize > 10) moduleSize = 10;
 
@@ -375,7 +391,7 @@ void NEATGenome::mutateAddModule(std::mt19937& rng, int moduleSize) {
                 int toId = moduleNodeIds[j];
                 int innovation = tracker.getConnectionInnovation(fromId, toId);
                 float weight = weightDist(rng);
-                m_connections.emplace_back(innovation, fromId, toId, weight, true, false);
+                insertConnection(innovation, fromId, toId, weight, true, false);
                 region.internalConnections.push_back(innovation);
             }
         }
@@ -397,7 +413,7 @@ void NEATGenome::mutateAddModule(std::mt19937& rng, int moduleSize) {
         int srcId = validSources[srcDist(rng)];
         int tgtId = moduleNodeIds[0];  // First module node is input
         int innovation = tracker.getConnectionInnovation(srcId, tgtId);
-        m_connections.emplace_back(innovation, srcId, tgtId, weightDist(rng), true, false);
+        insertConnection(innovation, srcId, tgtId, weightDist(rng), true, false);
         region.inputConnections.push_back(innovation);
     }
 
@@ -408,7 +424,7 @@ void NEATGenome::mutateAddModule(std::mt19937& rng, int moduleSize) {
         int tgtId = validTargets[tgtDist(rng)];
         if (srcId != tgtId) {
             int innovation = tracker.getConnectionInnovation(srcId, tgtId);
-            m_connections.emplace_back(innovation, srcId, tgtId, weightDist(rng), true, false);
+            insertConnection(innovation, srcId, tgtId, weightDist(rng), true, false);
             region.outputConnections.push_back(innovation);
         }
     }
@@ -449,7 +465,7 @@ void NEATGenome::mutateAddRecurrence(std::mt19937& rng) {
         if (fromNode->layer >= toNode->layer) {
             auto& tracker = InnovationTracker::instance();
             int innovation = tracker.getConnectionInnovation(fromId, toId);
-            m_connections.emplace_back(innovation, fromId, toId, weightDist(rng), true, true);
+            insertConnection(innovation, fromId, toId, weightDist(rng), true, true);
             return;
         }
     }
@@ -533,6 +549,8 @@ void NEATGenome::mutateSplitModule(std::mt19937& rng) {
 }
 
 void NEATGenome::mutatePruneDeadEnds() {
+    m_topologyValid = false;
+
     // Find nodes that have no path to output or from input
     std::unordered_set<int> inputNodeIds;
     std::unordered_set<int> outputNodeIds;
@@ -630,6 +648,8 @@ void NEATGenome::mutatePruneDeadEnds() {
 }
 
 void NEATGenome::mutateTransferModule(const NEATGenome& source, std::mt19937& rng) {
+    m_topologyValid = false;
+
     // Get source regions
     const auto& sourceRegions = source.getRegions();
     if (sourceRegions.empty()) return;
@@ -679,8 +699,8 @@ void NEATGenome::mutateTransferModule(const NEATGenome& source, std::mt19937& rn
             int newFrom = fromIt->second;
             int newTo = toIt->second;
             int innovation = tracker.getConnectionInnovation(newFrom, newTo);
-            m_connections.emplace_back(innovation, newFrom, newTo, conn.weight,
-                                       true, conn.recurrent);
+            insertConnection(innovation, newFrom, newTo, conn.weight,
+                             true, conn.recurrent);
             newRegion.internalConnections.push_back(innovation);
         }
     }
@@ -702,7 +722,7 @@ void NEATGenome::mutateTransferModule(const NEATGenome& source, std::mt19937& rn
         int srcId = validSources[srcDist(rng)];
         int tgtId = newRegion.nodeIds[0];
         int innovation = tracker.getConnectionInnovation(srcId, tgtId);
-        m_connections.emplace_back(innovation, srcId, tgtId, weightDist(rng), true, false);
+        insertConnection(innovation, srcId, tgtId, weightDist(rng), true, false);
         newRegion.inputConnections.push_back(innovation);
     }
 
@@ -711,7 +731,7 @@ void NEATGenome::mutateTransferModule(const NEATGenome& source, std::mt19937& rn
         int srcId = newRegion.nodeIds.back();
         int tgtId = validTargets[tgtDist(rng)];
         int innovation = tracker.getConnectionInnovation(srcId, tgtId);
-        m_connections.emplace_back(innovation, srcId, tgtId, weightDist(rng), true, false);
+        insertConnection(innovation, srcId, tgtId, weightDist(rng), true, false);
         newRegion.outputConnections.push_back(innovation);
     }
 
@@ -745,72 +765,137 @@ NEATGenome NEATGenome::crossover(const NEATGenome& fitter, const NEATGenome& oth
         }
     }
 
-    // Align genes by innovation number
-    std::unordered_map<int, const ConnectionGene*> fitterGenes;
-    std::unordered_map<int, const ConnectionGene*> otherGenes;
-
-    for (const auto& conn : fitter.m_connections) {
-        fitterGenes[conn.innovation] = &conn;
-    }
-    for (const auto& conn : other.m_connections) {
-        otherGenes[conn.innovation] = &conn;
-    }
+    // Both gene lists are sorted by innovation, so alignment is a linear merge
+    const auto& fitterGenes = fitter.m_connections;
+    const auto& otherGenes = other.m_connections;
+    child.m_connections.reserve(fitterGenes.size());
 
-    // Determine max innovation
-    int maxInnov = 0;
-    for (const auto& conn : fitter.m_connections) {
-        maxInnov = std::max(maxInnov, conn.innovation);
-    }
-    for (const auto& conn : other.m_connections) {
-        maxInnov = std::max(maxInnov, conn.innovation);
-    }
+    size_t j = 0;
+    for (size_t i = 0; i < fitterGenes.size(); i++) {
+        const ConnectionGene& fitterGene = fitterGenes[i];
+        if (i > 0 && fitterGenes[i - 1].innovation == fitterGene.innovation) {
+            continue;  // Duplicate marker (same connection split twice) - inherit once
+        }
 
-    // Process each innovation number
-    for (int innov = 0; innov <= maxInnov; innov++) {
-        auto fitterIt = fitterGenes.find(innov);
-        auto otherIt = otherGenes.find(innov);
+        // Disjoint/excess from other parent are NOT inherited (fitter parent dominates)
+        while (j < otherGenes.size() && otherGenes[j].innovation < fitterGene.innovation) {
+            j++;
+        }
 
-        if (fitterIt != fitterGenes.end() && otherIt != otherGenes.end()) {
+        if (j < otherGenes.size() && otherGenes[j].innovation == fitterGene.innovation) {
             // Matching gene - randomly choose parent
-            const ConnectionGene* chosen = (prob(rng) < 0.5f) ?
-                                           fitterIt->second : otherIt->second;
-            child.m_connections.push_back(*chosen);
+            const ConnectionGene& otherGene = otherGenes[j];
+            child.m_connections.push_back(prob(rng) < 0.5f ? fitterGene : otherGene);
 
             // Handle disabled genes
-            if (!fitterIt->second->enabled || !otherIt->second->enabled) {
+            if (!fitterGene.enabled || !otherGene.enabled) {
                 if (prob(rng) < 0.75f) {
                     child.m_connections.back().enabled = false;
                 }
             }
-        } else if (fitterIt != fitterGenes.end()) {
+        } else {
             // Disjoint/excess from fitter parent - always inherit
-            child.m_connections.push_back(*fitterIt->second);
+            child.m_connections.push_back(fitterGene);
         }
-        // Disjoint/excess from other parent are NOT inherited (fitter parent dominates)
     }
 
+    child.refreshTopologySignature();
     return child;
 }
 
+void NEATGenome::remapIds(const InnovationTracker::IdRemap& remap) {
+    if (remap.empty()) return;
+
+    for (auto& node : m_nodes) {
+        node.id = remap.node(node.id);
+    }
+    for (auto& conn : m_connections) {
+        conn.innovation = remap.innovation(conn.innovation);
+        conn.fromNode = remap.node(conn.fromNode);
+        conn.toNode = remap.node(conn.toNode);
+    }
+    // Resolved innovations can land below existing ones
+    std::stable_sort(m_connections.begin(), m_connections.end(),
+                     [](const ConnectionGene& a, const ConnectionGene& b) {
+                         return a.innovation < b.innovation;
+                     });
+    for (auto& modConn : m_modulatoryConnections) {
+        modConn.innovation = remap.innovation(modConn.innovation);
+        modConn.modulatorNodeId = remap.node(modConn.modulatorNodeId);
+        modConn.targetConnectionInnovation = remap.innovation(modConn.targetConnectionInnovation);
+    }
+    for (auto& region : m_regions) {
+        for (int& id : region.nodeIds) id = remap.node(id);
+        for (int& innov : region.inputConnections) innov = remap.innovation(innov);
+        for (int& innov : region.outputConnections) innov = remap.innovation(innov);
+        for (int& innov : region.internalConnections) innov = remap.innovation(innov);
+    }
+}
+
+void NEATGenome::setGenes(std::vector<NodeGene> nodes, std::vector<ConnectionGene> connections) {
+    m_nodes = std::move(nodes);
+    m_connections = std::move(connections);
+    m_regions.clear();
+    m_modulatoryConnections.clear();
+
+    m_inputCount = 0;
+    m_outputCount = 0;
+    for (const auto& node : m_nodes) {
+        if (node.type == NodeType::INPUT) m_inputCount++;
+        if (node.type == NodeType::OUTPUT) m_outputCount++;
+    }
+
+    refreshTopologySignature();
+}
+
+// ============================================================================
+// Gene Storage / Topology Signature
+// ============================================================================
+
+void NEATGenome::insertConnection(int innovation, int from, int to, float weight,
+                                  bool enabled, bool recurrent) {
+    // New innovations are almost always the largest, so this is usually an append
+    auto pos = std::upper_bound(m_connections.begin(), m_connections.end(), innovation,
+                                [](int innov, const ConnectionGene& conn) {
+                                    return innov < conn.innovation;
+                                });
+    m_connections.emplace(pos, innovation, from, to, weight, enabled, recurrent);
+    m_topologyValid = false;
+}
+
+TopologySignature NEATGenome::computeTopologySignature() const {
+    TopologySignature signature;
+    signature.nodeCount = static_cast<int>(m_nodes.size());
+    signature.enabledConnectionCount = getEnabledConnectionCount();
+    signature.recurrentConnectionCount = getRecurrentConnectionCount();
+    signature.maxLayer = getMaxLayer();
+    signature.modularity = calculateModularity();
+    return signature;
+}
+
+TopologySignature NEATGenome::getTopologySignature() const {
+    return m_topologyValid ? m_topology : computeTopologySignature();
+}
+
+void NEATGenome::refreshTopologySignature() {
+    m_topology = computeTopologySignature();
+    m_topologyValid = true;
+}
+
 // ============================================================================
 // Compatibility Distance
 // ============================================================================
 
 float NEATGenome::compatibilityDistance(const NEATGenome& other,
                                          float c1, float c2, float c3) const {
-    // Count excess, disjoint, and average weight difference
+    // Count excess, disjoint, and average weight difference in one merge pass
+    // over the innovation-sorted gene lists
 
-    std::set<int> thisInnovs, otherInnovs;
-    for (const auto& conn : m_connections) {
-        thisInnovs.insert(conn.innovation);
-    }
-    for (const auto& conn : other.m_connections) {
-        otherInnovs.insert(conn.innovation);
-    }
+    const auto& thisGenes = m_connections;
+    const auto& otherGenes = other.m_connections;
 
-    int thisMax = thisInnovs.empty() ? 0 : *thisInnovs.rbegin();
-    int otherMax = otherInnovs.empty() ? 0 : *otherInnovs.rbegin();
-    int maxInnov = std::max(thisMax, otherMax);
+    int thisMax = thisGenes.empty() ? 0 : thisGenes.back().innovation;
+    int otherMax = otherGenes.empty() ? 0 : otherGenes.back().innovation;
     int minMax = std::min(thisMax, otherMax);
 
     int excess = 0;
@@ -818,29 +903,41 @@ float NEATGenome::compatibilityDistance(const NEATGenome& other,
     float weightDiffSum = 0.0f;
     int matchingCount = 0;
 
-    // Build weight maps for matching genes
-    std::unordered_map<int, float> thisWeights, otherWeights;
-    for (const auto& conn : m_connections) {
-        thisWeights[conn.innovation] = conn.weight;
-    }
-    for (const auto& conn : other.m_connections) {
-        otherWeights[conn.innovation] = conn.weight;
-    }
-
-    for (int i = 0; i <= maxInnov; i++) {
-        bool inThis = thisInnovs.count(i) > 0;
-        bool inOther = otherInnovs.count(i) > 0;
+    // A connection split twice can leave the same innovation on several genes;
+    // each run of equal innovations counts once, weighted by its last gene
+    auto runEnd = [](const std::vector<ConnectionGene>& genes, size_t k) {
+        while (k + 1 < genes.size() && genes[k + 1].innovation == genes[k].innovation) {
+            k++;
+        }
+        return k;
+    };
 
-        if (inThis && inOther) {
+    size_t i = 0;
+    size_t j = 0;
+    while (i < thisGenes.size() || j < otherGenes.size()) {
+        int innov;
+        if (j == otherGenes.size() ||
+            (i < thisGenes.size() && thisGenes[i].innovation < otherGenes[j].innovation)) {
+            innov = thisGenes[i].innovation;
+            i = runEnd(thisGenes, i) + 1;
+        } else if (i == thisGenes.size() || otherGenes[j].innovation < thisGenes[i].innovation) {
+            innov = otherGenes[j].innovation;
+            j = runEnd(otherGenes, j) + 1;
+        } else {
             // Matching gene
-            weightDiffSum += std::abs(thisWeights[i] - otherWeights[i]);
+            size_t thisLast = runEnd(thisGenes, i);
+            size_t otherLast = runEnd(otherGenes, j);
+            weightDiffSum += std::abs(thisGenes[thisLast].weight - otherGenes[otherLast].weight);
             matchingCount++;
-        } else if (inThis || inOther) {
-            if (i > minMax) {
-                excess++;
-            } else {
-                disjoint++;
-            }
+            i = thisLast + 1;
+            j = otherLast + 1;
+            continue;
+        }
+
+        if (innov > minMax) {
+            excess++;
+        } else {
+            disjoint++;
         }
     }
 
@@ -874,40 +971,39 @@ float NEATGenome::compatibilityDistanceEnhanced(const NEATGenome& other,
 // ============================================================================
 
 float NEATGenome::calculateBrainStructureDistance(const NEATGenome& other) const {
+    // Compare cached signatures (modularity in particular is expensive to
+    // recompute for every pair during speciation)
+    const TopologySignature a = getTopologySignature();
+    const TopologySignature b = other.getTopologySignature();
+
     float distance = 0.0f;
 
     // Compare number of nodes
-    int thisNodes = static_cast<int>(m_nodes.size());
-    int otherNodes = static_cast<int>(other.m_nodes.size());
-    float nodeDiff = std::abs(thisNodes - otherNodes) /
-                     static_cast<float>(std::max(thisNodes, otherNodes) + 1);
+    float nodeDiff = std::abs(a.nodeCount - b.nodeCount) /
+                     static_cast<float>(std::max(a.nodeCount, b.nodeCount) + 1);
     distance += nodeDiff;
 
     // Compare number of connections
-    int thisConns = getEnabledConnectionCount();
-    int otherConns = other.getEnabledConnectionCount();
+    int thisConns = a.enabledConnectionCount;
+    int otherConns = b.enabledConnectionCount;
     float connDiff = std::abs(thisConns - otherConns) /
                      static_cast<float>(std::max(thisConns, otherConns) + 1);
     distance += connDiff;
 
     // Compare layer depth
-    int thisDepth = getMaxLayer();
-    int otherDepth = other.getMaxLayer();
-    float depthDiff = std::abs(thisDepth - otherDepth) /
-                      static_cast<float>(std::max(thisDepth, otherDepth) + 1);
+    float depthDiff = std::abs(a.maxLayer - b.maxLayer) /
+                      static_cast<float>(std::max(a.maxLayer, b.maxLayer) + 1);
     distance += depthDiff;
 
     // Compare recurrent connection ratio
-    float thisRecurrent = getRecurrentConnectionCount() /
+    float thisRecurrent = a.recurrentConnectionCount /
                           static_cast<float>(std::max(1, thisConns));
-    float otherRecurrent = other.getRecurrentConnectionCount() /
+    float otherRecurrent = b.recurrentConnectionCount /
                            static_cast<float>(std::max(1, otherConns));
     distance += std::abs(thisRecurrent - otherRecurrent);
 
     // Compare modularity
-    float thisModularity = calculateModularity();
-    float otherModularity = other.calculateModularity();
-    distance += std::abs(thisModularity - otherModularity);
+    distance += std::abs(a.modularity - b.modularity);
 
     return distance / 5.0f;  // Normalize by number of factors
 }
@@ -1284,6 +1380,8 @@ void NEATGenome::assignNodeToRegion(int nodeId, int regionId) {
 // ============================================================================
 
 void NEATGenome::addModulatoryNode(std::mt19937& rng, int targetRegionId) {
+    m_topologyValid = false;
+
     auto& tracker = InnovationTracker::instance();
     std::uniform_real_distribution<float> weightDist(-1.0f, 1.0f);
 
@@ -1311,7 +1409,7 @@ void NEATGenome::addModulatoryNode(std::mt19937& rng, int targetRegionId) {
         std::uniform_int_distribution<size_t> srcDist(0, validSources.size() - 1);
         int srcId = validSources[srcDist(rng)];
         int innovation = tracker.getConnectionInnovation(srcId, nodeId);
-        m_connections.emplace_back(innovation, srcId, nodeId, weightDist(rng), true, false);
+        insertConnection(innovation, srcId, nodeId, weightDist(rng), true, false);
     }
 
     // Create modulatory connections to target region or random connections
@@ -1487,6 +1585,8 @@ float NEATGenome::calculateBrainCost() const {
 }
 
 void NEATGenome::optimizeForEfficiency(std::mt19937& rng, float pruneThreshold) {
+    m_topologyValid = false;
+
     // Identify and remove inefficient components
 
     // 1. Disable weak connections
@@ -1569,10 +1669,15 @@ bool NEATGenome::wouldCreateCycle(int from, int to) const {
 // ============================================================================
 
 NEATPopulation::NEATPopulation(int populationSize, int numInputs, int numOutputs)
+    : NEATPopulation(populationSize, numInputs, numOutputs, std::random_device{}())
+{
+}
+
+NEATPopulation::NEATPopulation(int populationSize, int numInputs, int numOutputs, uint32_t seed)
     : m_populationSize(populationSize)
     , m_numInputs(numInputs)
     , m_numOutputs(numOutputs)
-    , m_rng(std::random_device{}())
+    , m_rng(seed)
 {
     // Reset innovation tracker for new population
     InnovationTracker::instance().reset();
@@ -1589,17 +1694,29 @@ NEATPopulation::NEATPopulation(int populationSize, int numInputs, int numOutputs
 }
 
 void NEATPopulation::evaluateFitness(std::function<float(const NEATGenome&)> fitnessFunc) {
-    float bestFitness = -std::numeric_limits<float>::max();
-
-    for (auto& genome : m_genomes) {
-        float fitness = fitnessFunc(genome);
-        genome.setFitness(fitness);
+    auto evaluateRange = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            m_genomes[i].setFitness(fitnessFunc(m_genomes[i]));
+        }
+    };
+    if (parallel) {
+        ThreadPool::shared().parallelFor(m_genomes.size(), 1, evaluateRange);
+    } else {
+        evaluateRange(0, m_genomes.size());
+    }
 
-        if (fitness > bestFitness) {
-            bestFitness = fitness;
-            m_bestGenome = genome;
+    // Pick the best serially so ties resolve the same way regardless of threading
+    float bestFitness = -std::numeric_limits<float>::max();
+    const NEATGenome* best = nullptr;
+    for (const auto& genome : m_genomes) {
+        if (genome.getFitness() > bestFitness) {
+            bestFitness = genome.getFitness();
+            best = &genome;
         }
     }
+    if (best) {
+        m_bestGenome = *best;
+    }
 }
 
 void NEATPopulation::evolve() {
@@ -1649,28 +1766,57 @@ void NEATPopulation::speciate() {
         species.clear();
     }
 
-    // Assign each genome to a species
-    for (auto& genome : m_genomes) {
-        bool foundSpecies = false;
-
-        for (auto& species : m_species) {
-            float distance = genome.compatibilityDistance(
-                species.representative, c1_excess, c2_disjoint, c3_weight);
-
-            if (distance < compatibilityThreshold) {
-                species.members.push_back(&genome);
-                genome.setSpeciesId(species.id);
-                foundSpecies = true;
-                break;
+    // Distances to the existing representatives are independent per genome, so
+    // find each genome's first compatible existing species in parallel. This is
+    // the bulk of the O(genomes * species) compatibility work.
+    const size_t existingSpecies = m_species.size();
+    std::vector<int> firstMatch(m_genomes.size(), -1);
+    auto matchRange = [&](size_t begin, size_t end) {
+        for (size_t g = begin; g < end; g++) {
+            for (size_t s = 0; s < existingSpecies; s++) {
+                float distance = m_genomes[g].compatibilityDistance(
+                    m_species[s].representative, c1_excess, c2_disjoint, c3_weight);
+                if (distance < compatibilityThreshold) {
+                    firstMatch[g] = static_cast<int>(s);
+                    break;
+                }
+            }
+        }
+    };
+    if (parallel && existingSpecies > 0) {
+        ThreadPool::shared().parallelFor(m_genomes.size(), 8, matchRange);
+    } else {
+        matchRange(0, m_genomes.size());
+    }
+
+    // Assign each genome to a species. Genomes without an existing match are
+    // compared (in order) against species founded earlier in this pass, which
+    // gives exactly the serial first-fit result.
+    for (size_t g = 0; g < m_genomes.size(); g++) {
+        NEATGenome& genome = m_genomes[g];
+        int speciesIdx = firstMatch[g];
+
+        if (speciesIdx < 0) {
+            for (size_t s = existingSpecies; s < m_species.size(); s++) {
+                float distance = genome.compatibilityDistance(
+                    m_species[s].representative, c1_excess, c2_disjoint, c3_weight);
+                if (distance < compatibilityThreshold) {
+                    speciesIdx = static_cast<int>(s);
+                    break;
+                }
             }
         }
 
-        if (!foundSpecies) {
+        if (speciesIdx >= 0) {
+            Species& species = m_species[speciesIdx];
+            species.members.push_back(&genome);
+            genome.setSpeciesId(species.id);
+        } else {
             // Create new species
             Species newSpecies(m_nextSpeciesId++, genome);
             newSpecies.members.push_back(&genome);
             genome.setSpeciesId(newSpecies.id);
-            m_species.push_back(newSpecies);
+            m_species.push_back(std::move(newSpecies));
         }
     }
 
@@ -1726,10 +1872,19 @@ void NEATPopulation::reproduceSpecies() {
         totalOffspring++;
     }
 
-    // Generate new population
+    // Plan the new population serially: champions are copied as-is, every
+    // other slot records which species breeds it and its own RNG seed.
     std::vector<NEATGenome> newGenomes;
     newGenomes.reserve(m_populationSize);
 
+    struct OffspringSlot {
+        size_t genomeIndex;
+        size_t speciesIndex;
+        uint32_t seed;
+    };
+    std::vector<OffspringSlot> slots;
+    slots.reserve(m_populationSize);
+
     for (size_t speciesIdx = 0; speciesIdx < m_species.size(); speciesIdx++) {
         Species& species = m_species[speciesIdx];
         int count = offspringCounts[speciesIdx];
@@ -1748,38 +1903,67 @@ void NEATPopulation::reproduceSpecies() {
             count--;
         }
 
-        // Produce offspring
         for (int i = 0; i < count; i++) {
-            NEATGenome offspring = reproduce(species);
-            newGenomes.push_back(std::move(offspring));
+            slots.push_back({newGenomes.size(), speciesIdx, static_cast<uint32_t>(m_rng())});
+            newGenomes.emplace_back();
         }
     }
 
+    // Produce offspring in parallel. New structure gets provisional IDs from a
+    // per-offspring innovation journal, so no worker touches the shared tracker.
+    auto& tracker = InnovationTracker::global();
+    std::vector<InnovationTracker> journals;
+    journals.reserve(slots.size());
+    for (size_t i = 0; i < slots.size(); i++) {
+        journals.push_back(InnovationTracker::createJournal(tracker));
+    }
+
+    auto produceRange = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const OffspringSlot& slot = slots[i];
+            std::mt19937 rng(slot.seed);
+            InnovationTracker::JournalScope scope(journals[i]);
+            newGenomes[slot.genomeIndex] = reproduce(m_species[slot.speciesIndex], rng);
+        }
+    };
+    if (parallel) {
+        ThreadPool::shared().parallelFor(slots.size(), 4, produceRange);
+    } else {
+        produceRange(0, slots.size());
+    }
+
+    // Resolve innovations in offspring order: the same structural mutation in
+    // two offspring maps to one innovation number, independent of scheduling.
+    for (size_t i = 0; i < slots.size(); i++) {
+        if (journals[i].getJournal().empty()) continue;
+        newGenomes[slots[i].genomeIndex].remapIds(tracker.resolveJournal(journals[i]));
+    }
+
     m_genomes = std::move(newGenomes);
 }
 
-NEATGenome NEATPopulation::reproduce(Species& species) {
+NEATGenome NEATPopulation::reproduce(const Species& species, std::mt19937& rng) const {
     std::uniform_real_distribution<float> prob(0.0f, 1.0f);
 
     // Select parents from top performers
     int survivalCount = std::max(1, static_cast<int>(species.members.size() * survivalThreshold));
     std::uniform_int_distribution<int> parentDist(0, survivalCount - 1);
 
-    NEATGenome* parent1 = species.members[parentDist(m_rng)];
+    NEATGenome* parent1 = species.members[parentDist(rng)];
 
     // 75% chance of crossover with another parent
     NEATGenome offspring;
-    if (prob(m_rng) < 0.75f && species.members.size() > 1) {
-        NEATGenome* parent2 = species.members[parentDist(m_rng)];
+    if (prob(rng) < 0.75f && species.members.size() > 1) {
+        NEATGenome* parent2 = species.members[parentDist(rng)];
         while (parent2 == parent1 && survivalCount > 1) {
-            parent2 = species.members[parentDist(m_rng)];
+            parent2 = species.members[parentDist(rng)];
         }
 
         // Fitter parent is first argument
         if (parent1->getFitness() >= parent2->getFitness()) {
-            offspring = NEATGenome::crossover(*parent1, *parent2, m_rng);
+            offspring = NEATGenome::crossover(*parent1, *parent2, rng);
         } else {
-            offspring = NEATGenome::crossover(*parent2, *parent1, m_rng);
+            offspring = NEATGenome::crossover(*parent2, *parent1, rng);
         }
     } else {
         // Asexual reproduction
@@ -1787,7 +1971,7 @@ NEATGenome NEATPopulation::reproduce(Species& species) {
     }
 
     // Mutate
-    offspring.mutate(m_rng, mutationParams);
+    offspring.mutate(rng, mutationParams);
 
     return offspring;
 }
@@ -10,6 +10,7 @@
 #include <string>
 #include <functional>
 #include <deque>
+#include <cstdint>
 
 namespace ai {
 
@@ -178,13 +179,34 @@ struct ConnectionGene {
           plastic(true), plasticityRate(1.0f) {}
 };
 
+// ============================================================================
+// Topology Signature - cached structural summary for speciation
+// ============================================================================
+
+struct TopologySignature {
+    int nodeCount = 0;
+    int enabledConnectionCount = 0;
+    int recurrentConnectionCount = 0;
+    int maxLayer = 0;
+    float modularity = 0.0f;
+};
+
 // ============================================================================
 // Innovation Tracker (Global for population) - Enhanced with history tracking
 // ============================================================================
 
 class InnovationTracker {
 public:
+    // Returns the innovation journal active on this thread (see JournalScope),
+    // or the population-wide tracker.
     static InnovationTracker& instance() {
+        if (t_activeJournal) {
+            return *t_activeJournal;
+        }
+        return global();
+    }
+
+    static InnovationTracker& global() {
         static InnovationTracker tracker;
         return tracker;
     }
@@ -196,9 +218,20 @@ class InnovationTracker {
         if (it != m_connectionInnovations.end()) {
             return it->second;
         }
+        if (m_parent && !isProvisionalId(from) && !isProvisionalId(to)) {
+            auto parentIt = m_parent->m_connectionInnovations.find(key);
+            if (parentIt != m_parent->m_connectionInnovations.end()) {
+                return parentIt->second;
+            }
+        }
         int innov = m_nextConnectionInnovation++;
         m_connectionInnovations[key] = innov;
 
+        if (m_parent) {
+            m_journal.push_back({InnovationRequest::Kind::CONNECTION, innov, from, to});
+            return innov;
+        }
+
         // Create innovation record
         InnovationRecord record(innov, m_currentGeneration, from, to);
         m_innovationHistory[innov] = record;
@@ -212,17 +245,129 @@ class InnovationTracker {
         if (it != m_nodeInnovations.end()) {
             return it->second;
         }
+        if (m_parent && !isProvisionalId(splitConnectionId)) {
+            auto parentIt = m_parent->m_nodeInnovations.find(splitConnectionId);
+            if (parentIt != m_parent->m_nodeInnovations.end()) {
+                return parentIt->second;
+            }
+        }
         int innov = m_nextNodeId++;
         m_nodeInnovations[splitConnectionId] = innov;
+        if (m_parent) {
+            m_journal.push_back({InnovationRequest::Kind::SPLIT_NODE, innov, splitConnectionId, 0});
+        }
         return innov;
     }
 
-    int getNextNodeId() { return m_nextNodeId++; }
+    int getNextNodeId() {
+        int id = m_nextNodeId++;
+        if (m_parent) {
+            m_journal.push_back({InnovationRequest::Kind::NEW_NODE, id, 0, 0});
+        }
+        return id;
+    }
+
+    // ========================================================================
+    // Batched Innovation Resolution
+    // ========================================================================
+    //
+    // Worker threads must not hand out innovation numbers directly: the IDs
+    // would depend on thread timing. Instead each unit of parallel work
+    // (e.g. one offspring) runs under a JournalScope. The journal answers
+    // lookups of innovations that already exist in its parent tracker and
+    // hands out provisional IDs (>= PROVISIONAL_ID_BASE) for new ones,
+    // recording every request. Afterwards the owner replays the journals
+    // serially, in a fixed order, with resolveJournal() and rewrites the
+    // genomes via NEATGenome::remapIds().
+
+    static constexpr int PROVISIONAL_ID_BASE = 1 << 30;
+
+    static bool isProvisionalId(int id) {
+        return id >= PROVISIONAL_ID_BASE || id <= -PROVISIONAL_ID_BASE;
+    }
+
+    struct InnovationRequest {
+        enum class Kind { CONNECTION, SPLIT_NODE, NEW_NODE };
+        Kind kind;
+        int provisionalId;
+        int a;  // CONNECTION: from node, SPLIT_NODE: split connection innovation
+        int b;  // CONNECTION: to node (negative = modulated connection innovation)
+    };
+
+    // Provisional -> real ID maps produced by resolveJournal()
+    struct IdRemap {
+        std::unordered_map<int, int> nodes;
+        std::unordered_map<int, int> innovations;
+
+        int node(int id) const {
+            auto it = nodes.find(id);
+            return it != nodes.end() ? it->second : id;
+        }
+        int innovation(int id) const {
+            auto it = innovations.find(id);
+            return it != innovations.end() ? it->second : id;
+        }
+        bool empty() const { return nodes.empty() && innovations.empty(); }
+    };
+
+    // Create a journal that reads through to 'parent'. The parent must not be
+    // modified while journals created from it are in use.
+    static InnovationTracker createJournal(const InnovationTracker& parent) {
+        InnovationTracker journal;
+        journal.m_parent = &parent;
+        journal.m_nextConnectionInnovation = PROVISIONAL_ID_BASE;
+        journal.m_nextNodeId = PROVISIONAL_ID_BASE;
+        journal.m_currentGeneration = parent.m_currentGeneration;
+        return journal;
+    }
+
+    bool isJournal() const { return m_parent != nullptr; }
+    const std::vector<InnovationRequest>& getJournal() const { return m_journal; }
+
+    // Replay a journal's requests against this tracker, in recorded order
+    IdRemap resolveJournal(const InnovationTracker& journal) {
+        IdRemap remap;
+        for (const auto& request : journal.m_journal) {
+            switch (request.kind) {
+                case InnovationRequest::Kind::CONNECTION: {
+                    int from = remap.node(request.a);
+                    // Modulatory connections key on the negated target innovation
+                    int to = request.b <= -PROVISIONAL_ID_BASE ? -remap.innovation(-request.b)
+                                                               : remap.node(request.b);
+                    remap.innovations[request.provisionalId] = getConnectionInnovation(from, to);
+                    break;
+                }
+                case InnovationRequest::Kind::SPLIT_NODE:
+                    remap.nodes[request.provisionalId] = getNodeInnovation(remap.innovation(request.a));
+                    break;
+                case InnovationRequest::Kind::NEW_NODE:
+                    remap.nodes[request.provisionalId] = getNextNodeId();
+                    break;
+            }
+        }
+        return remap;
+    }
+
+    // RAII: routes instance() on the current thread to a journal
+    class JournalScope {
+    public:
+        explicit JournalScope(InnovationTracker& journal) : m_previous(t_activeJournal) {
+            t_activeJournal = &journal;
+        }
+        ~JournalScope() { t_activeJournal = m_previous; }
+
+        JournalScope(const JournalScope&) = delete;
+        JournalScope& operator=(const JournalScope&) = delete;
+
+    private:
+        InnovationTracker* m_previous;
+    };
 
     void reset() {
         m_connectionInnovations.clear();
         m_nodeInnovations.clear();
         m_innovationHistory.clear();
+        m_journal.clear();
         m_nextConnectionInnovation = 0;
         m_nextNodeId = 0;
         m_currentGeneration = 0;
@@ -346,6 +491,12 @@ class InnovationTracker {
     int m_nextConnectionInnovation = 0;
     int m_nextNodeId = 0;
     int m_currentGeneration = 0;
+
+    // Journal mode (see createJournal)
+    const InnovationTracker* m_parent = nullptr;
+    std::vector<InnovationRequest> m_journal;
+
+    static inline thread_local InnovationTracker* t_activeJournal = nullptr;
 };
 
 // ============================================================================
@@ -405,6 +556,25 @@ class NEATGenome {
     static NEATGenome crossover(const NEATGenome& fitter, const NEATGenome& other,
                                 std::mt19937& rng);
 
+    // Replace provisional node IDs / innovation numbers (handed out by an
+    // innovation journal) with the real ones from InnovationTracker::resolveJournal
+    void remapIds(const InnovationTracker::IdRemap& remap);
+
+    // Replace the genes wholesale, e.g. with ones read back from a creature
+    // record. Input and output counts follow from the node types; connection
+    // genes must be sorted by innovation number.
+    void setGenes(std::vector<NodeGene> nodes, std::vector<ConnectionGene> connections);
+
+    // ========================================================================
+    // Topology Signature
+    // ========================================================================
+
+    // Structural summary used by calculateBrainStructureDistance. Cached after
+    // createMinimal/mutate/crossover; computed on the fly if the genome was
+    // edited since (reading it never writes, so it is safe across threads).
+    TopologySignature getTopologySignature() const;
+    void refreshTopologySignature();
+
     // ========================================================================
     // Species Distance - Enhanced
     // ========================================================================
@@ -506,8 +676,10 @@ class NEATGenome {
     const std::vector<NodeGene>& getNodes() const { return m_nodes; }
     const std::vector<ConnectionGene>& getConnections() const { return m_connections; }
 
-    std::vector<NodeGene>& getNodes() { return m_nodes; }
-    std::vector<ConnectionGene>& getConnections() { return m_connections; }
+    // Mutable access invalidates the cached topology signature. Connection
+    // genes must stay sorted by innovation number.
+    std::vector<NodeGene>& getNodes() { m_topologyValid = false; return m_nodes; }
+    std::vector<ConnectionGene>& getConnections() { m_topologyValid = false; return m_connections; }
 
     int getInputCount() const { return m_inputCount; }
     int getOutputCount() const { return m_outputCount; }
@@ -544,7 +716,7 @@ class NEATGenome {
 
 private:
     std::vector<NodeGene> m_nodes;
-    std::vector<ConnectionGene> m_connections;
+    std::vector<ConnectionGene> m_connections;  // Sorted by innovation number
     std::vector<BrainRegion> m_regions;
     std::vector<ModulatoryConnection> m_modulatoryConnections;
 
@@ -557,7 +729,13 @@ class NEATGenome {
     int m_speciesId = -1;
     int m_nextRegionId = 0;
 
+    TopologySignature m_topology;
+    bool m_topologyValid = false;
+
     // Helper methods
+    void insertConnection(int innovation, int from, int to, float weight,
+                          bool enabled, bool recurrent);
+    TopologySignature computeTopologySignature() const;
     bool connectionExists(int from, int to) const;
     bool wouldCreateCycle(int from, int to) const;
     NodeGene* getNode(int id);
@@ -692,7 +870,11 @@ class Species {
 class NEATPopulation {
 public:
     NEATPopulation(int populationSize, int numInputs, int numOutputs);
+    // Seeded variant: runs with the same seed evolve identically (parallel or not)
+    NEATPopulation(int populationSize, int numInputs, int numOutputs, uint32_t seed);
 
+    // Fitness is evaluated across the shared thread pool when 'parallel' is
+    // set, so fitnessFunc must be safe to call concurrently.
     void evaluateFitness(std::function<float(const NEATGenome&)> fitnessFunc);
     void evolve();
 
@@ -716,6 +898,11 @@ class NEATPopulation {
     float survivalThreshold = 0.2f;  // Top % that can reproduce
     int stagnationLimit = 15;         // Generations before species is penalized
 
+    // Fan fitness evaluation, speciation distances and offspring generation out
+    // over ThreadPool::shared(). Results are identical to serial mode for the
+    // same RNG state; innovations are resolved in offspring order.
+    bool parallel = true;
+
 private:
     std::vector<NEATGenome> m_genomes;
     std::vector<Species> m_species;
@@ -731,7 +918,7 @@ class NEATPopulation {
 
     void speciate();
     void reproduceSpecies();
-    NEATGenome reproduce(Species& species);
+    NEATGenome reproduce(const Species& species, std::mt19937& rng) const;
 };
 
 // ============================================================================
@@ -0,0 +1,259 @@
+#include "ArchipelagoRunner.h"
+#include "ArchipelagoTransport.h"
+#include "DistributedArchipelago.h"
+#include "MultiIslandManager.h"
+#include "../entities/behaviors/InterIslandMigration.h"
+#include "../environment/ArchipelagoGenerator.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace Forge {
+
+namespace {
+
+// Value following a flag, or nullptr at the end of argv
+const char* flagValue(int argc, char* argv[], int& i) {
+    if (i + 1 >= argc) {
+        std::cerr << "Missing value for " << argv[i] << std::endl;
+        return nullptr;
+    }
+    return argv[++i];
+}
+
+void printProgress(uint32_t tick, const MultiIslandManager& islands, const InterIslandMigration& migration) {
+    const MigrationStats& stats = migration.getStats();
+    std::cout << "[Archipelago] tick " << tick
+              << ": creatures " << islands.getTotalCreatureCount()
+              << ", migrations in flight " << migration.getActiveMigrationCount()
+              << ", arrived " << stats.successfulMigrations
+              << ", lost " << stats.failedMigrations << std::endl;
+}
+
+void printCoordinatorProgress(const ArchipelagoCoordinator& coordinator) {
+    std::cout << "[Coordinator] tick " << coordinator.getTick()
+              << ": creatures " << coordinator.getGlobalStats().totalCreatures
+              << ", migrants routed " << coordinator.getMigrantsRouted() << std::endl;
+}
+
+// Every process builds the same archipelago from the seed
+void buildArchipelago(const ArchipelagoRunOptions& options, MultiIslandManager& islands) {
+    ArchipelagoGenerator archipelago;
+    archipelago.generateWithSeed(options.islandCount, ArchipelagoGenerator::DEFAULT_SPACING, options.seed);
+
+    islands.setTerrainSize(options.terrainSize);
+    islands.setCoarseSimulationEnabled(options.coarseSimulation);
+    islands.init(archipelago);
+}
+
+int runSingleProcess(const ArchipelagoRunOptions& options) {
+    std::cout << "[Archipelago] " << options.islandCount << " islands, seed " << options.seed << std::endl;
+
+    MultiIslandManager islands;
+    buildArchipelago(options, islands);
+    islands.generateAll(options.seed);
+
+    InterIslandMigration migration;
+    migration.setSeed(options.seed);
+
+    for (uint32_t tick = 1; options.ticks == 0 || tick <= options.ticks; ++tick) {
+        islands.update(options.tickSeconds);
+        migration.update(options.tickSeconds, islands);
+
+        if (options.reportInterval > 0 && tick % options.reportInterval == 0) {
+            printProgress(tick, islands, migration);
+        }
+    }
+
+    printProgress(options.ticks, islands, migration);
+    return 0;
+}
+
+int runWorker(const ArchipelagoRunOptions& options) {
+    const uint32_t workerIndex = static_cast<uint32_t>(options.workerIndex);
+    const uint32_t workerCount = static_cast<uint32_t>(options.workerCount);
+
+    // Connect first: the retry window starts now, not after generation
+    LocalSocketTransport transport;
+    if (!transport.connect(options.socketPath)) {
+        std::cerr << "[Worker " << workerIndex << "] " << transport.getLastError() << std::endl;
+        return 1;
+    }
+
+    MultiIslandManager islands;
+    InterIslandMigration migration;
+    migration.setSeed(options.seed);
+
+    buildArchipelago(options, islands);
+    ArchipelagoWorker worker(transport, workerIndex, workerCount);
+    worker.attach(islands, migration);
+    islands.generateAll(options.seed);
+
+    if (options.resume && !worker.restoreCheckpoint(options.checkpointDirectory)) {
+        std::cerr << "[Worker " << workerIndex << "] Cannot restore from "
+                  << options.checkpointDirectory << std::endl;
+        return 1;
+    }
+
+    if (!worker.sendHello()) {
+        std::cerr << "[Worker " << workerIndex << "] " << transport.getLastError() << std::endl;
+        return 1;
+    }
+
+    // Runs until the coordinator shuts the archipelago down
+    while (worker.step(options.tickSeconds)) {
+    }
+
+    std::cout << "[Worker " << workerIndex << "] stopped at tick " << worker.getTick()
+              << ", migrants sent " << worker.getMigrantsSent()
+              << ", received " << worker.getMigrantsReceived() << std::endl;
+    return 0;
+}
+
+int runCoordinator(const ArchipelagoRunOptions& options) {
+    std::cout << "[Coordinator] " << options.islandCount << " islands on " << options.workerCount
+              << " workers, seed " << options.seed << std::endl;
+
+    LocalSocketTransport transport;
+    if (!transport.listen(options.socketPath, options.workerCount)) {
+        std::cerr << "[Coordinator] " << transport.getLastError() << std::endl;
+        return 1;
+    }
+
+    ArchipelagoCoordinator coordinator(transport, static_cast<uint32_t>(options.islandCount));
+    if (!options.checkpointDirectory.empty()) {
+        coordinator.setCheckpointInterval(options.checkpointInterval, options.checkpointDirectory);
+    }
+
+    if ((options.resume && !coordinator.restoreCheckpoint(options.checkpointDirectory)) ||
+        !coordinator.waitForWorkers()) {
+        std::cerr << "[Coordinator] " << coordinator.getLastError() << std::endl;
+        coordinator.shutdown();
+        return 1;
+    }
+
+    while (options.ticks == 0 || coordinator.getTick() < options.ticks) {
+        if (!coordinator.runTick()) {
+            std::cerr << "[Coordinator] " << coordinator.getLastError() << std::endl;
+            coordinator.shutdown();
+            return 1;
+        }
+
+        if (options.reportInterval > 0 && coordinator.getTick() % options.reportInterval == 0) {
+            printCoordinatorProgress(coordinator);
+        }
+    }
+
+    coordinator.shutdown();
+    printCoordinatorProgress(coordinator);
+    return 0;
+}
+
+int launchArchipelago(const ArchipelagoRunOptions& options) {
+#ifdef _WIN32
+    (void)options;
+    std::cerr << "[Coordinator] --launch needs fork(); start the workers with --worker K" << std::endl;
+    return 1;
+#else
+    // Fork before anything starts threads; each child is one worker
+    std::vector<pid_t> children;
+    for (int k = 0; k < options.workerCount; ++k) {
+        pid_t pid = ::fork();
+        if (pid < 0) {
+            std::cerr << "[Coordinator] fork failed" << std::endl;
+            break;
+        }
+        if (pid == 0) {
+            ArchipelagoRunOptions workerOptions = options;
+            workerOptions.workerIndex = k;
+            std::cout.flush();
+            ::_exit(runWorker(workerOptions));
+        }
+        children.push_back(pid);
+    }
+
+    int result = static_cast<int>(children.size()) == options.workerCount ? runCoordinator(options) : 1;
+
+    for (pid_t child : children) {
+        int status = 0;
+        if (::waitpid(child, &status, 0) != child || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            result = 1;
+        }
+    }
+    return result;
+#endif
+}
+
+} // namespace
+
+bool parseArchipelagoArgs(int argc, char* argv[], ArchipelagoRunOptions& options) {
+    bool selected = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const char* value = nullptr;
+
+        if (std::strcmp(arg, "--archipelago") == 0) {
+            selected = true;
+        } else if (std::strcmp(arg, "--coarse") == 0) {
+            options.coarseSimulation = true;
+        } else if (std::strcmp(arg, "--launch") == 0) {
+            options.launchWorkers = true;
+        } else if (std::strcmp(arg, "--resume") == 0) {
+            options.resume = true;
+        } else if (std::strcmp(arg, "--islands") == 0 && (value = flagValue(argc, argv, i))) {
+            options.islandCount = std::clamp(std::atoi(value), 1, MultiIslandManager::MAX_ISLANDS);
+        } else if (std::strcmp(arg, "--seed") == 0 && (value = flagValue(argc, argv, i))) {
+            options.seed = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        } else if (std::strcmp(arg, "--ticks") == 0 && (value = flagValue(argc, argv, i))) {
+            options.ticks = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        } else if (std::strcmp(arg, "--tick-seconds") == 0 && (value = flagValue(argc, argv, i))) {
+            options.tickSeconds = std::max(0.001f, static_cast<float>(std::atof(value)));
+        } else if (std::strcmp(arg, "--terrain-size") == 0 && (value = flagValue(argc, argv, i))) {
+            options.terrainSize = std::clamp(std::atoi(value), 64, 512);
+        } else if (std::strcmp(arg, "--report") == 0 && (value = flagValue(argc, argv, i))) {
+            options.reportInterval = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        } else if (std::strcmp(arg, "--workers") == 0 && (value = flagValue(argc, argv, i))) {
+            options.workerCount = std::max(0, std::atoi(value));
+        } else if (std::strcmp(arg, "--worker") == 0 && (value = flagValue(argc, argv, i))) {
+            options.workerIndex = std::atoi(value);
+        } else if (std::strcmp(arg, "--socket") == 0 && (value = flagValue(argc, argv, i))) {
+            options.socketPath = value;
+        } else if (std::strcmp(arg, "--checkpoint") == 0 && (value = flagValue(argc, argv, i))) {
+            options.checkpointDirectory = value;
+        } else if (std::strcmp(arg, "--checkpoint-every") == 0 && (value = flagValue(argc, argv, i))) {
+            options.checkpointInterval = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        }
+    }
+
+    return selected;
+}
+
+int runArchipelago(const ArchipelagoRunOptions& options) {
+    if (options.workerCount == 0) {
+        return runSingleProcess(options);
+    }
+
+    if (options.workerIndex >= options.workerCount) {
+        std::cerr << "[Archipelago] --worker must be below --workers" << std::endl;
+        return 1;
+    }
+    if (options.resume && options.checkpointDirectory.empty()) {
+        std::cerr << "[Archipelago] --resume needs --checkpoint" << std::endl;
+        return 1;
+    }
+
+    if (options.workerIndex >= 0) {
+        return runWorker(options);
+    }
+    return options.launchWorkers ? launchArchipelago(options) : runCoordinator(options);
+}
+
+} // namespace Forge
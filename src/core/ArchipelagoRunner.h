@@ -0,0 +1,61 @@
+#pragma once
+
+// ArchipelagoRunner - Headless archipelago simulation
+//
+// Builds an archipelago, generates its islands with MultiIslandManager and
+// steps them together with InterIslandMigration at a fixed tick, without a
+// window or GPU device. Selected from the command line with --archipelago;
+// everything is seeded, so the same options reproduce the same run.
+//
+// With --workers the islands are split across processes (see
+// DistributedArchipelago): one coordinator plus one process per worker,
+// talking over a local socket. --launch has the coordinator fork its own
+// workers; otherwise each is started by hand with --worker K.
+
+#include <cstdint>
+#include <string>
+
+namespace Forge {
+
+struct ArchipelagoRunOptions {
+    int islandCount = 4;
+    uint32_t seed = 12345;
+    uint32_t ticks = 1800;              // 0 runs until interrupted
+    float tickSeconds = 1.0f / 30.0f;
+    int terrainSize = 128;              // Heightmap cells per island side
+    bool coarseSimulation = false;      // Let unobserved islands sleep
+    uint32_t reportInterval = 300;      // Ticks between progress lines (0 disables)
+
+    // Distributed run
+    int workerCount = 0;                // 0 runs every island in this process
+    int workerIndex = -1;               // This process's worker; -1 is the coordinator
+    bool launchWorkers = false;         // Coordinator forks the workers itself
+    std::string socketPath = "forge-archipelago.sock";
+    std::string checkpointDirectory;    // Empty disables checkpoints
+    uint32_t checkpointInterval = 0;    // Ticks between checkpoints
+    bool resume = false;                // Start from the checkpoint in checkpointDirectory
+};
+
+// Fill options from argv. Returns true if --archipelago was given, in which
+// case the caller should run the archipelago instead of the viewer.
+//   --archipelago             select headless archipelago mode
+//   --islands N               island count (1 - MultiIslandManager::MAX_ISLANDS)
+//   --seed N                  archipelago, terrain, population and migration seed
+//   --ticks N                 ticks to run (0 = until interrupted)
+//   --tick-seconds S          simulated seconds per tick
+//   --terrain-size N          heightmap cells per island side
+//   --coarse                  enable coarse simulation of unobserved islands
+//   --report N                ticks between progress lines
+//   --workers N               split the islands across N worker processes
+//   --worker K                run as worker K instead of the coordinator
+//   --launch                  coordinator forks its N workers (not on Windows)
+//   --socket PATH             coordinator socket path
+//   --checkpoint DIR          checkpoint directory
+//   --checkpoint-every N      ticks between checkpoints
+//   --resume                  resume from the checkpoint in DIR
+bool parseArchipelagoArgs(int argc, char* argv[], ArchipelagoRunOptions& options);
+
+// Run to completion; returns a process exit code
+int runArchipelago(const ArchipelagoRunOptions& options);
+
+} // namespace Forge
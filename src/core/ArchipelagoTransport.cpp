@@ -0,0 +1,257 @@
+#include "ArchipelagoTransport.h"
+#include <chrono>
+#include <thread>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace Forge {
+
+namespace {
+    constexpr uint32_t FRAME_MAGIC = 0x48435241;  // "ARCH"
+
+    struct FrameHeader {
+        uint32_t magic;
+        uint16_t type;
+        uint16_t reserved;
+        uint32_t tick;
+        uint32_t payloadSize;
+    };
+    static_assert(sizeof(FrameHeader) == 16, "FrameHeader must stay packed");
+
+#ifndef _WIN32
+    bool makeAddress(const std::string& path, sockaddr_un& address) {
+        if (path.empty() || path.size() >= sizeof(address.sun_path)) return false;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        return true;
+    }
+
+#ifdef MSG_NOSIGNAL
+    constexpr int SEND_FLAGS = MSG_NOSIGNAL;   // A dead peer is an error return, not SIGPIPE
+#else
+    constexpr int SEND_FLAGS = 0;
+#endif
+#endif
+} // namespace
+
+LocalSocketTransport::~LocalSocketTransport() {
+    close();
+}
+
+void LocalSocketTransport::close() {
+#ifndef _WIN32
+    for (int socket : m_sockets) {
+        ::close(socket);
+    }
+    if (!m_listenPath.empty()) {
+        ::unlink(m_listenPath.c_str());
+    }
+#endif
+    m_sockets.clear();
+    m_listenPath.clear();
+}
+
+// ============================================================================
+// Connection Setup
+// ============================================================================
+
+bool LocalSocketTransport::listen(const std::string& path, int peerCount) {
+    close();
+#ifdef _WIN32
+    (void)path;
+    (void)peerCount;
+    m_lastError = "Local socket transport is not available on Windows";
+    return false;
+#else
+    sockaddr_un address;
+    if (!makeAddress(path, address)) {
+        m_lastError = "Invalid socket path: " + path;
+        return false;
+    }
+
+    int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        m_lastError = std::string("socket: ") + std::strerror(errno);
+        return false;
+    }
+
+    ::unlink(path.c_str());
+    if (::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listener, peerCount) != 0) {
+        m_lastError = std::string("bind/listen: ") + std::strerror(errno);
+        ::close(listener);
+        return false;
+    }
+    m_listenPath = path;
+
+    while (static_cast<int>(m_sockets.size()) < peerCount) {
+        int peer = ::accept(listener, nullptr, nullptr);
+        if (peer < 0) {
+            if (errno == EINTR) continue;
+            m_lastError = std::string("accept: ") + std::strerror(errno);
+            ::close(listener);
+            close();
+            return false;
+        }
+        m_sockets.push_back(peer);
+    }
+
+    ::close(listener);
+    return true;
+#endif
+}
+
+bool LocalSocketTransport::connect(const std::string& path, int timeoutMs) {
+    close();
+#ifdef _WIN32
+    (void)path;
+    (void)timeoutMs;
+    m_lastError = "Local socket transport is not available on Windows";
+    return false;
+#else
+    sockaddr_un address;
+    if (!makeAddress(path, address)) {
+        m_lastError = "Invalid socket path: " + path;
+        return false;
+    }
+
+    // The coordinator may not have bound yet when workers start
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (true) {
+        int socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socket < 0) {
+            m_lastError = std::string("socket: ") + std::strerror(errno);
+            return false;
+        }
+
+        if (::connect(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+            m_sockets.push_back(socket);
+            return true;
+        }
+
+        int error = errno;
+        ::close(socket);
+        if ((error != ENOENT && error != ECONNREFUSED) || std::chrono::steady_clock::now() >= deadline) {
+            m_lastError = std::string("connect: ") + std::strerror(error);
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+#endif
+}
+
+bool LocalSocketTransport::createPair(LocalSocketTransport& a, LocalSocketTransport& b) {
+    a.close();
+    b.close();
+#ifdef _WIN32
+    a.m_lastError = b.m_lastError = "Local socket transport is not available on Windows";
+    return false;
+#else
+    int sockets[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0) {
+        a.m_lastError = b.m_lastError = std::string("socketpair: ") + std::strerror(errno);
+        return false;
+    }
+    a.m_sockets.push_back(sockets[0]);
+    b.m_sockets.push_back(sockets[1]);
+    return true;
+#endif
+}
+
+// ============================================================================
+// Framed I/O
+// ============================================================================
+
+bool LocalSocketTransport::writeAll(int socket, const void* data, size_t size) {
+#ifdef _WIN32
+    (void)socket;
+    (void)data;
+    (void)size;
+    return false;
+#else
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        ssize_t written = ::send(socket, bytes, size, SEND_FLAGS);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            m_lastError = std::string("send: ") + std::strerror(errno);
+            return false;
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+#endif
+}
+
+bool LocalSocketTransport::readAll(int socket, void* data, size_t size) {
+#ifdef _WIN32
+    (void)socket;
+    (void)data;
+    (void)size;
+    return false;
+#else
+    uint8_t* bytes = static_cast<uint8_t*>(data);
+    while (size > 0) {
+        ssize_t received = ::recv(socket, bytes, size, 0);
+        if (received < 0) {
+            if (errno == EINTR) continue;
+            m_lastError = std::string("recv: ") + std::strerror(errno);
+            return false;
+        }
+        if (received == 0) {
+            m_lastError = "Peer closed the connection";
+            return false;
+        }
+        bytes += received;
+        size -= static_cast<size_t>(received);
+    }
+    return true;
+#endif
+}
+
+bool LocalSocketTransport::send(int peer, const ArchipelagoMessage& message) {
+    if (peer < 0 || peer >= getPeerCount()) return false;
+    if (message.payload.size() > MAX_PAYLOAD_BYTES) {
+        m_lastError = "Payload too large";
+        return false;
+    }
+
+    FrameHeader header;
+    header.magic = FRAME_MAGIC;
+    header.type = static_cast<uint16_t>(message.type);
+    header.reserved = 0;
+    header.tick = message.tick;
+    header.payloadSize = static_cast<uint32_t>(message.payload.size());
+
+    int socket = m_sockets[peer];
+    return writeAll(socket, &header, sizeof(header)) &&
+           writeAll(socket, message.payload.data(), message.payload.size());
+}
+
+bool LocalSocketTransport::receive(int peer, ArchipelagoMessage& message) {
+    if (peer < 0 || peer >= getPeerCount()) return false;
+
+    int socket = m_sockets[peer];
+    FrameHeader header;
+    if (!readAll(socket, &header, sizeof(header))) return false;
+
+    if (header.magic != FRAME_MAGIC || header.payloadSize > MAX_PAYLOAD_BYTES) {
+        m_lastError = "Corrupt frame header";
+        return false;
+    }
+
+    message.type = static_cast<ArchipelagoMessageType>(header.type);
+    message.tick = header.tick;
+    message.payload.resize(header.payloadSize);
+    return readAll(socket, message.payload.data(), message.payload.size());
+}
+
+} // namespace Forge
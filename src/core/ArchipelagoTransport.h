@@ -0,0 +1,93 @@
+#pragma once
+
+// ArchipelagoTransport - Message channel between archipelago processes
+// The coordinator holds one peer per worker; a worker holds a single peer,
+// the coordinator. Messages are framed and delivered in order per peer.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Forge {
+
+// ============================================================================
+// Messages
+// ============================================================================
+
+enum class ArchipelagoMessageType : uint16_t {
+    HELLO,              // Worker -> coordinator: worker index and wire layout
+    TICK_DONE,          // Worker -> coordinator: island stats and outgoing migrants
+    RELEASE,            // Coordinator -> worker: all island stats, incoming migrants,
+                        // and a checkpoint directory when one is due
+    CHECKPOINT_DONE,    // Worker -> coordinator: shard written (payload: 1 byte success)
+    SHUTDOWN            // Coordinator -> worker: leave the tick loop
+};
+
+struct ArchipelagoMessage {
+    ArchipelagoMessageType type = ArchipelagoMessageType::HELLO;
+    uint32_t tick = 0;
+    std::vector<uint8_t> payload;
+};
+
+// ============================================================================
+// Transport Interface
+// ============================================================================
+
+class ArchipelagoTransport {
+public:
+    virtual ~ArchipelagoTransport() = default;
+
+    virtual int getPeerCount() const = 0;
+
+    // Both block until the whole message has gone out / come in. A false
+    // return means the peer is gone and the channel should be abandoned.
+    virtual bool send(int peer, const ArchipelagoMessage& message) = 0;
+    virtual bool receive(int peer, ArchipelagoMessage& message) = 0;
+};
+
+// ============================================================================
+// Local Socket Transport
+// ============================================================================
+
+// Unix domain stream sockets, for processes on the same machine. On Windows
+// listen/connect/createPair currently fail.
+class LocalSocketTransport : public ArchipelagoTransport {
+public:
+    static constexpr uint32_t MAX_PAYLOAD_BYTES = 256u * 1024u * 1024u;
+
+    LocalSocketTransport() = default;
+    ~LocalSocketTransport() override;
+
+    LocalSocketTransport(const LocalSocketTransport&) = delete;
+    LocalSocketTransport& operator=(const LocalSocketTransport&) = delete;
+
+    // Coordinator side: bind to path and accept peerCount connections, in
+    // the order the workers connect
+    bool listen(const std::string& path, int peerCount);
+
+    // Worker side: connect to a listening coordinator, retrying until the
+    // socket exists or timeoutMs runs out
+    bool connect(const std::string& path, int timeoutMs = 5000);
+
+    // Connected pair for a coordinator and a worker created in one process
+    // (e.g. before fork); each side gets one peer
+    static bool createPair(LocalSocketTransport& a, LocalSocketTransport& b);
+
+    void close();
+
+    int getPeerCount() const override { return static_cast<int>(m_sockets.size()); }
+    bool send(int peer, const ArchipelagoMessage& message) override;
+    bool receive(int peer, ArchipelagoMessage& message) override;
+
+    const std::string& getLastError() const { return m_lastError; }
+
+private:
+    std::vector<int> m_sockets;
+    std::string m_listenPath;   // Unlinked on close
+    std::string m_lastError;
+
+    bool writeAll(int socket, const void* data, size_t size);
+    bool readAll(int socket, void* data, size_t size);
+};
+
+} // namespace Forge
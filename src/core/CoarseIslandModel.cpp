@@ -0,0 +1,252 @@
+#include "CoarseIslandModel.h"
+#include "CreatureManager.h"
+#include "../environment/Terrain.h"
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace Forge {
+
+namespace {
+    constexpr int PLACEMENT_ATTEMPTS = 8;
+
+    // Same parameters as CreatureManager::makeOffspringGenome
+    constexpr float OFFSPRING_MUTATION_RATE = 0.1f;
+    constexpr float OFFSPRING_MUTATION_STRENGTH = 0.2f;
+} // namespace
+
+// ============================================================================
+// Capture
+// ============================================================================
+
+void CoarseIslandModel::capture(CreatureManager& creatures, float birthRate, float deathRate,
+                                float capacity, uint32_t seed) {
+    m_species.clear();
+    m_capacity = std::max(1.0f, capacity);
+    m_births = 0.0;
+    m_deaths = 0.0;
+    m_rng.seed(seed);
+
+    std::unordered_map<uint64_t, size_t> speciesIndex;
+    std::vector<uint32_t> seen;     // Members visited per species, for reservoir sampling
+    double fitnessSum = 0.0;
+    double total = 0.0;
+
+    creatures.forEach([&](Creature& creature, size_t) {
+        if (!creature.isAlive()) return;
+
+        const uint64_t key = (static_cast<uint64_t>(creature.getType()) << 32) | creature.getSpeciesId();
+        auto [it, inserted] = speciesIndex.try_emplace(key, m_species.size());
+        if (inserted) {
+            Species species;
+            species.type = creature.getType();
+            species.speciesId = creature.getSpeciesId();
+            species.genomes.reserve(GENOME_RESERVOIR);
+            species.brains.reserve(GENOME_RESERVOIR);
+            m_species.push_back(std::move(species));
+            seen.push_back(0);
+        }
+
+        Species& species = m_species[it->second];
+        species.population += 1.0;
+        species.meanEnergy += creature.getEnergy();
+        species.meanFitness += creature.getFitness();
+        fitnessSum += creature.getFitness();
+        total += 1.0;
+
+        // Uniform sample of the species' genomes, each with its brain
+        uint32_t& count = seen[it->second];
+        const ai::NEATGenome brain = creature.hasNEATBrain() ? creature.getNEATGenome() : ai::NEATGenome();
+        if (species.genomes.size() < GENOME_RESERVOIR) {
+            species.genomes.push_back(creature.getGenome());
+            species.brains.push_back(brain);
+        } else {
+            std::uniform_int_distribution<uint32_t> slot(0, count);
+            uint32_t j = slot(m_rng);
+            if (j < GENOME_RESERVOIR) {
+                species.genomes[j] = creature.getGenome();
+                species.brains[j] = brain;
+            }
+        }
+        ++count;
+    });
+
+    if (total <= 0.0) return;
+
+    // Observed rates are net of crowding; undo that so the logistic model
+    // reproduces them at the captured population
+    const float crowding = static_cast<float>(std::max(0.05, 1.0 - total / m_capacity));
+    const float baseBirth = (birthRate >= 0.0f ? birthRate : DEFAULT_TURNOVER) / crowding;
+    const float baseDeath = deathRate >= 0.0f ? deathRate : DEFAULT_TURNOVER;
+    const float islandFitness = static_cast<float>(fitnessSum / total);
+
+    for (Species& species : m_species) {
+        const float members = static_cast<float>(species.population);
+        species.meanEnergy /= members;
+        species.meanFitness /= members;
+
+        // Fitter species out-breed the island average, within limits
+        float relativeFitness = islandFitness > 0.0f ? species.meanFitness / islandFitness : 1.0f;
+        species.birthRate = baseBirth * std::clamp(relativeFitness, 0.5f, 2.0f);
+        species.deathRate = baseDeath;
+    }
+}
+
+void CoarseIslandModel::restore(std::vector<Species> species, float capacity, double births,
+                                double deaths, uint32_t seed) {
+    m_species = std::move(species);
+    for (Species& pool : m_species) {
+        pool.brains.resize(pool.genomes.size());
+    }
+    m_capacity = std::max(1.0f, capacity);
+    m_births = births;
+    m_deaths = deaths;
+    m_rng.seed(seed);
+}
+
+// ============================================================================
+// Advance
+// ============================================================================
+
+void CoarseIslandModel::advance(float deltaTime) {
+    if (deltaTime <= 0.0f) return;
+
+    double total = 0.0;
+    for (const Species& species : m_species) {
+        total += species.population;
+    }
+    const double crowding = std::max(0.0, 1.0 - total / m_capacity);
+
+    for (Species& species : m_species) {
+        if (species.population <= 0.0) continue;
+
+        double births = species.birthRate * crowding * species.population * deltaTime;
+        double deaths = species.deathRate * species.population * deltaTime;
+        species.population *= std::exp((species.birthRate * crowding - species.deathRate) * deltaTime);
+
+        // Below half a creature the species is gone
+        if (species.population < 0.5) {
+            deaths += species.population;
+            species.population = 0.0;
+        }
+
+        m_births += births;
+        m_deaths += deaths;
+        species.pendingBirths += births;
+        evolveReservoir(species);
+    }
+}
+
+void CoarseIslandModel::evolveReservoir(Species& species) {
+    if (species.genomes.empty()) return;
+
+    // Each whole birth replaces one reservoir genome with a mutated copy of
+    // another, inheriting its brain. Work per step is capped; a bounded
+    // backlog carries over.
+    species.pendingBirths = std::min(species.pendingBirths, static_cast<double>(MAX_MUTATIONS_PER_STEP * 4));
+
+    std::uniform_int_distribution<size_t> pick(0, species.genomes.size() - 1);
+    for (size_t n = 0; n < MAX_MUTATIONS_PER_STEP && species.pendingBirths >= 1.0; ++n) {
+        size_t parent = pick(m_rng);
+        size_t child = pick(m_rng);
+        if (child != parent) {
+            species.genomes[child] = species.genomes[parent];
+            species.brains[child] = species.brains[parent];
+        }
+        species.genomes[child].mutate(OFFSPRING_MUTATION_RATE, OFFSPRING_MUTATION_STRENGTH);
+        species.pendingBirths -= 1.0;
+    }
+}
+
+// ============================================================================
+// Rehydrate
+// ============================================================================
+
+int CoarseIslandModel::rehydrate(CreatureManager& creatures, const Terrain& terrain) {
+    const float worldWidth = terrain.getWidth() * terrain.getScale();
+    const float worldDepth = terrain.getDepth() * terrain.getScale();
+    std::uniform_real_distribution<float> posDist(0.05f, 0.95f);
+
+    int spawned = 0;
+    for (const Species& species : m_species) {
+        const int count = static_cast<int>(std::lround(species.population));
+        if (count <= 0 || species.genomes.empty()) continue;
+
+        const bool aquatic = isAquatic(species.type) && species.type != CreatureType::AMPHIBIAN;
+
+        for (int n = 0; n < count; ++n) {
+            // Same land/water placement rule as the initial population
+            glm::vec3 position;
+            bool placed = false;
+            for (int attempt = 0; attempt < PLACEMENT_ATTEMPTS && !placed; ++attempt) {
+                float x = posDist(m_rng) * worldWidth - worldWidth * 0.5f;
+                float z = posDist(m_rng) * worldDepth - worldDepth * 0.5f;
+                if (terrain.isWater(x, z) == aquatic) {
+                    position = glm::vec3(x, terrain.getHeight(x, z) - (aquatic ? 1.0f : 0.0f), z);
+                    placed = true;
+                }
+            }
+            if (!placed) continue;
+
+            // Cycle through the reservoir; repeats are siblings, not clones
+            const size_t slot = static_cast<size_t>(n) % species.genomes.size();
+            Genome genome = species.genomes[slot];
+            if (static_cast<size_t>(n) >= species.genomes.size()) {
+                genome.mutate(OFFSPRING_MUTATION_RATE, OFFSPRING_MUTATION_STRENGTH);
+            }
+
+            CreatureHandle handle = creatures.spawn(species.type, position, std::move(genome));
+            if (Creature* creature = creatures.get(handle)) {
+                creature->setEnergy(species.meanEnergy);
+                if (slot < species.brains.size() && !species.brains[slot].getNodes().empty()) {
+                    creature->initializeNEATBrain(species.brains[slot]);
+                }
+                ++spawned;
+            }
+        }
+    }
+
+    return spawned;
+}
+
+// ============================================================================
+// Summary
+// ============================================================================
+
+int CoarseIslandModel::getPopulation() const {
+    double total = 0.0;
+    for (const Species& species : m_species) {
+        total += species.population;
+    }
+    return static_cast<int>(std::lround(total));
+}
+
+int CoarseIslandModel::getLivingSpeciesCount() const {
+    int count = 0;
+    for (const Species& species : m_species) {
+        count += species.population >= 0.5 ? 1 : 0;
+    }
+    return count;
+}
+
+float CoarseIslandModel::getMeanEnergy() const {
+    double weighted = 0.0;
+    double total = 0.0;
+    for (const Species& species : m_species) {
+        weighted += species.meanEnergy * species.population;
+        total += species.population;
+    }
+    return total > 0.0 ? static_cast<float>(weighted / total) : 0.0f;
+}
+
+float CoarseIslandModel::getMeanFitness() const {
+    double weighted = 0.0;
+    double total = 0.0;
+    for (const Species& species : m_species) {
+        weighted += species.meanFitness * species.population;
+        total += species.population;
+    }
+    return total > 0.0 ? static_cast<float>(weighted / total) : 0.0f;
+}
+
+} // namespace Forge
@@ -0,0 +1,85 @@
+#pragma once
+
+// CoarseIslandModel - Statistical stand-in for an island nobody is watching
+//
+// When an island goes to sleep its creatures are summarised into one pool
+// per (creature type, species): an expected head count, per-capita birth and
+// death rates, mean energy and fitness, and a small reservoir of genomes and
+// their evolved NEAT brains copied from living members. advance() grows or shrinks each pool with a
+// logistic birth/death model against the island's capacity and folds births
+// into the reservoir as mutated copies, so the pool keeps evolving at a cost
+// independent of its size. rehydrate() spawns the pools back as creatures
+// whose genomes and brains are drawn from the evolved reservoirs.
+
+#include "../entities/CreatureType.h"
+#include "../entities/Genome.h"
+#include "../ai/NEATGenome.h"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+class Terrain;
+
+namespace Forge {
+
+class CreatureManager;
+
+class CoarseIslandModel {
+public:
+    static constexpr size_t GENOME_RESERVOIR = 8;           // Genomes kept per species
+    static constexpr size_t MAX_MUTATIONS_PER_STEP = GENOME_RESERVOIR;
+    static constexpr float DEFAULT_TURNOVER = 0.01f;        // Per-capita rate when none was observed
+
+    struct Species {
+        CreatureType type = CreatureType::HERBIVORE;
+        uint32_t speciesId = 0;
+        double population = 0.0;        // Expected head count
+        float birthRate = 0.0f;         // Per capita per second
+        float deathRate = 0.0f;
+        float meanEnergy = 0.0f;
+        float meanFitness = 0.0f;
+        double pendingBirths = 0.0;     // Births not yet folded into the reservoir
+        std::vector<Genome> genomes;    // Representative genomes
+        std::vector<ai::NEATGenome> brains; // Brain of each genome; no nodes if it had none
+    };
+
+    // Summarise the living creatures. birthRate/deathRate are the island's
+    // observed per-capita rates while it was detailed (negative: unknown);
+    // capacity is the island's creature limit.
+    void capture(CreatureManager& creatures, float birthRate, float deathRate,
+                 float capacity, uint32_t seed);
+
+    // Advance every pool by deltaTime seconds
+    void advance(float deltaTime);
+
+    // Spawn the pools as creatures on a cleared, initialised manager.
+    // Returns the number of creatures spawned.
+    int rehydrate(CreatureManager& creatures, const Terrain& terrain);
+
+    const std::vector<Species>& getSpecies() const { return m_species; }
+    int getPopulation() const;
+    int getLivingSpeciesCount() const;
+    float getMeanEnergy() const;
+    float getMeanFitness() const;
+    int getBirths() const { return static_cast<int>(m_births); }
+    int getDeaths() const { return static_cast<int>(m_deaths); }
+
+    // Checkpoint support (see DistributedArchipelago): the pools, capacity
+    // and birth/death totals are the whole model. The RNG stream is not
+    // kept; restore() starts a new one from seed.
+    float getCapacity() const { return m_capacity; }
+    double getBirthTotal() const { return m_births; }
+    double getDeathTotal() const { return m_deaths; }
+    void restore(std::vector<Species> species, float capacity, double births, double deaths, uint32_t seed);
+
+private:
+    std::vector<Species> m_species;
+    float m_capacity = 1.0f;
+    double m_births = 0.0;              // Since capture
+    double m_deaths = 0.0;
+    std::mt19937 m_rng;
+
+    void evolveReservoir(Species& species);
+};
+
+} // namespace Forge
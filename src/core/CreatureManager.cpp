@@ -1,6 +1,7 @@
 #include "CreatureManager.h"
 #include "../environment/Terrain.h"
 #include "../environment/EcosystemManager.h"
+#include "../entities/behaviors/BehaviorCoordinator.h"
 #include "../entities/Creature.h"
 #include "../entities/SwimBehavior.h"
 #include "../ai/NEATGenome.h"
@@ -60,6 +61,8 @@ void CreatureManager::clear() {
     m_generations.clear();
     m_freeIndices.clear();
     m_pendingDeaths.clear();
+    m_recycledGenomes.clear();
+    m_recycledBrains.clear();
 
     for (auto& list : m_domainLists) {
         list.clear();
@@ -80,6 +83,57 @@ void CreatureManager::clear() {
 
 CreatureHandle CreatureManager::spawn(CreatureType type, const glm::vec3& position,
                                        const Genome* parentGenome) {
+    if (parentGenome) {
+        return spawn(type, position, makeOffspringGenome(*parentGenome));
+    }
+
+    // Initialize genome based on type
+    Genome genome;
+    if (isAquatic(type)) {
+        if (type == CreatureType::AQUATIC_APEX) {
+            genome.randomizeShark();
+        } else if (isAquaticPredator(type)) {
+            genome.randomizeAquaticPredator();
+        } else {
+            genome.randomizeAquatic();
+        }
+    } else if (isFlying(type)) {
+        if (type == CreatureType::AERIAL_PREDATOR) {
+            genome.randomizeAerialPredator();
+        } else if (isBirdType(type)) {
+            genome.randomizeBird();
+        } else if (isInsectType(type)) {
+            genome.randomizeInsect();
+        } else {
+            genome.randomizeFlying();
+        }
+    } else {
+        genome.randomize();
+    }
+
+    return spawn(type, position, std::move(genome));
+}
+
+Genome CreatureManager::makeOffspringGenome(const Genome& parentGenome) {
+    Genome genome;
+    if (!m_recycledGenomes.empty()) {
+        genome = std::move(m_recycledGenomes.back());
+        m_recycledGenomes.pop_back();
+    }
+
+    // Copy-assignment reuses the recycled vectors' capacity
+    genome = parentGenome;
+    genome.mutate(0.1f, 0.2f);  // mutationRate, mutationStrength
+    return genome;
+}
+
+void CreatureManager::recycleGenome(Genome&& genome) {
+    if (m_recycledGenomes.size() < MAX_RECYCLED_BUFFERS) {
+        m_recycledGenomes.push_back(std::move(genome));
+    }
+}
+
+CreatureHandle CreatureManager::spawn(CreatureType type, const glm::vec3& position, Genome&& genome) {
     m_stats.spawnAttempts++;
 
     // Check 1: Population limit
@@ -88,6 +142,7 @@ CreatureHandle CreatureManager::spawn(CreatureType type, const glm::vec3& positi
         m_stats.failureReasons[static_cast<int>(SpawnFailureReason::POPULATION_LIMIT)]++;
         std::cout << "[SPAWN FAILED] Population limit reached (" << MAX_CREATURES << ") for "
                   << getCreatureTypeName(type) << std::endl;
+        recycleGenome(std::move(genome));
         return CreatureHandle::invalid();
     }
 
@@ -96,6 +151,7 @@ CreatureHandle CreatureManager::spawn(CreatureType type, const glm::vec3& positi
         m_stats.spawnFailures++;
         m_stats.failureReasons[static_cast<int>(SpawnFailureReason::NO_TERRAIN)]++;
         std::cerr << "[SPAWN FAILED] Terrain not initialized for " << getCreatureTypeName(type) << std::endl;
+        recycleGenome(std::move(genome));
         return CreatureHandle::invalid();
     }
 
@@ -167,43 +223,14 @@ CreatureHandle CreatureManager::spawn(CreatureType type, const glm::vec3& positi
                           << getCreatureTypeName(type) << " at ("
                           << position.x << ", " << position.z << "). Try spawning near coastline." << std::endl;
                 releaseSlot(index);  // Release allocated slot
+                recycleGenome(std::move(genome));
                 return CreatureHandle::invalid();
             }
         }
     }
 
-    // Create genome
-    Genome genome;
-    if (parentGenome) {
-        genome = *parentGenome;
-        genome.mutate(0.1f, 0.2f);  // mutationRate, mutationStrength
-    } else {
-        // Initialize genome based on type
-        if (isAquatic(type)) {
-            if (type == CreatureType::AQUATIC_APEX) {
-                genome.randomizeShark();
-            } else if (isAquaticPredator(type)) {
-                genome.randomizeAquaticPredator();
-            } else {
-                genome.randomizeAquatic();
-            }
-        } else if (isFlying(type)) {
-            if (type == CreatureType::AERIAL_PREDATOR) {
-                genome.randomizeAerialPredator();
-            } else if (isBirdType(type)) {
-                genome.randomizeBird();
-            } else if (isInsectType(type)) {
-                genome.randomizeInsect();
-            } else {
-                genome.randomizeFlying();
-            }
-        } else {
-            genome.randomize();
-        }
-    }
-
-    // Create creature using proper constructor
-    auto creature = std::make_unique<Creature>(validPos, genome, type);
+    // Create creature, moving the genome in and reusing a dead creature's brains
+    auto creature = std::make_unique<Creature>(validPos, std::move(genome), type, takeRecycledBrains());
 
     // Store creature
     m_creatures[index] = std::move(creature);
@@ -532,6 +559,12 @@ void CreatureManager::update(float deltaTime) {
                 m_ecosystem->onCreatureDeath(*creature);
             }
 
+            // Drop its territory and mark a carcass for the variety behaviors
+            if (m_behaviors) {
+                m_behaviors->onCreatureDeath(static_cast<uint32_t>(creature->getID()),
+                                             creature->getPosition());
+            }
+
             // Update stats
             m_stats.alive--;
             m_stats.deaths++;
@@ -788,11 +821,26 @@ size_t CreatureManager::allocateSlot() {
 
 void CreatureManager::releaseSlot(size_t index) {
     if (index < m_creatures.size()) {
+        if (Creature* creature = m_creatures[index].get()) {
+            recycleGenome(creature->releaseGenome());
+            if (m_recycledBrains.size() < MAX_RECYCLED_BUFFERS) {
+                m_recycledBrains.push_back(creature->releaseBrainBuffers());
+            }
+        }
         m_creatures[index].reset();
         m_freeIndices.push_back(static_cast<uint32_t>(index));
     }
 }
 
+Creature::BrainBuffers CreatureManager::takeRecycledBrains() {
+    if (m_recycledBrains.empty()) {
+        return {};
+    }
+    Creature::BrainBuffers buffers = std::move(m_recycledBrains.back());
+    m_recycledBrains.pop_back();
+    return buffers;
+}
+
 void CreatureManager::updateStats() {
     float totalEnergy = 0.0f;
     float totalAge = 0.0f;
@@ -16,6 +16,7 @@
 
 class Terrain;
 class EcosystemManager;
+class BehaviorCoordinator;
 
 namespace Forge {
 
@@ -23,6 +24,7 @@ namespace Forge {
 using ::Creature;
 using ::Terrain;
 using ::EcosystemManager;
+using ::BehaviorCoordinator;
 
 // ============================================================================
 // Domain Types for Spatial Partitioning
@@ -147,6 +149,9 @@ class CreatureManager {
     void init(Terrain* terrain, EcosystemManager* ecosystem, unsigned int seed = 0);
     void clear();
 
+    // Behaviors told about each death as it is processed (territories, carcasses)
+    void setBehaviorCoordinator(BehaviorCoordinator* behaviors) { m_behaviors = behaviors; }
+
     // ========================================================================
     // Creature Lifecycle
     // ========================================================================
@@ -155,6 +160,13 @@ class CreatureManager {
     CreatureHandle spawn(CreatureType type, const glm::vec3& position,
                          const Genome* parentGenome = nullptr);
 
+    // Spawn taking ownership of an already-built genome (moved, not mutated).
+    // Build it with makeOffspringGenome() to reuse recycled genome storage.
+    CreatureHandle spawn(CreatureType type, const glm::vec3& position, Genome&& genome);
+
+    // Copy a parent genome into recycled storage and mutate it for an offspring
+    Genome makeOffspringGenome(const Genome& parentGenome);
+
     // Spawn with specific genome (for loading saves)
     CreatureHandle spawnWithGenome(const glm::vec3& position, const Genome& genome);
 
@@ -164,6 +176,12 @@ class CreatureManager {
     // Check if handle is valid and creature is alive
     bool isAlive(CreatureHandle handle) const;
 
+    // Handle for the creature in a slot (as passed to forEach), invalid if out of range
+    CreatureHandle getHandle(size_t index) const {
+        if (index >= m_generations.size()) return CreatureHandle::invalid();
+        return CreatureHandle{static_cast<uint32_t>(index), m_generations[index]};
+    }
+
     // Get creature by handle (nullptr if invalid)
     Creature* get(CreatureHandle handle);
     const Creature* get(CreatureHandle handle) const;
@@ -329,12 +347,19 @@ class CreatureManager {
     // Terrain for height sampling
     Terrain* m_terrain = nullptr;
     EcosystemManager* m_ecosystem = nullptr;
+    BehaviorCoordinator* m_behaviors = nullptr;
 
     // Main creature storage (pooled)
     std::vector<std::unique_ptr<Creature>> m_creatures;
     std::vector<uint32_t> m_freeIndices;
     std::vector<uint32_t> m_generations;  // For handle validation
 
+    // Genome/brain buffers stripped from released creatures, reused by the next
+    // births so population booms don't hit the allocator once per newborn
+    static constexpr size_t MAX_RECYCLED_BUFFERS = 512;
+    std::vector<Genome> m_recycledGenomes;
+    std::vector<Creature::BrainBuffers> m_recycledBrains;
+
     // Domain-specific lists (for efficient iteration)
     std::array<std::vector<Creature*>, static_cast<size_t>(CreatureDomain::COUNT)> m_domainLists;
 
@@ -366,6 +391,8 @@ class CreatureManager {
     // Helper methods
     size_t allocateSlot();
     void releaseSlot(size_t index);
+    void recycleGenome(Genome&& genome);
+    Creature::BrainBuffers takeRecycledBrains();
     void updateStats();
     void rebuildDomainLists();
     float getTerrainHeight(const glm::vec3& position) const;
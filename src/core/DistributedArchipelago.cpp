@@ -0,0 +1,836 @@
+#include "DistributedArchipelago.h"
+#include "CoarseIslandModel.h"
+#include "Serializer.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <type_traits>
+
+namespace Forge {
+
+namespace {
+    constexpr uint32_t SHARD_MAGIC = 0x44524853;      // "SHRD"
+    constexpr uint32_t MANIFEST_MAGIC = 0x4B435241;   // "ARCK"
+    constexpr uint32_t CHECKPOINT_VERSION = 3;
+    constexpr uint32_t MAX_COARSE_POOLS = 65536;      // Sanity bound when reading shards
+
+    // The genome's trait block is every member except neuralWeights. All of
+    // those are trivially copyable, so the block is copied as two raw byte
+    // ranges around the vector.
+    static_assert(std::is_standard_layout<Genome>::value, "Genome trait block needs a fixed layout");
+    constexpr size_t WEIGHTS_OFFSET = offsetof(Genome, neuralWeights);
+    constexpr size_t TAIL_OFFSET = WEIGHTS_OFFSET + sizeof(std::vector<float>);
+    constexpr size_t TRAIT_BYTES = WEIGHTS_OFFSET + (sizeof(Genome) - TAIL_OFFSET);
+
+    // Brain genes are copied the same way, one gene at a time
+    static_assert(std::is_trivially_copyable<ai::NodeGene>::value, "Node genes need a fixed layout");
+    static_assert(std::is_trivially_copyable<ai::ConnectionGene>::value, "Connection genes need a fixed layout");
+
+    size_t recordBytes(const CreatureRecordHeader& header) {
+        return sizeof(CreatureRecordHeader) + TRAIT_BYTES +
+               header.weightCount * sizeof(float) +
+               header.brainNodeCount * sizeof(ai::NodeGene) +
+               header.brainConnectionCount * sizeof(ai::ConnectionGene);
+    }
+
+    // Crossing progress stored after an in-flight migrant's record in a shard
+    struct CrossingState {
+        uint32_t state;             // MigrationState
+        float progress;
+        float totalDistance;
+        float estimatedDuration;
+        float startEnergy;
+        float survivalChance;
+        float startPosition[3];
+    };
+
+    // One coarse pool in a shard; its reservoir genomes follow as creature records
+    struct CoarseSpeciesState {
+        uint32_t type;              // CreatureType
+        uint32_t speciesId;
+        double population;
+        double pendingBirths;
+        float birthRate;
+        float deathRate;
+        float meanEnergy;
+        float meanFitness;
+        uint32_t genomeCount;
+    };
+
+    template<typename T>
+    void appendPod(std::vector<uint8_t>& out, const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "appendPod needs a trivially copyable type");
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+        out.insert(out.end(), bytes, bytes + sizeof(T));
+    }
+
+    template<typename T>
+    bool readPod(const std::vector<uint8_t>& in, size_t& offset, T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "readPod needs a trivially copyable type");
+        if (offset + sizeof(T) > in.size()) return false;
+        std::memcpy(&value, in.data() + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+
+    void appendStats(std::vector<uint8_t>& out, uint32_t islandIndex, const IslandStats& stats) {
+        appendPod(out, islandIndex);
+        appendPod(out, stats);
+    }
+} // namespace
+
+// ============================================================================
+// Creature Records
+// ============================================================================
+
+uint32_t creatureRecordFingerprint() {
+    // FNV-1a over the sizes and offsets the wire format depends on
+    const uint32_t fields[] = {
+        CHECKPOINT_VERSION,
+        static_cast<uint32_t>(sizeof(Genome)),
+        static_cast<uint32_t>(WEIGHTS_OFFSET),
+        static_cast<uint32_t>(sizeof(CreatureRecordHeader)),
+        static_cast<uint32_t>(sizeof(IslandStats)),
+        static_cast<uint32_t>(sizeof(ai::NodeGene)),
+        static_cast<uint32_t>(sizeof(ai::ConnectionGene))
+    };
+
+    uint32_t hash = 2166136261u;
+    for (uint32_t field : fields) {
+        for (int shift = 0; shift < 32; shift += 8) {
+            hash ^= (field >> shift) & 0xFFu;
+            hash *= 16777619u;
+        }
+    }
+    return hash;
+}
+
+void writeCreatureRecord(const MigrationEvent& event, std::vector<uint8_t>& out) {
+    const Genome& genome = event.genome;
+    const size_t weightCount = std::min<size_t>(genome.neuralWeights.size(),
+                                                std::numeric_limits<uint16_t>::max());
+
+    // The brain travels whole or not at all
+    const ai::NEATGenome& brain = event.brainGenome;
+    const bool hasBrain = event.hasBrain && !brain.getNodes().empty() &&
+                          brain.getNodes().size() <= std::numeric_limits<uint16_t>::max() &&
+                          brain.getConnections().size() <= std::numeric_limits<uint16_t>::max();
+
+    CreatureRecordHeader header{};
+    header.weightCount = static_cast<uint16_t>(weightCount);
+    header.brainNodeCount = hasBrain ? static_cast<uint16_t>(brain.getNodes().size()) : 0;
+    header.brainConnectionCount = hasBrain ? static_cast<uint16_t>(brain.getConnections().size()) : 0;
+    header.recordSize = static_cast<uint32_t>(recordBytes(header));
+    header.creatureId = event.creatureId;
+    header.sourceIsland = static_cast<uint16_t>(event.sourceIsland);
+    header.targetIsland = static_cast<uint16_t>(event.targetIsland);
+    header.creatureType = static_cast<uint8_t>(event.creatureType);
+    header.migrationType = static_cast<uint8_t>(event.type);
+    header.energy = event.currentEnergy;
+    header.timeElapsed = event.timeElapsed;
+    header.position[0] = event.targetPosition.x;
+    header.position[1] = event.targetPosition.y;
+    header.position[2] = event.targetPosition.z;
+
+    out.reserve(out.size() + header.recordSize);
+    appendPod(out, header);
+
+    const uint8_t* traits = reinterpret_cast<const uint8_t*>(&genome);
+    out.insert(out.end(), traits, traits + WEIGHTS_OFFSET);
+    out.insert(out.end(), traits + TAIL_OFFSET, traits + sizeof(Genome));
+
+    const uint8_t* weights = reinterpret_cast<const uint8_t*>(genome.neuralWeights.data());
+    out.insert(out.end(), weights, weights + weightCount * sizeof(float));
+
+    if (hasBrain) {
+        const uint8_t* nodes = reinterpret_cast<const uint8_t*>(brain.getNodes().data());
+        out.insert(out.end(), nodes, nodes + header.brainNodeCount * sizeof(ai::NodeGene));
+        const uint8_t* connections = reinterpret_cast<const uint8_t*>(brain.getConnections().data());
+        out.insert(out.end(), connections, connections + header.brainConnectionCount * sizeof(ai::ConnectionGene));
+    }
+}
+
+bool peekCreatureRecord(const std::vector<uint8_t>& data, size_t offset, CreatureRecordHeader& out) {
+    if (!readPod(data, offset, out)) return false;
+
+    const size_t expected = recordBytes(out);
+    return out.recordSize == expected && offset - sizeof(CreatureRecordHeader) + expected <= data.size();
+}
+
+bool readCreatureRecord(const std::vector<uint8_t>& data, size_t& offset, MigrationEvent& out) {
+    CreatureRecordHeader header;
+    if (!peekCreatureRecord(data, offset, header)) return false;
+
+    const uint8_t* cursor = data.data() + offset + sizeof(header);
+    uint8_t* traits = reinterpret_cast<uint8_t*>(&out.genome);
+    std::memcpy(traits, cursor, WEIGHTS_OFFSET);
+    cursor += WEIGHTS_OFFSET;
+    std::memcpy(traits + TAIL_OFFSET, cursor, sizeof(Genome) - TAIL_OFFSET);
+    cursor += sizeof(Genome) - TAIL_OFFSET;
+
+    out.genome.neuralWeights.resize(header.weightCount);
+    std::memcpy(out.genome.neuralWeights.data(), cursor, header.weightCount * sizeof(float));
+    cursor += header.weightCount * sizeof(float);
+
+    out.hasBrain = header.brainNodeCount > 0;
+    if (out.hasBrain) {
+        std::vector<ai::NodeGene> nodes(header.brainNodeCount, ai::NodeGene(0, ai::NodeType::INPUT));
+        std::memcpy(nodes.data(), cursor, header.brainNodeCount * sizeof(ai::NodeGene));
+        cursor += header.brainNodeCount * sizeof(ai::NodeGene);
+
+        std::vector<ai::ConnectionGene> connections(header.brainConnectionCount, ai::ConnectionGene(0, 0, 0));
+        std::memcpy(connections.data(), cursor, header.brainConnectionCount * sizeof(ai::ConnectionGene));
+
+        out.brainGenome.setGenes(std::move(nodes), std::move(connections));
+    }
+
+    out.creatureId = header.creatureId;
+    out.sourceIsland = header.sourceIsland;
+    out.targetIsland = header.targetIsland;
+    out.creatureType = static_cast<CreatureType>(header.creatureType);
+    out.type = static_cast<MigrationType>(header.migrationType);
+    out.startEnergy = header.energy;
+    out.currentEnergy = header.energy;
+    out.timeElapsed = header.timeElapsed;
+    out.targetPosition = glm::vec3(header.position[0], header.position[1], header.position[2]);
+    out.currentPosition = out.targetPosition;
+
+    offset += header.recordSize;
+    return true;
+}
+
+// ============================================================================
+// Coarse Models
+// ============================================================================
+
+namespace {
+    void writeCoarseModel(BinaryWriter& writer, const CoarseIslandModel& model, uint32_t islandIndex) {
+        const auto& pools = model.getSpecies();
+        writer.write(model.getCapacity());
+        writer.write(model.getBirthTotal());
+        writer.write(model.getDeathTotal());
+        writer.write(static_cast<uint32_t>(pools.size()));
+
+        std::vector<uint8_t> records;
+        for (const CoarseIslandModel::Species& pool : pools) {
+            CoarseSpeciesState state{};
+            state.type = static_cast<uint32_t>(pool.type);
+            state.speciesId = pool.speciesId;
+            state.population = pool.population;
+            state.pendingBirths = pool.pendingBirths;
+            state.birthRate = pool.birthRate;
+            state.deathRate = pool.deathRate;
+            state.meanEnergy = pool.meanEnergy;
+            state.meanFitness = pool.meanFitness;
+            state.genomeCount = static_cast<uint32_t>(pool.genomes.size());
+            writer.writeRaw(&state, sizeof(state));
+
+            records.clear();
+            for (size_t g = 0; g < pool.genomes.size(); ++g) {
+                MigrationEvent snapshot;
+                snapshot.sourceIsland = islandIndex;
+                snapshot.targetIsland = islandIndex;
+                snapshot.creatureType = pool.type;
+                snapshot.genome = pool.genomes[g];
+                snapshot.hasBrain = g < pool.brains.size() && !pool.brains[g].getNodes().empty();
+                if (snapshot.hasBrain) {
+                    snapshot.brainGenome = pool.brains[g];
+                }
+                writeCreatureRecord(snapshot, records);
+            }
+            writer.writeVector(records);
+        }
+    }
+
+    std::unique_ptr<CoarseIslandModel> readCoarseModel(BinaryReader& reader, uint32_t seed) {
+        const float capacity = reader.read<float>();
+        const double births = reader.read<double>();
+        const double deaths = reader.read<double>();
+        const uint32_t poolCount = reader.read<uint32_t>();
+        if (!reader.good() || poolCount > MAX_COARSE_POOLS) return nullptr;
+
+        std::vector<CoarseIslandModel::Species> pools(poolCount);
+        for (CoarseIslandModel::Species& pool : pools) {
+            CoarseSpeciesState state;
+            reader.readRaw(&state, sizeof(state));
+            std::vector<uint8_t> records = reader.readVector<uint8_t>(std::numeric_limits<uint32_t>::max());
+            if (!reader.good() || state.genomeCount > CoarseIslandModel::GENOME_RESERVOIR) return nullptr;
+
+            pool.type = static_cast<CreatureType>(state.type);
+            pool.speciesId = state.speciesId;
+            pool.population = state.population;
+            pool.pendingBirths = state.pendingBirths;
+            pool.birthRate = state.birthRate;
+            pool.deathRate = state.deathRate;
+            pool.meanEnergy = state.meanEnergy;
+            pool.meanFitness = state.meanFitness;
+
+            size_t offset = 0;
+            pool.genomes.resize(state.genomeCount);
+            pool.brains.resize(state.genomeCount);
+            for (size_t g = 0; g < pool.genomes.size(); ++g) {
+                MigrationEvent snapshot;
+                if (!readCreatureRecord(records, offset, snapshot)) return nullptr;
+                pool.genomes[g] = std::move(snapshot.genome);
+                if (snapshot.hasBrain) {
+                    pool.brains[g] = std::move(snapshot.brainGenome);
+                }
+            }
+        }
+
+        auto model = std::make_unique<CoarseIslandModel>();
+        model->restore(std::move(pools), capacity, births, deaths, seed);
+        return model;
+    }
+} // namespace
+
+// ============================================================================
+// Worker
+// ============================================================================
+
+ArchipelagoWorker::ArchipelagoWorker(ArchipelagoTransport& transport, uint32_t workerIndex,
+                                     uint32_t workerCount)
+    : m_transport(transport)
+    , m_workerIndex(workerIndex)
+    , m_workerCount(workerCount) {
+}
+
+void ArchipelagoWorker::attach(MultiIslandManager& islands, InterIslandMigration& migration) {
+    m_islands = &islands;
+    m_migration = &migration;
+
+    for (uint32_t i = 0; i < islands.getIslandCount(); ++i) {
+        if (!ownsIsland(i, m_workerIndex, m_workerCount)) {
+            islands.releaseIsland(i);
+        }
+    }
+
+    migration.setRemoteArrivalHandler([this](const MigrationEvent& event) {
+        writeCreatureRecord(event, m_outgoing);
+        ++m_outgoingCount;
+    });
+}
+
+bool ArchipelagoWorker::sendHello() {
+    ArchipelagoMessage hello;
+    hello.type = ArchipelagoMessageType::HELLO;
+    hello.tick = m_tick;
+    appendPod(hello.payload, m_workerIndex);
+    appendPod(hello.payload, m_workerCount);
+    appendPod(hello.payload, m_islands ? m_islands->getIslandCount() : 0u);
+    appendPod(hello.payload, creatureRecordFingerprint());
+    return m_transport.send(0, hello);
+}
+
+bool ArchipelagoWorker::step(float deltaTime) {
+    if (m_shutdown || !m_islands || !m_migration) return false;
+
+    m_islands->update(deltaTime);
+    m_migration->update(deltaTime, *m_islands);
+
+    // Report: stats for owned islands, then migrants bound for other workers
+    ArchipelagoMessage report;
+    report.type = ArchipelagoMessageType::TICK_DONE;
+    report.tick = m_tick;
+
+    const uint32_t islandCount = m_islands->getIslandCount();
+    uint32_t ownedCount = 0;
+    for (uint32_t i = 0; i < islandCount; ++i) {
+        ownedCount += ownsIsland(i, m_workerIndex, m_workerCount) ? 1 : 0;
+    }
+    appendPod(report.payload, ownedCount);
+    for (uint32_t i = 0; i < islandCount; ++i) {
+        if (ownsIsland(i, m_workerIndex, m_workerCount)) {
+            appendStats(report.payload, i, m_islands->getIslandStats(i));
+        }
+    }
+
+    appendPod(report.payload, m_outgoingCount);
+    report.payload.insert(report.payload.end(), m_outgoing.begin(), m_outgoing.end());
+    m_migrantsSent += static_cast<int>(m_outgoingCount);
+    m_outgoing.clear();
+    m_outgoingCount = 0;
+
+    ArchipelagoMessage reply;
+    if (!m_transport.send(0, report) || !m_transport.receive(0, reply) ||
+        reply.type != ArchipelagoMessageType::RELEASE || !applyRelease(reply)) {
+        m_shutdown = true;
+        return false;
+    }
+
+    ++m_tick;
+    return true;
+}
+
+bool ArchipelagoWorker::applyRelease(const ArchipelagoMessage& message) {
+    const std::vector<uint8_t>& payload = message.payload;
+    size_t offset = 0;
+
+    // Remote island stats; owned islands keep their local values
+    uint32_t statCount = 0;
+    if (!readPod(payload, offset, statCount)) return false;
+    for (uint32_t i = 0; i < statCount; ++i) {
+        uint32_t index;
+        IslandStats stats;
+        if (!readPod(payload, offset, index) || !readPod(payload, offset, stats)) return false;
+        if (!ownsIsland(index, m_workerIndex, m_workerCount)) {
+            m_islands->setIslandStats(index, stats);
+        }
+    }
+
+    // Land incoming migrants in the order the coordinator routed them
+    uint32_t migrantCount = 0;
+    if (!readPod(payload, offset, migrantCount)) return false;
+    for (uint32_t i = 0; i < migrantCount; ++i) {
+        MigrationEvent event;
+        if (!readCreatureRecord(payload, offset, event)) return false;
+        if (ownsIsland(event.targetIsland, m_workerIndex, m_workerCount)) {
+            m_migration->landMigrant(std::move(event), *m_islands);
+            ++m_migrantsReceived;
+        }
+    }
+
+    // Checkpoint, if the coordinator asked for one at this barrier
+    uint32_t directoryLength = 0;
+    if (!readPod(payload, offset, directoryLength) || offset + directoryLength > payload.size()) return false;
+    if (directoryLength == 0) return true;
+
+    std::string directory(reinterpret_cast<const char*>(payload.data() + offset), directoryLength);
+    ArchipelagoMessage done;
+    done.type = ArchipelagoMessageType::CHECKPOINT_DONE;
+    done.tick = m_tick;
+    done.payload.push_back(writeCheckpoint(directory) ? 1 : 0);
+    return m_transport.send(0, done);
+}
+
+// ============================================================================
+// Worker Checkpoints
+// ============================================================================
+
+std::string ArchipelagoWorker::shardPath(const std::string& directory, uint32_t workerIndex) {
+    return directory + "/worker_" + std::to_string(workerIndex) + ".ckpt";
+}
+
+bool ArchipelagoWorker::writeCheckpoint(const std::string& directory) {
+    BinaryWriter writer;
+    if (!writer.open(shardPath(directory, m_workerIndex))) return false;
+
+    const uint32_t islandCount = m_islands->getIslandCount();
+    uint32_t ownedCount = 0;
+    for (uint32_t i = 0; i < islandCount; ++i) {
+        ownedCount += ownsIsland(i, m_workerIndex, m_workerCount) ? 1 : 0;
+    }
+
+    writer.write(SHARD_MAGIC);
+    writer.write(CHECKPOINT_VERSION);
+    writer.write(creatureRecordFingerprint());
+    writer.write(m_tick);
+    writer.write(m_workerIndex);
+    writer.write(ownedCount);
+
+    std::vector<uint8_t> records;
+    for (uint32_t i = 0; i < islandCount; ++i) {
+        if (!ownsIsland(i, m_workerIndex, m_workerCount)) continue;
+
+        Island* island = m_islands->getIsland(i);
+        records.clear();
+
+        // A sleeping island is saved as its model; waking it here would
+        // spend the detailed update the model exists to avoid
+        const bool sleeping = island && island->isSleeping();
+        writer.write(i);
+        writer.writeBool(sleeping);
+        if (sleeping) {
+            writeCoarseModel(writer, *island->coarse, i);
+            continue;
+        }
+
+        uint32_t creatureCount = 0;
+
+        if (island && island->creatures) {
+            island->creatures->forEach([&](Creature& creature, size_t) {
+                if (!creature.isAlive()) return;
+
+                MigrationEvent snapshot;
+                snapshot.creatureId = creature.getId();
+                snapshot.sourceIsland = i;
+                snapshot.targetIsland = i;
+                snapshot.creatureType = creature.getType();
+                snapshot.currentEnergy = creature.getEnergy();
+                snapshot.targetPosition = island->localToWorld(creature.getPosition());
+                snapshot.genome = creature.getGenome();
+                snapshot.hasBrain = creature.hasNEATBrain();
+                if (snapshot.hasBrain) {
+                    snapshot.brainGenome = creature.getNEATGenome();
+                }
+                writeCreatureRecord(snapshot, records);
+                ++creatureCount;
+            });
+        }
+
+        writer.write(creatureCount);
+        writer.writeVector(records);
+    }
+
+    // Crossings this worker started and has not landed yet
+    records.clear();
+    const std::vector<MigrationEvent>& crossings = m_migration->getActiveMigrations();
+    for (const MigrationEvent& event : crossings) {
+        writeCreatureRecord(event, records);
+
+        CrossingState crossing{};
+        crossing.state = static_cast<uint32_t>(event.state);
+        crossing.progress = event.progress;
+        crossing.totalDistance = event.totalDistance;
+        crossing.estimatedDuration = event.estimatedDuration;
+        crossing.startEnergy = event.startEnergy;
+        crossing.survivalChance = event.survivalChance;
+        crossing.startPosition[0] = event.startPosition.x;
+        crossing.startPosition[1] = event.startPosition.y;
+        crossing.startPosition[2] = event.startPosition.z;
+        appendPod(records, crossing);
+    }
+    writer.write(static_cast<uint32_t>(crossings.size()));
+    writer.writeVector(records);
+
+    return writer.isOpen();
+}
+
+bool ArchipelagoWorker::restoreCheckpoint(const std::string& directory) {
+    if (!m_islands || !m_migration) return false;
+
+    BinaryReader reader;
+    if (!reader.open(shardPath(directory, m_workerIndex))) return false;
+
+    try {
+        if (reader.read<uint32_t>() != SHARD_MAGIC ||
+            reader.read<uint32_t>() != CHECKPOINT_VERSION ||
+            reader.read<uint32_t>() != creatureRecordFingerprint()) {
+            return false;
+        }
+
+        const uint32_t tick = reader.read<uint32_t>();
+        if (reader.read<uint32_t>() != m_workerIndex) return false;
+
+        const uint32_t ownedCount = reader.read<uint32_t>();
+        for (uint32_t n = 0; n < ownedCount; ++n) {
+            const uint32_t index = reader.read<uint32_t>();
+            Island* island = m_islands->getIsland(index);
+
+            if (reader.readBool()) {
+                auto model = readCoarseModel(reader, (island ? island->config.seed : index) ^ tick);
+                if (!model) return false;
+                if (island && ownsIsland(index, m_workerIndex, m_workerCount)) {
+                    m_islands->restoreSleepingIsland(index, std::move(model));
+                }
+                continue;
+            }
+
+            const uint32_t creatureCount = reader.read<uint32_t>();
+            std::vector<uint8_t> records = reader.readVector<uint8_t>(std::numeric_limits<uint32_t>::max());
+            if (!reader.good()) return false;
+
+            if (!island || !island->creatures) continue;
+
+            island->coarse.reset();
+            island->creatures->clear();
+            size_t offset = 0;
+            for (uint32_t c = 0; c < creatureCount; ++c) {
+                MigrationEvent snapshot;
+                if (!readCreatureRecord(records, offset, snapshot)) return false;
+
+                glm::vec3 localPosition = island->worldToLocal(snapshot.targetPosition);
+                CreatureHandle handle = island->creatures->spawn(snapshot.creatureType, localPosition,
+                                                                 std::move(snapshot.genome));
+                if (Creature* creature = island->creatures->get(handle)) {
+                    creature->setEnergy(snapshot.currentEnergy);
+                    if (snapshot.hasBrain) {
+                        creature->setNEATGenome(snapshot.brainGenome);
+                    }
+                }
+            }
+        }
+
+        const uint32_t crossingCount = reader.read<uint32_t>();
+        std::vector<uint8_t> records = reader.readVector<uint8_t>(std::numeric_limits<uint32_t>::max());
+        if (!reader.good() || crossingCount > records.size() / sizeof(CreatureRecordHeader)) return false;
+
+        std::vector<MigrationEvent> crossings(crossingCount);
+        size_t offset = 0;
+        for (MigrationEvent& event : crossings) {
+            CrossingState crossing;
+            if (!readCreatureRecord(records, offset, event) || !readPod(records, offset, crossing)) return false;
+
+            event.state = static_cast<MigrationState>(crossing.state);
+            event.progress = crossing.progress;
+            event.totalDistance = crossing.totalDistance;
+            event.estimatedDuration = crossing.estimatedDuration;
+            event.startEnergy = crossing.startEnergy;
+            event.survivalChance = crossing.survivalChance;
+            event.startPosition = glm::vec3(crossing.startPosition[0], crossing.startPosition[1],
+                                            crossing.startPosition[2]);
+            event.currentPosition = glm::mix(event.startPosition, event.targetPosition, event.progress);
+        }
+        m_migration->restoreActiveMigrations(std::move(crossings));
+
+        // The shard was written at the end of its tick
+        m_tick = tick + 1;
+    } catch (const std::exception&) {
+        return false;
+    }
+
+    m_islands->updateStatistics();
+    return true;
+}
+
+// ============================================================================
+// Coordinator
+// ============================================================================
+
+ArchipelagoCoordinator::ArchipelagoCoordinator(ArchipelagoTransport& transport, uint32_t islandCount)
+    : m_transport(transport)
+    , m_islandCount(islandCount)
+    , m_workerCount(static_cast<uint32_t>(transport.getPeerCount())) {
+    m_peerOfWorker.assign(m_workerCount, -1);
+    m_islandStats.resize(islandCount);
+    m_inbox.resize(m_workerCount);
+    m_inboxCounts.assign(m_workerCount, 0);
+}
+
+bool ArchipelagoCoordinator::waitForWorkers() {
+    for (int peer = 0; peer < static_cast<int>(m_workerCount); ++peer) {
+        ArchipelagoMessage hello;
+        if (!m_transport.receive(peer, hello) || hello.type != ArchipelagoMessageType::HELLO) {
+            m_lastError = "Worker did not say hello";
+            return false;
+        }
+
+        size_t offset = 0;
+        uint32_t workerIndex, workerCount, islandCount, fingerprint;
+        if (!readPod(hello.payload, offset, workerIndex) || !readPod(hello.payload, offset, workerCount) ||
+            !readPod(hello.payload, offset, islandCount) || !readPod(hello.payload, offset, fingerprint)) {
+            m_lastError = "Malformed hello";
+            return false;
+        }
+
+        if (workerCount != m_workerCount || workerIndex >= m_workerCount ||
+            m_peerOfWorker[workerIndex] != -1) {
+            m_lastError = "Worker " + std::to_string(workerIndex) + " has an unexpected index";
+            return false;
+        }
+        if (islandCount != m_islandCount || fingerprint != creatureRecordFingerprint()) {
+            m_lastError = "Worker " + std::to_string(workerIndex) + " runs a different archipelago or build";
+            return false;
+        }
+        if (hello.tick != m_tick) {
+            m_lastError = "Worker " + std::to_string(workerIndex) + " resumed from a different checkpoint";
+            return false;
+        }
+
+        m_peerOfWorker[workerIndex] = peer;
+    }
+    return true;
+}
+
+bool ArchipelagoCoordinator::collectReport(uint32_t workerIndex) {
+    ArchipelagoMessage report;
+    if (!m_transport.receive(m_peerOfWorker[workerIndex], report) ||
+        report.type != ArchipelagoMessageType::TICK_DONE || report.tick != m_tick) {
+        m_lastError = "Lost worker " + std::to_string(workerIndex) + " at tick " + std::to_string(m_tick);
+        return false;
+    }
+
+    const std::vector<uint8_t>& payload = report.payload;
+    size_t offset = 0;
+
+    uint32_t statCount = 0;
+    if (!readPod(payload, offset, statCount)) return false;
+    for (uint32_t i = 0; i < statCount; ++i) {
+        uint32_t index;
+        IslandStats stats;
+        if (!readPod(payload, offset, index) || !readPod(payload, offset, stats)) return false;
+        if (index < m_islandCount && ArchipelagoWorker::ownsIsland(index, workerIndex, m_workerCount)) {
+            m_islandStats[index] = stats;
+        }
+    }
+
+    // Route records by target island without decoding the genomes
+    uint32_t migrantCount = 0;
+    if (!readPod(payload, offset, migrantCount)) return false;
+    for (uint32_t i = 0; i < migrantCount; ++i) {
+        CreatureRecordHeader header;
+        if (!peekCreatureRecord(payload, offset, header)) {
+            m_lastError = "Corrupt migrant record from worker " + std::to_string(workerIndex);
+            return false;
+        }
+
+        if (header.targetIsland < m_islandCount) {
+            const uint32_t owner = header.targetIsland % m_workerCount;
+            m_inbox[owner].insert(m_inbox[owner].end(), payload.begin() + offset,
+                                  payload.begin() + offset + header.recordSize);
+            ++m_inboxCounts[owner];
+            ++m_migrantsRouted;
+        }
+        offset += header.recordSize;
+    }
+    return true;
+}
+
+bool ArchipelagoCoordinator::runTick() {
+    for (uint32_t w = 0; w < m_workerCount; ++w) {
+        m_inbox[w].clear();
+        m_inboxCounts[w] = 0;
+    }
+
+    // Barrier. Reports are read in worker order, so migrants reach each
+    // worker in the same order on every run.
+    for (uint32_t w = 0; w < m_workerCount; ++w) {
+        if (!collectReport(w)) return false;
+    }
+    m_globalStats = MultiIslandManager::combineStats(m_islandStats);
+
+    std::string checkpoint;
+    checkpoint.swap(m_pendingCheckpoint);
+    if (checkpoint.empty() && m_checkpointInterval > 0 && (m_tick + 1) % m_checkpointInterval == 0) {
+        checkpoint = m_checkpointDirectory;
+    }
+    if (!checkpoint.empty()) {
+        std::error_code error;
+        std::filesystem::create_directories(checkpoint, error);
+    }
+
+    std::vector<uint8_t> statsBlock;
+    appendPod(statsBlock, m_islandCount);
+    for (uint32_t i = 0; i < m_islandCount; ++i) {
+        appendStats(statsBlock, i, m_islandStats[i]);
+    }
+
+    for (uint32_t w = 0; w < m_workerCount; ++w) {
+        ArchipelagoMessage release;
+        release.type = ArchipelagoMessageType::RELEASE;
+        release.tick = m_tick;
+        release.payload = statsBlock;
+        release.payload.reserve(statsBlock.size() + m_inbox[w].size() + checkpoint.size() + 8);
+        appendPod(release.payload, m_inboxCounts[w]);
+        release.payload.insert(release.payload.end(), m_inbox[w].begin(), m_inbox[w].end());
+        appendPod(release.payload, static_cast<uint32_t>(checkpoint.size()));
+        release.payload.insert(release.payload.end(), checkpoint.begin(), checkpoint.end());
+
+        if (!m_transport.send(m_peerOfWorker[w], release)) {
+            m_lastError = "Lost worker " + std::to_string(w) + " at tick " + std::to_string(m_tick);
+            return false;
+        }
+    }
+
+    if (!checkpoint.empty() && !finishCheckpoint(checkpoint)) return false;
+
+    ++m_tick;
+    return true;
+}
+
+void ArchipelagoCoordinator::shutdown() {
+    ArchipelagoMessage message;
+    message.type = ArchipelagoMessageType::SHUTDOWN;
+    message.tick = m_tick;
+    for (int peer = 0; peer < m_transport.getPeerCount(); ++peer) {
+        m_transport.send(peer, message);
+    }
+}
+
+// ============================================================================
+// Coordinator Checkpoints
+// ============================================================================
+
+void ArchipelagoCoordinator::setCheckpointInterval(uint32_t ticks, const std::string& directory) {
+    m_checkpointInterval = ticks;
+    m_checkpointDirectory = directory;
+}
+
+void ArchipelagoCoordinator::requestCheckpoint(const std::string& directory) {
+    m_pendingCheckpoint = directory;
+}
+
+std::string ArchipelagoCoordinator::manifestPath(const std::string& directory) {
+    return directory + "/archipelago.ckpt";
+}
+
+bool ArchipelagoCoordinator::finishCheckpoint(const std::string& directory) {
+    // Shards are written after landing, so no migrant is in the coordinator's
+    // hands; crossings still at sea are in the shard of the worker sailing them
+    for (uint32_t w = 0; w < m_workerCount; ++w) {
+        ArchipelagoMessage done;
+        if (!m_transport.receive(m_peerOfWorker[w], done) ||
+            done.type != ArchipelagoMessageType::CHECKPOINT_DONE || done.payload.empty()) {
+            m_lastError = "Lost worker " + std::to_string(w) + " during checkpoint";
+            return false;
+        }
+        if (done.payload[0] == 0) {
+            m_lastError = "Worker " + std::to_string(w) + " failed to write its checkpoint shard";
+            return false;
+        }
+    }
+
+    // The manifest goes last: a directory without one holds no complete checkpoint
+    BinaryWriter writer;
+    if (!writer.open(manifestPath(directory))) {
+        m_lastError = "Failed to write " + manifestPath(directory);
+        return false;
+    }
+
+    writer.write(MANIFEST_MAGIC);
+    writer.write(CHECKPOINT_VERSION);
+    writer.write(creatureRecordFingerprint());
+    writer.write(m_tick);
+    writer.write(m_islandCount);
+    writer.write(m_workerCount);
+    for (const IslandStats& stats : m_islandStats) {
+        writer.writeRaw(&stats, sizeof(stats));
+    }
+
+    m_lastCheckpointTick = m_tick;
+    return true;
+}
+
+bool ArchipelagoCoordinator::restoreCheckpoint(const std::string& directory) {
+    BinaryReader reader;
+    if (!reader.open(manifestPath(directory))) {
+        m_lastError = "No checkpoint manifest in " + directory;
+        return false;
+    }
+
+    try {
+        if (reader.read<uint32_t>() != MANIFEST_MAGIC ||
+            reader.read<uint32_t>() != CHECKPOINT_VERSION ||
+            reader.read<uint32_t>() != creatureRecordFingerprint()) {
+            m_lastError = "Checkpoint was written by a different build";
+            return false;
+        }
+
+        const uint32_t tick = reader.read<uint32_t>();
+        if (reader.read<uint32_t>() != m_islandCount || reader.read<uint32_t>() != m_workerCount) {
+            m_lastError = "Checkpoint has a different island or worker count";
+            return false;
+        }
+
+        for (IslandStats& stats : m_islandStats) {
+            reader.readRaw(&stats, sizeof(stats));
+        }
+        if (!reader.good()) {
+            m_lastError = "Truncated checkpoint manifest";
+            return false;
+        }
+
+        m_tick = tick + 1;
+        m_lastCheckpointTick = tick;
+    } catch (const std::exception& e) {
+        m_lastError = e.what();
+        return false;
+    }
+
+    m_globalStats = MultiIslandManager::combineStats(m_islandStats);
+    return true;
+}
+
+} // namespace Forge
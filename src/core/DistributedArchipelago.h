@@ -0,0 +1,183 @@
+#pragma once
+
+// DistributedArchipelago - Runs one archipelago across several processes
+//
+// Every process builds the same island layout from the same archipelago.
+// Worker k of n then owns the islands with index % n == k and releases the
+// rest, so each process only holds terrain and creatures for its own share.
+// Workers advance in lockstep ticks: step owned islands and migration, then
+// report island stats and any migrants whose crossing ended on a remote
+// island. The coordinator waits for every report (the barrier), routes the
+// migrants to the owning workers, merges stats and releases the next tick.
+// Checkpoints are taken at the barrier, after migrants have landed; each
+// worker's shard also holds the crossings it still has at sea, and keeps
+// sleeping islands as their coarse models rather than waking them.
+//
+// Migrants and checkpointed creatures travel as compact creature records:
+// a fixed header, the genome's trait block, its neural weights and the
+// node and connection genes of the creature's NEAT brain. Trait block and
+// genes are copied in their in-memory layout, so every process has to run
+// the same build; HELLO carries a layout fingerprint and the coordinator
+// rejects workers that disagree.
+
+#include "ArchipelagoTransport.h"
+#include "MultiIslandManager.h"
+#include "../entities/behaviors/InterIslandMigration.h"
+#include <string>
+#include <vector>
+
+namespace Forge {
+
+// ============================================================================
+// Creature Records
+// ============================================================================
+
+struct CreatureRecordHeader {
+    uint32_t recordSize;        // Bytes including header, traits, weights and brain
+    uint32_t creatureId;
+    uint16_t sourceIsland;
+    uint16_t targetIsland;
+    uint8_t creatureType;       // CreatureType
+    uint8_t migrationType;      // MigrationType
+    uint16_t weightCount;
+    uint16_t brainNodeCount;    // 0 when the creature has no NEAT brain
+    uint16_t brainConnectionCount;
+    float energy;
+    float timeElapsed;          // Crossing time so far
+    float position[3];          // World position; a migrant's is re-picked on landing
+};
+
+// Identifies the record layout; processes exchanging records must agree
+uint32_t creatureRecordFingerprint();
+
+// Append one record for the creature carried by a migration event
+void writeCreatureRecord(const MigrationEvent& event, std::vector<uint8_t>& out);
+
+// Decode the record at offset and advance offset past it
+bool readCreatureRecord(const std::vector<uint8_t>& data, size_t& offset, MigrationEvent& out);
+
+// Header of the record at offset, without decoding the genome
+bool peekCreatureRecord(const std::vector<uint8_t>& data, size_t offset, CreatureRecordHeader& out);
+
+// ============================================================================
+// Worker
+// ============================================================================
+
+class ArchipelagoWorker {
+public:
+    ArchipelagoWorker(ArchipelagoTransport& transport, uint32_t workerIndex, uint32_t workerCount);
+
+    static bool ownsIsland(uint32_t islandIndex, uint32_t workerIndex, uint32_t workerCount) {
+        return workerCount == 0 || islandIndex % workerCount == workerIndex;
+    }
+
+    // Release the islands this worker does not own and send crossings that
+    // end on them through the transport. Call after MultiIslandManager::init()
+    // and before generateAll().
+    void attach(MultiIslandManager& islands, InterIslandMigration& migration);
+
+    // Introduce this worker to the coordinator
+    bool sendHello();
+
+    // Step owned islands and migration by one tick, then wait at the barrier.
+    // Returns false once the coordinator shuts down or goes away.
+    bool step(float deltaTime);
+
+    // Replace the creatures on owned islands with this worker's checkpoint
+    // shard. Islands must already be generated.
+    bool restoreCheckpoint(const std::string& directory);
+
+    static std::string shardPath(const std::string& directory, uint32_t workerIndex);
+
+    uint32_t getTick() const { return m_tick; }
+    bool isShutdown() const { return m_shutdown; }
+    int getMigrantsSent() const { return m_migrantsSent; }
+    int getMigrantsReceived() const { return m_migrantsReceived; }
+
+private:
+    ArchipelagoTransport& m_transport;
+    uint32_t m_workerIndex;
+    uint32_t m_workerCount;
+
+    MultiIslandManager* m_islands = nullptr;
+    InterIslandMigration* m_migration = nullptr;
+
+    uint32_t m_tick = 0;
+    bool m_shutdown = false;
+
+    // Records for crossings that ended on a remote island this tick
+    std::vector<uint8_t> m_outgoing;
+    uint32_t m_outgoingCount = 0;
+
+    int m_migrantsSent = 0;
+    int m_migrantsReceived = 0;
+
+    bool applyRelease(const ArchipelagoMessage& message);
+    bool writeCheckpoint(const std::string& directory);
+};
+
+// ============================================================================
+// Coordinator
+// ============================================================================
+
+class ArchipelagoCoordinator {
+public:
+    // One transport peer per worker
+    ArchipelagoCoordinator(ArchipelagoTransport& transport, uint32_t islandCount);
+
+    // Wait for HELLO from every worker and check they agree on the layout
+    bool waitForWorkers();
+
+    // One barrier: collect every worker's report, route migrants, merge
+    // stats, release the workers and, if one is due, finish a checkpoint
+    bool runTick();
+
+    // Checkpoint every interval ticks (0 disables) into directory
+    void setCheckpointInterval(uint32_t ticks, const std::string& directory);
+
+    // Checkpoint at the next barrier
+    void requestCheckpoint(const std::string& directory);
+
+    // Resume from a checkpoint manifest; workers restore their shards from
+    // the same directory. Call before waitForWorkers().
+    bool restoreCheckpoint(const std::string& directory);
+
+    void shutdown();
+
+    static std::string manifestPath(const std::string& directory);
+
+    uint32_t getTick() const { return m_tick; }
+    const IslandStats& getGlobalStats() const { return m_globalStats; }
+    const std::vector<IslandStats>& getIslandStats() const { return m_islandStats; }
+    int getMigrantsRouted() const { return m_migrantsRouted; }
+    uint32_t getLastCheckpointTick() const { return m_lastCheckpointTick; }
+    const std::string& getLastError() const { return m_lastError; }
+
+private:
+    ArchipelagoTransport& m_transport;
+    uint32_t m_islandCount;
+    uint32_t m_workerCount;
+
+    std::vector<int> m_peerOfWorker;     // Transport peer for each worker index
+
+    uint32_t m_tick = 0;
+    std::vector<IslandStats> m_islandStats;
+    IslandStats m_globalStats;
+    int m_migrantsRouted = 0;
+
+    // Incoming records per worker, rebuilt every tick
+    std::vector<std::vector<uint8_t>> m_inbox;
+    std::vector<uint32_t> m_inboxCounts;
+
+    uint32_t m_checkpointInterval = 0;
+    std::string m_checkpointDirectory;
+    std::string m_pendingCheckpoint;
+    uint32_t m_lastCheckpointTick = 0;
+
+    std::string m_lastError;
+
+    bool collectReport(uint32_t workerIndex);
+    bool finishCheckpoint(const std::string& directory);
+};
+
+} // namespace Forge
@@ -310,6 +310,10 @@ class RingBuffer {
         return m_data[idx];
     }
 
+    // i-th element counted from the oldest
+    const T& operator[](size_t i) const { return m_data[(m_head + i) % Capacity]; }
+    T& operator[](size_t i) { return m_data[(m_head + i) % Capacity]; }
+
     bool isEmpty() const { return m_count == 0; }
     bool isFull() const { return m_count == Capacity; }
     size_t size() const { return m_count; }
@@ -2,6 +2,7 @@
 #include "../environment/IslandGenerator.h"
 #include "../environment/ClimateSystem.h"
 #include "../graphics/Camera.h"
+#include "../utils/ThreadPool.h"
 #include <algorithm>
 #include <cmath>
 
@@ -57,14 +58,35 @@ void MultiIslandManager::initializeDX12(DX12Device* device, ID3D12PipelineState*
 }
 
 void MultiIslandManager::generateAll(unsigned int baseSeed) {
+    // Island height fields are independent of each other, so they are built
+    // concurrently. Mesh upload records onto the DX12 command list and logs,
+    // so it runs here on the calling thread; vegetation and creatures use
+    // shared RNG paths and follow in island order.
+    ThreadPool::shared().parallelFor(m_islands.size(), 1, [this](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            if (m_islands[i].terrain) {
+                m_islands[i].terrain->generateHeightField(m_islands[i].config.seed);
+            }
+        }
+    });
+
     for (size_t i = 0; i < m_islands.size(); ++i) {
         auto& island = m_islands[i];
 
-        // Generate terrain
-        generateIslandTerrain(island);
+        if (island.terrain) {
+            island.terrain->buildMesh();
+        }
+
+        // Generate vegetation on the finished terrain
+        if (island.vegetation) {
+            island.vegetation->generate(island.config.seed + 1);
+        }
+
+        if (island.isRemote) continue;
 
         // Populate with creatures
         populateIsland(island, baseSeed + static_cast<unsigned int>(i * 10000));
+        resetDetailedWindow(island);
 
         island.isLoaded = true;
     }
@@ -110,18 +132,6 @@ void MultiIslandManager::createIsland(const IslandConfig& config, uint32_t index
     m_islands.push_back(std::move(island));
 }
 
-void MultiIslandManager::generateIslandTerrain(Island& island) {
-    if (!island.terrain) return;
-
-    // Generate terrain with island-specific seed
-    island.terrain->generate(island.config.seed);
-
-    // Generate vegetation
-    if (island.vegetation) {
-        island.vegetation->generate(island.config.seed + 1);
-    }
-}
-
 void MultiIslandManager::populateIsland(Island& island, unsigned int seed) {
     if (!island.terrain || !island.creatures) return;
 
@@ -223,6 +233,10 @@ void MultiIslandManager::setActiveIsland(uint32_t index) {
         m_islands[i].isActive = (i == index);
     }
 
+    // The camera is here now
+    wakeIsland(index);
+    m_islands[index].idleTime = 0.0f;
+
     // Emit events
     if (previousActive != index) {
         if (previousActive < m_islands.size()) {
@@ -243,6 +257,22 @@ void MultiIslandManager::setActiveIsland(uint32_t index) {
     }
 }
 
+void MultiIslandManager::releaseIsland(uint32_t index) {
+    if (index >= m_islands.size()) return;
+
+    auto& island = m_islands[index];
+    island.vegetation.reset();
+    island.creatures.reset();
+    island.terrain.reset();
+    island.coarse.reset();
+    island.stats.reset();
+    island.isRemote = true;
+    island.isLoaded = false;
+    island.isActive = false;
+    island.needsUpdate = false;
+    m_globalStatsDirty = true;
+}
+
 int MultiIslandManager::findIslandAt(const glm::vec3& worldPos) const {
     glm::vec2 pos2D(worldPos.x, worldPos.z);
 
@@ -275,6 +305,8 @@ void MultiIslandManager::update(float deltaTime) {
     m_totalTime += deltaTime;
     m_globalStatsDirty = true;
 
+    // Work out which islands step this tick, and by how much
+    m_pendingSteps.clear();
     for (size_t i = 0; i < m_islands.size(); ++i) {
         auto& island = m_islands[i];
 
@@ -282,20 +314,47 @@ void MultiIslandManager::update(float deltaTime) {
 
         // Always update active island
         if (island.isActive && m_alwaysUpdateActive) {
-            updateIsland(static_cast<uint32_t>(i), deltaTime);
+            wakeIsland(static_cast<uint32_t>(i));
+            m_pendingSteps.push_back({static_cast<uint32_t>(i), deltaTime, island.stats.totalCreatures});
         }
-        // Update inactive islands at reduced rate
+        // Update inactive islands at reduced rate, each on its own clock
         else if (island.needsUpdate) {
-            // Update at 1/4 rate for inactive islands
-            static float accumulatedTime = 0.0f;
-            accumulatedTime += deltaTime;
+            island.accumulatedTime += deltaTime;
+
+            // Nobody has looked at this island for a while: let it sleep
+            if (m_coarseSimulation && !island.isSleeping()) {
+                island.idleTime += deltaTime;
+                if (island.idleTime > m_sleepAfter) {
+                    sleepIsland(static_cast<uint32_t>(i));
+                }
+            }
 
-            if (accumulatedTime > 0.1f) {  // Update every 100ms
-                updateIsland(static_cast<uint32_t>(i), accumulatedTime);
-                accumulatedTime = 0.0f;
+            if (island.accumulatedTime > INACTIVE_UPDATE_INTERVAL) {
+                m_pendingSteps.push_back({static_cast<uint32_t>(i), island.accumulatedTime,
+                                          island.stats.totalCreatures});
+                island.accumulatedTime = 0.0f;
             }
         }
     }
+
+    // Each island owns its terrain and creatures, so islands step as
+    // independent tasks
+    ThreadPool::shared().parallelFor(m_pendingSteps.size(), 1, [this](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const IslandStep& step = m_pendingSteps[i];
+            stepIsland(m_islands[step.index], step.deltaTime);
+        }
+    });
+
+    // Barrier: sleeping islands advance here, since their genome reservoirs
+    // mutate through the shared Random engine; events go out in island order
+    for (const IslandStep& step : m_pendingSteps) {
+        Island& island = m_islands[step.index];
+        if (island.isSleeping()) {
+            stepCoarseIsland(island, step.deltaTime);
+        }
+        emitPopulationEvents(step.index, step.previousCreatureCount);
+    }
 }
 
 void MultiIslandManager::updateIsland(uint32_t index, float deltaTime) {
@@ -308,11 +367,102 @@ void MultiIslandManager::updateIsland(uint32_t index, float deltaTime) {
     // Store previous stats for event detection
     int prevCreatureCount = island.stats.totalCreatures;
 
+    if (island.isSleeping()) {
+        stepCoarseIsland(island, deltaTime);
+    } else {
+        stepIsland(island, deltaTime);
+    }
+    emitPopulationEvents(index, prevCreatureCount);
+}
+
+void MultiIslandManager::stepIsland(Island& island, float deltaTime) {
+    if (!island.creatures || island.isSleeping()) return;
+
     // Update creature manager
     island.creatures->update(deltaTime);
+    island.detailedTime += deltaTime;
 
     // Update statistics
     updateIslandStats(island);
+}
+
+void MultiIslandManager::stepCoarseIsland(Island& island, float deltaTime) {
+    if (!island.coarse) return;
+
+    island.coarse->advance(deltaTime);
+    updateIslandStats(island);
+}
+
+// ============================================================================
+// Coarse Simulation
+// ============================================================================
+
+void MultiIslandManager::resetDetailedWindow(Island& island) {
+    island.detailedTime = 0.0f;
+    island.birthsAtWake = island.creatures ? island.creatures->getStats().births : 0;
+    island.deathsAtWake = island.creatures ? island.creatures->getStats().deaths : 0;
+}
+
+void MultiIslandManager::sleepIsland(uint32_t index) {
+    if (index >= m_islands.size()) return;
+
+    auto& island = m_islands[index];
+    if (!island.isLoaded || !island.creatures || island.isSleeping()) return;
+
+    // Per-capita rates over the detailed window, if it was long enough to mean anything
+    const PopulationStats& population = island.creatures->getStats();
+    float birthRate = -1.0f;
+    float deathRate = -1.0f;
+    if (island.detailedTime >= MIN_RATE_WINDOW && population.alive > 0) {
+        float exposure = population.alive * island.detailedTime;
+        birthRate = (population.births - island.birthsAtWake) / exposure;
+        deathRate = (population.deaths - island.deathsAtWake) / exposure;
+    }
+
+    // Refresh diversity while the creatures are still here; the model keeps it
+    updateIslandStats(island);
+
+    island.coarse = std::make_unique<CoarseIslandModel>();
+    island.coarse->capture(*island.creatures, birthRate, deathRate,
+                           static_cast<float>(m_maxCreaturesPerIsland),
+                           island.config.seed ^ static_cast<uint32_t>(static_cast<uint64_t>(m_totalTime * 1000.0)));
+    island.creatures->clear();
+
+    updateIslandStats(island);
+    m_globalStatsDirty = true;
+}
+
+void MultiIslandManager::wakeIsland(uint32_t index) {
+    if (index >= m_islands.size()) return;
+
+    auto& island = m_islands[index];
+    island.idleTime = 0.0f;
+    if (!island.coarse || !island.creatures || !island.terrain) return;
+
+    island.creatures->clear();
+    island.coarse->rehydrate(*island.creatures, *island.terrain);
+    island.coarse.reset();
+
+    resetDetailedWindow(island);
+    updateIslandStats(island);
+    m_globalStatsDirty = true;
+}
+
+void MultiIslandManager::restoreSleepingIsland(uint32_t index, std::unique_ptr<CoarseIslandModel> model) {
+    if (index >= m_islands.size() || !model) return;
+
+    auto& island = m_islands[index];
+    if (island.creatures) {
+        island.creatures->clear();
+    }
+    island.coarse = std::move(model);
+
+    updateIslandStats(island);
+    m_globalStatsDirty = true;
+}
+
+void MultiIslandManager::emitPopulationEvents(uint32_t index, int prevCreatureCount) {
+    auto& island = m_islands[index];
 
     // Detect significant events
     int newCount = island.stats.totalCreatures;
@@ -348,8 +498,22 @@ void MultiIslandManager::updateStatistics() {
 }
 
 void MultiIslandManager::updateIslandStats(Island& island) {
+    const float lastDiversity = island.stats.geneticDiversity;
     island.stats.reset();
 
+    if (island.coarse) {
+        // No creatures to measure; diversity keeps its last detailed value
+        const CoarseIslandModel& model = *island.coarse;
+        island.stats.totalCreatures = model.getPopulation();
+        island.stats.avgFitness = model.getMeanFitness();
+        island.stats.avgEnergy = model.getMeanEnergy();
+        island.stats.births = model.getBirths();
+        island.stats.deaths = model.getDeaths();
+        island.stats.geneticDiversity = lastDiversity;
+        island.stats.speciesCount = model.getLivingSpeciesCount();
+        return;
+    }
+
     if (!island.creatures) return;
 
     const auto& popStats = island.creatures->getStats();
@@ -458,7 +622,9 @@ void MultiIslandManager::renderForShadow(const Camera& camera, ID3D12GraphicsCom
 int MultiIslandManager::getTotalCreatureCount() const {
     int total = 0;
     for (const auto& island : m_islands) {
-        if (island.creatures) {
+        if (island.coarse) {
+            total += island.coarse->getPopulation();
+        } else if (island.creatures) {
             total += island.creatures->getTotalPopulation();
         }
     }
@@ -467,7 +633,9 @@ int MultiIslandManager::getTotalCreatureCount() const {
 
 int MultiIslandManager::getCreatureCount(uint32_t islandIndex) const {
     const auto* island = getIsland(islandIndex);
-    if (!island || !island->creatures) return 0;
+    if (!island) return 0;
+    if (island->coarse) return island->coarse->getPopulation();
+    if (!island->creatures) return 0;
     return island->creatures->getTotalPopulation();
 }
 
@@ -477,6 +645,7 @@ CreatureHandle MultiIslandManager::spawnCreature(uint32_t islandIndex, CreatureT
     auto* island = getIsland(islandIndex);
     if (!island || !island->creatures) return CreatureHandle::invalid();
 
+    wakeIsland(islandIndex);
     return island->creatures->spawn(type, localPosition, parentGenome);
 }
 
@@ -488,6 +657,8 @@ bool MultiIslandManager::transferCreature(uint32_t fromIsland, uint32_t toIsland
     if (!srcIsland || !dstIsland) return false;
     if (!srcIsland->creatures || !dstIsland->creatures) return false;
 
+    wakeIsland(toIsland);
+
     // Get the creature
     Creature* creature = srcIsland->creatures->get(handle);
     if (!creature || !creature->isAlive()) return false;
@@ -583,40 +754,57 @@ const IslandStats& MultiIslandManager::getIslandStats(uint32_t index) const {
 IslandStats MultiIslandManager::getGlobalStats() const {
     if (!m_globalStatsDirty) return m_globalStatsCache;
 
-    m_globalStatsCache.reset();
+    std::vector<IslandStats> perIsland;
+    perIsland.reserve(m_islands.size());
+    for (const auto& island : m_islands) {
+        perIsland.push_back(island.stats);
+    }
+
+    m_globalStatsCache = combineStats(perIsland);
+    m_globalStatsDirty = false;
+    return m_globalStatsCache;
+}
+
+void MultiIslandManager::setIslandStats(uint32_t index, const IslandStats& stats) {
+    if (index >= m_islands.size()) return;
+    m_islands[index].stats = stats;
+    m_globalStatsDirty = true;
+}
+
+IslandStats MultiIslandManager::combineStats(const std::vector<IslandStats>& perIsland) {
+    IslandStats combined;
 
     int totalCount = 0;
     float totalFitness = 0.0f;
     float totalEnergy = 0.0f;
     float totalDiversity = 0.0f;
 
-    for (const auto& island : m_islands) {
-        m_globalStatsCache.totalCreatures += island.stats.totalCreatures;
-        m_globalStatsCache.speciesCount += island.stats.speciesCount;
-        m_globalStatsCache.births += island.stats.births;
-        m_globalStatsCache.deaths += island.stats.deaths;
-        m_globalStatsCache.immigrations += island.stats.immigrations;
-        m_globalStatsCache.emigrations += island.stats.emigrations;
-
-        if (island.stats.totalCreatures > 0) {
-            totalFitness += island.stats.avgFitness * island.stats.totalCreatures;
-            totalEnergy += island.stats.avgEnergy * island.stats.totalCreatures;
-            totalDiversity += island.stats.geneticDiversity;
-            totalCount += island.stats.totalCreatures;
+    for (const auto& stats : perIsland) {
+        combined.totalCreatures += stats.totalCreatures;
+        combined.speciesCount += stats.speciesCount;
+        combined.births += stats.births;
+        combined.deaths += stats.deaths;
+        combined.immigrations += stats.immigrations;
+        combined.emigrations += stats.emigrations;
+
+        if (stats.totalCreatures > 0) {
+            totalFitness += stats.avgFitness * stats.totalCreatures;
+            totalEnergy += stats.avgEnergy * stats.totalCreatures;
+            totalDiversity += stats.geneticDiversity;
+            totalCount += stats.totalCreatures;
         }
     }
 
     if (totalCount > 0) {
-        m_globalStatsCache.avgFitness = totalFitness / totalCount;
-        m_globalStatsCache.avgEnergy = totalEnergy / totalCount;
+        combined.avgFitness = totalFitness / totalCount;
+        combined.avgEnergy = totalEnergy / totalCount;
     }
 
-    if (!m_islands.empty()) {
-        m_globalStatsCache.geneticDiversity = totalDiversity / m_islands.size();
+    if (!perIsland.empty()) {
+        combined.geneticDiversity = totalDiversity / perIsland.size();
     }
 
-    m_globalStatsDirty = false;
-    return m_globalStatsCache;
+    return combined;
 }
 
 float MultiIslandManager::getGeneticDistance(uint32_t islandA, uint32_t islandB) const {
@@ -7,6 +7,7 @@
 #include "../environment/Terrain.h"
 #include "../environment/VegetationManager.h"
 #include "CreatureManager.h"
+#include "CoarseIslandModel.h"
 #include <glm/glm.hpp>
 #include <vector>
 #include <memory>
@@ -75,6 +76,23 @@ struct Island {
     bool isLoaded = false;
     bool isActive = false;
     bool needsUpdate = true;
+    bool isRemote = false;          // Simulated by another process (see DistributedArchipelago)
+
+    // Simulation time not yet stepped (inactive islands update at a reduced rate)
+    float accumulatedTime = 0.0f;
+
+    // Coarse ("far") simulation: set while the island sleeps, in which case
+    // creatures is empty and stats come from the model
+    std::unique_ptr<CoarseIslandModel> coarse;
+    float idleTime = 0.0f;          // Unobserved detailed time since last woken
+
+    // Detailed time and birth/death counters since last woken, from which
+    // the coarse model's rates are measured
+    float detailedTime = 0.0f;
+    int birthsAtWake = 0;
+    int deathsAtWake = 0;
+
+    bool isSleeping() const { return coarse != nullptr; }
 
     // Transform from local to world coordinates
     glm::vec3 localToWorld(const glm::vec3& localPos) const {
@@ -191,11 +209,18 @@ class MultiIslandManager {
     // Find island containing world position
     int findIslandAt(const glm::vec3& worldPos) const;
 
+    // Drop an island's terrain, creatures and vegetation and mark it remote.
+    // Distributed workers call this for islands another process owns, before
+    // generateAll(); the island keeps its layout so distances still work.
+    void releaseIsland(uint32_t index);
+
     // ========================================================================
     // Update
     // ========================================================================
 
-    // Update all active islands
+    // Update all active islands. Islands due a step this tick are stepped in
+    // parallel, one ThreadPool task each; events are emitted afterwards in
+    // island order.
     void update(float deltaTime);
 
     // Update specific island (for LOD/streaming)
@@ -204,6 +229,26 @@ class MultiIslandManager {
     // Update statistics for all islands
     void updateStatistics();
 
+    // ========================================================================
+    // Coarse Simulation
+    // ========================================================================
+
+    // Inactive islands left unobserved for sleepAfter seconds switch to a
+    // statistical per-species model (CoarseIslandModel) and are rehydrated
+    // into creatures when they become active or a migrant lands. Off by default.
+    void setCoarseSimulationEnabled(bool enabled) { m_coarseSimulation = enabled; }
+    bool isCoarseSimulationEnabled() const { return m_coarseSimulation; }
+    void setSleepAfter(float seconds) { m_sleepAfter = seconds; }
+
+    // Summarise an island's creatures and put it to sleep
+    void sleepIsland(uint32_t index);
+
+    // Respawn a sleeping island's creatures from its model; no-op if awake
+    void wakeIsland(uint32_t index);
+
+    // Put an island to sleep on a model read back from a checkpoint
+    void restoreSleepingIsland(uint32_t index, std::unique_ptr<CoarseIslandModel> model);
+
     // ========================================================================
     // Rendering
     // ========================================================================
@@ -256,6 +301,12 @@ class MultiIslandManager {
     const IslandStats& getIslandStats(uint32_t index) const;
     IslandStats getGlobalStats() const;
 
+    // Overwrite an island's statistics (remote islands, reported by their owner)
+    void setIslandStats(uint32_t index, const IslandStats& stats);
+
+    // Archipelago-wide totals and population-weighted averages
+    static IslandStats combineStats(const std::vector<IslandStats>& perIsland);
+
     // Get genetic distance between islands
     float getGeneticDistance(uint32_t islandA, uint32_t islandB) const;
 
@@ -307,6 +358,20 @@ class MultiIslandManager {
     // LOD/Update settings
     float m_inactiveUpdateRadius = 500.0f;  // Distance from camera to update inactive islands
     bool m_alwaysUpdateActive = true;
+    static constexpr float INACTIVE_UPDATE_INTERVAL = 0.1f;  // Seconds between inactive island steps
+
+    // Coarse simulation
+    bool m_coarseSimulation = false;
+    float m_sleepAfter = 30.0f;                         // Unobserved seconds before sleeping
+    static constexpr float MIN_RATE_WINDOW = 10.0f;     // Detailed seconds needed to trust measured rates
+
+    // Islands stepped this tick
+    struct IslandStep {
+        uint32_t index;
+        float deltaTime;
+        int previousCreatureCount;
+    };
+    std::vector<IslandStep> m_pendingSteps;
 
     // Events
     std::vector<EventCallback> m_eventCallbacks;
@@ -322,11 +387,18 @@ class MultiIslandManager {
 
     // Helper methods
     void createIsland(const IslandConfig& config, uint32_t index);
-    void generateIslandTerrain(Island& island);
     void populateIsland(Island& island, unsigned int seed);
 
     void emitEvent(const IslandEvent& event);
 
+    // Island-local part of a step; touches nothing outside the island, so
+    // different islands may be stepped concurrently. Sleeping islands are
+    // skipped here and advanced by stepCoarseIsland() on the calling thread.
+    void stepIsland(Island& island, float deltaTime);
+    void stepCoarseIsland(Island& island, float deltaTime);
+    void resetDetailedWindow(Island& island);
+    void emitPopulationEvents(uint32_t index, int previousCreatureCount);
+
     // Statistics helpers
     void updateIslandStats(Island& island);
     float calculateGeneticDiversity(const Island& island) const;
@@ -73,63 +73,22 @@ static SensoryGenome createSensoryGenome(const Genome& g) {
 }
 
 Creature::Creature(const glm::vec3& position, const Genome& genome, CreatureType type)
-    : position(position), velocity(0.0f), rotation(0.0f), wanderTarget(1.0f, 0.0f, 0.0f),
-      m_wanderAngle(0.0f),  // Per-instance wander angle (thread-safe)
-      genome(genome), diploidGenome(),  // Initialize diploidGenome with default
-      sensory(createSensoryGenome(genome)), type(type), currentTime(0.0f),
-      energy(100.0f), age(0.0f), alive(true), sterile(false), fitnessModifier(1.0f),
-      generation(0), id(nextID++),
-      fitness(0.0f), foodEaten(0), distanceTraveled(0.0f),
-      fear(0.0f), huntingCooldown(0.0f), killCount(0), beingHunted(false),
-      m_lastRotation(0.0f) {  // PHASE 11 - Agent 9: Initialize rotation tracking
-
-    brain = std::make_unique<NeuralNetwork>(genome.neuralWeights);
-
-    // Initialize NEAT brain by default - neural network drives behavior!
-    initializeNEATBrain();
-
-    // Configure steering behaviors based on genome (kept as fallback)
-    SteeringBehaviors::Config config;
-    config.maxSpeed = genome.speed;
-    config.maxForce = genome.speed * 0.5f;
-    config.fleeDistance = genome.visionRange * 0.8f;
-    config.separationDistance = genome.size * 3.0f;
-    config.alignmentDistance = genome.visionRange * 0.4f;
-    config.cohesionDistance = genome.visionRange * 0.5f;
-    steering.setConfig(config);
-
-    // Generate species display name based on genome traits
-    m_speciesDisplayName = naming::getNameGenerator().generateNameWithSeed(genome, type, static_cast<uint32_t>(id));
-}
+    : Creature(position, Genome(genome), type, BrainBuffers{}) {}
 
 Creature::Creature(const glm::vec3& position, const Genome& parent1, const Genome& parent2, CreatureType type)
+    : Creature(position, Genome(parent1, parent2), type, BrainBuffers{}) {}
+
+Creature::Creature(const glm::vec3& position, Genome&& offspringGenome, CreatureType type, BrainBuffers&& recycled)
     : position(position), velocity(0.0f), rotation(0.0f), wanderTarget(1.0f, 0.0f, 0.0f),
       m_wanderAngle(0.0f),  // Per-instance wander angle (thread-safe)
-      genome(parent1, parent2), diploidGenome(),  // Initialize diploidGenome with default
+      genome(std::move(offspringGenome)), diploidGenome(),  // Initialize diploidGenome with default
       sensory(createSensoryGenome(genome)), type(type), currentTime(0.0f),
       energy(100.0f), age(0.0f), alive(true), sterile(false), fitnessModifier(1.0f),
       generation(0), id(nextID++),
       fitness(0.0f), foodEaten(0), distanceTraveled(0.0f),
-      fear(0.0f), huntingCooldown(0.0f), killCount(0), beingHunted(false),
-      m_lastRotation(0.0f) {  // PHASE 11 - Agent 9: Initialize rotation tracking
-
-    brain = std::make_unique<NeuralNetwork>(genome.neuralWeights);
-
-    // Initialize NEAT brain by default - neural network drives behavior!
-    initializeNEATBrain();
-
-    // Configure steering behaviors based on genome (kept as fallback)
-    SteeringBehaviors::Config config;
-    config.maxSpeed = genome.speed;
-    config.maxForce = genome.speed * 0.5f;
-    config.fleeDistance = genome.visionRange * 0.8f;
-    config.separationDistance = genome.size * 3.0f;
-    config.alignmentDistance = genome.visionRange * 0.4f;
-    config.cohesionDistance = genome.visionRange * 0.5f;
-    steering.setConfig(config);
-
-    // Generate species display name based on genome traits
-    m_speciesDisplayName = naming::getNameGenerator().generateNameWithSeed(genome, type, static_cast<uint32_t>(id));
+      fear(0.0f), huntingCooldown(0.0f), killCount(0), beingHunted(false) {
+    // Reuse the dead creature's brain objects when we were handed any
+    finishConstruction(&recycled);
 }
 
 // Helper to sync legacy Genome from DiploidGenome
@@ -165,79 +124,49 @@ static Genome syncGenomeFromDiploid(const genetics::DiploidGenome& dg) {
 }
 
 Creature::Creature(const glm::vec3& position, const genetics::DiploidGenome& dg, CreatureType type)
+    : Creature(position, genetics::DiploidGenome(dg), type) {}
+
+Creature::Creature(const glm::vec3& position, genetics::DiploidGenome&& dg, CreatureType type)
     : position(position), velocity(0.0f), rotation(0.0f), wanderTarget(1.0f, 0.0f, 0.0f),
       m_wanderAngle(0.0f),  // Per-instance wander angle (thread-safe)
-      genome(syncGenomeFromDiploid(dg)), diploidGenome(dg),
+      genome(syncGenomeFromDiploid(dg)), diploidGenome(std::move(dg)),
       sensory(createSensoryGenome(genome)), type(type), currentTime(0.0f),
       energy(100.0f), age(0.0f), alive(true), sterile(false), fitnessModifier(1.0f),
       generation(0), id(nextID++),
       fitness(0.0f), foodEaten(0), distanceTraveled(0.0f),
-      fear(0.0f), huntingCooldown(0.0f), killCount(0), beingHunted(false),
-      m_lastRotation(0.0f) {  // PHASE 11 - Agent 9: Initialize rotation tracking
-
-    brain = std::make_unique<NeuralNetwork>(genome.neuralWeights);
-
-    // Initialize NEAT brain by default - neural network drives behavior!
-    initializeNEATBrain();
-
-    // Configure steering behaviors based on diploid genome (kept as fallback)
-    SteeringBehaviors::Config config;
-    config.maxSpeed = diploidGenome.getTrait(genetics::GeneType::SPEED);
-    config.maxForce = config.maxSpeed * 0.5f;
-    config.fleeDistance = diploidGenome.getTrait(genetics::GeneType::VISION_RANGE) * 0.8f;
-    config.separationDistance = diploidGenome.getTrait(genetics::GeneType::SIZE) * 3.0f;
-    config.alignmentDistance = diploidGenome.getTrait(genetics::GeneType::VISION_RANGE) * 0.4f;
-    config.cohesionDistance = diploidGenome.getTrait(genetics::GeneType::VISION_RANGE) * 0.5f;
-    steering.setConfig(config);
+      fear(0.0f), huntingCooldown(0.0f), killCount(0), beingHunted(false) {
+    finishConstruction(nullptr);
 
     // Apply genetic load as fitness modifier
     fitnessModifier = 1.0f - diploidGenome.getGeneticLoad() * 0.1f;
-
-    // Generate species display name based on genome traits
-    m_speciesDisplayName = naming::getNameGenerator().generateNameWithSeed(genome, type, static_cast<uint32_t>(id));
 }
 
 Creature::Creature(const glm::vec3& position, const genetics::DiploidGenome& parent1,
                    const genetics::DiploidGenome& parent2, CreatureType type)
-    : position(position), velocity(0.0f), rotation(0.0f), wanderTarget(1.0f, 0.0f, 0.0f),
-      m_wanderAngle(0.0f),  // Per-instance wander angle (thread-safe)
-      genome(),  // Default-initialized, will be set in constructor body
-      diploidGenome(parent1, parent2),  // Sexual reproduction
-      sensory(),  // Default-initialized, will be set in constructor body
-      type(type), currentTime(0.0f),
-      energy(100.0f), age(0.0f), alive(true), sterile(false), fitnessModifier(1.0f),
-      generation(0), id(nextID++),
-      fitness(0.0f), foodEaten(0), distanceTraveled(0.0f),
-      fear(0.0f), huntingCooldown(0.0f), killCount(0), beingHunted(false),
-      m_lastRotation(0.0f) {  // PHASE 11 - Agent 9: Initialize rotation tracking
-
-    // Sync legacy genome from new diploid genome - MUST be first
-    genome = syncGenomeFromDiploid(diploidGenome);
-    sensory = SensorySystem(createSensoryGenome(genome));
-
-    brain = std::make_unique<NeuralNetwork>(genome.neuralWeights);
-
-    // Initialize NEAT brain by default - neural network drives behavior!
-    initializeNEATBrain();
-
-    // Configure steering behaviors (kept as fallback)
-    SteeringBehaviors::Config config;
-    config.maxSpeed = diploidGenome.getTrait(genetics::GeneType::SPEED);
-    config.maxForce = config.maxSpeed * 0.5f;
-    config.fleeDistance = diploidGenome.getTrait(genetics::GeneType::VISION_RANGE) * 0.8f;
-    config.separationDistance = diploidGenome.getTrait(genetics::GeneType::SIZE) * 3.0f;
-    config.alignmentDistance = diploidGenome.getTrait(genetics::GeneType::VISION_RANGE) * 0.4f;
-    config.cohesionDistance = diploidGenome.getTrait(genetics::GeneType::VISION_RANGE) * 0.5f;
-    steering.setConfig(config);
-
-    // Apply genetic load and hybrid effects
-    fitnessModifier = 1.0f - diploidGenome.getGeneticLoad() * 0.1f;
-
+    : Creature(position, genetics::DiploidGenome(parent1, parent2), type) {  // Sexual reproduction
     // Inherit hybrid status
     if (parent1.isHybrid() || parent2.isHybrid() ||
         parent1.getSpeciesId() != parent2.getSpeciesId()) {
         diploidGenome.setHybrid(true);
     }
+}
+
+// Shared tail of every constructor: the legacy genome is final by now (synced
+// from the diploid genome where there is one), so brains, steering and the
+// display name all derive from it.
+void Creature::finishConstruction(BrainBuffers* recycled) {
+    // Initialize NEAT brain by default - neural network drives behavior!
+    initializeBrains(recycled);
+
+    // Configure steering behaviors based on genome (kept as fallback)
+    SteeringBehaviors::Config config;
+    config.maxSpeed = genome.speed;
+    config.maxForce = genome.speed * 0.5f;
+    config.fleeDistance = genome.visionRange * 0.8f;
+    config.separationDistance = genome.size * 3.0f;
+    config.alignmentDistance = genome.visionRange * 0.4f;
+    config.cohesionDistance = genome.visionRange * 0.5f;
+    steering.setConfig(config);
 
     // Generate species display name based on genome traits
     m_speciesDisplayName = naming::getNameGenerator().generateNameWithSeed(genome, type, static_cast<uint32_t>(id));
@@ -2503,8 +2432,24 @@ float Creature::getReproductionUrge() const {
 // NEAT BRAIN INTEGRATION - Evolved topology neural networks
 // =============================================================================
 
+void Creature::initializeBrains(BrainBuffers* recycled) {
+    if (recycled && recycled->brain) {
+        brain = std::move(recycled->brain);
+        brain->setWeights(genome.neuralWeights);
+    } else {
+        brain = std::make_unique<NeuralNetwork>(genome.neuralWeights);
+    }
+
+    if (recycled && recycled->neatBrain) {
+        m_neatBrain = std::move(recycled->neatBrain);
+    }
+    initializeNEATBrain();
+}
+
 void Creature::initializeNEATBrain() {
-    m_neatBrain = std::make_unique<ai::CreatureBrainInterface>();
+    if (!m_neatBrain) {
+        m_neatBrain = std::make_unique<ai::CreatureBrainInterface>();
+    }
     // 27 inputs (expanded sensory) and 10 outputs (expanded motor control)
     // This creates a neural network that actually DRIVES creature behavior
     m_neatBrain->initialize(ai::CreatureBrainInterface::BrainType::NEAT_EVOLVED,
@@ -31,6 +31,23 @@ class Creature {
     Creature(const glm::vec3& position, const genetics::DiploidGenome& diploidGenome, CreatureType type = CreatureType::HERBIVORE);
     Creature(const glm::vec3& position, const genetics::DiploidGenome& parent1, const genetics::DiploidGenome& parent2, CreatureType type = CreatureType::HERBIVORE);
 
+    // Heap-backed brain objects a dead creature hands back to CreatureManager
+    // so the next birth can re-initialize them instead of reallocating.
+    struct BrainBuffers {
+        std::unique_ptr<NeuralNetwork> brain;
+        std::unique_ptr<ai::CreatureBrainInterface> neatBrain;
+    };
+
+    // Move-based constructors: take ownership of an already-built offspring genome
+    // (and optionally recycled brain buffers) without copying it.
+    Creature(const glm::vec3& position, Genome&& offspringGenome, CreatureType type, BrainBuffers&& recycled);
+    Creature(const glm::vec3& position, genetics::DiploidGenome&& diploidGenome, CreatureType type = CreatureType::HERBIVORE);
+
+    // Strip reusable buffers from a creature whose slot is being released.
+    // The creature must not be used afterwards.
+    Genome releaseGenome() { return std::move(genome); }
+    BrainBuffers releaseBrainBuffers() { return BrainBuffers{std::move(brain), std::move(m_neatBrain)}; }
+
     void update(float deltaTime, const Terrain& terrain, const std::vector<glm::vec3>& foodPositions,
                 const std::vector<Creature*>& otherCreatures, const SpatialGrid* spatialGrid = nullptr,
                 const EnvironmentConditions* envConditions = nullptr,
@@ -114,7 +131,7 @@ class Creature {
 
     // Initialize NEAT brain from genome (called by evolution manager)
     void initializeNEATBrain(const ai::NEATGenome& genome);
-    void initializeNEATBrain();  // Create minimal NEAT brain
+    void initializeNEATBrain();  // Create minimal NEAT brain (reuses an existing brain object)
 
     // Get NEAT genome for reproduction
     const ai::NEATGenome& getNEATGenome() const;
@@ -306,6 +323,11 @@ class Creature {
     static constexpr float attackCooldown = 0.5f;
     static constexpr float killEnergyGain = 120.0f;
 
+    // Creates (or re-initializes recycled) legacy and NEAT brains from the genome
+    void initializeBrains(BrainBuffers* recycled);
+    // Brains, steering config and display name; shared tail of every constructor
+    void finishConstruction(BrainBuffers* recycled);
+
     void updatePhysics(float deltaTime, const Terrain& terrain);
     void updateBehaviorHerbivore(float deltaTime, const std::vector<glm::vec3>& foodPositions,
                                   const std::vector<Creature*>& otherCreatures, const SpatialGrid* grid,
@@ -82,8 +82,8 @@ std::vector<FoodSource> EcosystemBehaviors::getAvailableFood(
 
     // Scavengers get carrion
     if (traits.diet == DietType::CARRION && decomposers) {
-        auto corpsePositions = decomposers->getCorpsePositions();
-        for (const auto& pos : corpsePositions) {
+        for (const Corpse* corpse : decomposers->queryCorpses(position, visionRange)) {
+            const glm::vec3& pos = corpse->position;
             float dist = glm::length(glm::vec2(pos.x - position.x, pos.z - position.z));
             if (dist < visionRange) {
                 FoodSource source;
@@ -4,15 +4,24 @@
 
 NeuralNetwork::NeuralNetwork(const std::vector<float>& weights)
     : weights(weights) {
+    padWeights(weights.size());
+}
+
+void NeuralNetwork::setWeights(const std::vector<float>& newWeights) {
+    weights.assign(newWeights.begin(), newWeights.end());
+    padWeights(newWeights.size());
+}
+
+void NeuralNetwork::padWeights(size_t providedCount) {
     // Ensure we have enough weights for the network
     // Required: (inputCount * hiddenCount) + (hiddenCount * outputCount) = 8*8 + 8*6 = 112 weights
     const size_t requiredWeights = static_cast<size_t>(inputCount * hiddenCount + hiddenCount * outputCount);
-    if (this->weights.size() < requiredWeights) {
+    if (weights.size() < requiredWeights) {
         // Pad with small random-ish values based on index (deterministic)
-        this->weights.resize(requiredWeights);
-        for (size_t i = weights.size(); i < requiredWeights; i++) {
+        weights.resize(requiredWeights);
+        for (size_t i = providedCount; i < requiredWeights; i++) {
             // Simple deterministic initialization: small values based on index
-            this->weights[i] = (static_cast<float>(i % 17) - 8.0f) * 0.1f;
+            weights[i] = (static_cast<float>(i % 17) - 8.0f) * 0.1f;
         }
     }
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 // Neural network outputs for behavior modulation
@@ -138,6 +139,10 @@ class NeuralNetwork {
 public:
     NeuralNetwork(const std::vector<float>& weights);
 
+    // Re-initialize with new weights, reusing the existing weight buffer
+    // (used when a recycled network is handed to a newborn creature)
+    void setWeights(const std::vector<float>& newWeights);
+
     // Legacy method - Returns movement direction (angle) and speed multiplier
     void process(const std::vector<float>& inputs, float& outAngle, float& outSpeed);
 
@@ -156,6 +161,7 @@ class NeuralNetwork {
 
     float sigmoid(float x);
     float tanh(float x);
+    void padWeights(size_t providedCount);
 };
 
 // =============================================================================
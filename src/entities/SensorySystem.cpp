@@ -979,33 +979,22 @@ PheromoneGrid::PheromoneGrid(float worldSize, float cellSize)
     : worldSize(worldSize), cellSize(cellSize),
       evaporationRate(0.05f), diffusionRate(0.02f) {
     gridSize = static_cast<int>(worldSize / cellSize);
-    grid.resize(gridSize * gridSize);
+    for (auto& layer : layers) {
+        layer.resize(gridSize * cellSize, gridSize);
+    }
 }
 
 void PheromoneGrid::deposit(const glm::vec3& position, PheromoneType type, float strength) {
-    int idx = positionToIndex(position);
-    if (idx >= 0 && idx < static_cast<int>(grid.size())) {
-        grid[idx].concentrations[type] += strength;
-        grid[idx].concentrations[type] = std::min(1.0f, grid[idx].concentrations[type]);
-    }
+    layers[static_cast<int>(type)].deposit(position.x, position.z, strength, 1.0f);
 }
 
 float PheromoneGrid::sample(const glm::vec3& position, PheromoneType type) const {
-    int idx = positionToIndex(position);
-    if (idx >= 0 && idx < static_cast<int>(grid.size())) {
-        auto it = grid[idx].concentrations.find(type);
-        if (it != grid[idx].concentrations.end()) {
-            return it->second;
-        }
-    }
-    return 0.0f;
+    return layers[static_cast<int>(type)].sample(position.x, position.z);
 }
 
 glm::vec3 PheromoneGrid::getGradient(const glm::vec3& position, PheromoneType type) const {
-    float dx = sample(position + glm::vec3(cellSize, 0, 0), type) -
-               sample(position - glm::vec3(cellSize, 0, 0), type);
-    float dz = sample(position + glm::vec3(0, 0, cellSize), type) -
-               sample(position - glm::vec3(0, 0, cellSize), type);
+    float dx, dz;
+    layers[static_cast<int>(type)].gradient(position.x, position.z, 1, dx, dz);
 
     glm::vec3 gradient(dx, 0.0f, dz);
     if (glm::length(gradient) > 0.001f) {
@@ -1015,46 +1004,19 @@ glm::vec3 PheromoneGrid::getGradient(const glm::vec3& position, PheromoneType ty
 }
 
 void PheromoneGrid::update(float deltaTime) {
-    // Simple evaporation
-    for (auto& cell : grid) {
-        for (auto& [type, concentration] : cell.concentrations) {
-            concentration *= (1.0f - evaporationRate * deltaTime);
-            if (concentration < 0.01f) {
-                concentration = 0.0f;
-            }
-        }
+    // Spread to neighbouring cells, then evaporate; faint traces drop to zero
+    float keep = 1.0f - evaporationRate * deltaTime;
+    for (auto& layer : layers) {
+        layer.step(diffusionRate * deltaTime, keep, 0.0f, 0.01f);
     }
 }
 
 void PheromoneGrid::clear() {
-    for (auto& cell : grid) {
-        cell.concentrations.clear();
+    for (auto& layer : layers) {
+        layer.clear();
     }
 }
 
-int PheromoneGrid::positionToIndex(const glm::vec3& position) const {
-    float halfWorld = worldSize / 2.0f;
-    int x = static_cast<int>((position.x + halfWorld) / cellSize);
-    int z = static_cast<int>((position.z + halfWorld) / cellSize);
-
-    x = std::clamp(x, 0, gridSize - 1);
-    z = std::clamp(z, 0, gridSize - 1);
-
-    return z * gridSize + x;
-}
-
-glm::vec3 PheromoneGrid::indexToPosition(int index) const {
-    int x = index % gridSize;
-    int z = index / gridSize;
-    float halfWorld = worldSize / 2.0f;
-
-    return glm::vec3(
-        x * cellSize - halfWorld + cellSize / 2.0f,
-        0.0f,
-        z * cellSize - halfWorld + cellSize / 2.0f
-    );
-}
-
 // ============================================================================
 // SoundManager Implementation
 // ============================================================================
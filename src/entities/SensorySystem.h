@@ -1,6 +1,8 @@
 #pragma once
 
+#include "../utils/DiffusionField.h"
 #include <glm/glm.hpp>
+#include <array>
 #include <vector>
 #include <memory>
 #include <unordered_map>
@@ -46,16 +48,7 @@ enum class PheromoneType {
     MATING,          // "I'm available for reproduction"
     AGGREGATION      // "Gather here"
 };
-
-// Hash specialization for PheromoneType (required for std::unordered_map)
-namespace std {
-    template <>
-    struct hash<PheromoneType> {
-        size_t operator()(PheromoneType type) const {
-            return hash<int>()(static_cast<int>(type));
-        }
-    };
-}
+constexpr int PHEROMONE_TYPE_COUNT = 5;
 
 // Types of sounds
 enum class SoundType {
@@ -320,7 +313,9 @@ class SensorySystem {
                                   const glm::vec3& toTarget) const;
 };
 
-// Global pheromone grid for environment-based communication
+// Global pheromone grid for environment-based communication.
+// One dense concentration layer per pheromone type; update() cost depends on
+// the grid size only, and layers with nothing deposited are skipped.
 class PheromoneGrid {
 public:
     PheromoneGrid(float worldSize, float cellSize);
@@ -332,20 +327,15 @@ class PheromoneGrid {
     void update(float deltaTime);  // Evaporation and diffusion
     void clear();
 
-private:
-    struct PheromoneCell {
-        std::unordered_map<PheromoneType, float> concentrations;
-    };
+    const DiffusionField& getLayer(PheromoneType type) const { return layers[static_cast<int>(type)]; }
 
+private:
     float worldSize;
     float cellSize;
     int gridSize;
-    std::vector<PheromoneCell> grid;
+    std::array<DiffusionField, PHEROMONE_TYPE_COUNT> layers;
     float evaporationRate;
     float diffusionRate;
-
-    int positionToIndex(const glm::vec3& position) const;
-    glm::vec3 indexToPosition(int index) const;
 };
 
 // Sound propagation manager
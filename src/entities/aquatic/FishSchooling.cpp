@@ -1,10 +1,16 @@
 #include "FishSchooling.h"
+#include "../../utils/ThreadPool.h"
 #include <algorithm>
+#include <cfloat>
 #include <cmath>
 #include <random>
-#include <execution>
 #include <iostream>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FISH_SCHOOLING_SSE2 1
+#endif
+
 #ifdef _WIN32
 #include <d3d12.h>
 #include <d3dcompiler.h>
@@ -134,6 +140,7 @@ bool FishSchoolingManager::initialize(ID3D12Device* device, uint32_t maxFish) {
     m_device = device;
     m_maxFish = maxFish;
     m_fish.reserve(maxFish);
+    m_fishNext.reserve(maxFish);
 
     if (device) {
         m_useGPU = createComputePipeline(device) && createBuffers(device);
@@ -321,195 +328,246 @@ void FishSchoolingManager::updateCPU(float deltaTime) {
     // Rebuild spatial hash
     m_spatialGrid.build(m_fish);
 
-    // Parallel update if enough fish
-    if (m_fish.size() > 100) {
-        std::vector<uint32_t> indices(m_fish.size());
-        for (uint32_t i = 0; i < m_fish.size(); ++i) indices[i] = i;
-
-        // Thread-local neighbor buffers
-        std::for_each(std::execution::par_unseq, indices.begin(), indices.end(),
-            [this, deltaTime](uint32_t i) {
-                thread_local std::vector<uint32_t> neighbors;
-                neighbors.clear();
-
-                float maxRadius = std::max({m_config.separationRadius,
-                                           m_config.alignmentRadius,
-                                           m_config.cohesionRadius});
-
-                m_spatialGrid.queryNeighborsIntoBuffer(m_fish[i].position, maxRadius, neighbors);
-
-                glm::vec3 steering(0.0f);
-                steering += calculateSeparation(i, neighbors);
-                steering += calculateAlignment(i, neighbors);
-                steering += calculateCohesion(i, neighbors);
-                steering += calculatePredatorAvoidance(i);
-                steering += calculateFoodAttraction(i);
-                steering += calculateWander(i, deltaTime);
-                steering += calculateBoundaryAvoidance(i);
-                steering += calculateDepthCorrection(i);
-
-                integrateMotion(i, steering, deltaTime);
-                updateSwimAnimation(i, deltaTime);
-            });
-    } else {
-        std::vector<uint32_t> neighbors;
-
-        for (uint32_t i = 0; i < m_fish.size(); ++i) {
-            neighbors.clear();
-
-            float maxRadius = std::max({m_config.separationRadius,
-                                       m_config.alignmentRadius,
-                                       m_config.cohesionRadius});
-
-            m_spatialGrid.queryNeighborsIntoBuffer(m_fish[i].position, maxRadius, neighbors);
-
-            glm::vec3 steering(0.0f);
-            steering += calculateSeparation(i, neighbors);
-            steering += calculateAlignment(i, neighbors);
-            steering += calculateCohesion(i, neighbors);
-            steering += calculatePredatorAvoidance(i);
-            steering += calculateFoodAttraction(i);
-            steering += calculateWander(i, deltaTime);
-            steering += calculateBoundaryAvoidance(i);
-            steering += calculateDepthCorrection(i);
+    // Every fish reads only m_fish and writes only its own slot of
+    // m_fishNext, so chunks can run on any thread in any order
+    const size_t count = m_fish.size();
+    m_fishNext.resize(count);
 
-            integrateMotion(i, steering, deltaTime);
-            updateSwimAnimation(i, deltaTime);
+    auto updateRange = [this, deltaTime](size_t begin, size_t end) {
+        NeighborBatch batch;
+        for (size_t i = begin; i < end; ++i) {
+            stepFish(static_cast<uint32_t>(i), deltaTime, batch, m_fishNext[i]);
         }
+    };
+    if (m_parallelUpdate) {
+        ThreadPool::shared().parallelFor(count, UPDATE_CHUNK, updateRange);
+    } else {
+        updateRange(0, count);
     }
 
+    m_fish.swap(m_fishNext);
+
     propagatePanic(deltaTime);
     assignToSchools();
 }
 
-glm::vec3 FishSchoolingManager::calculateSeparation(uint32_t fishIndex,
-                                                    const std::vector<uint32_t>& neighbors) {
-    const FishState& fish = m_fish[fishIndex];
-    glm::vec3 steering(0.0f);
-    int count = 0;
+void FishSchoolingManager::stepFish(uint32_t fishIndex, float deltaTime, NeighborBatch& batch,
+                                    FishState& next) const {
+    next = m_fish[fishIndex];
+
+    float maxRadius = std::max({m_config.separationRadius,
+                               m_config.alignmentRadius,
+                               m_config.cohesionRadius});
 
-    float radius = m_config.separationRadius;
-    float radiusSq = radius * radius;
+    m_spatialGrid.queryNeighborsIntoBuffer(next.position, maxRadius, batch.indices);
+    gatherNeighbors(next, fishIndex, batch);
 
-    for (uint32_t neighborIdx : neighbors) {
+    glm::vec3 steering(0.0f);
+    steering += calculateSchoolingSteering(next, batch);
+    steering += calculatePredatorAvoidance(next);
+    steering += calculateFoodAttraction(next);
+    steering += calculateWander(fishIndex, deltaTime);
+    steering += calculateBoundaryAvoidance(next);
+    steering += calculateDepthCorrection(next);
+
+    integrateMotion(next, steering, deltaTime);
+    updateSwimAnimation(next, deltaTime);
+}
+
+void FishSchoolingManager::gatherNeighbors(const FishState& fish, uint32_t fishIndex,
+                                           NeighborBatch& batch) const {
+    const size_t capacity = batch.indices.size();
+    batch.x.resize(capacity);
+    batch.y.resize(capacity);
+    batch.z.resize(capacity);
+    batch.vx.resize(capacity);
+    batch.vy.resize(capacity);
+    batch.vz.resize(capacity);
+    batch.sameSchool.resize(capacity);
+
+    // The grid query returns whole cells; keep only fish inside the widest
+    // rule radius so the kernel doesn't process the cube's corners
+    float maxRadius = std::max({m_config.separationRadius,
+                               m_config.alignmentRadius,
+                               m_config.cohesionRadius});
+    const float maxRadiusSq = maxRadius * maxRadius;
+
+    size_t count = 0;
+    for (uint32_t neighborIdx : batch.indices) {
         if (neighborIdx == fishIndex) continue;
 
         const FishState& neighbor = m_fish[neighborIdx];
         glm::vec3 diff = fish.position - neighbor.position;
-        float distSq = glm::dot(diff, diff);
-
-        if (distSq < radiusSq && distSq > 0.0001f) {
-            float dist = std::sqrt(distSq);
-            // Weight by inverse distance (closer = stronger repulsion)
-            steering += glm::normalize(diff) * (1.0f - dist / radius);
-            count++;
-        }
+        if (glm::dot(diff, diff) >= maxRadiusSq) continue;
+
+        batch.x[count] = neighbor.position.x;
+        batch.y[count] = neighbor.position.y;
+        batch.z[count] = neighbor.position.z;
+        batch.vx[count] = neighbor.velocity.x;
+        batch.vy[count] = neighbor.velocity.y;
+        batch.vz[count] = neighbor.velocity.z;
+
+        // Only align and cohere with same school
+        bool sameSchool = neighbor.schoolId == fish.schoolId || fish.schoolId == 0;
+        batch.sameSchool[count] = sameSchool ? 1.0f : 0.0f;
+        count++;
     }
+    batch.count = count;
+}
 
-    if (count > 0) {
-        steering /= static_cast<float>(count);
-        steering *= m_config.separationWeight * fish.separationWeight;
+glm::vec3 FishSchoolingManager::calculateSchoolingSteering(const FishState& fish,
+                                                           const NeighborBatch& batch) const {
+    const size_t count = batch.count;
+    const float separationRadius = m_config.separationRadius;
+    const float separationRadiusSq = separationRadius * separationRadius;
+    const float alignmentRadiusSq = m_config.alignmentRadius * m_config.alignmentRadius;
+    const float cohesionRadiusSq = m_config.cohesionRadius * m_config.cohesionRadius;
+
+    // Accumulators: separation xyz + count, velocity sum xyz + count,
+    // position sum xyz + count
+    float sums[12] = {};
+    size_t i = 0;
+
+#if defined(FISH_SCHOOLING_SSE2)
+    {
+        const __m128 px = _mm_set1_ps(fish.position.x);
+        const __m128 py = _mm_set1_ps(fish.position.y);
+        const __m128 pz = _mm_set1_ps(fish.position.z);
+        const __m128 sepRadius = _mm_set1_ps(separationRadius);
+        const __m128 sepRadiusSq = _mm_set1_ps(separationRadiusSq);
+        const __m128 aliRadiusSq = _mm_set1_ps(alignmentRadiusSq);
+        const __m128 cohRadiusSq = _mm_set1_ps(cohesionRadiusSq);
+        const __m128 minDistSq = _mm_set1_ps(0.0001f);
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 zero = _mm_setzero_ps();
+
+        __m128 acc[12];
+        for (auto& a : acc) a = zero;
+
+        for (; i + 4 <= count; i += 4) {
+            __m128 nx = _mm_loadu_ps(batch.x.data() + i);
+            __m128 ny = _mm_loadu_ps(batch.y.data() + i);
+            __m128 nz = _mm_loadu_ps(batch.z.data() + i);
+            __m128 dx = _mm_sub_ps(px, nx);
+            __m128 dy = _mm_sub_ps(py, ny);
+            __m128 dz = _mm_sub_ps(pz, nz);
+            __m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)),
+                                       _mm_mul_ps(dz, dz));
+
+            // Separation: normalize(diff) * (1 - dist / radius); masked lanes
+            // may hold inf/NaN before the and, never after
+            __m128 sepMask = _mm_and_ps(_mm_cmplt_ps(distSq, sepRadiusSq), _mm_cmpgt_ps(distSq, minDistSq));
+            __m128 dist = _mm_sqrt_ps(distSq);
+            __m128 weight = _mm_div_ps(_mm_sub_ps(one, _mm_div_ps(dist, sepRadius)), dist);
+            weight = _mm_and_ps(sepMask, weight);
+            acc[0] = _mm_add_ps(acc[0], _mm_mul_ps(dx, weight));
+            acc[1] = _mm_add_ps(acc[1], _mm_mul_ps(dy, weight));
+            acc[2] = _mm_add_ps(acc[2], _mm_mul_ps(dz, weight));
+            acc[3] = _mm_add_ps(acc[3], _mm_and_ps(sepMask, one));
+
+            __m128 school = _mm_cmpgt_ps(_mm_loadu_ps(batch.sameSchool.data() + i), zero);
+
+            __m128 aliMask = _mm_and_ps(school, _mm_cmplt_ps(distSq, aliRadiusSq));
+            acc[4] = _mm_add_ps(acc[4], _mm_and_ps(aliMask, _mm_loadu_ps(batch.vx.data() + i)));
+            acc[5] = _mm_add_ps(acc[5], _mm_and_ps(aliMask, _mm_loadu_ps(batch.vy.data() + i)));
+            acc[6] = _mm_add_ps(acc[6], _mm_and_ps(aliMask, _mm_loadu_ps(batch.vz.data() + i)));
+            acc[7] = _mm_add_ps(acc[7], _mm_and_ps(aliMask, one));
+
+            __m128 cohMask = _mm_and_ps(school, _mm_cmplt_ps(distSq, cohRadiusSq));
+            acc[8] = _mm_add_ps(acc[8], _mm_and_ps(cohMask, nx));
+            acc[9] = _mm_add_ps(acc[9], _mm_and_ps(cohMask, ny));
+            acc[10] = _mm_add_ps(acc[10], _mm_and_ps(cohMask, nz));
+            acc[11] = _mm_add_ps(acc[11], _mm_and_ps(cohMask, one));
+        }
 
-        // Limit force
-        float len = glm::length(steering);
-        if (len > m_config.separationMaxForce) {
-            steering = steering / len * m_config.separationMaxForce;
+        // Lanes are reduced in a fixed order
+        for (int k = 0; k < 12; ++k) {
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, acc[k]);
+            sums[k] = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
         }
     }
+#endif
 
-    return steering;
-}
-
-glm::vec3 FishSchoolingManager::calculateAlignment(uint32_t fishIndex,
-                                                   const std::vector<uint32_t>& neighbors) {
-    const FishState& fish = m_fish[fishIndex];
-    glm::vec3 averageVelocity(0.0f);
-    int count = 0;
-
-    float radius = m_config.alignmentRadius;
-    float radiusSq = radius * radius;
-
-    for (uint32_t neighborIdx : neighbors) {
-        if (neighborIdx == fishIndex) continue;
-
-        const FishState& neighbor = m_fish[neighborIdx];
-
-        // Only align with same school
-        if (neighbor.schoolId != fish.schoolId && fish.schoolId != 0) continue;
-
-        glm::vec3 diff = fish.position - neighbor.position;
-        float distSq = glm::dot(diff, diff);
+    for (; i < count; ++i) {
+        float dx = fish.position.x - batch.x[i];
+        float dy = fish.position.y - batch.y[i];
+        float dz = fish.position.z - batch.z[i];
+        float distSq = dx * dx + dy * dy + dz * dz;
 
-        if (distSq < radiusSq) {
-            averageVelocity += neighbor.velocity;
-            count++;
+        if (distSq < separationRadiusSq && distSq > 0.0001f) {
+            float dist = std::sqrt(distSq);
+            float weight = (1.0f - dist / separationRadius) / dist;
+            sums[0] += dx * weight;
+            sums[1] += dy * weight;
+            sums[2] += dz * weight;
+            sums[3] += 1.0f;
+        }
+        if (batch.sameSchool[i] > 0.0f) {
+            if (distSq < alignmentRadiusSq) {
+                sums[4] += batch.vx[i];
+                sums[5] += batch.vy[i];
+                sums[6] += batch.vz[i];
+                sums[7] += 1.0f;
+            }
+            if (distSq < cohesionRadiusSq) {
+                sums[8] += batch.x[i];
+                sums[9] += batch.y[i];
+                sums[10] += batch.z[i];
+                sums[11] += 1.0f;
+            }
         }
     }
 
-    glm::vec3 steering(0.0f);
-    if (count > 0) {
-        averageVelocity /= static_cast<float>(count);
-        steering = averageVelocity - fish.velocity;
-        steering *= m_config.alignmentWeight * fish.alignmentWeight;
+    // Separation - weight by inverse distance (closer = stronger repulsion)
+    glm::vec3 separation(0.0f);
+    if (sums[3] > 0.0f) {
+        separation = glm::vec3(sums[0], sums[1], sums[2]) / sums[3];
+        separation *= m_config.separationWeight * fish.separationWeight;
 
-        float len = glm::length(steering);
-        if (len > m_config.alignmentMaxForce) {
-            steering = steering / len * m_config.alignmentMaxForce;
+        // Limit force
+        float len = glm::length(separation);
+        if (len > m_config.separationMaxForce) {
+            separation = separation / len * m_config.separationMaxForce;
         }
     }
 
-    return steering;
-}
-
-glm::vec3 FishSchoolingManager::calculateCohesion(uint32_t fishIndex,
-                                                  const std::vector<uint32_t>& neighbors) {
-    const FishState& fish = m_fish[fishIndex];
-    glm::vec3 centerOfMass(0.0f);
-    int count = 0;
+    // Alignment - steer towards average neighbour velocity
+    glm::vec3 alignment(0.0f);
+    if (sums[7] > 0.0f) {
+        glm::vec3 averageVelocity = glm::vec3(sums[4], sums[5], sums[6]) / sums[7];
+        alignment = averageVelocity - fish.velocity;
+        alignment *= m_config.alignmentWeight * fish.alignmentWeight;
 
-    float radius = m_config.cohesionRadius;
-    float radiusSq = radius * radius;
-
-    for (uint32_t neighborIdx : neighbors) {
-        if (neighborIdx == fishIndex) continue;
-
-        const FishState& neighbor = m_fish[neighborIdx];
-
-        // Only cohere with same school
-        if (neighbor.schoolId != fish.schoolId && fish.schoolId != 0) continue;
-
-        glm::vec3 diff = fish.position - neighbor.position;
-        float distSq = glm::dot(diff, diff);
-
-        if (distSq < radiusSq) {
-            centerOfMass += neighbor.position;
-            count++;
+        float len = glm::length(alignment);
+        if (len > m_config.alignmentMaxForce) {
+            alignment = alignment / len * m_config.alignmentMaxForce;
         }
     }
 
-    glm::vec3 steering(0.0f);
-    if (count > 0) {
-        centerOfMass /= static_cast<float>(count);
+    // Cohesion - steer towards neighbours' center of mass
+    glm::vec3 cohesion(0.0f);
+    if (sums[11] > 0.0f) {
+        glm::vec3 centerOfMass = glm::vec3(sums[8], sums[9], sums[10]) / sums[11];
         glm::vec3 desired = centerOfMass - fish.position;
 
         float dist = glm::length(desired);
         if (dist > 0.001f) {
             // Modulate by distance - farther away = stronger pull
-            float factor = std::min(dist / radius, 1.0f);
-            steering = glm::normalize(desired) * factor * m_config.cohesionWeight * fish.cohesionWeight;
+            float factor = std::min(dist / m_config.cohesionRadius, 1.0f);
+            cohesion = glm::normalize(desired) * factor * m_config.cohesionWeight * fish.cohesionWeight;
 
-            float len = glm::length(steering);
+            float len = glm::length(cohesion);
             if (len > m_config.cohesionMaxForce) {
-                steering = steering / len * m_config.cohesionMaxForce;
+                cohesion = cohesion / len * m_config.cohesionMaxForce;
             }
         }
     }
 
-    return steering;
+    return separation + alignment + cohesion;
 }
 
-glm::vec3 FishSchoolingManager::calculatePredatorAvoidance(uint32_t fishIndex) {
-    const FishState& fish = m_fish[fishIndex];
+glm::vec3 FishSchoolingManager::calculatePredatorAvoidance(FishState& fish) const {
     glm::vec3 steering(0.0f);
 
     float detectionRange = m_config.predatorDetectionRange;
@@ -529,16 +587,14 @@ glm::vec3 FishSchoolingManager::calculatePredatorAvoidance(uint32_t fishIndex) {
             steering += glm::normalize(diff) * urgency * threatLevel * m_config.predatorFleeForce;
 
             // Increase panic level
-            m_fish[fishIndex].panicLevel = std::min(m_fish[fishIndex].panicLevel + urgency * 0.5f, 1.0f);
+            fish.panicLevel = std::min(fish.panicLevel + urgency * 0.5f, 1.0f);
         }
     }
 
     return steering;
 }
 
-glm::vec3 FishSchoolingManager::calculateFoodAttraction(uint32_t fishIndex) {
-    const FishState& fish = m_fish[fishIndex];
-
+glm::vec3 FishSchoolingManager::calculateFoodAttraction(const FishState& fish) const {
     // Don't seek food when panicked
     if (fish.panicLevel > 0.5f) return glm::vec3(0.0f);
 
@@ -578,9 +634,7 @@ glm::vec3 FishSchoolingManager::calculateFoodAttraction(uint32_t fishIndex) {
     return steering;
 }
 
-glm::vec3 FishSchoolingManager::calculateWander(uint32_t fishIndex, float deltaTime) {
-    FishState& fish = m_fish[fishIndex];
-
+glm::vec3 FishSchoolingManager::calculateWander(uint32_t fishIndex, float deltaTime) const {
     // Simple wander using noise
     float seed = fishIndex * 0.1f + m_time * 0.5f;
     float noiseX = std::sin(seed * 1.3f) * std::cos(seed * 0.7f);
@@ -593,8 +647,7 @@ glm::vec3 FishSchoolingManager::calculateWander(uint32_t fishIndex, float deltaT
     return wander;
 }
 
-glm::vec3 FishSchoolingManager::calculateBoundaryAvoidance(uint32_t fishIndex) {
-    const FishState& fish = m_fish[fishIndex];
+glm::vec3 FishSchoolingManager::calculateBoundaryAvoidance(const FishState& fish) const {
     glm::vec3 steering(0.0f);
 
     float margin = 20.0f;
@@ -624,8 +677,7 @@ glm::vec3 FishSchoolingManager::calculateBoundaryAvoidance(uint32_t fishIndex) {
     return steering;
 }
 
-glm::vec3 FishSchoolingManager::calculateDepthCorrection(uint32_t fishIndex) {
-    FishState& fish = m_fish[fishIndex];
+glm::vec3 FishSchoolingManager::calculateDepthCorrection(const FishState& fish) const {
     glm::vec3 steering(0.0f);
 
     float currentDepth = -fish.position.y;
@@ -640,9 +692,8 @@ glm::vec3 FishSchoolingManager::calculateDepthCorrection(uint32_t fishIndex) {
     return steering;
 }
 
-void FishSchoolingManager::integrateMotion(uint32_t fishIndex, const glm::vec3& steering,
-                                          float deltaTime) {
-    FishState& fish = m_fish[fishIndex];
+void FishSchoolingManager::integrateMotion(FishState& fish, const glm::vec3& steering,
+                                          float deltaTime) const {
 
     // Apply acceleration limit
     glm::vec3 acceleration = steering;
@@ -706,8 +757,7 @@ void FishSchoolingManager::integrateMotion(uint32_t fishIndex, const glm::vec3&
     fish.age += deltaTime;
 }
 
-void FishSchoolingManager::updateSwimAnimation(uint32_t fishIndex, float deltaTime) {
-    FishState& fish = m_fish[fishIndex];
+void FishSchoolingManager::updateSwimAnimation(FishState& fish, float deltaTime) const {
 
     // Swim phase based on speed and genome
     float frequency = 2.0f + fish.speed * 0.3f;
@@ -723,10 +773,10 @@ void FishSchoolingManager::updateSwimAnimation(uint32_t fishIndex, float deltaTi
 
 void FishSchoolingManager::propagatePanic(float deltaTime) {
     // Fish can spread panic to nearby fish
+    std::vector<uint32_t> neighbors;
     for (size_t i = 0; i < m_fish.size(); ++i) {
         if (m_fish[i].panicLevel < 0.3f) continue;
 
-        std::vector<uint32_t> neighbors;
         m_spatialGrid.queryNeighborsIntoBuffer(m_fish[i].position,
                                                m_config.panicSpreadRadius, neighbors);
 
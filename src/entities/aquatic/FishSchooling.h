@@ -5,6 +5,8 @@
 #include <vector>
 #include <memory>
 #include <unordered_map>
+#include <string>
+#include <cstddef>
 #include <cstdint>
 
 // Forward declarations for DX12
@@ -102,7 +104,7 @@ struct alignas(16) FishState {
     float maxSpeed;
 };
 
-static_assert(sizeof(FishState) == 96, "FishState must be 96 bytes for GPU alignment");
+static_assert(sizeof(FishState) == 112, "FishState must be 112 bytes for GPU alignment");
 
 // ============================================================================
 // School Data Structure
@@ -261,12 +263,18 @@ class FishSchoolingManager {
     // Update - CPU fallback or GPU dispatch
     void update(float deltaTime);
     void updateCPU(float deltaTime);
+
+    // Run updateCPU in chunks on ThreadPool::shared(). Results are identical
+    // to serial mode.
+    void setParallelUpdate(bool enabled) { m_parallelUpdate = enabled; }
+    bool isParallelUpdate() const { return m_parallelUpdate; }
     void updateGPU(ID3D12GraphicsCommandList* commandList, float deltaTime);
 
     // Sync GPU results back to CPU
     void syncFromGPU(ID3D12GraphicsCommandList* commandList);
 
-    // Accessors
+    // Accessors. updateCPU swaps in a new fish buffer, so references and
+    // pointers into it are only valid until the next update.
     const std::vector<FishState>& getFish() const { return m_fish; }
     std::vector<FishState>& getFish() { return m_fish; }
     const std::vector<School>& getSchools() const { return m_schools; }
@@ -295,18 +303,33 @@ class FishSchoolingManager {
                             float& outCohesion, float& outPanicLevel) const;
 
 private:
-    // CPU simulation
-    glm::vec3 calculateSeparation(uint32_t fishIndex, const std::vector<uint32_t>& neighbors);
-    glm::vec3 calculateAlignment(uint32_t fishIndex, const std::vector<uint32_t>& neighbors);
-    glm::vec3 calculateCohesion(uint32_t fishIndex, const std::vector<uint32_t>& neighbors);
-    glm::vec3 calculatePredatorAvoidance(uint32_t fishIndex);
-    glm::vec3 calculateFoodAttraction(uint32_t fishIndex);
-    glm::vec3 calculateWander(uint32_t fishIndex, float deltaTime);
-    glm::vec3 calculateBoundaryAvoidance(uint32_t fishIndex);
-    glm::vec3 calculateDepthCorrection(uint32_t fishIndex);
-
-    void integrateMotion(uint32_t fishIndex, const glm::vec3& steering, float deltaTime);
-    void updateSwimAnimation(uint32_t fishIndex, float deltaTime);
+    // CPU simulation. Fish are stepped from the current state (m_fish, read
+    // only during the step) into m_fishNext, one slot per fish, so the order
+    // and threading of the step can't change the result.
+    static constexpr size_t UPDATE_CHUNK = 256;     // Fish per parallelFor chunk
+
+    // Neighbour attributes gathered as SoA for the steering kernel
+    struct NeighborBatch {
+        std::vector<uint32_t> indices;
+        std::vector<float> x, y, z;
+        std::vector<float> vx, vy, vz;
+        std::vector<float> sameSchool;  // 1 if alignment/cohesion apply to this neighbour
+        size_t count = 0;               // Gathered neighbours; arrays may be longer
+    };
+
+    void stepFish(uint32_t fishIndex, float deltaTime, NeighborBatch& batch, FishState& next) const;
+    void gatherNeighbors(const FishState& fish, uint32_t fishIndex, NeighborBatch& batch) const;
+
+    // Separation + alignment + cohesion in one pass over the gathered neighbours
+    glm::vec3 calculateSchoolingSteering(const FishState& fish, const NeighborBatch& batch) const;
+    glm::vec3 calculatePredatorAvoidance(FishState& fish) const;
+    glm::vec3 calculateFoodAttraction(const FishState& fish) const;
+    glm::vec3 calculateWander(uint32_t fishIndex, float deltaTime) const;
+    glm::vec3 calculateBoundaryAvoidance(const FishState& fish) const;
+    glm::vec3 calculateDepthCorrection(const FishState& fish) const;
+
+    void integrateMotion(FishState& fish, const glm::vec3& steering, float deltaTime) const;
+    void updateSwimAnimation(FishState& fish, float deltaTime) const;
     void propagatePanic(float deltaTime);
     void assignToSchools();
 
@@ -317,6 +340,7 @@ class FishSchoolingManager {
 
     // Data
     std::vector<FishState> m_fish;
+    std::vector<FishState> m_fishNext;  // Back buffer written by updateCPU
     std::vector<School> m_schools;
     std::unordered_map<uint32_t, uint32_t> m_schoolMap;  // schoolId -> index
 
@@ -337,6 +361,7 @@ class FishSchoolingManager {
     uint32_t m_frameNumber = 0;
     float m_time = 0.0f;
     bool m_useGPU = false;
+    bool m_parallelUpdate = true;
 
     // DX12 resources
     ID3D12Device* m_device = nullptr;
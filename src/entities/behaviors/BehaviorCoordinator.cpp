@@ -7,8 +7,17 @@
 #include "../../environment/BiomeSystem.h"
 #include "../../environment/Terrain.h"
 #include <glm/gtc/constants.hpp>
+#include <algorithm>
+#include <chrono>
 #include <sstream>
 
+namespace {
+    constexpr size_t SUBSYSTEM_COUNT = static_cast<size_t>(BehaviorSubsystem::COUNT);
+
+    // Weight of the newest measurement in a subsystem's smoothed cost
+    constexpr float COST_SMOOTHING = 0.2f;
+} // namespace
+
 BehaviorCoordinator::BehaviorCoordinator() {
     // Default weights
     m_weights.territorial = 1.0f;
@@ -17,6 +26,15 @@ BehaviorCoordinator::BehaviorCoordinator() {
     m_weights.migration = 2.0f;
     m_weights.parental = 1.2f;
     m_weights.fleeFromPredator = 3.0f;
+
+    // Default cadences. Hunting already plans on its own timer and only
+    // interpolates per tick; territories and variety events are sliced.
+    setSchedule(BehaviorSubsystem::TERRITORIAL, 0.0f, 0.25f, 8);
+    setSchedule(BehaviorSubsystem::SOCIAL, 0.1f, 0.5f, 1);
+    setSchedule(BehaviorSubsystem::HUNTING, 0.0f, 0.5f, 1);
+    setSchedule(BehaviorSubsystem::MIGRATION, 0.5f, 0.25f, 1);
+    setSchedule(BehaviorSubsystem::PARENTAL, 0.1f, 0.25f, 1);
+    setSchedule(BehaviorSubsystem::VARIETY, 0.0f, 0.25f, 8);
 }
 
 void BehaviorCoordinator::init(CreatureManager* creatureManager,
@@ -44,6 +62,7 @@ void BehaviorCoordinator::init(CreatureManager* creatureManager,
 void BehaviorCoordinator::reset() {
     // Reset all subsystems to initial state
     m_territorialBehavior = TerritorialBehavior();
+    m_territorialBehavior.getConfig().updateSlices = getSchedule(BehaviorSubsystem::TERRITORIAL).slices;
     m_socialGroups = SocialGroupManager();
     m_packHunting = PackHuntingBehavior();
     m_migration = MigrationBehavior();
@@ -60,6 +79,14 @@ void BehaviorCoordinator::reset() {
         m_varietyBehaviors.init(m_creatureManager, m_spatialGrid);
     }
 
+    for (auto& schedule : m_schedules) {
+        schedule.pending = 0.0f;
+        schedule.costMs = 0.0f;
+        schedule.deferrals = 0;
+    }
+    m_scheduleCursor = 0;
+    m_varietyEventCursor = 0;
+
     m_currentTime = 0.0f;
 }
 
@@ -70,81 +97,174 @@ void BehaviorCoordinator::update(float deltaTime) {
 
     m_currentTime += deltaTime;
 
-    // Update each behavior system
-    // Order matters: territorial first, then social (which may depend on territories),
-    // then hunting (depends on social groups), then migration/parental
+    // Pick the due subsystems, round-robin from the cursor, until the frame
+    // budget is reserved. Disabled subsystems do not bank time.
+    std::array<bool, SUBSYSTEM_COUNT> selected{};
+    float reservedMs = 0.0f;
+    bool anySelected = false;
+    size_t firstDeferred = SUBSYSTEM_COUNT;
 
-    if (m_territorialEnabled) {
-        m_territorialBehavior.update(deltaTime, *m_creatureManager, *m_spatialGrid);
+    for (size_t k = 0; k < SUBSYSTEM_COUNT; ++k) {
+        const size_t i = (m_scheduleCursor + k) % SUBSYSTEM_COUNT;
+        SubsystemSchedule& schedule = m_schedules[i];
+
+        if (!isSubsystemEnabled(static_cast<BehaviorSubsystem>(i))) {
+            schedule.pending = 0.0f;
+            continue;
+        }
+
+        schedule.pending += deltaTime;
+        if (schedule.pending < schedule.interval || schedule.pending <= 0.0f) continue;
+
+        const float costMs = std::max(schedule.budgetMs, schedule.costMs);
+        if (anySelected && reservedMs + costMs > m_frameBudgetMs) {
+            schedule.deferrals++;
+            if (firstDeferred == SUBSYSTEM_COUNT) firstDeferred = i;
+            continue;
+        }
+
+        selected[i] = true;
+        reservedMs += costMs;
+        anySelected = true;
     }
 
-    if (m_socialEnabled) {
-        m_socialGroups.update(deltaTime, *m_creatureManager, *m_spatialGrid);
+    // Deferred work goes first next tick
+    m_scheduleCursor = firstDeferred != SUBSYSTEM_COUNT ? firstDeferred
+                                                        : (m_scheduleCursor + 1) % SUBSYSTEM_COUNT;
+
+    // Run the selection in dependency order: territorial first, then social
+    // (which may depend on territories), then hunting (depends on social
+    // groups), then migration/parental
+    for (size_t i = 0; i < SUBSYSTEM_COUNT; ++i) {
+        if (!selected[i]) continue;
+        SubsystemSchedule& schedule = m_schedules[i];
+
+        auto start = std::chrono::steady_clock::now();
+        runSubsystem(static_cast<BehaviorSubsystem>(i), schedule.pending);
+        auto end = std::chrono::steady_clock::now();
+
+        const float costMs = std::chrono::duration<float, std::milli>(end - start).count();
+        schedule.costMs = schedule.costMs > 0.0f
+            ? schedule.costMs + (costMs - schedule.costMs) * COST_SMOOTHING
+            : costMs;
+        schedule.pending = 0.0f;
     }
+}
+
+void BehaviorCoordinator::setSchedule(BehaviorSubsystem subsystem, float interval, float budgetMs, int slices) {
+    SubsystemSchedule& schedule = m_schedules[static_cast<size_t>(subsystem)];
+    schedule.interval = interval;
+    schedule.budgetMs = budgetMs;
+    schedule.slices = std::max(1, slices);
 
-    if (m_huntingEnabled && m_foodChain) {
-        m_packHunting.update(deltaTime, *m_creatureManager, m_socialGroups,
-                            *m_spatialGrid, *m_foodChain);
+    // Territories slice themselves; variety event slicing is read per run
+    if (subsystem == BehaviorSubsystem::TERRITORIAL) {
+        m_territorialBehavior.getConfig().updateSlices = schedule.slices;
     }
+}
 
-    if (m_migrationEnabled) {
-        m_migration.update(deltaTime, *m_creatureManager);
+bool BehaviorCoordinator::isSubsystemEnabled(BehaviorSubsystem subsystem) const {
+    switch (subsystem) {
+        case BehaviorSubsystem::TERRITORIAL: return m_territorialEnabled;
+        case BehaviorSubsystem::SOCIAL:      return m_socialEnabled;
+        case BehaviorSubsystem::HUNTING:     return m_huntingEnabled && m_foodChain;
+        case BehaviorSubsystem::MIGRATION:   return m_migrationEnabled;
+        case BehaviorSubsystem::PARENTAL:    return m_parentalEnabled;
+        case BehaviorSubsystem::VARIETY:     return m_varietyEnabled;
+        default:                             return false;
     }
+}
 
-    if (m_parentalEnabled) {
-        m_parentalCare.update(deltaTime, *m_creatureManager);
+void BehaviorCoordinator::runSubsystem(BehaviorSubsystem subsystem, float deltaTime) {
+    const SubsystemSchedule& schedule = getSchedule(subsystem);
+
+    switch (subsystem) {
+        case BehaviorSubsystem::TERRITORIAL:
+            m_territorialBehavior.update(deltaTime, *m_creatureManager, *m_spatialGrid);
+            break;
+        case BehaviorSubsystem::SOCIAL:
+            m_socialGroups.update(deltaTime, *m_creatureManager);
+            break;
+        case BehaviorSubsystem::HUNTING:
+            m_packHunting.update(deltaTime, *m_creatureManager, m_socialGroups,
+                                 *m_spatialGrid, *m_foodChain);
+            break;
+        case BehaviorSubsystem::MIGRATION:
+            m_migration.update(deltaTime, *m_creatureManager);
+            break;
+        case BehaviorSubsystem::PARENTAL:
+            m_parentalCare.update(deltaTime, *m_creatureManager);
+            break;
+        case BehaviorSubsystem::VARIETY:
+            m_varietyBehaviors.update(deltaTime, m_currentTime);
+            emitVarietyEvents(schedule.slices);
+            break;
+        default:
+            break;
     }
+}
 
-    if (m_varietyEnabled) {
-        m_varietyBehaviors.update(deltaTime, m_currentTime);
-
-        // Emit variety behavior events with cooldown
-        auto& allCreatures = m_creatureManager->getAllCreatures();
-        for (const auto& creature : allCreatures) {
-            if (!creature || !creature->isAlive()) continue;
-
-            uint32_t id = creature->getId();
-            const auto* state = m_varietyBehaviors.getBehaviorState(id);
-            if (!state) continue;
-
-            // Check cooldown
-            auto it = m_socialEventCooldowns.find(id);
-            bool canEmit = (it == m_socialEventCooldowns.end() || (m_currentTime - it->second) > EVENT_COOLDOWN);
-
-            if (canEmit) {
-                BehaviorEvent event;
-                event.creatureID = id;
-                event.position = creature->getPosition();
-                event.timestamp = m_currentTime;
-                event.intensity = 1.0f;
-
-                // Emit events for active variety behaviors
-                switch (state->currentBehavior) {
-                    case VarietyBehaviorType::MATING_DISPLAY:
-                        event.type = BehaviorEventType::MATING_DISPLAY;
-                        emitEvent(event);
-                        m_socialEventCooldowns[id] = m_currentTime;
-                        break;
-                    case VarietyBehaviorType::PLAYING:
-                        event.type = BehaviorEventType::PLAY_BEHAVIOR;
-                        emitEvent(event);
-                        m_socialEventCooldowns[id] = m_currentTime;
-                        break;
-                    case VarietyBehaviorType::SCAVENGING_SEEK:
-                    case VarietyBehaviorType::SCAVENGING_FEED:
-                        event.type = BehaviorEventType::SCAVENGING;
-                        emitEvent(event);
-                        m_socialEventCooldowns[id] = m_currentTime;
-                        break;
-                    case VarietyBehaviorType::CURIOSITY_APPROACH:
-                    case VarietyBehaviorType::CURIOSITY_INSPECT:
-                        event.type = BehaviorEventType::CURIOSITY_EXPLORE;
-                        emitEvent(event);
-                        m_socialEventCooldowns[id] = m_currentTime;
-                        break;
-                    default:
-                        break;
-                }
+void BehaviorCoordinator::emitVarietyEvents(int slices) {
+    // Visit 1/slices of the creature slots per call, continuing where the
+    // last call stopped; cooldowns are far longer than a full pass
+    auto& allCreatures = m_creatureManager->getAllCreatures();
+    const size_t count = allCreatures.size();
+    if (count == 0) return;
+
+    const size_t sliceCount = static_cast<size_t>(std::max(1, slices));
+    const size_t sliceSize = (count + sliceCount - 1) / sliceCount;
+    if (m_varietyEventCursor >= count) {
+        m_varietyEventCursor = 0;
+    }
+    const size_t begin = m_varietyEventCursor;
+    const size_t end = std::min(count, begin + sliceSize);
+    m_varietyEventCursor = end;
+
+    for (size_t i = begin; i < end; ++i) {
+        const auto& creature = allCreatures[i];
+        if (!creature || !creature->isAlive()) continue;
+
+        uint32_t id = creature->getId();
+        const auto* state = m_varietyBehaviors.getBehaviorState(id);
+        if (!state) continue;
+
+        // Check cooldown
+        auto it = m_socialEventCooldowns.find(id);
+        bool canEmit = (it == m_socialEventCooldowns.end() || (m_currentTime - it->second) > EVENT_COOLDOWN);
+
+        if (canEmit) {
+            BehaviorEvent event;
+            event.creatureID = id;
+            event.position = creature->getPosition();
+            event.timestamp = m_currentTime;
+            event.intensity = 1.0f;
+
+            // Emit events for active variety behaviors
+            switch (state->currentBehavior) {
+                case VarietyBehaviorType::MATING_DISPLAY:
+                    event.type = BehaviorEventType::MATING_DISPLAY;
+                    emitEvent(event);
+                    m_socialEventCooldowns[id] = m_currentTime;
+                    break;
+                case VarietyBehaviorType::PLAYING:
+                    event.type = BehaviorEventType::PLAY_BEHAVIOR;
+                    emitEvent(event);
+                    m_socialEventCooldowns[id] = m_currentTime;
+                    break;
+                case VarietyBehaviorType::SCAVENGING_SEEK:
+                case VarietyBehaviorType::SCAVENGING_FEED:
+                    event.type = BehaviorEventType::SCAVENGING;
+                    emitEvent(event);
+                    m_socialEventCooldowns[id] = m_currentTime;
+                    break;
+                case VarietyBehaviorType::CURIOSITY_APPROACH:
+                case VarietyBehaviorType::CURIOSITY_INSPECT:
+                    event.type = BehaviorEventType::CURIOSITY_EXPLORE;
+                    emitEvent(event);
+                    m_socialEventCooldowns[id] = m_currentTime;
+                    break;
+                default:
+                    break;
             }
         }
     }
@@ -165,7 +285,7 @@ glm::vec3 BehaviorCoordinator::calculateBehaviorForces(Creature* creature) {
 
     // Calculate individual forces from each system
     if (m_territorialEnabled) {
-        territorialForce = m_territorialBehavior.calculateForce(creature, *m_spatialGrid);
+        territorialForce = m_territorialBehavior.calculateForce(creature);
     }
 
     if (m_socialEnabled) {
@@ -500,6 +620,8 @@ glm::vec3 BehaviorCoordinator::resolveConflicts(Creature* creature, const glm::v
 }
 
 void BehaviorCoordinator::onCreatureDeath(uint32_t creatureId, const glm::vec3& deathPos) {
+    m_territorialBehavior.onOwnerDeath(creatureId);
+
     if (m_varietyEnabled) {
         m_varietyBehaviors.onCreatureDeath(creatureId, deathPos, m_currentTime);
     }
@@ -530,11 +652,12 @@ void BehaviorCoordinator::emitEvent(const BehaviorEvent& event) {
     }
     m_debugStats.lastEventTime = m_currentTime;
 
-    // Store in recent events history
-    m_recentEvents.push_back(event);
-    if (m_recentEvents.size() > MAX_EVENT_HISTORY) {
-        m_recentEvents.erase(m_recentEvents.begin());
+    // Store in recent events history, dropping the oldest when full
+    if (m_recentEvents.isFull()) {
+        BehaviorEvent dropped;
+        m_recentEvents.pop(dropped);
     }
+    m_recentEvents.push(event);
 
     // Notify all registered callbacks
     for (auto& callback : m_eventCallbacks) {
@@ -2,6 +2,7 @@
 
 #include <glm/glm.hpp>
 #include <memory>
+#include <array>
 #include <cstdint>
 #include <vector>
 #include <functional>
@@ -14,6 +15,7 @@
 #include "MigrationBehavior.h"
 #include "ParentalCare.h"
 #include "VarietyBehaviors.h"
+#include "../../core/MemoryOptimizer.h"
 
 // Forward declarations
 class Creature;
@@ -57,6 +59,17 @@ struct BehaviorEvent {
 
 using BehaviorEventCallback = std::function<void(const BehaviorEvent&)>;
 
+// Behavior subsystems in the order update() runs them
+enum class BehaviorSubsystem {
+    TERRITORIAL,
+    SOCIAL,
+    HUNTING,
+    MIGRATION,
+    PARENTAL,
+    VARIETY,
+    COUNT
+};
+
 /**
  * @brief Central coordinator for all emergent creature behavior systems
  *
@@ -77,6 +90,31 @@ class BehaviorCoordinator {
         float fleeFromPredator = 3.0f;  // Highest priority - survival
     };
 
+    /**
+     * @brief Update cadence and time budget for one behavior subsystem
+     *
+     * A subsystem is due once the simulation time since its last update
+     * reaches its interval, and is then handed all of that time at once.
+     * Each tick the scheduler walks the due subsystems round-robin and runs
+     * them while their reserved cost - the larger of budgetMs and the
+     * measured cost - fits in the frame budget; the rest wait for the next
+     * tick and are considered first there. The first due subsystem always
+     * runs so nothing starves under a budget smaller than its cost.
+     */
+    struct SubsystemSchedule {
+        float interval = 0.0f;      // Seconds between updates (0: every tick)
+        float budgetMs = 0.25f;     // Time reserved per update
+        int slices = 1;             // Ticks to spread one full pass over, where supported
+
+        // Runtime
+        float pending = 0.0f;       // Simulation time not yet handed to the subsystem
+        float costMs = 0.0f;        // Smoothed measured cost of an update
+        int deferrals = 0;          // Due updates pushed to a later tick
+    };
+
+    static constexpr size_t MAX_EVENT_HISTORY = 100;
+    using EventHistory = Forge::RingBuffer<BehaviorEvent, MAX_EVENT_HISTORY>;
+
     /**
      * @brief Statistics for debugging and UI
      */
@@ -206,6 +244,17 @@ class BehaviorCoordinator {
     bool isParentalEnabled() const { return m_parentalEnabled; }
     bool isVarietyEnabled() const { return m_varietyEnabled; }
 
+    /**
+     * @brief Per-subsystem cadence and budget, and the per-tick ceiling
+     *
+     * setSchedule() keeps the subsystem's runtime state and passes the slice
+     * count on to subsystems that slice themselves.
+     */
+    void setSchedule(BehaviorSubsystem subsystem, float interval, float budgetMs, int slices = 1);
+    const SubsystemSchedule& getSchedule(BehaviorSubsystem subsystem) const { return m_schedules[static_cast<size_t>(subsystem)]; }
+    void setFrameBudget(float milliseconds) { m_frameBudgetMs = milliseconds; }
+    float getFrameBudget() const { return m_frameBudgetMs; }
+
     /**
      * @brief Notify of creature death for scavenging behavior
      */
@@ -231,9 +280,9 @@ class BehaviorCoordinator {
     void emitEvent(const BehaviorEvent& event);
 
     /**
-     * @brief Get recent events for debugging/UI
+     * @brief Get recent events for debugging/UI, oldest first
      */
-    const std::vector<BehaviorEvent>& getRecentEvents() const { return m_recentEvents; }
+    const EventHistory& getRecentEvents() const { return m_recentEvents; }
 
     /**
      * @brief Clear event history
@@ -274,6 +323,14 @@ class BehaviorCoordinator {
                                const glm::vec3& migration, const glm::vec3& parental,
                                const glm::vec3& flee);
 
+    bool isSubsystemEnabled(BehaviorSubsystem subsystem) const;
+
+    // Advance one subsystem by the time it has accumulated
+    void runSubsystem(BehaviorSubsystem subsystem, float deltaTime);
+
+    // Emit events for one slice of the creatures' variety behaviors
+    void emitVarietyEvents(int slices);
+
     // Behavior subsystems
     TerritorialBehavior m_territorialBehavior;
     SocialGroupManager m_socialGroups;
@@ -299,14 +356,19 @@ class BehaviorCoordinator {
     bool m_parentalEnabled = true;
     bool m_varietyEnabled = true;
 
+    // Scheduling
+    std::array<SubsystemSchedule, static_cast<size_t>(BehaviorSubsystem::COUNT)> m_schedules;
+    float m_frameBudgetMs = 2.0f;
+    size_t m_scheduleCursor = 0;        // Subsystem considered first next tick
+    size_t m_varietyEventCursor = 0;    // Next creature index for variety events
+
     // State
     float m_currentTime = 0.0f;
     bool m_initialized = false;
 
     // Event system (Phase 10, Agent 4)
     std::vector<BehaviorEventCallback> m_eventCallbacks;
-    std::vector<BehaviorEvent> m_recentEvents;
-    static constexpr size_t MAX_EVENT_HISTORY = 100;
+    EventHistory m_recentEvents;
     DebugStats m_debugStats;
 
     // Event cooldowns (prevent spam)
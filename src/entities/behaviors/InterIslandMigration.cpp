@@ -1,5 +1,6 @@
 #include "InterIslandMigration.h"
 #include "../../core/MultiIslandManager.h"
+#include "../../utils/ThreadPool.h"
 #include <algorithm>
 #include <cmath>
 
@@ -23,8 +24,18 @@ InterIslandMigration::InterIslandMigration() {
 // ============================================================================
 
 void InterIslandMigration::update(float deltaTime, MultiIslandManager& islands) {
-    // Check for new migration triggers
-    checkMigrationTriggers(islands);
+    const uint32_t islandCount = islands.getIslandCount();
+    syncIslandQueues(islandCount);
+
+    // Check for new migration triggers, one task per island
+    ThreadPool::shared().parallelFor(islandCount, 1, [this, &islands](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            checkMigrationTriggers(static_cast<uint32_t>(i), islands);
+        }
+    });
+
+    // Barrier: drain the queues in island order
+    dispatchDepartures();
 
     // Process ongoing migrations
     processMigrations(deltaTime, islands);
@@ -33,61 +44,87 @@ void InterIslandMigration::update(float deltaTime, MultiIslandManager& islands)
     m_stats.inProgressMigrations = static_cast<int>(m_activeMigrations.size());
 }
 
-void InterIslandMigration::checkMigrationTriggers(MultiIslandManager& islands) {
+void InterIslandMigration::setSeed(uint32_t seed) {
+    m_rng.seed(seed);
+    m_islandQueues.clear();
+}
+
+void InterIslandMigration::syncIslandQueues(uint32_t islandCount) {
+    // New islands draw their stream seed from the main RNG, so a seeded
+    // run rolls the same departures however the tasks are scheduled
+    while (m_islandQueues.size() < islandCount) {
+        IslandQueue queue;
+        queue.rng.seed(m_rng());
+        m_islandQueues.push_back(std::move(queue));
+    }
+    m_islandQueues.resize(islandCount);
+}
+
+void InterIslandMigration::checkMigrationTriggers(uint32_t islandIdx, MultiIslandManager& islands) {
     std::uniform_real_distribution<float> chanceDist(0.0f, 1.0f);
 
-    for (uint32_t islandIdx = 0; islandIdx < islands.getIslandCount(); ++islandIdx) {
-        auto* island = islands.getIsland(islandIdx);
-        if (!island || !island->creatures) continue;
+    auto* island = islands.getIsland(islandIdx);
+    if (!island || !island->creatures) return;
 
-        // Check population pressure
-        bool populationPressure = checkPopulationPressure(islandIdx, islands);
+    IslandQueue& queue = m_islandQueues[islandIdx];
 
-        // Iterate through creatures on this island
-        island->creatures->forEach([&](Creature& creature, size_t idx) {
-            if (!creature.isAlive()) return;
+    // Check population pressure
+    bool populationPressure = checkPopulationPressure(islandIdx, islands);
 
-            // Calculate base migration chance
-            float migrationChance = m_config.baseMigrationChance;
+    // Iterate through creatures on this island
+    island->creatures->forEach([&](Creature& creature, size_t idx) {
+        if (!creature.isAlive()) return;
 
-            // Apply modifiers
-            if (populationPressure) {
-                migrationChance *= 5.0f;  // Much more likely when crowded
-            }
+        // Calculate base migration chance
+        float migrationChance = m_config.baseMigrationChance;
 
-            if (creature.getEnergy() < m_config.starvationThreshold * 100.0f) {
-                migrationChance *= 3.0f;  // More likely when hungry
-            }
+        // Apply modifiers
+        if (populationPressure) {
+            migrationChance *= 5.0f;  // Much more likely when crowded
+        }
 
-            // Check coastal proximity (simplified - creatures near edge more likely)
-            glm::vec3 pos = creature.getPosition();
-            float worldSize = static_cast<float>(island->terrain->getWidth() * island->terrain->getScale());
-            float distFromCenter = glm::length(glm::vec2(pos.x, pos.z));
-            float edgeProximity = distFromCenter / (worldSize * 0.5f);
+        if (creature.getEnergy() < m_config.starvationThreshold * 100.0f) {
+            migrationChance *= 3.0f;  // More likely when hungry
+        }
 
-            if (edgeProximity > 0.7f) {
-                migrationChance *= m_config.coastalProximityBonus;
-            }
+        // Check coastal proximity (simplified - creatures near edge more likely)
+        glm::vec3 pos = creature.getPosition();
+        float worldSize = static_cast<float>(island->terrain->getWidth() * island->terrain->getScale());
+        float distFromCenter = glm::length(glm::vec2(pos.x, pos.z));
+        float edgeProximity = distFromCenter / (worldSize * 0.5f);
+
+        if (edgeProximity > 0.7f) {
+            migrationChance *= m_config.coastalProximityBonus;
+        }
 
-            // Roll for migration attempt
-            if (chanceDist(m_rng) < migrationChance) {
-                // Determine best migration type for this creature
-                MigrationType type = getBestMigrationType(&creature);
+        // Roll for migration attempt
+        if (chanceDist(queue.rng) < migrationChance) {
+            // Determine best migration type for this creature
+            MigrationType type = pickMigrationType(&creature, queue.rng);
 
-                if (!isMigrationTypeEnabled(type)) return;
+            if (!isMigrationTypeEnabled(type)) return;
 
-                // Select target island
-                uint32_t targetIsland = selectTargetIsland(islandIdx, &creature, type, islands);
+            // Select target island
+            uint32_t targetIsland = selectTargetIsland(islandIdx, &creature, type, islands, queue.rng);
 
-                if (targetIsland != islandIdx && targetIsland < islands.getIslandCount()) {
-                    CreatureHandle handle;
-                    handle.index = static_cast<uint32_t>(idx);
-                    handle.generation = 1;  // Simplified
+            if (targetIsland != islandIdx && targetIsland < islands.getIslandCount()) {
+                CreatureHandle handle = island->creatures->getHandle(idx);
 
-                    attemptMigration(islandIdx, handle, targetIsland, type, islands);
+                MigrationEvent event;
+                if (beginMigration(islandIdx, handle, targetIsland, type, islands, queue.rng, event)) {
+                    queue.departures.push_back(std::move(event));
                 }
             }
-        });
+        }
+    });
+}
+
+void InterIslandMigration::dispatchDepartures() {
+    for (auto& queue : m_islandQueues) {
+        for (const auto& event : queue.departures) {
+            recordDeparture(event);
+        }
+        queue.departures.clear();
     }
 }
 
@@ -145,6 +182,19 @@ void InterIslandMigration::processMigrations(float deltaTime, MultiIslandManager
 bool InterIslandMigration::attemptMigration(uint32_t sourceIsland, CreatureHandle handle,
                                              uint32_t targetIsland, MigrationType type,
                                              MultiIslandManager& islands) {
+    MigrationEvent event;
+    if (!beginMigration(sourceIsland, handle, targetIsland, type, islands, m_rng, event)) {
+        return false;
+    }
+
+    recordDeparture(event);
+    return true;
+}
+
+bool InterIslandMigration::beginMigration(uint32_t sourceIsland, CreatureHandle handle,
+                                           uint32_t targetIsland, MigrationType type,
+                                           MultiIslandManager& islands, std::mt19937& rng,
+                                           MigrationEvent& event) {
     auto* srcIsland = islands.getIsland(sourceIsland);
     auto* dstIsland = islands.getIsland(targetIsland);
 
@@ -161,7 +211,6 @@ bool InterIslandMigration::attemptMigration(uint32_t sourceIsland, CreatureHandl
     float travelTime = calculateTravelTime(sourceIsland, targetIsland, type, islands);
 
     // Create migration event
-    MigrationEvent event;
     event.creatureId = handle.index;
     event.sourceIsland = sourceIsland;
     event.targetIsland = targetIsland;
@@ -179,23 +228,29 @@ bool InterIslandMigration::attemptMigration(uint32_t sourceIsland, CreatureHandl
 
     event.startPosition = srcIsland->localToWorld(creature->getPosition());
     event.currentPosition = event.startPosition;
-    event.targetPosition = calculateArrivalPosition(targetIsland, type, islands);
+    event.targetPosition = calculateArrivalPosition(targetIsland, type, islands, rng);
 
     event.genome = creature->getGenome();
     event.creatureType = creature->getType();
+    event.hasBrain = creature->hasNEATBrain();
+    if (event.hasBrain) {
+        event.brainGenome = creature->getNEATGenome();
+    }
 
     // Remove creature from source island
     srcIsland->creatures->kill(handle, "Migration departure");
+    return true;
+}
 
+void InterIslandMigration::recordDeparture(const MigrationEvent& event) {
     // Add to active migrations
     m_activeMigrations.push_back(event);
 
     // Update statistics
     m_stats.totalAttempts++;
-    m_stats.attemptsByType[static_cast<int>(type)]++;
+    m_stats.attemptsByType[static_cast<int>(event.type)]++;
 
     notifyCallbacks(event);
-    return true;
 }
 
 bool InterIslandMigration::forceMigration(uint32_t sourceIsland, CreatureHandle handle,
@@ -214,8 +269,25 @@ bool InterIslandMigration::forceMigration(uint32_t sourceIsland, CreatureHandle
 // Migration Completion
 // ============================================================================
 
+void InterIslandMigration::landMigrant(MigrationEvent event, MultiIslandManager& islands) {
+    event.targetPosition = calculateArrivalPosition(event.targetIsland, event.type, islands, m_rng);
+    event.state = MigrationState::COMPLETED;
+    completeMigration(event, islands);
+}
+
+void InterIslandMigration::restoreActiveMigrations(std::vector<MigrationEvent> migrations) {
+    m_activeMigrations = std::move(migrations);
+    m_stats.inProgressMigrations = static_cast<int>(m_activeMigrations.size());
+}
+
 void InterIslandMigration::completeMigration(MigrationEvent& event, MultiIslandManager& islands) {
     auto* dstIsland = islands.getIsland(event.targetIsland);
+    if (dstIsland && dstIsland->isRemote && m_remoteArrivalHandler) {
+        // Landing and its statistics happen in the owning process
+        m_remoteArrivalHandler(event);
+        return;
+    }
+
     if (!dstIsland || !dstIsland->creatures) {
         failMigration(event, islands);
         return;
@@ -248,6 +320,11 @@ void InterIslandMigration::completeMigration(MigrationEvent& event, MultiIslandM
         }
     }
 
+    // A sleeping island comes back to full detail for the arrival
+    if (dstIsland->isSleeping()) {
+        islands.wakeIsland(event.targetIsland);
+    }
+
     // Spawn creature on destination island
     CreatureHandle newHandle = dstIsland->creatures->spawnWithGenome(localArrival, event.genome);
 
@@ -256,6 +333,10 @@ void InterIslandMigration::completeMigration(MigrationEvent& event, MultiIslandM
         Creature* newCreature = dstIsland->creatures->get(newHandle);
         if (newCreature) {
             // Energy was already reduced during transit - creature arrives with remaining energy
+            // The evolved brain crosses with its owner
+            if (event.hasBrain) {
+                newCreature->setNEATGenome(event.brainGenome);
+            }
         }
 
         // Update island statistics for migration tracking
@@ -424,6 +505,10 @@ float InterIslandMigration::calculateTravelTime(uint32_t sourceIsland, uint32_t
 }
 
 MigrationType InterIslandMigration::getBestMigrationType(const Creature* creature) {
+    return pickMigrationType(creature, m_rng);
+}
+
+MigrationType InterIslandMigration::pickMigrationType(const Creature* creature, std::mt19937& rng) const {
     if (!creature) return MigrationType::RANDOM_DISPERSAL;
 
     CreatureType type = creature->getType();
@@ -440,7 +525,7 @@ MigrationType InterIslandMigration::getBestMigrationType(const Creature* creatur
 
     // Land creatures most likely to raft or drift
     std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-    float roll = dist(m_rng);
+    float roll = dist(rng);
 
     if (roll < 0.4f) {
         return MigrationType::FLOATING_DEBRIS;
@@ -465,7 +550,7 @@ bool InterIslandMigration::checkCoastalDrift(const Creature* creature, uint32_t
     return island->terrain->isWater(pos.x, pos.z);
 }
 
-bool InterIslandMigration::checkPopulationPressure(uint32_t islandIndex, const MultiIslandManager& islands) {
+bool InterIslandMigration::checkPopulationPressure(uint32_t islandIndex, const MultiIslandManager& islands) const {
     const auto* island = islands.getIsland(islandIndex);
     if (!island || !island->creatures) return false;
 
@@ -486,7 +571,8 @@ bool InterIslandMigration::checkFoodScarcity(const Creature* creature, uint32_t
 // ============================================================================
 
 uint32_t InterIslandMigration::selectTargetIsland(uint32_t sourceIsland, const Creature* creature,
-                                                    MigrationType type, const MultiIslandManager& islands) {
+                                                    MigrationType type, const MultiIslandManager& islands,
+                                                    std::mt19937& rng) const {
     // Get neighboring islands
     float maxRange = 500.0f;  // Maximum migration range
 
@@ -518,7 +604,7 @@ uint32_t InterIslandMigration::selectTargetIsland(uint32_t sourceIsland, const C
 
     // Weighted random selection
     std::uniform_real_distribution<float> dist(0.0f, totalWeight);
-    float roll = dist(m_rng);
+    float roll = dist(rng);
 
     float cumulative = 0.0f;
     for (size_t i = 0; i < neighbors.size(); ++i) {
@@ -536,7 +622,8 @@ uint32_t InterIslandMigration::selectTargetIsland(uint32_t sourceIsland, const C
 // ============================================================================
 
 glm::vec3 InterIslandMigration::calculateArrivalPosition(uint32_t targetIsland, MigrationType type,
-                                                          const MultiIslandManager& islands) {
+                                                          const MultiIslandManager& islands,
+                                                          std::mt19937& rng) const {
     const auto* island = islands.getIsland(targetIsland);
     if (!island) return glm::vec3(0.0f);
 
@@ -547,8 +634,8 @@ glm::vec3 InterIslandMigration::calculateArrivalPosition(uint32_t targetIsland,
     std::uniform_real_distribution<float> angleDist(0.0f, 6.28318f);
     std::uniform_real_distribution<float> radiusDist(0.3f, 0.8f);
 
-    float angle = angleDist(m_rng);
-    float radius = radiusDist(m_rng);
+    float angle = angleDist(rng);
+    float radius = radiusDist(rng);
 
     // Water-based arrivals come from edge, flying can land anywhere
     if (type == MigrationType::COASTAL_DRIFT || type == MigrationType::FLOATING_DEBRIS) {
@@ -4,6 +4,7 @@
 // Implements various migration triggers and pathways
 
 #include "../../core/CreatureManager.h"
+#include "../../ai/NEATGenome.h"
 #include "../../environment/ArchipelagoGenerator.h"
 #include <glm/glm.hpp>
 #include <vector>
@@ -72,6 +73,8 @@ struct MigrationEvent {
     // Creature data (for transfer)
     Genome genome;
     CreatureType creatureType;
+    ai::NEATGenome brainGenome;     // Evolved brain, if hasBrain
+    bool hasBrain = false;
 
     MigrationEvent()
         : creatureId(0), sourceIsland(0), targetIsland(0),
@@ -156,6 +159,7 @@ struct MigrationConfig {
 class InterIslandMigration {
 public:
     using MigrationCallback = std::function<void(const MigrationEvent&)>;
+    using RemoteArrivalHandler = std::function<void(const MigrationEvent&)>;
 
     InterIslandMigration();
     ~InterIslandMigration() = default;
@@ -164,6 +168,10 @@ class InterIslandMigration {
     // Main Update
     // ========================================================================
 
+    // Departure rolls run as one ThreadPool task per island, each writing
+    // only to its own island's queue with its own RNG stream. The queues are
+    // then drained on the calling thread in island order, which starts the
+    // crossings, advances them and lands arrivals.
     void update(float deltaTime, MultiIslandManager& islands);
 
     // ========================================================================
@@ -179,6 +187,23 @@ class InterIslandMigration {
     bool forceMigration(uint32_t sourceIsland, CreatureHandle handle,
                         uint32_t targetIsland, MultiIslandManager& islands);
 
+    // ========================================================================
+    // Distributed Archipelago
+    // ========================================================================
+
+    // Crossings that reach a remote island are handed to this handler instead
+    // of landing; the owning process lands them with landMigrant()
+    void setRemoteArrivalHandler(RemoteArrivalHandler handler) { m_remoteArrivalHandler = std::move(handler); }
+
+    // Land a migrant whose crossing finished in another process. The arrival
+    // point is picked again here, where the target terrain is known.
+    void landMigrant(MigrationEvent event, MultiIslandManager& islands);
+
+    // Replace the crossings in progress with ones read back from a
+    // checkpoint. They carry on from where they were; departure stats are
+    // not counted again.
+    void restoreActiveMigrations(std::vector<MigrationEvent> migrations);
+
     // ========================================================================
     // Active Migrations
     // ========================================================================
@@ -195,6 +220,10 @@ class InterIslandMigration {
     // ========================================================================
 
     void setConfig(const MigrationConfig& config) { m_config = config; }
+
+    // Reseed the main RNG; per-island streams are re-derived from it on the
+    // next update, so a seeded run rolls the same migrations
+    void setSeed(uint32_t seed);
     const MigrationConfig& getConfig() const { return m_config; }
 
     // Enable/disable migration types
@@ -234,6 +263,13 @@ class InterIslandMigration {
     // Active migrations
     std::vector<MigrationEvent> m_activeMigrations;
 
+    // Per-island message queue, filled by that island's departure task
+    struct IslandQueue {
+        std::vector<MigrationEvent> departures;
+        std::mt19937 rng;
+    };
+    std::vector<IslandQueue> m_islandQueues;
+
     // Configuration
     MigrationConfig m_config;
     std::array<bool, 8> m_enabledTypes;
@@ -243,30 +279,47 @@ class InterIslandMigration {
 
     // Callbacks
     std::vector<MigrationCallback> m_callbacks;
+    RemoteArrivalHandler m_remoteArrivalHandler;
 
     // Random number generator
     std::mt19937 m_rng;
 
     // Internal methods
-    void checkMigrationTriggers(MultiIslandManager& islands);
+    void syncIslandQueues(uint32_t islandCount);
+    void checkMigrationTriggers(uint32_t islandIndex, MultiIslandManager& islands);
+    void dispatchDepartures();
     void processMigrations(float deltaTime, MultiIslandManager& islands);
     void completeMigration(MigrationEvent& event, MultiIslandManager& islands);
     void failMigration(MigrationEvent& event, MultiIslandManager& islands);
 
+    // Builds the event and removes the creature from its source island.
+    // Only touches the source island, so it is safe inside a departure task.
+    bool beginMigration(uint32_t sourceIsland, CreatureHandle handle,
+                        uint32_t targetIsland, MigrationType type,
+                        MultiIslandManager& islands, std::mt19937& rng,
+                        MigrationEvent& outEvent);
+
+    // Records a started migration in the stats and active list
+    void recordDeparture(const MigrationEvent& event);
+
+    MigrationType pickMigrationType(const Creature* creature, std::mt19937& rng) const;
+
     // Trigger detection
     bool checkCoastalDrift(const Creature* creature, uint32_t islandIndex,
                            const MultiIslandManager& islands);
-    bool checkPopulationPressure(uint32_t islandIndex, const MultiIslandManager& islands);
+    bool checkPopulationPressure(uint32_t islandIndex, const MultiIslandManager& islands) const;
     bool checkFoodScarcity(const Creature* creature, uint32_t islandIndex,
                            const MultiIslandManager& islands);
 
     // Target selection
     uint32_t selectTargetIsland(uint32_t sourceIsland, const Creature* creature,
-                                 MigrationType type, const MultiIslandManager& islands);
+                                 MigrationType type, const MultiIslandManager& islands,
+                                 std::mt19937& rng) const;
 
     // Position calculation
     glm::vec3 calculateArrivalPosition(uint32_t targetIsland, MigrationType type,
-                                        const MultiIslandManager& islands);
+                                        const MultiIslandManager& islands,
+                                        std::mt19937& rng) const;
     glm::vec3 interpolateMigrationPosition(const MigrationEvent& event) const;
 
     // Survival calculation helpers
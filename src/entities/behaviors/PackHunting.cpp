@@ -7,6 +7,7 @@
 #include <glm/gtc/constants.hpp>
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 // Helper to determine if a predator type can hunt a prey type
 static bool isValidPreyType(CreatureType predator, CreatureType prey) {
@@ -55,11 +56,21 @@ void PackHuntingBehavior::update(float deltaTime, CreatureManager& creatures,
         }
     }
 
+    // Resolve hunters and prey once; everything below works from pointers
+    resolveParticipants(creatures);
+
     // Update existing hunts
-    updateActiveHunts(deltaTime, creatures, grid);
+    m_planTimer += deltaTime;
+    updateActiveHunts(deltaTime);
+
+    // Planning runs at a lower cadence, batched across every hunt
+    if (m_planTimer >= m_config.planInterval) {
+        m_planTimer = 0.0f;
+        planHunts();
 
-    // Try to start new hunts
-    initiateNewHunts(creatures, groups, grid, foodChain);
+        // Try to start new hunts
+        initiateNewHunts(groups, grid, foodChain);
+    }
 
     // Clean up completed hunts
     for (uint32_t id : m_huntsToRemove) {
@@ -141,8 +152,27 @@ bool PackHuntingBehavior::isBeingHunted(uint32_t creatureID) const {
     return m_targetsBeingHunted.count(creatureID) > 0;
 }
 
-void PackHuntingBehavior::initiateNewHunts(CreatureManager& creatures,
-                                           const SocialGroupManager& groups,
+void PackHuntingBehavior::resolveParticipants(CreatureManager& creatures) {
+    m_participants.clear();
+
+    creatures.forEach([&](Creature& c, size_t) {
+        if (!c.isAlive()) return;
+
+        // Pack members may start hunts; prey only matter while hunted
+        const uint32_t id = static_cast<uint32_t>(c.getID());
+        if (SocialGroupManager::getGroupTypeForCreature(c.getType()) == SocialGroupManager::GroupType::PACK ||
+            m_creatureToHunt.count(id) > 0 || m_targetsBeingHunted.count(id) > 0) {
+            m_participants.emplace(id, &c);
+        }
+    });
+}
+
+Creature* PackHuntingBehavior::findParticipant(uint32_t creatureID) const {
+    auto it = m_participants.find(creatureID);
+    return it != m_participants.end() ? it->second : nullptr;
+}
+
+void PackHuntingBehavior::initiateNewHunts(const SocialGroupManager& groups,
                                            const SpatialGrid& grid,
                                            const FoodChainManager& foodChain) {
     // Check each predator pack for potential hunts
@@ -163,20 +193,22 @@ void PackHuntingBehavior::initiateNewHunts(CreatureManager& creatures,
         // Check if enough members are ready (not on cooldown)
         std::vector<uint32_t> availableHunters;
         for (const auto& member : group.members) {
-            if (m_huntCooldowns.count(member.creatureID) == 0) {
+            if (m_huntCooldowns.count(member.creatureID) == 0 && findParticipant(member.creatureID)) {
                 availableHunters.push_back(member.creatureID);
             }
         }
 
         if (availableHunters.size() < static_cast<size_t>(m_config.minPackSize)) continue;
 
-        // Find prey near the group
-        auto& nearbyCreatures = grid.query(group.centroid, m_config.huntRange);
+        // Find prey near the group. Copied out because the defender count
+        // below reuses the grid's query buffer.
+        const auto& nearbyCreatures = grid.query(group.centroid, m_config.huntRange);
+        m_preyCandidates.assign(nearbyCreatures.begin(), nearbyCreatures.end());
 
         Creature* bestPrey = nullptr;
         float bestScore = -1.0f;
 
-        for (Creature* potential : nearbyCreatures) {
+        for (Creature* potential : m_preyCandidates) {
             if (!potential || !potential->isAlive()) continue;
 
             // Check if already being hunted
@@ -191,13 +223,8 @@ void PackHuntingBehavior::initiateNewHunts(CreatureManager& creatures,
             float energyScore = potential->getEnergy() / 200.0f;  // Well-fed prey = more reward
 
             // Count nearby same-type creatures (prefer isolated prey)
-            int defenders = 0;
-            auto& nearPrey = grid.query(potential->getPosition(), 15.0f);
-            for (auto* nearby : nearPrey) {
-                if (nearby && nearby->isAlive() && nearby->getType() == potential->getType()) {
-                    defenders++;
-                }
-            }
+            int defenders = static_cast<int>(grid.queryByType(potential->getPosition(), 15.0f,
+                                                              static_cast<int>(potential->getType())).size());
             float isolationScore = 1.0f / (1.0f + defenders * 0.3f);
 
             float score = distScore * 0.4f + energyScore * 0.3f + isolationScore * 0.3f;
@@ -210,11 +237,10 @@ void PackHuntingBehavior::initiateNewHunts(CreatureManager& creatures,
 
         if (bestPrey && bestScore > 0.3f) {
             // Initiate hunt
-            Hunt newHunt;
-            newHunt.huntID = m_nextHuntID++;
+            uint32_t huntID = m_nextHuntID++;
+            Hunt& newHunt = m_activeHunts[huntID];
+            newHunt.huntID = huntID;
             newHunt.targetID = bestPrey->getID();
-            newHunt.targetLastKnownPos = bestPrey->getPosition();
-            newHunt.targetPredictedPos = predictPreyPosition(bestPrey, 2.0f);
             newHunt.phase = HuntPhase::STALKING;
             newHunt.startTime = m_currentTime;
             newHunt.phaseStartTime = m_currentTime;
@@ -232,40 +258,45 @@ void PackHuntingBehavior::initiateNewHunts(CreatureManager& creatures,
                 count++;
             }
 
-            // Assign roles
-            assignRoles(newHunt, creatures);
+            // First plan; role positions start from where the hunters stand
+            updateTargetTracking(newHunt, bestPrey);
+            assignRoles(newHunt);
+            calculateRolePositions(newHunt);
+            for (auto& hunter : newHunt.hunters) {
+                hunter.planFrom = findParticipant(hunter.creatureID)->getPosition();
+                hunter.assignedPosition = hunter.planFrom;
+            }
 
             // Register hunt
             for (const auto& hunter : newHunt.hunters) {
-                m_creatureToHunt[hunter.creatureID] = newHunt.huntID;
+                m_creatureToHunt[hunter.creatureID] = huntID;
                 m_hunterRoles[hunter.creatureID] = hunter.role;
             }
             m_targetsBeingHunted.insert(newHunt.targetID);
-            m_activeHunts[newHunt.huntID] = newHunt;
         }
     }
 }
 
-void PackHuntingBehavior::updateActiveHunts(float deltaTime, CreatureManager& creatures,
-                                            const SpatialGrid& grid) {
+void PackHuntingBehavior::updateActiveHunts(float deltaTime) {
     for (auto& [huntID, hunt] : m_activeHunts) {
         // Update phase duration
         hunt.phaseDuration = m_currentTime - hunt.phaseStartTime;
 
-        // Update target tracking
-        updateTargetTracking(hunt, creatures);
-
         // Check if target is still valid
-        Creature* target = creatures.getCreatureByID(hunt.targetID);
+        Creature* target = findParticipant(hunt.targetID);
         if (!target || !target->isAlive()) {
-            completeHunt(hunt, false, creatures);
+            completeHunt(hunt, false);
             m_huntsToRemove.insert(huntID);
             continue;
         }
 
+        // Extrapolate the prey track to this frame
+        hunt.targetLastKnownPos = hunt.track.position +
+                                  hunt.track.velocity * (m_currentTime - hunt.track.sampleTime);
+
         // Check if hunt should be abandoned
-        if (shouldAbandonHunt(hunt, creatures)) {
-            completeHunt(hunt, false, creatures);
+        if (shouldAbandonHunt(hunt, target)) {
+            completeHunt(hunt, false);
             m_huntsToRemove.insert(huntID);
             continue;
         }
@@ -273,15 +304,15 @@ void PackHuntingBehavior::updateActiveHunts(float deltaTime, CreatureManager& cr
         // Remove dead hunters
         hunt.hunters.erase(
             std::remove_if(hunt.hunters.begin(), hunt.hunters.end(),
-                          [&creatures](const Hunter& h) {
-                              Creature* c = creatures.getCreatureByID(h.creatureID);
+                          [this](const Hunter& h) {
+                              Creature* c = findParticipant(h.creatureID);
                               return !c || !c->isAlive();
                           }),
             hunt.hunters.end());
 
         // Check minimum hunters
         if (hunt.hunters.size() < static_cast<size_t>(m_config.minPackSize)) {
-            completeHunt(hunt, false, creatures);
+            completeHunt(hunt, false);
             m_huntsToRemove.insert(huntID);
             continue;
         }
@@ -293,21 +324,18 @@ void PackHuntingBehavior::updateActiveHunts(float deltaTime, CreatureManager& cr
             }
         }
 
-        // Calculate role positions
-        calculateRolePositions(hunt, creatures);
-
-        // Calculate encirclement
-        hunt.encirclementScore = calculateEncirclement(hunt, creatures);
+        // Follow the planned role positions
+        interpolateRolePositions(hunt);
 
         // Check for phase transition
-        if (shouldAdvancePhase(hunt, creatures)) {
+        if (shouldAdvancePhase(hunt, target)) {
             advancePhase(hunt);
         }
 
         // Check for successful takedown
         if (hunt.phase == HuntPhase::TAKEDOWN) {
             for (const auto& hunter : hunt.hunters) {
-                Creature* hunterCreature = creatures.getCreatureByID(hunter.creatureID);
+                Creature* hunterCreature = findParticipant(hunter.creatureID);
                 if (!hunterCreature) continue;
 
                 float dist = glm::distance(hunterCreature->getPosition(), target->getPosition());
@@ -316,7 +344,7 @@ void PackHuntingBehavior::updateActiveHunts(float deltaTime, CreatureManager& cr
                     hunterCreature->attack(target, deltaTime);
 
                     if (!target->isAlive()) {
-                        completeHunt(hunt, true, creatures);
+                        completeHunt(hunt, true);
                         m_huntsToRemove.insert(huntID);
                         break;
                     }
@@ -326,20 +354,40 @@ void PackHuntingBehavior::updateActiveHunts(float deltaTime, CreatureManager& cr
     }
 }
 
-void PackHuntingBehavior::assignRoles(Hunt& hunt, CreatureManager& creatures) {
-    if (hunt.hunters.empty()) return;
+void PackHuntingBehavior::planHunts() {
+    for (auto& [huntID, hunt] : m_activeHunts) {
+        if (m_huntsToRemove.count(huntID) > 0) continue;
+
+        Creature* target = findParticipant(hunt.targetID);
+        if (!target || !target->isAlive()) continue;
+
+        updateTargetTracking(hunt, target);
+        assignRoles(hunt);
+
+        // Interpolate from wherever the previous plan had got to
+        for (auto& hunter : hunt.hunters) {
+            hunter.planFrom = hunter.assignedPosition;
+            m_hunterRoles[hunter.creatureID] = hunter.role;
+        }
+        calculateRolePositions(hunt);
+
+        // Calculate encirclement
+        hunt.encirclementScore = calculateEncirclement(hunt);
+    }
+}
 
-    Creature* target = creatures.getCreatureByID(hunt.targetID);
-    if (!target) return;
+void PackHuntingBehavior::assignRoles(Hunt& hunt) {
+    if (hunt.hunters.empty()) return;
 
-    glm::vec3 targetPos = target->getPosition();
+    glm::vec3 targetPos = hunt.track.position;
+    glm::vec3 targetVel = hunt.track.velocity;
 
     // Find the creature closest to target - they're the leader
-    float minDist = FLT_MAX;
+    float minDist = std::numeric_limits<float>::max();
     size_t leaderIdx = 0;
 
     for (size_t i = 0; i < hunt.hunters.size(); i++) {
-        Creature* hunter = creatures.getCreatureByID(hunt.hunters[i].creatureID);
+        Creature* hunter = findParticipant(hunt.hunters[i].creatureID);
         if (!hunter) continue;
 
         float dist = glm::distance(hunter->getPosition(), targetPos);
@@ -356,12 +404,11 @@ void PackHuntingBehavior::assignRoles(Hunt& hunt, CreatureManager& creatures) {
     for (size_t i = 0; i < hunt.hunters.size(); i++) {
         if (i == leaderIdx) continue;
 
-        Creature* hunter = creatures.getCreatureByID(hunt.hunters[i].creatureID);
+        Creature* hunter = findParticipant(hunt.hunters[i].creatureID);
         if (!hunter) continue;
 
         glm::vec3 hunterPos = hunter->getPosition();
         glm::vec3 toTarget = targetPos - hunterPos;
-        glm::vec3 targetVel = target->getVelocity();
 
         // Determine role based on position and prey movement
         float angle = 0.0f;
@@ -384,20 +431,40 @@ void PackHuntingBehavior::assignRoles(Hunt& hunt, CreatureManager& creatures) {
     }
 }
 
-void PackHuntingBehavior::updateTargetTracking(Hunt& hunt, CreatureManager& creatures) {
-    Creature* target = creatures.getCreatureByID(hunt.targetID);
-    if (!target || !target->isAlive()) return;
+void PackHuntingBehavior::updateTargetTracking(Hunt& hunt, const Creature* target) {
+    PreyTrack& track = hunt.track;
+    track.position = target->getPosition();
+    track.velocity = target->getVelocity();
+    track.sampleTime = m_currentTime;
 
-    hunt.targetLastKnownPos = target->getPosition();
-    hunt.targetPredictedPos = predictPreyPosition(target, 2.0f);
-}
+    // The pack closes in from its centroid at its average top speed
+    glm::vec3 packCenter(0.0f);
+    float packSpeed = 0.0f;
+    int count = 0;
+    for (const auto& hunter : hunt.hunters) {
+        if (Creature* h = findParticipant(hunter.creatureID)) {
+            packCenter += h->getPosition();
+            packSpeed += h->getSpeed();
+            count++;
+        }
+    }
+    if (count > 0) {
+        packCenter /= static_cast<float>(count);
+        packSpeed /= static_cast<float>(count);
+    } else {
+        packCenter = track.position;
+    }
+
+    track.intercept = predictIntercept(track.position, track.velocity, packCenter, packSpeed);
 
-void PackHuntingBehavior::calculateRolePositions(Hunt& hunt, CreatureManager& creatures) {
-    Creature* target = creatures.getCreatureByID(hunt.targetID);
-    if (!target) return;
+    hunt.targetLastKnownPos = track.position;
+    hunt.targetPredictedPos = track.intercept;
+}
 
-    glm::vec3 targetPos = hunt.targetLastKnownPos;
-    glm::vec3 targetVel = target->getVelocity();
+void PackHuntingBehavior::calculateRolePositions(Hunt& hunt) {
+    // Plan for where the prey will be when the next plan runs
+    glm::vec3 targetPos = hunt.track.position + hunt.track.velocity * m_config.planInterval;
+    glm::vec3 targetVel = hunt.track.velocity;
     glm::vec3 targetDir = glm::length(targetVel) > 0.1f ? glm::normalize(targetVel) : glm::vec3(1, 0, 0);
     glm::vec3 perpendicular(-targetDir.z, 0, targetDir.x);
 
@@ -406,48 +473,57 @@ void PackHuntingBehavior::calculateRolePositions(Hunt& hunt, CreatureManager& cr
         switch (hunter.role) {
             case HuntRole::LEADER:
                 // Leader stays closest to target
-                hunter.assignedPosition = targetPos - targetDir * m_config.flankingDistance * 0.5f;
+                hunter.planTo = targetPos - targetDir * m_config.flankingDistance * 0.5f;
                 break;
 
             case HuntRole::FLANKER:
                 // Flankers spread to sides
                 {
                     float side = (flankerCount % 2 == 0) ? 1.0f : -1.0f;
-                    hunter.assignedPosition = targetPos + perpendicular * side * m_config.flankingDistance;
+                    hunter.planTo = targetPos + perpendicular * side * m_config.flankingDistance;
                     flankerCount++;
                 }
                 break;
 
             case HuntRole::CHASER:
                 // Chasers pursue from behind
-                hunter.assignedPosition = targetPos - targetDir * m_config.flankingDistance;
+                hunter.planTo = targetPos - targetDir * m_config.flankingDistance;
                 break;
 
             case HuntRole::BLOCKER:
                 // Blockers get ahead of prey
-                hunter.assignedPosition = hunt.targetPredictedPos + targetDir * m_config.flankingDistance;
+                hunter.planTo = hunt.targetPredictedPos + targetDir * m_config.flankingDistance;
                 break;
 
             case HuntRole::AMBUSHER:
                 // Ambushers wait far ahead
-                hunter.assignedPosition = hunt.targetPredictedPos + targetDir * m_config.flankingDistance * 2.0f;
+                hunter.planTo = hunt.targetPredictedPos + targetDir * m_config.flankingDistance * 2.0f;
                 break;
 
             default:
-                hunter.assignedPosition = targetPos;
+                hunter.planTo = targetPos;
                 break;
         }
+    }
+}
+
+void PackHuntingBehavior::interpolateRolePositions(Hunt& hunt) {
+    const float t = m_config.planInterval > 0.0f
+                  ? glm::clamp(m_planTimer / m_config.planInterval, 0.0f, 1.0f)
+                  : 1.0f;
+
+    for (auto& hunter : hunt.hunters) {
+        hunter.assignedPosition = glm::mix(hunter.planFrom, hunter.planTo, t);
 
         // Check if in position
-        Creature* hunterCreature = creatures.getCreatureByID(hunter.creatureID);
-        if (hunterCreature) {
+        if (Creature* hunterCreature = findParticipant(hunter.creatureID)) {
             float dist = glm::distance(hunterCreature->getPosition(), hunter.assignedPosition);
             hunter.inPosition = (dist < 5.0f);
         }
     }
 }
 
-bool PackHuntingBehavior::shouldAdvancePhase(const Hunt& hunt, CreatureManager& creatures) {
+bool PackHuntingBehavior::shouldAdvancePhase(const Hunt& hunt, const Creature* target) {
     switch (hunt.phase) {
         case HuntPhase::STALKING:
             // Advance when all hunters are close enough or time limit reached
@@ -464,15 +540,10 @@ bool PackHuntingBehavior::shouldAdvancePhase(const Hunt& hunt, CreatureManager&
 
         case HuntPhase::CHASE:
             // Advance to takedown when close enough
-            {
-                Creature* target = creatures.getCreatureByID(hunt.targetID);
-                if (!target) return false;
-
-                for (const auto& hunter : hunt.hunters) {
-                    Creature* h = creatures.getCreatureByID(hunter.creatureID);
-                    if (h && glm::distance(h->getPosition(), target->getPosition()) < m_config.attackRange * 2.0f) {
-                        return true;
-                    }
+            for (const auto& hunter : hunt.hunters) {
+                Creature* h = findParticipant(hunter.creatureID);
+                if (h && glm::distance(h->getPosition(), target->getPosition()) < m_config.attackRange * 2.0f) {
+                    return true;
                 }
             }
             return false;
@@ -503,7 +574,7 @@ void PackHuntingBehavior::advancePhase(Hunt& hunt) {
     }
 }
 
-bool PackHuntingBehavior::shouldAbandonHunt(const Hunt& hunt, CreatureManager& creatures) {
+bool PackHuntingBehavior::shouldAbandonHunt(const Hunt& hunt, const Creature* target) {
     // Too long in chase phase
     if (hunt.phase == HuntPhase::CHASE && hunt.phaseDuration > m_config.chaseDuration) {
         return true;
@@ -520,18 +591,15 @@ bool PackHuntingBehavior::shouldAbandonHunt(const Hunt& hunt, CreatureManager& c
     if (allFatigued) return true;
 
     // Target too far from all hunters
-    Creature* target = creatures.getCreatureByID(hunt.targetID);
-    if (target) {
-        bool anyClose = false;
-        for (const auto& hunter : hunt.hunters) {
-            Creature* h = creatures.getCreatureByID(hunter.creatureID);
-            if (h && glm::distance(h->getPosition(), target->getPosition()) < m_config.huntRange * 1.5f) {
-                anyClose = true;
-                break;
-            }
+    bool anyClose = false;
+    for (const auto& hunter : hunt.hunters) {
+        Creature* h = findParticipant(hunter.creatureID);
+        if (h && glm::distance(h->getPosition(), target->getPosition()) < m_config.huntRange * 1.5f) {
+            anyClose = true;
+            break;
         }
-        if (!anyClose) return true;
     }
+    if (!anyClose) return true;
 
     // Too many failed attempts
     if (hunt.failedAttempts > 5) return true;
@@ -539,13 +607,13 @@ bool PackHuntingBehavior::shouldAbandonHunt(const Hunt& hunt, CreatureManager& c
     return false;
 }
 
-void PackHuntingBehavior::completeHunt(Hunt& hunt, bool success, CreatureManager& creatures) {
+void PackHuntingBehavior::completeHunt(Hunt& hunt, bool success) {
     if (success) {
         m_successfulHunts++;
         // Hunters share energy bonus
         float sharePerHunter = m_config.successBonus / static_cast<float>(hunt.hunters.size());
         for (const auto& hunter : hunt.hunters) {
-            Creature* h = creatures.getCreatureByID(hunter.creatureID);
+            Creature* h = findParticipant(hunter.creatureID);
             if (h) {
                 h->consumeFood(sharePerHunter);
             }
@@ -632,16 +700,16 @@ glm::vec3 PackHuntingBehavior::calculateTakedownForce(const Hunter& hunter, cons
     return glm::normalize(toTarget) * m_config.chaseSpeed * 1.2f;
 }
 
-float PackHuntingBehavior::calculateEncirclement(const Hunt& hunt, CreatureManager& creatures) {
-    Creature* target = creatures.getCreatureByID(hunt.targetID);
-    if (!target || hunt.hunters.size() < 2) return 0.0f;
+float PackHuntingBehavior::calculateEncirclement(const Hunt& hunt) {
+    if (hunt.hunters.size() < 2) return 0.0f;
 
-    glm::vec3 targetPos = target->getPosition();
+    glm::vec3 targetPos = hunt.track.position;
 
     // Calculate angle coverage around target
-    std::vector<float> angles;
+    std::vector<float>& angles = m_angleScratch;
+    angles.clear();
     for (const auto& hunter : hunt.hunters) {
-        Creature* h = creatures.getCreatureByID(hunter.creatureID);
+        Creature* h = findParticipant(hunter.creatureID);
         if (!h) continue;
 
         glm::vec3 toHunter = h->getPosition() - targetPos;
@@ -668,11 +736,30 @@ float PackHuntingBehavior::calculateEncirclement(const Hunt& hunt, CreatureManag
     return glm::clamp(coverage, 0.0f, 1.0f);
 }
 
-glm::vec3 PackHuntingBehavior::predictPreyPosition(const Creature* prey, float timeAhead) {
-    if (!prey) return glm::vec3(0.0f);
-
-    glm::vec3 pos = prey->getPosition();
-    glm::vec3 vel = prey->getVelocity();
+glm::vec3 PackHuntingBehavior::predictIntercept(const glm::vec3& preyPos, const glm::vec3& preyVel,
+                                                const glm::vec3& packCenter, float packSpeed) const {
+    // Smallest t > 0 with |preyPos + preyVel * t - packCenter| = packSpeed * t
+    const glm::vec3 offset = preyPos - packCenter;
+    const float a = glm::dot(preyVel, preyVel) - packSpeed * packSpeed;
+    const float b = 2.0f * glm::dot(offset, preyVel);
+    const float c = glm::dot(offset, offset);
+
+    // Prey the pack can't catch is led by the full horizon
+    float t = m_config.maxInterceptTime;
+    if (std::abs(a) < 1e-4f) {
+        if (b < 0.0f) t = -c / b;
+    } else {
+        const float disc = b * b - 4.0f * a * c;
+        if (disc >= 0.0f) {
+            const float root = std::sqrt(disc);
+            const float t1 = (-b - root) / (2.0f * a);
+            const float t2 = (-b + root) / (2.0f * a);
+            if (t1 > 0.0f && t2 > 0.0f) t = std::min(t1, t2);
+            else if (t1 > 0.0f) t = t1;
+            else if (t2 > 0.0f) t = t2;
+        }
+    }
 
-    return pos + vel * timeAhead;
+    t = glm::clamp(t, 0.0f, m_config.maxInterceptTime);
+    return preyPos + preyVel * t;
 }
@@ -49,17 +49,28 @@ class PackHuntingBehavior {
     struct Hunter {
         uint32_t creatureID = 0;
         HuntRole role = HuntRole::NONE;
-        glm::vec3 assignedPosition{0.0f};   // Target position for role
+        glm::vec3 assignedPosition{0.0f};   // Target position for role, interpolated between plans
+        glm::vec3 planFrom{0.0f};           // assignedPosition when the last plan ran
+        glm::vec3 planTo{0.0f};             // Role position planned for the next plan time
         float fatigue = 0.0f;               // Accumulates during chase
         bool inPosition = false;            // Ready for phase transition
     };
 
+    // Prey state sampled when the hunt was last planned
+    struct PreyTrack {
+        glm::vec3 position{0.0f};
+        glm::vec3 velocity{0.0f};
+        glm::vec3 intercept{0.0f};          // Where the pack can meet the prey
+        float sampleTime = 0.0f;
+    };
+
     struct Hunt {
         uint32_t huntID = 0;
         uint32_t targetID = 0;              // Prey creature ID
         std::vector<Hunter> hunters;
-        glm::vec3 targetLastKnownPos{0.0f}; // Updated each frame
-        glm::vec3 targetPredictedPos{0.0f}; // Where prey will be
+        PreyTrack track;
+        glm::vec3 targetLastKnownPos{0.0f}; // Track extrapolated to the current frame
+        glm::vec3 targetPredictedPos{0.0f}; // Predicted intercept
         HuntPhase phase = HuntPhase::NONE;
         float startTime = 0.0f;
         float phaseStartTime = 0.0f;
@@ -83,6 +94,8 @@ class PackHuntingBehavior {
         float chaseDuration = 20.0f;        // Max time before abandoning chase
         float cooldownAfterHunt = 15.0f;    // Rest time after hunt
         float successBonus = 50.0f;         // Energy gain on successful hunt
+        float planInterval = 0.5f;          // Seconds between hunt plans (roles, tracks, new hunts)
+        float maxInterceptTime = 4.0f;      // Longest lead used when predicting an intercept
     };
 
     PackHuntingBehavior() = default;
@@ -138,34 +151,54 @@ class PackHuntingBehavior {
     int getSuccessfulHunts() const { return m_successfulHunts; }
     int getFailedHunts() const { return m_failedHunts; }
 
+    /**
+     * @brief Earliest point where hunters at packCenter moving at packSpeed can
+     *        meet the prey, capped at maxInterceptTime ahead
+     */
+    glm::vec3 predictIntercept(const glm::vec3& preyPos, const glm::vec3& preyVel,
+                               const glm::vec3& packCenter, float packSpeed) const;
+
 private:
+    // Look up every pack predator and hunted prey in one pass over the creatures
+    void resolveParticipants(CreatureManager& creatures);
+
+    // Living participant resolved this frame, or nullptr
+    Creature* findParticipant(uint32_t creatureID) const;
+
     // Try to initiate new hunts for pack groups
-    void initiateNewHunts(CreatureManager& creatures, const SocialGroupManager& groups,
-                          const SpatialGrid& grid, const FoodChainManager& foodChain);
+    void initiateNewHunts(const SocialGroupManager& groups, const SpatialGrid& grid,
+                          const FoodChainManager& foodChain);
 
     // Update existing hunts
-    void updateActiveHunts(float deltaTime, CreatureManager& creatures, const SpatialGrid& grid);
+    void updateActiveHunts(float deltaTime);
+
+    // Re-plan every active hunt: sample prey tracks, reassign roles and
+    // set the role positions to interpolate toward
+    void planHunts();
 
     // Assign roles to hunters based on position
-    void assignRoles(Hunt& hunt, CreatureManager& creatures);
+    void assignRoles(Hunt& hunt);
+
+    // Sample the prey's position and velocity and predict an intercept
+    void updateTargetTracking(Hunt& hunt, const Creature* target);
 
-    // Update target tracking
-    void updateTargetTracking(Hunt& hunt, CreatureManager& creatures);
+    // Calculate the role positions for the next plan time
+    void calculateRolePositions(Hunt& hunt);
 
-    // Calculate assigned positions for each role
-    void calculateRolePositions(Hunt& hunt, CreatureManager& creatures);
+    // Move assigned positions along the path between plans
+    void interpolateRolePositions(Hunt& hunt);
 
     // Check phase transition conditions
-    bool shouldAdvancePhase(const Hunt& hunt, CreatureManager& creatures);
+    bool shouldAdvancePhase(const Hunt& hunt, const Creature* target);
 
     // Advance to next hunt phase
     void advancePhase(Hunt& hunt);
 
     // Check if hunt should be abandoned
-    bool shouldAbandonHunt(const Hunt& hunt, CreatureManager& creatures);
+    bool shouldAbandonHunt(const Hunt& hunt, const Creature* target);
 
     // Process hunt completion (success or failure)
-    void completeHunt(Hunt& hunt, bool success, CreatureManager& creatures);
+    void completeHunt(Hunt& hunt, bool success);
 
     // Calculate force for stalking phase
     glm::vec3 calculateStalkingForce(const Hunter& hunter, const Hunt& hunt, Creature* creature);
@@ -180,10 +213,7 @@ class PackHuntingBehavior {
     glm::vec3 calculateTakedownForce(const Hunter& hunter, const Hunt& hunt, Creature* creature);
 
     // Calculate encirclement score (how surrounded prey is)
-    float calculateEncirclement(const Hunt& hunt, CreatureManager& creatures);
-
-    // Predict where prey will be in the near future
-    glm::vec3 predictPreyPosition(const Creature* prey, float timeAhead);
+    float calculateEncirclement(const Hunt& hunt);
 
     std::unordered_map<uint32_t, Hunt> m_activeHunts;          // huntID -> Hunt
     std::unordered_map<uint32_t, uint32_t> m_creatureToHunt;   // creatureID -> huntID
@@ -192,6 +222,12 @@ class PackHuntingBehavior {
     std::unordered_map<uint32_t, float> m_huntCooldowns;       // creatureID -> cooldown remaining
     std::unordered_set<uint32_t> m_huntsToRemove;
 
+    // Per-frame participant lookup and planning state
+    std::unordered_map<uint32_t, Creature*> m_participants;     // creatureID -> creature
+    std::vector<Creature*> m_preyCandidates;                    // Scratch for prey selection
+    std::vector<float> m_angleScratch;                          // Scratch for encirclement
+    float m_planTimer = 0.0f;                                   // Time since the last plan
+
     uint32_t m_nextHuntID = 1;
     HuntingConfig m_config;
     float m_currentTime = 0.0f;
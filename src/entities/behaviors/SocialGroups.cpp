@@ -1,10 +1,81 @@
 #include "SocialGroups.h"
 #include "../Creature.h"
 #include "../../core/CreatureManager.h"
-#include "../../utils/SpatialGrid.h"
 #include <glm/gtc/constants.hpp>
 #include <algorithm>
 #include <cmath>
+#include <numeric>
+
+namespace {
+
+inline uint32_t hashCell(const glm::ivec2& cell, uint32_t mask) {
+    return (static_cast<uint32_t>(cell.x) * 73856093u ^
+            static_cast<uint32_t>(cell.y) * 83492791u) & mask;
+}
+
+// Counting sort of point indices into hashed XZ cells of cellSize
+template <typename Index, typename PositionOf>
+void buildCellIndex(Index& index, size_t count, float cellSize, PositionOf&& positionOf) {
+    index.invCellSize = 1.0f / std::max(cellSize, 0.001f);
+
+    uint32_t buckets = 16;
+    while (buckets < count * 2) buckets <<= 1;
+    index.bucketMask = buckets - 1;
+
+    index.pointCells.resize(count);
+    index.entries.resize(count);
+    index.bucketStart.assign(buckets + 1, 0);
+
+    for (size_t i = 0; i < count; ++i) {
+        const glm::vec3 position = positionOf(i);
+        const glm::ivec2 cell(static_cast<int>(std::floor(position.x * index.invCellSize)),
+                              static_cast<int>(std::floor(position.z * index.invCellSize)));
+        index.pointCells[i] = cell;
+        index.bucketStart[hashCell(cell, index.bucketMask) + 1]++;
+    }
+    for (uint32_t b = 0; b < buckets; ++b) {
+        index.bucketStart[b + 1] += index.bucketStart[b];
+    }
+
+    // Fill using the next-free offset, then shift back so bucketStart[b]
+    // is the start of bucket b again
+    for (size_t i = 0; i < count; ++i) {
+        index.entries[index.bucketStart[hashCell(index.pointCells[i], index.bucketMask)]++] =
+            static_cast<uint32_t>(i);
+    }
+    for (uint32_t b = buckets; b > 0; --b) {
+        index.bucketStart[b] = index.bucketStart[b - 1];
+    }
+    index.bucketStart[0] = 0;
+}
+
+// Visit every point in the 3x3 block of cells around center
+template <typename Index, typename Visit>
+void visitNearbyCells(const Index& index, const glm::ivec2& center, Visit&& visit) {
+    for (int dz = -1; dz <= 1; ++dz) {
+        for (int dx = -1; dx <= 1; ++dx) {
+            const glm::ivec2 cell(center.x + dx, center.y + dz);
+            const uint32_t bucket = hashCell(cell, index.bucketMask);
+            for (uint32_t e = index.bucketStart[bucket]; e < index.bucketStart[bucket + 1]; ++e) {
+                const uint32_t point = index.entries[e];
+                // Different cells can share a bucket
+                if (index.pointCells[point] == cell) {
+                    visit(point);
+                }
+            }
+        }
+    }
+}
+
+inline uint32_t findRoot(std::vector<uint32_t>& parent, uint32_t i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];  // Path halving
+        i = parent[i];
+    }
+    return i;
+}
+
+} // namespace
 
 // Static helper functions
 SocialGroupManager::GroupType SocialGroupManager::getGroupTypeForCreature(CreatureType type) {
@@ -42,20 +113,23 @@ bool SocialGroupManager::isSocialType(CreatureType type) {
     return getGroupTypeForCreature(type) != GroupType::SOLITARY;
 }
 
-void SocialGroupManager::update(float deltaTime, CreatureManager& creatures, const SpatialGrid& grid) {
+void SocialGroupManager::update(float deltaTime, CreatureManager& creatures) {
     m_currentTime += deltaTime;
 
+    // Snapshot social creatures once; everything below reads the cache
+    cacheMembers(creatures);
+
     // Update existing groups first
-    updateExistingGroups(deltaTime, creatures);
+    updateExistingGroups(deltaTime);
 
     // Try to form new groups
-    formNewGroups(creatures, grid);
+    formNewGroups();
 
     // Merge nearby groups
-    mergeNearbyGroups(creatures);
+    mergeNearbyGroups();
 
     // Split oversized groups
-    splitOversizedGroups(creatures);
+    splitOversizedGroups();
 
     // Clean up empty groups
     for (uint32_t id : m_groupsToRemove) {
@@ -157,76 +231,155 @@ size_t SocialGroupManager::getLargestGroupSize() const {
     return largest;
 }
 
-void SocialGroupManager::formNewGroups(CreatureManager& creatures, const SpatialGrid& grid) {
-    // Find ungrouped social creatures
-    std::vector<Creature*> ungrouped;
+void SocialGroupManager::cacheMembers(CreatureManager& creatures) {
+    m_cache.ids.clear();
+    m_cache.creatures.clear();
+    m_cache.positions.clear();
+    m_cache.velocities.clear();
+    m_cache.types.clear();
+    m_cache.slotOf.clear();
 
     creatures.forEach([&](Creature& c, size_t) {
         if (!c.isAlive()) return;
         if (!isSocialType(c.getType())) return;
-        if (m_creatureToGroup.count(c.getID()) > 0) return;
 
-        ungrouped.push_back(&c);
+        const uint32_t id = static_cast<uint32_t>(c.getID());
+        m_cache.slotOf.emplace(id, static_cast<uint32_t>(m_cache.ids.size()));
+        m_cache.ids.push_back(id);
+        m_cache.creatures.push_back(&c);
+        m_cache.positions.push_back(c.getPosition());
+        m_cache.velocities.push_back(c.getVelocity());
+        m_cache.types.push_back(c.getType());
     });
+}
 
-    // Try to form groups from clusters of ungrouped creatures
-    std::unordered_set<uint32_t> processed;
+uint32_t SocialGroupManager::findSlot(uint32_t creatureID) const {
+    auto it = m_cache.slotOf.find(creatureID);
+    return it != m_cache.slotOf.end() ? it->second : NO_SLOT;
+}
 
-    for (Creature* creature : ungrouped) {
-        if (processed.count(creature->getID()) > 0) continue;
+void SocialGroupManager::formNewGroups() {
+    // Find ungrouped social creatures
+    m_ungrouped.clear();
+    for (uint32_t slot = 0; slot < m_cache.ids.size(); ++slot) {
+        if (m_creatureToGroup.count(m_cache.ids[slot]) == 0) {
+            m_ungrouped.push_back(slot);
+        }
+    }
+
+    const size_t minSize = std::max<size_t>(1, static_cast<size_t>(m_config.minGroupSize));
+    const size_t maxSize = std::max<size_t>(1, static_cast<size_t>(m_config.maxGroupSize));
+    const size_t count = m_ungrouped.size();
+    if (count < minSize) return;
+
+    // Creatures of the same type within groupFormDistance (in XZ, like
+    // SpatialGrid::query) are linked; each connected cluster is a candidate
+    // group. One cell spans the link distance, so links never leave the 3x3
+    // block of cells around a creature.
+    const float formDistance = std::max(m_config.groupFormDistance, 0.001f);
+    const float formDistanceSq = formDistance * formDistance;
+    buildCellIndex(m_cellIndex, count, formDistance,
+                   [&](size_t i) { return m_cache.positions[m_ungrouped[i]]; });
+
+    m_componentParent.resize(count);
+    std::iota(m_componentParent.begin(), m_componentParent.end(), 0u);
+
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint32_t slot = m_ungrouped[i];
+        const glm::vec3& position = m_cache.positions[slot];
+
+        visitNearbyCells(m_cellIndex, m_cellIndex.pointCells[i], [&](uint32_t j) {
+            if (j <= i) return;  // Each pair once
+            const uint32_t other = m_ungrouped[j];
+            if (m_cache.types[other] != m_cache.types[slot]) return;
+
+            const float dx = m_cache.positions[other].x - position.x;
+            const float dz = m_cache.positions[other].z - position.z;
+            if (dx * dx + dz * dz > formDistanceSq) return;
+
+            // Lower index becomes the root, so results don't depend on visit order
+            uint32_t a = findRoot(m_componentParent, i);
+            uint32_t b = findRoot(m_componentParent, j);
+            if (a != b) {
+                m_componentParent[std::max(a, b)] = std::min(a, b);
+            }
+        });
+    }
 
-        // Find nearby ungrouped creatures of same type
-        auto& nearby = grid.query(creature->getPosition(), m_config.groupFormDistance);
-        std::vector<Creature*> potentialMembers;
+    // Bucket members by component root (counting sort)
+    m_componentStart.assign(count + 1, 0);
+    for (uint32_t i = 0; i < count; ++i) {
+        m_componentStart[findRoot(m_componentParent, i) + 1]++;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        m_componentStart[i + 1] += m_componentStart[i];
+    }
+    m_componentMembers.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        m_componentMembers[m_componentStart[findRoot(m_componentParent, i)]++] = m_ungrouped[i];
+    }
+    for (uint32_t i = static_cast<uint32_t>(count); i > 0; --i) {
+        m_componentStart[i] = m_componentStart[i - 1];
+    }
+    m_componentStart[0] = 0;
 
-        for (Creature* other : nearby) {
-            if (!other || !other->isAlive()) continue;
-            if (other->getType() != creature->getType()) continue;
-            if (m_creatureToGroup.count(other->getID()) > 0) continue;
-            if (processed.count(other->getID()) > 0) continue;
+    for (uint32_t root = 0; root < count; ++root) {
+        uint32_t* members = m_componentMembers.data() + m_componentStart[root];
+        const size_t size = m_componentStart[root + 1] - m_componentStart[root];
+        if (size < minSize) continue;
 
-            potentialMembers.push_back(other);
+        if (size <= maxSize) {
+            createGroup(members, size);
+            continue;
         }
 
-        // Need at least minGroupSize to form a group
-        if (potentialMembers.size() >= static_cast<size_t>(m_config.minGroupSize)) {
-            // Create new group
-            uint32_t groupID = m_nextGroupID++;
-
-            Group newGroup;
-            newGroup.groupID = groupID;
-            newGroup.creatureType = creature->getType();
-            newGroup.groupType = getGroupTypeForCreature(creature->getType());
-            newGroup.cohesion = 1.0f;
-            newGroup.formationRadius = m_config.groupFormDistance;
-            newGroup.age = 0.0f;
-
-            // Add members (up to maxGroupSize)
-            size_t count = 0;
-            for (Creature* member : potentialMembers) {
-                if (count >= static_cast<size_t>(m_config.maxGroupSize)) break;
-
-                GroupMember gm;
-                gm.creatureID = member->getID();
-                gm.joinTime = m_currentTime;
-                gm.loyalty = 0.3f;
-                gm.isLeader = false;
-
-                newGroup.members.push_back(gm);
-                m_creatureToGroup[member->getID()] = groupID;
-                processed.insert(member->getID());
-                count++;
+        // Too big for one group: sweep along X and cut into near-equal strips
+        std::sort(members, members + size, [&](uint32_t a, uint32_t b) {
+            return m_cache.positions[a].x < m_cache.positions[b].x;
+        });
+
+        const size_t groupCount = (size + maxSize - 1) / maxSize;
+        size_t begin = 0;
+        for (size_t g = 0; g < groupCount; ++g) {
+            const size_t end = size * (g + 1) / groupCount;
+            if (end - begin >= minSize) {
+                createGroup(members + begin, end - begin);
             }
-
-            // Elect initial leader
-            m_groups[groupID] = newGroup;
-            electLeader(m_groups[groupID], creatures);
-            updateGroupStats(m_groups[groupID], creatures);
+            begin = end;
         }
     }
 }
 
-void SocialGroupManager::updateExistingGroups(float deltaTime, CreatureManager& creatures) {
+void SocialGroupManager::createGroup(const uint32_t* slots, size_t count) {
+    uint32_t groupID = m_nextGroupID++;
+    const CreatureType type = m_cache.types[slots[0]];
+
+    Group& newGroup = m_groups[groupID];
+    newGroup.groupID = groupID;
+    newGroup.creatureType = type;
+    newGroup.groupType = getGroupTypeForCreature(type);
+    newGroup.cohesion = 1.0f;
+    newGroup.formationRadius = m_config.groupFormDistance;
+    newGroup.age = 0.0f;
+    newGroup.members.reserve(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        GroupMember gm;
+        gm.creatureID = m_cache.ids[slots[i]];
+        gm.joinTime = m_currentTime;
+        gm.loyalty = 0.3f;
+        gm.isLeader = false;
+
+        newGroup.members.push_back(gm);
+        m_creatureToGroup[gm.creatureID] = groupID;
+    }
+
+    // Elect initial leader
+    electLeader(newGroup);
+    updateGroupStats(newGroup);
+}
+
+void SocialGroupManager::updateExistingGroups(float deltaTime) {
     for (auto& [groupID, group] : m_groups) {
         group.age += deltaTime;
 
@@ -234,16 +387,16 @@ void SocialGroupManager::updateExistingGroups(float deltaTime, CreatureManager&
         std::vector<size_t> toRemove;
         for (size_t i = 0; i < group.members.size(); i++) {
             GroupMember& member = group.members[i];
-            Creature* creature = creatures.getCreatureByID(member.creatureID);
+            const uint32_t slot = findSlot(member.creatureID);
 
-            if (!creature || !creature->isAlive()) {
+            if (slot == NO_SLOT) {
                 toRemove.push_back(i);
                 m_creatureToGroup.erase(member.creatureID);
                 continue;
             }
 
             // Check distance from group centroid
-            float dist = glm::distance(creature->getPosition(), group.centroid);
+            float dist = glm::distance(m_cache.positions[slot], group.centroid);
             if (dist > m_config.groupBreakDistance) {
                 // Too far - decrease loyalty
                 member.loyalty -= m_config.loyaltyDecayRate * deltaTime * 2.0f;
@@ -283,64 +436,82 @@ void SocialGroupManager::updateExistingGroups(float deltaTime, CreatureManager&
         }
 
         if (!leaderValid) {
-            electLeader(group, creatures);
+            electLeader(group);
         }
 
         // Update group statistics
-        updateGroupStats(group, creatures);
+        updateGroupStats(group);
 
         // Periodically challenge leader (every ~30 seconds)
         if (std::fmod(group.age, 30.0f) < deltaTime) {
-            electLeader(group, creatures);
+            electLeader(group);
         }
     }
 }
 
-void SocialGroupManager::mergeNearbyGroups(CreatureManager& creatures) {
-    std::vector<std::pair<uint32_t, uint32_t>> toMerge;
+void SocialGroupManager::mergeNearbyGroups() {
+    // Live groups, oldest first: the older group absorbs the newer one
+    m_mergeOrder.clear();
+    float maxRadius = 0.0f;
+    for (auto& [id, group] : m_groups) {
+        if (m_groupsToRemove.count(id) > 0) continue;
+        m_mergeOrder.push_back(&group);
+        maxRadius = std::max(maxRadius, group.formationRadius);
+    }
+    if (m_mergeOrder.size() < 2) return;
+
+    std::sort(m_mergeOrder.begin(), m_mergeOrder.end(),
+              [](const Group* a, const Group* b) { return a->groupID < b->groupID; });
+
+    // Index centroids; the merge threshold never exceeds the widest
+    // formation radius, so candidates lie in the surrounding 3x3 cells
+    const size_t maxSize = static_cast<size_t>(m_config.maxGroupSize);
+    buildCellIndex(m_cellIndex, m_mergeOrder.size(), maxRadius,
+                   [&](size_t i) { return m_mergeOrder[i]->centroid; });
 
-    for (auto& [id1, group1] : m_groups) {
-        for (auto& [id2, group2] : m_groups) {
-            if (id1 >= id2) continue;  // Avoid duplicate checks
-            if (group1.creatureType != group2.creatureType) continue;
+    for (uint32_t i = 0; i < m_mergeOrder.size(); ++i) {
+        Group& target = *m_mergeOrder[i];
+        if (m_groupsToRemove.count(target.groupID) > 0) continue;
 
-            float dist = glm::distance(group1.centroid, group2.centroid);
-            float mergeThreshold = (group1.formationRadius + group2.formationRadius) * 0.5f;
+        bool merged = false;
+        visitNearbyCells(m_cellIndex, m_cellIndex.pointCells[i], [&](uint32_t j) {
+            if (j <= i) return;
+            Group& source = *m_mergeOrder[j];
+            if (source.creatureType != target.creatureType) return;
+            if (m_groupsToRemove.count(source.groupID) > 0) return;
+
+            // Centroids as indexed, before this pass moved any members
+            float dist = glm::distance(target.centroid, source.centroid);
+            float mergeThreshold = (target.formationRadius + source.formationRadius) * 0.5f;
 
             // Check if groups are close and combined size is acceptable
-            if (dist < mergeThreshold &&
-                group1.members.size() + group2.members.size() <= static_cast<size_t>(m_config.maxGroupSize)) {
-                toMerge.emplace_back(id1, id2);
+            if (dist >= mergeThreshold ||
+                target.members.size() + source.members.size() > maxSize) {
+                return;
             }
-        }
-    }
 
-    // Perform merges
-    for (const auto& [id1, id2] : toMerge) {
-        auto it1 = m_groups.find(id1);
-        auto it2 = m_groups.find(id2);
-        if (it1 == m_groups.end() || it2 == m_groups.end()) continue;
+            // Move members from source to target
+            for (auto& member : source.members) {
+                member.loyalty *= 0.5f;  // Reduce loyalty during merge
+                target.members.push_back(member);
+                m_creatureToGroup[member.creatureID] = target.groupID;
+            }
+            source.members.clear();
 
-        Group& target = it1->second;
-        Group& source = it2->second;
+            // Mark source for removal
+            m_groupsToRemove.insert(source.groupID);
+            merged = true;
+        });
 
-        // Move members from source to target
-        for (auto& member : source.members) {
-            member.loyalty *= 0.5f;  // Reduce loyalty during merge
-            target.members.push_back(member);
-            m_creatureToGroup[member.creatureID] = id1;
+        if (merged) {
+            // Re-elect leader
+            electLeader(target);
+            updateGroupStats(target);
         }
-
-        // Re-elect leader
-        electLeader(target, creatures);
-        updateGroupStats(target, creatures);
-
-        // Mark source for removal
-        m_groupsToRemove.insert(id2);
     }
 }
 
-void SocialGroupManager::splitOversizedGroups(CreatureManager& creatures) {
+void SocialGroupManager::splitOversizedGroups() {
     std::vector<uint32_t> toSplit;
 
     for (const auto& [id, group] : m_groups) {
@@ -374,16 +545,16 @@ void SocialGroupManager::splitOversizedGroups(CreatureManager& creatures) {
         original.members.resize(splitPoint);
 
         // Update both groups
-        electLeader(original, creatures);
-        updateGroupStats(original, creatures);
+        electLeader(original);
+        updateGroupStats(original);
 
         m_groups[newGroupID] = newGroup;
-        electLeader(m_groups[newGroupID], creatures);
-        updateGroupStats(m_groups[newGroupID], creatures);
+        electLeader(m_groups[newGroupID]);
+        updateGroupStats(m_groups[newGroupID]);
     }
 }
 
-void SocialGroupManager::updateGroupStats(Group& group, CreatureManager& creatures) {
+void SocialGroupManager::updateGroupStats(Group& group) {
     if (group.members.empty()) return;
 
     glm::vec3 centroidSum(0.0f);
@@ -391,10 +562,10 @@ void SocialGroupManager::updateGroupStats(Group& group, CreatureManager& creatur
     int count = 0;
 
     for (const auto& member : group.members) {
-        Creature* creature = creatures.getCreatureByID(member.creatureID);
-        if (creature && creature->isAlive()) {
-            centroidSum += creature->getPosition();
-            velocitySum += creature->getVelocity();
+        const uint32_t slot = findSlot(member.creatureID);
+        if (slot != NO_SLOT) {
+            centroidSum += m_cache.positions[slot];
+            velocitySum += m_cache.velocities[slot];
             count++;
         }
     }
@@ -407,9 +578,9 @@ void SocialGroupManager::updateGroupStats(Group& group, CreatureManager& creatur
     // Update cohesion based on spread
     float maxDist = 0.0f;
     for (const auto& member : group.members) {
-        Creature* creature = creatures.getCreatureByID(member.creatureID);
-        if (creature && creature->isAlive()) {
-            float dist = glm::distance(creature->getPosition(), group.centroid);
+        const uint32_t slot = findSlot(member.creatureID);
+        if (slot != NO_SLOT) {
+            float dist = glm::distance(m_cache.positions[slot], group.centroid);
             maxDist = std::max(maxDist, dist);
         }
     }
@@ -417,7 +588,7 @@ void SocialGroupManager::updateGroupStats(Group& group, CreatureManager& creatur
     group.cohesion = 1.0f - glm::clamp(maxDist / group.formationRadius, 0.0f, 1.0f);
 }
 
-void SocialGroupManager::electLeader(Group& group, CreatureManager& creatures) {
+void SocialGroupManager::electLeader(Group& group) {
     if (group.members.empty()) return;
 
     // Find fittest member to be leader
@@ -428,8 +599,9 @@ void SocialGroupManager::electLeader(Group& group, CreatureManager& creatures) {
     for (auto& member : group.members) {
         member.isLeader = false;
 
-        Creature* creature = creatures.getCreatureByID(member.creatureID);
-        if (!creature || !creature->isAlive()) continue;
+        const uint32_t slot = findSlot(member.creatureID);
+        if (slot == NO_SLOT) continue;
+        Creature* creature = m_cache.creatures[slot];
 
         // Leadership score based on: fitness, energy, size, loyalty
         float score = creature->getFitness() * 0.3f +
@@ -457,15 +629,15 @@ void SocialGroupManager::electLeader(Group& group, CreatureManager& creatures) {
     }
 }
 
-void SocialGroupManager::updateFormation(Group& group, CreatureManager& creatures) {
+void SocialGroupManager::updateFormation(Group& group) {
     if (group.members.empty()) return;
 
-    Creature* leader = creatures.getCreatureByID(group.leaderID);
-    if (!leader || !leader->isAlive()) return;
+    const uint32_t leaderSlot = findSlot(group.leaderID);
+    if (leaderSlot == NO_SLOT) return;
 
-    glm::vec3 leaderPos = leader->getPosition();
-    glm::vec3 leaderDir = glm::normalize(leader->getVelocity());
-    if (glm::length(leader->getVelocity()) < 0.1f) {
+    const glm::vec3& leaderVelocity = m_cache.velocities[leaderSlot];
+    glm::vec3 leaderDir = glm::normalize(leaderVelocity);
+    if (glm::length(leaderVelocity) < 0.1f) {
         leaderDir = glm::vec3(1, 0, 0);  // Default direction
     }
 
@@ -539,18 +711,17 @@ glm::vec3 SocialGroupManager::calculateCohesionForce(Creature* creature, const G
     return glm::normalize(toCentroid) * strength * group.cohesion;
 }
 
-glm::vec3 SocialGroupManager::calculateSeparationForce(Creature* creature, const Group& group,
-                                                       CreatureManager& creatures) {
+glm::vec3 SocialGroupManager::calculateSeparationForce(Creature* creature, const Group& group) {
     glm::vec3 force(0.0f);
     float personalSpace = 2.5f;
 
     for (const auto& member : group.members) {
         if (member.creatureID == creature->getID()) continue;
 
-        Creature* other = creatures.getCreatureByID(member.creatureID);
-        if (!other || !other->isAlive()) continue;
+        const uint32_t slot = findSlot(member.creatureID);
+        if (slot == NO_SLOT) continue;
 
-        glm::vec3 away = creature->getPosition() - other->getPosition();
+        glm::vec3 away = creature->getPosition() - m_cache.positions[slot];
         float dist = glm::length(away);
 
         if (dist < personalSpace && dist > 0.01f) {
@@ -571,15 +742,14 @@ glm::vec3 SocialGroupManager::calculateAlignmentForce(Creature* creature, const
     return (desiredVel - currentVel) * 0.1f;
 }
 
-glm::vec3 SocialGroupManager::calculateFormationForce(Creature* creature, const Group& group,
-                                                      CreatureManager& creatures) {
-    Creature* leader = creatures.getCreatureByID(group.leaderID);
-    if (!leader || !leader->isAlive()) return glm::vec3(0.0f);
+glm::vec3 SocialGroupManager::calculateFormationForce(Creature* creature, const Group& group) {
+    const uint32_t leaderSlot = findSlot(group.leaderID);
+    if (leaderSlot == NO_SLOT) return glm::vec3(0.0f);
 
     // Find this creature's target offset
     for (const auto& member : group.members) {
         if (member.creatureID == creature->getID()) {
-            glm::vec3 targetPos = leader->getPosition() + member.targetOffset;
+            glm::vec3 targetPos = m_cache.positions[leaderSlot] + member.targetOffset;
             glm::vec3 toTarget = targetPos - creature->getPosition();
             float dist = glm::length(toTarget);
 
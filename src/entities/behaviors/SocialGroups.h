@@ -9,7 +9,6 @@
 
 // Forward declarations
 class Creature;
-class SpatialGrid;
 namespace Forge { class CreatureManager; }
 using Forge::CreatureManager;
 
@@ -73,7 +72,7 @@ class SocialGroupManager {
     /**
      * @brief Update all social groups - called once per frame
      */
-    void update(float deltaTime, CreatureManager& creatures, const SpatialGrid& grid);
+    void update(float deltaTime, CreatureManager& creatures);
 
     /**
      * @brief Calculate social steering force for a creature
@@ -132,38 +131,72 @@ class SocialGroupManager {
     static bool isSocialType(CreatureType type);
 
 private:
-    // Try to form new groups from ungrouped creatures
-    void formNewGroups(CreatureManager& creatures, const SpatialGrid& grid);
+    // Per-update snapshot of every living social creature, stored as parallel
+    // arrays indexed by slot. Built with one pass over the creature manager so
+    // group maintenance never has to search for a creature by ID.
+    struct MemberCache {
+        std::vector<uint32_t> ids;
+        std::vector<Creature*> creatures;
+        std::vector<glm::vec3> positions;
+        std::vector<glm::vec3> velocities;
+        std::vector<CreatureType> types;
+        std::unordered_map<uint32_t, uint32_t> slotOf;     // creatureID -> slot
+    };
+
+    // Uniform hash grid over points in the XZ plane, rebuilt when used.
+    // Buckets are stored CSR-style: entries[bucketStart[b] .. bucketStart[b + 1])
+    // are the point indices whose cell hashes to bucket b.
+    struct CellIndex {
+        float invCellSize = 1.0f;
+        uint32_t bucketMask = 0;
+        std::vector<uint32_t> bucketStart;
+        std::vector<uint32_t> entries;
+        std::vector<glm::ivec2> pointCells;     // Cell of each point, by point index
+    };
+
+    static constexpr uint32_t NO_SLOT = 0xFFFFFFFFu;
+
+    // Refresh the member cache from the creature manager
+    void cacheMembers(CreatureManager& creatures);
+
+    // Slot of a living social creature, or NO_SLOT
+    uint32_t findSlot(uint32_t creatureID) const;
+
+    // Form groups from connected clusters of ungrouped creatures
+    void formNewGroups();
+
+    // Create a group from cached member slots
+    void createGroup(const uint32_t* slots, size_t count);
 
     // Update existing groups (remove dead, check distances)
-    void updateExistingGroups(float deltaTime, CreatureManager& creatures);
+    void updateExistingGroups(float deltaTime);
 
     // Merge nearby groups of same type
-    void mergeNearbyGroups(CreatureManager& creatures);
+    void mergeNearbyGroups();
 
     // Split oversized groups
-    void splitOversizedGroups(CreatureManager& creatures);
+    void splitOversizedGroups();
 
     // Update group centroid and average velocity
-    void updateGroupStats(Group& group, CreatureManager& creatures);
+    void updateGroupStats(Group& group);
 
     // Select best leader for a group
-    void electLeader(Group& group, CreatureManager& creatures);
+    void electLeader(Group& group);
 
     // Calculate formation positions for members
-    void updateFormation(Group& group, CreatureManager& creatures);
+    void updateFormation(Group& group);
 
     // Calculate force to maintain group cohesion
     glm::vec3 calculateCohesionForce(Creature* creature, const Group& group);
 
     // Calculate force for separation (personal space)
-    glm::vec3 calculateSeparationForce(Creature* creature, const Group& group, CreatureManager& creatures);
+    glm::vec3 calculateSeparationForce(Creature* creature, const Group& group);
 
     // Calculate force for velocity alignment
     glm::vec3 calculateAlignmentForce(Creature* creature, const Group& group);
 
     // Calculate force to maintain formation position
-    glm::vec3 calculateFormationForce(Creature* creature, const Group& group, CreatureManager& creatures);
+    glm::vec3 calculateFormationForce(Creature* creature, const Group& group);
 
     // Add creature to a group
     void addToGroup(uint32_t groupID, uint32_t creatureID);
@@ -177,4 +210,13 @@ class SocialGroupManager {
     uint32_t m_nextGroupID = 1;
     SocialConfig m_config;
     float m_currentTime = 0.0f;
+
+    // Scratch state reused across updates
+    MemberCache m_cache;
+    CellIndex m_cellIndex;
+    std::vector<uint32_t> m_ungrouped;          // Slots of ungrouped creatures
+    std::vector<uint32_t> m_componentParent;    // Union-find forest over m_ungrouped
+    std::vector<uint32_t> m_componentStart;     // Components bucketed by root, CSR-style
+    std::vector<uint32_t> m_componentMembers;
+    std::vector<Group*> m_mergeOrder;           // Live groups by ascending ID
 };
@@ -4,31 +4,78 @@
 #include "../../utils/SpatialGrid.h"
 #include <glm/gtc/constants.hpp>
 #include <algorithm>
+#include <cmath>
+
+namespace {
+
+inline uint64_t cellKey(const glm::ivec2& cell) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cell.x)) << 32) |
+           static_cast<uint32_t>(cell.y);
+}
+
+inline glm::ivec2 cellOf(float x, float z, float invCellSize) {
+    return glm::ivec2(static_cast<int>(std::floor(x * invCellSize)),
+                      static_cast<int>(std::floor(z * invCellSize)));
+}
+
+} // namespace
+
+template <typename Visit>
+void TerritorialBehavior::forEachTerritoryAt(const glm::vec3& position, Visit&& visit) const {
+    if (m_index.cells.empty()) return;
+
+    auto cell = m_index.cells.find(cellKey(cellOf(position.x, position.z, m_index.invCellSize)));
+    if (cell == m_index.cells.end()) return;
+
+    for (uint32_t ownerID : cell->second) {
+        auto it = m_territories.find(ownerID);
+        if (it != m_territories.end()) {
+            visit(it->second);
+        }
+    }
+}
 
 void TerritorialBehavior::update(float deltaTime, CreatureManager& creatures, const SpatialGrid& grid) {
     m_currentTime += deltaTime;
+    refreshIndexCellSize();
+
+    // Only one slice of territories is updated per call, with the time that
+    // slice has accumulated since it was last visited
+    const uint32_t slices = static_cast<uint32_t>(std::max(1, m_config.updateSlices));
+    if (m_sliceElapsed.size() != slices) {
+        m_sliceElapsed.assign(slices, 0.0f);
+        m_sliceTerritories.assign(slices, 0);
+        for (const auto& [ownerID, territory] : m_territories) {
+            m_sliceTerritories[ownerID % slices]++;
+        }
+        m_sliceCursor = 0;
+    }
+    for (float& elapsed : m_sliceElapsed) {
+        elapsed += deltaTime;
+    }
+    const uint32_t slice = m_sliceCursor;
+    const float sliceTime = m_sliceElapsed[slice];
+    m_sliceElapsed[slice] = 0.0f;
+    m_sliceCursor = (m_sliceCursor + 1) % slices;
 
-    // First pass: remove territories of dead creatures
-    removeDeadOwnerTerritories(creatures);
+    // First pass: pair this slice's territories with their owners
+    resolveOwners(creatures, slice);
 
-    // Second pass: update all active territories
-    for (auto& [ownerID, territory] : m_territories) {
-        Creature* owner = creatures.getCreatureByID(ownerID);
-        if (!owner || !owner->isAlive()) {
-            // Shouldn't happen after removeDeadOwnerTerritories, but be safe
-            continue;
-        }
+    // Second pass: update this slice's active territories
+    for (auto& [territoryPtr, owner] : m_activeOwners) {
+        Territory& territory = *territoryPtr;
+        const uint32_t ownerID = territory.ownerID;
 
         // Update territory center to drift toward owner position
-        updateTerritoryCenter(territory, owner->getPosition(), deltaTime);
+        updateTerritoryCenter(territory, owner->getPosition(), sliceTime);
 
         // Increase territory strength over time (establishment)
         if (glm::distance(owner->getPosition(), territory.center) < territory.radius * 0.5f) {
             // Owner is within core territory - strengthen it
-            territory.strength = glm::min(1.0f, territory.strength + m_config.strengthGainRate * deltaTime);
+            territory.strength = glm::min(1.0f, territory.strength + m_config.strengthGainRate * sliceTime);
         } else if (glm::distance(owner->getPosition(), territory.center) > territory.radius) {
             // Owner is outside territory - weaken it
-            territory.strength = glm::max(0.0f, territory.strength - m_config.strengthDecayRate * deltaTime);
+            territory.strength = glm::max(0.0f, territory.strength - m_config.strengthDecayRate * sliceTime);
 
             // If too far for too long, mark for removal
             if (glm::distance(owner->getPosition(), territory.center) > territory.radius * m_config.abandonDistance) {
@@ -51,18 +98,22 @@ void TerritorialBehavior::update(float deltaTime, CreatureManager& creatures, co
         float age = m_currentTime - territory.establishedTime;
         if (age > m_config.maxTerritoryAge) {
             float ageFactor = (age - m_config.maxTerritoryAge) / m_config.maxTerritoryAge;
-            territory.strength *= (1.0f - ageFactor * 0.1f * deltaTime);
+            territory.strength *= (1.0f - ageFactor * 0.1f * sliceTime);
         }
+
+        // The center drifted; re-file it if it crossed a cell boundary
+        reindexTerritory(territory);
     }
 
     // Deferred removal of abandoned territories
     for (uint32_t id : m_territoriesToRemove) {
-        m_territories.erase(id);
+        eraseTerritory(id);
     }
     m_territoriesToRemove.clear();
+    m_activeOwners.clear();
 }
 
-glm::vec3 TerritorialBehavior::calculateForce(Creature* creature, const SpatialGrid& grid) {
+glm::vec3 TerritorialBehavior::calculateForce(Creature* creature) {
     if (!creature || !creature->isAlive()) {
         return glm::vec3(0.0f);
     }
@@ -73,7 +124,7 @@ glm::vec3 TerritorialBehavior::calculateForce(Creature* creature, const SpatialG
     auto it = m_territories.find(creatureID);
     if (it != m_territories.end()) {
         // Owner behavior: defend territory from intruders
-        return calculateOwnerForce(creature, it->second, grid);
+        return calculateOwnerForce(creature, it->second);
     } else {
         // Non-owner behavior: avoid other creatures' territories
         return calculateIntruderForce(creature);
@@ -98,15 +149,17 @@ bool TerritorialBehavior::tryEstablishTerritory(Creature* creature, float resour
     }
 
     // Check if position overlaps with existing strong territories
+    refreshIndexCellSize();
     glm::vec3 pos = creature->getPosition();
-    for (const auto& [otherID, territory] : m_territories) {
-        if (territory.strength > 0.5f) {
-            float dist = glm::distance(pos, territory.center);
-            if (dist < territory.radius * 0.8f) {
-                // Too close to established territory
-                return false;
-            }
+    bool blocked = false;
+    forEachTerritoryAt(pos, [&](const Territory& territory) {
+        if (territory.strength > 0.5f && glm::distance(pos, territory.center) < territory.radius * 0.8f) {
+            // Too close to established territory
+            blocked = true;
         }
+    });
+    if (blocked) {
+        return false;
     }
 
     // Establish new territory
@@ -120,12 +173,22 @@ bool TerritorialBehavior::tryEstablishTerritory(Creature* creature, float resour
     newTerritory.intrusionCount = 0;
     newTerritory.lastDefenseTime = m_currentTime;
 
-    m_territories[creatureID] = newTerritory;
+    // Indexed at once, so later claims this frame see it
+    Territory& territory = m_territories[creatureID];
+    territory = newTerritory;
+    indexTerritory(territory);
+    if (!m_sliceTerritories.empty()) {
+        m_sliceTerritories[creatureID % m_sliceTerritories.size()]++;
+    }
     return true;
 }
 
 void TerritorialBehavior::abandonTerritory(uint32_t creatureID) {
-    m_territories.erase(creatureID);
+    eraseTerritory(creatureID);
+}
+
+void TerritorialBehavior::onOwnerDeath(uint32_t creatureID) {
+    eraseTerritory(creatureID);
 }
 
 bool TerritorialBehavior::hasTerritory(uint32_t creatureID) const {
@@ -141,15 +204,16 @@ const TerritorialBehavior::Territory* TerritorialBehavior::getTerritory(uint32_t
 }
 
 uint32_t TerritorialBehavior::isInTerritory(const glm::vec3& position, uint32_t excludeOwnerID) const {
-    for (const auto& [ownerID, territory] : m_territories) {
-        if (ownerID == excludeOwnerID) continue;
+    uint32_t found = 0;
+    forEachTerritoryAt(position, [&](const Territory& territory) {
+        if (found != 0 || territory.ownerID == excludeOwnerID) return;
 
         float dist = glm::distance(position, territory.center);
         if (dist < territory.radius) {
-            return ownerID;
+            found = territory.ownerID;
         }
-    }
-    return 0;
+    });
+    return found;
 }
 
 float TerritorialBehavior::getAverageStrength() const {
@@ -170,20 +234,107 @@ int TerritorialBehavior::getTotalIntrusions() const {
     return total;
 }
 
-void TerritorialBehavior::removeDeadOwnerTerritories(CreatureManager& creatures) {
-    m_territoriesToRemove.clear();
+void TerritorialBehavior::resolveOwners(CreatureManager& creatures, uint32_t slice) {
+    m_activeOwners.clear();
+    m_seenOwners.clear();
+    if (m_sliceTerritories[slice] == 0) return;
+
+    // Creatures outside the slice are skipped before the map lookup
+    const uint32_t slices = static_cast<uint32_t>(m_sliceTerritories.size());
+    creatures.forEach([&](Creature& creature, size_t) {
+        if (!creature.isAlive()) return;
 
-    for (const auto& [ownerID, territory] : m_territories) {
-        Creature* owner = creatures.getCreatureByID(ownerID);
-        if (!owner || !owner->isAlive()) {
-            m_territoriesToRemove.push_back(ownerID);
+        const uint32_t id = static_cast<uint32_t>(creature.getID());
+        if (id % slices != slice) return;
+
+        auto it = m_territories.find(id);
+        if (it != m_territories.end()) {
+            m_activeOwners.emplace_back(&it->second, &creature);
+            m_seenOwners.push_back(id);
+        }
+    });
+
+    // Deaths normally arrive through onOwnerDeath(); anything in the slice
+    // left without an owner died unreported
+    if (m_activeOwners.size() == m_sliceTerritories[slice]) return;
+
+    std::sort(m_seenOwners.begin(), m_seenOwners.end());
+    for (auto it = m_territories.begin(); it != m_territories.end();) {
+        if (it->first % slices == slice &&
+            !std::binary_search(m_seenOwners.begin(), m_seenOwners.end(), it->first)) {
+            unindexTerritory(it->second);
+            it = m_territories.erase(it);
+            m_sliceTerritories[slice]--;
+        } else {
+            ++it;
         }
     }
+}
 
-    for (uint32_t id : m_territoriesToRemove) {
-        m_territories.erase(id);
+void TerritorialBehavior::eraseTerritory(uint32_t ownerID) {
+    auto it = m_territories.find(ownerID);
+    if (it == m_territories.end()) return;
+
+    unindexTerritory(it->second);
+    m_territories.erase(it);
+    if (!m_sliceTerritories.empty()) {
+        m_sliceTerritories[ownerID % m_sliceTerritories.size()]--;
+    }
+}
+
+void TerritorialBehavior::indexTerritory(Territory& territory) {
+    territory.indexCellMin = cellOf(territory.center.x - territory.radius,
+                                    territory.center.z - territory.radius, m_index.invCellSize);
+    territory.indexCellMax = cellOf(territory.center.x + territory.radius,
+                                    territory.center.z + territory.radius, m_index.invCellSize);
+
+    for (int z = territory.indexCellMin.y; z <= territory.indexCellMax.y; ++z) {
+        for (int x = territory.indexCellMin.x; x <= territory.indexCellMax.x; ++x) {
+            m_index.cells[cellKey(glm::ivec2(x, z))].push_back(territory.ownerID);
+        }
+    }
+}
+
+void TerritorialBehavior::unindexTerritory(const Territory& territory) {
+    for (int z = territory.indexCellMin.y; z <= territory.indexCellMax.y; ++z) {
+        for (int x = territory.indexCellMin.x; x <= territory.indexCellMax.x; ++x) {
+            auto cell = m_index.cells.find(cellKey(glm::ivec2(x, z)));
+            if (cell == m_index.cells.end()) continue;
+
+            std::vector<uint32_t>& owners = cell->second;
+            auto it = std::find(owners.begin(), owners.end(), territory.ownerID);
+            if (it != owners.end()) {
+                *it = owners.back();
+                owners.pop_back();
+            }
+            if (owners.empty()) {
+                m_index.cells.erase(cell);
+            }
+        }
+    }
+}
+
+void TerritorialBehavior::reindexTerritory(Territory& territory) {
+    const glm::ivec2 lo = cellOf(territory.center.x - territory.radius,
+                                 territory.center.z - territory.radius, m_index.invCellSize);
+    const glm::ivec2 hi = cellOf(territory.center.x + territory.radius,
+                                 territory.center.z + territory.radius, m_index.invCellSize);
+    if (lo == territory.indexCellMin && hi == territory.indexCellMax) return;
+
+    unindexTerritory(territory);
+    indexTerritory(territory);
+}
+
+void TerritorialBehavior::refreshIndexCellSize() {
+    // Cells about a typical territory across, so most touch at most four
+    const float invCellSize = 1.0f / std::max(m_config.baseRadius * 2.0f, 1.0f);
+    if (invCellSize == m_index.invCellSize) return;
+
+    m_index.invCellSize = invCellSize;
+    m_index.cells.clear();
+    for (auto& [ownerID, territory] : m_territories) {
+        indexTerritory(territory);
     }
-    m_territoriesToRemove.clear();
 }
 
 void TerritorialBehavior::updateTerritoryCenter(Territory& territory, const glm::vec3& ownerPos, float deltaTime) {
@@ -205,19 +356,27 @@ void TerritorialBehavior::processIntrusions(Territory& territory, Creature* owne
                                             const SpatialGrid& grid, float currentTime) {
     if (!owner) return;
 
-    // Query creatures near territory center
-    auto& nearby = grid.query(territory.center, territory.radius);
+    territory.closestIntruderID = 0;
+    float closestDist = territory.radius;
+
+    // Only same-type creatures are considered intruders for territorial disputes
+    auto& nearby = grid.queryByType(territory.center, territory.radius,
+                                    static_cast<int>(owner->getType()));
 
     for (Creature* other : nearby) {
         if (!other || other == owner || !other->isAlive()) continue;
 
-        // Only same-type creatures are considered intruders for territorial disputes
-        if (other->getType() == owner->getType()) {
-            float dist = glm::distance(other->getPosition(), territory.center);
-            if (dist < territory.radius * 0.8f) {  // Deep inside territory
-                territory.intrusionCount++;
-                territory.lastDefenseTime = currentTime;
-            }
+        float dist = glm::distance(other->getPosition(), territory.center);
+        if (dist < territory.radius * 0.8f) {  // Deep inside territory
+            territory.intrusionCount++;
+            territory.lastDefenseTime = currentTime;
+        }
+
+        // Remembered for the owner's defense force this frame
+        if (dist < closestDist) {
+            closestDist = dist;
+            territory.closestIntruderID = static_cast<uint32_t>(other->getID());
+            territory.closestIntruderPos = other->getPosition();
         }
     }
 
@@ -225,32 +384,12 @@ void TerritorialBehavior::processIntrusions(Territory& territory, Creature* owne
     territory.intrusionCount = glm::min(territory.intrusionCount, 20);
 }
 
-glm::vec3 TerritorialBehavior::calculateOwnerForce(Creature* owner, const Territory& territory,
-                                                   const SpatialGrid& grid) {
+glm::vec3 TerritorialBehavior::calculateOwnerForce(Creature* owner, const Territory& territory) {
     glm::vec3 force(0.0f);
 
-    // Get nearby creatures
-    auto& nearby = grid.query(territory.center, territory.radius);
-
-    Creature* closestIntruder = nullptr;
-    float closestDist = territory.radius;
-
-    for (Creature* other : nearby) {
-        if (!other || other == owner || !other->isAlive()) continue;
-
-        // Same-type intruders trigger defense response
-        if (other->getType() == owner->getType()) {
-            float dist = glm::distance(other->getPosition(), territory.center);
-            if (dist < closestDist) {
-                closestDist = dist;
-                closestIntruder = other;
-            }
-        }
-    }
-
-    if (closestIntruder) {
+    if (territory.closestIntruderID != 0) {
         // Chase the intruder!
-        glm::vec3 toIntruder = closestIntruder->getPosition() - owner->getPosition();
+        glm::vec3 toIntruder = territory.closestIntruderPos - owner->getPosition();
         float dist = glm::length(toIntruder);
 
         if (dist > 0.5f) {
@@ -280,7 +419,7 @@ glm::vec3 TerritorialBehavior::calculateIntruderForce(Creature* intruder) {
     glm::vec3 force(0.0f);
     glm::vec3 pos = intruder->getPosition();
 
-    for (const auto& [ownerID, territory] : m_territories) {
+    forEachTerritoryAt(pos, [&](const Territory& territory) {
         glm::vec3 toCenter = territory.center - pos;
         float dist = glm::length(toCenter);
 
@@ -293,7 +432,7 @@ glm::vec3 TerritorialBehavior::calculateIntruderForce(Creature* intruder) {
             // Push away from center
             force -= glm::normalize(toCenter) * repulsion;
         }
-    }
+    });
 
     return force;
 }
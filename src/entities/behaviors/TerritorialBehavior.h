@@ -3,6 +3,7 @@
 #include <glm/glm.hpp>
 #include <unordered_map>
 #include <vector>
+#include <utility>
 #include <cstdint>
 
 // Forward declarations
@@ -29,6 +30,10 @@ class TerritorialBehavior {
         float resourceQuality = 1.0f;   // Resource density in territory
         int intrusionCount = 0;         // Recent intrusions (affects aggression)
         float lastDefenseTime = 0.0f;   // Last time owner defended
+        uint32_t closestIntruderID = 0; // Nearest same-type intruder at last update, 0 if none
+        glm::vec3 closestIntruderPos{0.0f};
+        glm::ivec2 indexCellMin{0};     // Index cells the territory is filed under
+        glm::ivec2 indexCellMax{-1};
     };
 
     struct TerritorialConfig {
@@ -42,6 +47,7 @@ class TerritorialBehavior {
         float maxTerritoryAge = 300.0f;          // Max time before territory weakens
         float abandonDistance = 2.0f;            // Distance multiplier before abandoning
         int maxIntrusionsBeforeAggression = 3;   // Intrusions before heightened defense
+        int updateSlices = 1;                    // Territories updated per call: 1/updateSlices, round-robin
     };
 
     TerritorialBehavior() = default;
@@ -58,10 +64,9 @@ class TerritorialBehavior {
     /**
      * @brief Calculate territorial steering force for a creature
      * @param creature The creature to calculate force for
-     * @param grid Spatial grid for neighbor queries
      * @return Steering force vector (add to creature's velocity)
      */
-    glm::vec3 calculateForce(Creature* creature, const SpatialGrid& grid);
+    glm::vec3 calculateForce(Creature* creature);
 
     /**
      * @brief Attempt to establish a new territory for a creature
@@ -77,6 +82,12 @@ class TerritorialBehavior {
      */
     void abandonTerritory(uint32_t creatureID);
 
+    /**
+     * @brief Drop a creature's territory when it dies
+     * @param creatureID ID of the creature that died
+     */
+    void onOwnerDeath(uint32_t creatureID);
+
     /**
      * @brief Check if a creature has an established territory
      * @param creatureID ID of the creature to check
@@ -119,23 +130,59 @@ class TerritorialBehavior {
     int getTotalIntrusions() const;
 
 private:
-    // Clean up territories for dead creatures
-    void removeDeadOwnerTerritories(CreatureManager& creatures);
+    // Territories filed under every XZ cell their bounding square overlaps, so
+    // "which territories contain this point" reads a single cell. Kept current
+    // as territories are claimed, dropped and drift across cell boundaries.
+    struct TerritoryIndex {
+        float invCellSize = 0.0f;       // 0 until first used
+        std::unordered_map<uint64_t, std::vector<uint32_t>> cells;  // Packed cell -> owner IDs
+    };
+
+    // Pair each territory in a slice with its living owner in one pass over
+    // the creatures; drops the slice's territories whose owner died without
+    // a notification
+    void resolveOwners(CreatureManager& creatures, uint32_t slice);
+
+    // Remove a territory from both the map and the index
+    void eraseTerritory(uint32_t ownerID);
+
+    // File a territory under the cells its bounds overlap, or take it out
+    void indexTerritory(Territory& territory);
+    void unindexTerritory(const Territory& territory);
+
+    // Re-file a territory whose bounds moved into different cells
+    void reindexTerritory(Territory& territory);
+
+    // Re-file everything if the configured territory size changed the cell size
+    void refreshIndexCellSize();
+
+    // Visit every territory whose bounds overlap the cell containing position
+    template <typename Visit>
+    void forEachTerritoryAt(const glm::vec3& position, Visit&& visit) const;
 
     // Update territory center to follow owner (with drift)
     void updateTerritoryCenter(Territory& territory, const glm::vec3& ownerPos, float deltaTime);
 
-    // Check for intrusions and update intrusion counts
+    // Check for intrusions, update intrusion counts and find the closest intruder
     void processIntrusions(Territory& territory, Creature* owner, const SpatialGrid& grid, float currentTime);
 
     // Calculate force for territory owner (chase intruders)
-    glm::vec3 calculateOwnerForce(Creature* owner, const Territory& territory, const SpatialGrid& grid);
+    glm::vec3 calculateOwnerForce(Creature* owner, const Territory& territory);
 
     // Calculate force for non-owner (avoid territories)
     glm::vec3 calculateIntruderForce(Creature* intruder);
 
     std::unordered_map<uint32_t, Territory> m_territories;
     std::vector<uint32_t> m_territoriesToRemove;  // Deferred removal list
+    std::vector<std::pair<Territory*, Creature*>> m_activeOwners;  // Resolved this update
+    std::vector<uint32_t> m_seenOwners;
+    TerritoryIndex m_index;
     TerritorialConfig m_config;
     float m_currentTime = 0.0f;
+
+    // Round-robin slicing: slice k holds territories whose owner ID is k mod
+    // the slice count and is handed the time accumulated since its last visit
+    std::vector<float> m_sliceElapsed;
+    std::vector<uint32_t> m_sliceTerritories;   // Territories per slice
+    uint32_t m_sliceCursor = 0;
 };
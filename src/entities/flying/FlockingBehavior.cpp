@@ -8,6 +8,47 @@
 // FLOCKING BEHAVIOR IMPLEMENTATION
 // =============================================================================
 
+namespace {
+
+inline uint32_t hashCell(const glm::ivec3& cell, uint32_t mask) {
+    return (static_cast<uint32_t>(cell.x) * 73856093u ^
+            static_cast<uint32_t>(cell.y) * 19349663u ^
+            static_cast<uint32_t>(cell.z) * 83492791u) & mask;
+}
+
+// Visit every member whose cell is exactly `ring` cells (Chebyshev) from
+// center. Ring 0 is the center cell itself.
+template <typename Visit>
+void visitShell(const FlockNeighborGrid& grid, const glm::ivec3& center, int ring, Visit&& visit) {
+    const glm::ivec3 lo = glm::max(center - ring, grid.minCell);
+    const glm::ivec3 hi = glm::min(center + ring, grid.maxCell);
+
+    for (int z = lo.z; z <= hi.z; ++z) {
+        for (int y = lo.y; y <= hi.y; ++y) {
+            const bool interiorRow = std::abs(z - center.z) < ring && std::abs(y - center.y) < ring;
+            for (int x = lo.x; x <= hi.x; ++x) {
+                // Inner cells were covered by smaller rings; jump across them
+                if (interiorRow && std::abs(x - center.x) < ring) {
+                    x = center.x + ring - 1;
+                    continue;
+                }
+
+                const glm::ivec3 cell(x, y, z);
+                const uint32_t bucket = hashCell(cell, grid.bucketMask);
+                for (uint32_t e = grid.bucketStart[bucket]; e < grid.bucketStart[bucket + 1]; ++e) {
+                    const uint32_t index = grid.entries[e];
+                    // Different cells can share a bucket
+                    if (grid.memberCells[index] == cell) {
+                        visit(index);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
 FlockingBehavior::FlockingBehavior() {}
 
 // =============================================================================
@@ -118,6 +159,11 @@ void FlockingBehavior::updateFlock(Flock& flock, float deltaTime) {
     // Update centroid and average velocity
     updateFlockCentroid(flock);
 
+    // V-formations only follow their leader; every other type queries neighbours
+    if (flock.type != FlockType::V_FORMATION) {
+        buildNeighborGrid(flock);
+    }
+
     // Update based on flock type
     switch (flock.type) {
         case FlockType::BOIDS:
@@ -163,18 +209,17 @@ void FlockingBehavior::updateFlock(Flock& flock, float deltaTime) {
 // =============================================================================
 
 void FlockingBehavior::updateBoidsFlock(Flock& flock, float deltaTime) {
-    for (auto& member : flock.members) {
-        glm::vec3 separation = calculateSeparation(member, flock);
-        glm::vec3 alignment = calculateAlignment(member, flock);
-        glm::vec3 cohesion = calculateCohesion(member, flock);
+    for (size_t i = 0; i < flock.members.size(); ++i) {
+        FlockMember& member = flock.members[i];
+        BoidsForces forces = calculateBoidsForces(flock, i);
         glm::vec3 goal = calculateGoalSeeking(member, flock);
         glm::vec3 avoidance = calculateObstacleAvoidance(member);
 
         // Combine forces with weights
         member.targetVelocity = member.velocity +
-            separation * flock.config.separationWeight +
-            alignment * flock.config.alignmentWeight +
-            cohesion * flock.config.cohesionWeight +
+            forces.separation * flock.config.separationWeight +
+            forces.alignment * flock.config.alignmentWeight +
+            forces.cohesion * flock.config.cohesionWeight +
             goal * flock.config.goalStrength +
             avoidance * 2.0f;  // High weight for obstacle avoidance
 
@@ -182,73 +227,128 @@ void FlockingBehavior::updateBoidsFlock(Flock& flock, float deltaTime) {
     }
 }
 
-glm::vec3 FlockingBehavior::calculateSeparation(const FlockMember& member, const Flock& flock) {
-    glm::vec3 steering(0.0f);
-    int count = 0;
-
-    for (const auto& other : flock.members) {
-        if (other.creatureId == member.creatureId) continue;
-
-        float distance = glm::length(other.position - member.position);
-        if (distance < flock.config.separationRadius && distance > 0.001f) {
-            // Steer away from neighbor
-            glm::vec3 diff = member.position - other.position;
-            diff = glm::normalize(diff) / distance;  // Weight by distance
-            steering += diff;
-            count++;
-        }
+void FlockingBehavior::buildNeighborGrid(Flock& flock) {
+    FlockNeighborGrid& grid = flock.neighborGrid;
+    const size_t count = flock.members.size();
+
+    // One cell spans the widest rule radius, so the 3x3x3 block around a
+    // member holds every neighbour any rule can see
+    grid.cellSize = std::max({flock.config.separationRadius, flock.config.alignmentRadius,
+                              flock.config.cohesionRadius, 0.001f});
+    grid.invCellSize = 1.0f / grid.cellSize;
+
+    uint32_t buckets = 16;
+    while (buckets < count * 2) buckets <<= 1;
+    grid.bucketMask = buckets - 1;
+
+    grid.memberCells.resize(count);
+    grid.entries.resize(count);
+    grid.bucketStart.assign(buckets + 1, 0);
+    grid.minCell = glm::ivec3(std::numeric_limits<int>::max());
+    grid.maxCell = glm::ivec3(std::numeric_limits<int>::min());
+
+    // Counting sort of member indices by bucket
+    for (size_t i = 0; i < count; ++i) {
+        glm::ivec3 cell(glm::floor(flock.members[i].position * grid.invCellSize));
+        grid.memberCells[i] = cell;
+        grid.minCell = glm::min(grid.minCell, cell);
+        grid.maxCell = glm::max(grid.maxCell, cell);
+        grid.bucketStart[hashCell(cell, grid.bucketMask) + 1]++;
     }
-
-    if (count > 0) {
-        steering /= static_cast<float>(count);
+    for (uint32_t b = 0; b < buckets; ++b) {
+        grid.bucketStart[b + 1] += grid.bucketStart[b];
     }
 
-    return steering;
+    // Fill using the next-free offset, then shift back so bucketStart[b]
+    // is the start of bucket b again
+    for (size_t i = 0; i < count; ++i) {
+        grid.entries[grid.bucketStart[hashCell(grid.memberCells[i], grid.bucketMask)]++] =
+            static_cast<uint32_t>(i);
+    }
+    for (uint32_t b = buckets; b > 0; --b) {
+        grid.bucketStart[b] = grid.bucketStart[b - 1];
+    }
+    grid.bucketStart[0] = 0;
 }
 
-glm::vec3 FlockingBehavior::calculateAlignment(const FlockMember& member, const Flock& flock) {
+FlockingBehavior::BoidsForces FlockingBehavior::calculateBoidsForces(const Flock& flock,
+                                                                     size_t memberIndex) {
+    const FlockMember& member = flock.members[memberIndex];
+    const FlockingConfig& config = flock.config;
+
+    glm::vec3 separation(0.0f);
     glm::vec3 averageVelocity(0.0f);
-    int count = 0;
+    glm::vec3 centerOfMass(0.0f);
+    int separationCount = 0;
+    int alignmentCount = 0;
+    int cohesionCount = 0;
 
-    for (const auto& other : flock.members) {
-        if (other.creatureId == member.creatureId) continue;
+    // Single pass over nearby members feeds all three rules
+    auto accumulate = [&](uint32_t index) {
+        if (index == memberIndex) return;
+        const FlockMember& other = flock.members[index];
 
         float distance = glm::length(other.position - member.position);
-        if (distance < flock.config.alignmentRadius) {
+        if (distance < config.separationRadius && distance > 0.001f) {
+            // Steer away from neighbor, weighted by distance
+            separation += glm::normalize(member.position - other.position) / distance;
+            separationCount++;
+        }
+        if (distance < config.alignmentRadius) {
             averageVelocity += other.velocity;
-            count++;
+            alignmentCount++;
         }
-    }
+        if (distance < config.cohesionRadius) {
+            centerOfMass += other.position;
+            cohesionCount++;
+        }
+    };
 
-    if (count > 0) {
-        averageVelocity /= static_cast<float>(count);
-        return (averageVelocity - member.velocity) * 0.1f;  // Gradually match
-    }
+    const glm::ivec3& cell = flock.neighborGrid.memberCells[memberIndex];
+    visitShell(flock.neighborGrid, cell, 0, accumulate);
+    visitShell(flock.neighborGrid, cell, 1, accumulate);
 
-    return glm::vec3(0.0f);
+    BoidsForces forces;
+    if (separationCount > 0) {
+        forces.separation = separation / static_cast<float>(separationCount);
+    }
+    if (alignmentCount > 0) {
+        averageVelocity /= static_cast<float>(alignmentCount);
+        forces.alignment = (averageVelocity - member.velocity) * 0.1f;  // Gradually match
+    }
+    if (cohesionCount > 0) {
+        centerOfMass /= static_cast<float>(cohesionCount);
+        glm::vec3 direction = centerOfMass - member.position;
+        forces.cohesion = glm::normalize(direction) * 0.5f;  // Move toward center
+    }
+    return forces;
 }
 
-glm::vec3 FlockingBehavior::calculateCohesion(const FlockMember& member, const Flock& flock) {
-    glm::vec3 centerOfMass(0.0f);
+glm::vec3 FlockingBehavior::calculateSeparation(const Flock& flock, size_t memberIndex) {
+    const FlockMember& member = flock.members[memberIndex];
+    glm::vec3 steering(0.0f);
     int count = 0;
 
-    for (const auto& other : flock.members) {
-        if (other.creatureId == member.creatureId) continue;
+    auto accumulate = [&](uint32_t index) {
+        if (index == memberIndex) return;
+        const FlockMember& other = flock.members[index];
 
         float distance = glm::length(other.position - member.position);
-        if (distance < flock.config.cohesionRadius) {
-            centerOfMass += other.position;
+        if (distance < flock.config.separationRadius && distance > 0.001f) {
+            steering += glm::normalize(member.position - other.position) / distance;
             count++;
         }
-    }
+    };
+
+    const glm::ivec3& cell = flock.neighborGrid.memberCells[memberIndex];
+    visitShell(flock.neighborGrid, cell, 0, accumulate);
+    visitShell(flock.neighborGrid, cell, 1, accumulate);
 
     if (count > 0) {
-        centerOfMass /= static_cast<float>(count);
-        glm::vec3 direction = centerOfMass - member.position;
-        return glm::normalize(direction) * 0.5f;  // Move toward center
+        steering /= static_cast<float>(count);
     }
 
-    return glm::vec3(0.0f);
+    return steering;
 }
 
 glm::vec3 FlockingBehavior::calculateGoalSeeking(const FlockMember& member, const Flock& flock) {
@@ -452,13 +552,8 @@ uint32_t FlockingBehavior::selectNextLeader(const Flock& flock) {
 // =============================================================================
 
 void FlockingBehavior::updateMurmuration(Flock& flock, float deltaTime) {
-    // Update topological neighbors periodically
-    static float neighborUpdateTimer = 0.0f;
-    neighborUpdateTimer += deltaTime;
-    if (neighborUpdateTimer > 0.5f) {  // Update every 0.5 seconds
-        updateTopologicalNeighbors(flock);
-        neighborUpdateTimer = 0.0f;
-    }
+    // Refresh a slice of topological neighbour sets
+    updateTopologicalNeighbors(flock, deltaTime);
 
     // Propagate wave if in maneuver
     if (flock.inManeuver) {
@@ -472,29 +567,88 @@ void FlockingBehavior::updateMurmuration(Flock& flock, float deltaTime) {
     }
 }
 
-void FlockingBehavior::updateTopologicalNeighbors(Flock& flock) {
-    int k = flock.config.topologicalNeighbors;
+void FlockingBehavior::updateTopologicalNeighbors(Flock& flock, float deltaTime) {
+    const size_t count = flock.members.size();
+    if (count == 0) return;
 
-    for (auto& member : flock.members) {
-        // Find k nearest neighbors
-        std::vector<std::pair<float, uint32_t>> distances;
+    // Newly joined members get neighbours straight away
+    for (size_t i = 0; i < count; ++i) {
+        if (flock.members[i].topologicalNeighbors.empty() && count > 1) {
+            findTopologicalNeighbors(flock, i);
+        }
+    }
 
-        for (const auto& other : flock.members) {
-            if (other.creatureId == member.creatureId) continue;
+    // Spread a full pass over NEIGHBOR_REFRESH_INTERVAL: each frame refreshes
+    // its share of members, continuing where the previous frame stopped
+    flock.neighborRefreshBudget += static_cast<float>(count) * deltaTime / NEIGHBOR_REFRESH_INTERVAL;
+    size_t refreshCount = std::min(static_cast<size_t>(flock.neighborRefreshBudget), count);
+    flock.neighborRefreshBudget = std::min(flock.neighborRefreshBudget - static_cast<float>(refreshCount),
+                                           static_cast<float>(count));
 
-            float dist = glm::length(other.position - member.position);
-            distances.push_back({dist, other.creatureId});
-        }
+    for (size_t n = 0; n < refreshCount; ++n) {
+        if (flock.neighborRefreshCursor >= count) flock.neighborRefreshCursor = 0;
+        findTopologicalNeighbors(flock, flock.neighborRefreshCursor++);
+    }
+}
 
-        // Sort by distance
-        std::sort(distances.begin(), distances.end());
+void FlockingBehavior::findTopologicalNeighbors(Flock& flock, size_t memberIndex) {
+    FlockMember& member = flock.members[memberIndex];
+    const FlockNeighborGrid& grid = flock.neighborGrid;
+    const size_t k = static_cast<size_t>(std::max(flock.config.topologicalNeighbors, 0));
+    auto& candidates = m_neighborCandidates;
+    candidates.clear();
+
+    auto addCandidate = [&](uint32_t index) {
+        if (index == memberIndex) return;
+        const FlockMember& other = flock.members[index];
+        candidates.push_back({glm::length(other.position - member.position), other.creatureId});
+    };
+
+    // Grow rings of cells outward. After ring r every member within
+    // r * cellSize has been seen, so once k candidates lie inside that
+    // distance the k nearest are final.
+    const glm::ivec3& cell = grid.memberCells[memberIndex];
+    const glm::ivec3 extent = glm::max(grid.maxCell - cell, cell - grid.minCell);
+    const int maxRing = std::max({extent.x, extent.y, extent.z});
+    bool complete = false;
+
+    for (int ring = 0; ring <= maxRing; ++ring) {
+        // Once a shell holds more cells than the flock has members, a
+        // straight scan is cheaper
+        const size_t side = static_cast<size_t>(2 * ring + 1);
+        if (ring > 1 && side * side * 6 > flock.members.size()) break;
+
+        visitShell(grid, cell, ring, addCandidate);
+
+        const float covered = static_cast<float>(ring) * grid.cellSize;
+        size_t inside = 0;
+        for (const auto& candidate : candidates) {
+            if (candidate.first <= covered) inside++;
+        }
+        if (inside >= k || ring == maxRing) {
+            complete = true;
+            break;
+        }
+    }
 
-        // Take k nearest
-        member.topologicalNeighbors.clear();
-        for (int i = 0; i < std::min(k, static_cast<int>(distances.size())); ++i) {
-            member.topologicalNeighbors.push_back(distances[i].second);
+    if (!complete) {
+        candidates.clear();
+        for (size_t i = 0; i < flock.members.size(); ++i) {
+            addCandidate(static_cast<uint32_t>(i));
         }
     }
+
+    // Partial selection of the k nearest, then order just those
+    size_t take = std::min(k, candidates.size());
+    if (take < candidates.size()) {
+        std::nth_element(candidates.begin(), candidates.begin() + take, candidates.end());
+    }
+    std::sort(candidates.begin(), candidates.begin() + take);
+
+    member.topologicalNeighbors.clear();
+    for (size_t i = 0; i < take; ++i) {
+        member.topologicalNeighbors.push_back(candidates[i].second);
+    }
 }
 
 glm::vec3 FlockingBehavior::calculateMurmurationVelocity(const FlockMember& member,
@@ -615,7 +769,7 @@ void FlockingBehavior::updateThermalCircle(Flock& flock, float deltaTime) {
         member.targetVelocity.y += lift;  // Add lift
 
         // Maintain separation in thermal
-        glm::vec3 sep = calculateSeparation(member, flock);
+        glm::vec3 sep = calculateSeparation(flock, index);
         member.targetVelocity += sep * flock.config.separationWeight;
 
         limitVelocity(member.targetVelocity, flock.config.minSpeed, flock.config.maxSpeed);
@@ -679,7 +833,7 @@ void FlockingBehavior::updateHuntingPack(Flock& flock, float deltaTime) {
                                 std::min(glm::length(toTarget), flock.config.maxSpeed);
 
         // Avoid other pack members
-        glm::vec3 sep = calculateSeparation(member, flock);
+        glm::vec3 sep = calculateSeparation(flock, index);
         member.targetVelocity += sep * flock.config.separationWeight * 2.0f;
 
         limitVelocity(member.targetVelocity, flock.config.minSpeed, flock.config.maxSpeed);
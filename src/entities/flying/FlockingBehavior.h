@@ -5,6 +5,7 @@
 #include <vector>
 #include <unordered_set>
 #include <unordered_map>
+#include <utility>
 #include <cstdint>
 
 class Creature;
@@ -107,6 +108,21 @@ struct FlockingConfig {
     float goalStrength = 0.3f;          // Weight of goal-seeking
 };
 
+// Uniform hash grid over a flock's member positions, rebuilt once per update
+// so neighbour queries only visit nearby cells instead of every member.
+// Buckets are stored CSR-style: entries[bucketStart[b] .. bucketStart[b + 1])
+// are the member indices whose cell hashes to bucket b.
+struct FlockNeighborGrid {
+    float cellSize = 1.0f;
+    float invCellSize = 1.0f;
+    uint32_t bucketMask = 0;
+    std::vector<uint32_t> bucketStart;
+    std::vector<uint32_t> entries;
+    std::vector<glm::ivec3> memberCells;    // Cell of each member, by member index
+    glm::ivec3 minCell{0};                  // Occupied cell bounds
+    glm::ivec3 maxCell{0};
+};
+
 // A flock is a collection of birds with shared behavior
 struct Flock {
     uint32_t flockId;
@@ -130,6 +146,11 @@ struct Flock {
     glm::vec3 waveOrigin;               // Origin of current wave
     float wavePhase = 0.0f;
     bool inManeuver = false;
+    size_t neighborRefreshCursor = 0;   // Next member whose topological neighbours are refreshed
+    float neighborRefreshBudget = 0.0f; // Fractional members owed a refresh
+
+    // Spatial index over members for the current update
+    FlockNeighborGrid neighborGrid;
 
     // Thermal state
     glm::vec3 thermalCenter;
@@ -216,10 +237,19 @@ class FlockingBehavior {
     void updateThermalCircle(Flock& flock, float deltaTime);
     void updateHuntingPack(Flock& flock, float deltaTime);
 
-    // Reynolds boids rules
-    glm::vec3 calculateSeparation(const FlockMember& member, const Flock& flock);
-    glm::vec3 calculateAlignment(const FlockMember& member, const Flock& flock);
-    glm::vec3 calculateCohesion(const FlockMember& member, const Flock& flock);
+    // Spatial index
+    void buildNeighborGrid(Flock& flock);
+
+    // Reynolds boids rules. All three are accumulated in one pass over the
+    // neighbouring grid cells; separation alone is used by thermal circles
+    // and hunting packs.
+    struct BoidsForces {
+        glm::vec3 separation{0.0f};
+        glm::vec3 alignment{0.0f};
+        glm::vec3 cohesion{0.0f};
+    };
+    BoidsForces calculateBoidsForces(const Flock& flock, size_t memberIndex);
+    glm::vec3 calculateSeparation(const Flock& flock, size_t memberIndex);
     glm::vec3 calculateGoalSeeking(const FlockMember& member, const Flock& flock);
     glm::vec3 calculateObstacleAvoidance(const FlockMember& member);
 
@@ -228,8 +258,13 @@ class FlockingBehavior {
     void assignFormationPositions(Flock& flock);
     uint32_t selectNextLeader(const Flock& flock);
 
-    // Murmuration helpers
-    void updateTopologicalNeighbors(Flock& flock);
+    // Murmuration helpers. Each member's neighbour list is refreshed once per
+    // NEIGHBOR_REFRESH_INTERVAL, spread round-robin across frames.
+    static constexpr float NEIGHBOR_REFRESH_INTERVAL = 0.5f;
+    std::vector<std::pair<float, uint32_t>> m_neighborCandidates;  // Scratch (distance, creatureId)
+
+    void updateTopologicalNeighbors(Flock& flock, float deltaTime);
+    void findTopologicalNeighbors(Flock& flock, size_t memberIndex);
     glm::vec3 calculateMurmurationVelocity(const FlockMember& member, const Flock& flock);
     void propagateWave(Flock& flock, float deltaTime);
 
@@ -34,12 +34,14 @@ EvolutionaryHistoryTracker::EvolutionaryHistoryTracker()
     : m_currentGeneration(0)
     , m_traitChangeThreshold(0.01f)
     , m_detailedGenomicTracking(true)
-    , m_maxLineageRecords(0)
+    , m_compactLineageStorage(true)
+    , m_maxLineageRecords(DEFAULT_MAX_LINEAGE_RECORDS)
     , m_maxSpeciesRecords(0)
     , m_totalBirths(0)
     , m_totalDeaths(0)
     , m_totalSpeciations(0)
     , m_totalExtinctions(0)
+    , m_lineageSpillInterval(DEFAULT_SPILL_INTERVAL)
 {
 }
 
@@ -86,9 +88,14 @@ void EvolutionaryHistoryTracker::recordBirth(const Creature* creature,
             record.speciesHistory.back().second != currentSpecies) {
             record.speciesHistory.emplace_back(m_currentGeneration, currentSpecies);
         }
+
+        LineageIndex storeIndex = m_lineageStore.indexOf(lineageId);
+        m_lineageStore.recordBirth(storeIndex, m_currentGeneration);
+        m_lineageStore.setSpecies(storeIndex, currentSpecies);
     } else {
         // Create new lineage record
         lineageId = createLineageRecord(creature, parentLineageId);
+        if (lineageId == 0) return;
     }
 
     // Update lineage tree structure
@@ -130,9 +137,6 @@ void EvolutionaryHistoryTracker::recordBirth(const Creature* creature,
         }
     }
 
-    // Invalidate ancestor cache for related lineages
-    invalidateAncestorCache(lineageId);
-
     // Auto-prune if limits are set
     autoPruneIfNeeded();
 }
@@ -148,6 +152,7 @@ void EvolutionaryHistoryTracker::recordDeath(const Creature* creature)
 
     // Update lineage record
     updateLineageOnDeath(lineageId);
+    m_lineageStore.recordDeath(m_lineageStore.indexOf(lineageId), m_currentGeneration);
 
     // Check for lineage extinction
     auto it = m_lineageRecords.find(lineageId);
@@ -259,6 +264,11 @@ void EvolutionaryHistoryTracker::recordTraitChange(SpeciesId species,
     // Store by species
     m_traitChangesBySpecies[species].push_back(change);
 
+    // Compact storage keeps trait changes once per species only
+    if (m_compactLineageStorage) {
+        return;
+    }
+
     // Also update lineage records for this species
     for (auto& [lineageId, record] : m_lineageRecords) {
         if (record.getCurrentSpecies() == species && record.isExtant()) {
@@ -288,34 +298,11 @@ LineageId EvolutionaryHistoryTracker::getMostRecentCommonAncestor(LineageId line
     if (lineage1 == 0 || lineage2 == 0) return 0;
     if (lineage1 == lineage2) return lineage1;
 
-    // Check cache first
-    uint64_t cacheKey = makeAncestorCacheKey(lineage1, lineage2);
-    auto cacheIt = m_ancestorCache.find(cacheKey);
-    if (cacheIt != m_ancestorCache.end()) {
-        return cacheIt->second;
-    }
-
-    // Build ancestor set for lineage1
-    std::unordered_set<LineageId> ancestors1 = buildAncestorSet(lineage1);
-    ancestors1.insert(lineage1);
+    LineageIndex mrca = m_lineageStore.getMostRecentCommonAncestor(
+        m_lineageStore.indexOf(lineage1), m_lineageStore.indexOf(lineage2));
+    if (mrca == INVALID_LINEAGE_INDEX) return 0;
 
-    // Walk up lineage2's ancestry and find first intersection
-    LineageId current = lineage2;
-    while (current != 0) {
-        if (ancestors1.count(current) > 0) {
-            // Cache the result
-            m_ancestorCache[cacheKey] = current;
-            return current;
-        }
-
-        auto it = m_lineageRecords.find(current);
-        if (it == m_lineageRecords.end()) break;
-        current = it->second.ancestorLineageId;
-    }
-
-    // No common ancestor found
-    m_ancestorCache[cacheKey] = 0;
-    return 0;
+    return m_lineageStore.getId(mrca);
 }
 
 int EvolutionaryHistoryTracker::getEvolutionaryDistance(LineageId lineage1,
@@ -324,61 +311,29 @@ int EvolutionaryHistoryTracker::getEvolutionaryDistance(LineageId lineage1,
     if (lineage1 == 0 || lineage2 == 0) return -1;
     if (lineage1 == lineage2) return 0;
 
-    LineageId mrca = getMostRecentCommonAncestor(lineage1, lineage2);
-    if (mrca == 0) return -1;
+    LineageIndex index1 = m_lineageStore.indexOf(lineage1);
+    LineageIndex index2 = m_lineageStore.indexOf(lineage2);
+    LineageIndex mrca = m_lineageStore.getMostRecentCommonAncestor(index1, index2);
+    if (mrca == INVALID_LINEAGE_INDEX) return -1;
 
-    // Count generations from lineage1 to MRCA
-    int dist1 = 0;
-    LineageId current = lineage1;
-    while (current != mrca && current != 0) {
-        auto it = m_lineageRecords.find(current);
-        if (it == m_lineageRecords.end()) break;
-
-        // Use founding generation difference as distance
-        auto parentIt = m_lineageRecords.find(it->second.ancestorLineageId);
-        if (parentIt != m_lineageRecords.end()) {
-            dist1 += std::abs(it->second.foundingGeneration -
-                             parentIt->second.foundingGeneration);
-        } else {
-            dist1++;
-        }
-        current = it->second.ancestorLineageId;
-    }
-
-    // Count generations from lineage2 to MRCA
-    int dist2 = 0;
-    current = lineage2;
-    while (current != mrca && current != 0) {
-        auto it = m_lineageRecords.find(current);
-        if (it == m_lineageRecords.end()) break;
-
-        auto parentIt = m_lineageRecords.find(it->second.ancestorLineageId);
-        if (parentIt != m_lineageRecords.end()) {
-            dist2 += std::abs(it->second.foundingGeneration -
-                             parentIt->second.foundingGeneration);
-        } else {
-            dist2++;
-        }
-        current = it->second.ancestorLineageId;
-    }
+    // Founding generations increase along every path from the MRCA, so the
+    // summed per-edge generation gaps telescope to endpoint differences.
+    Generation mrcaGen = m_lineageStore.getFoundingGeneration(mrca);
+    int dist1 = std::abs(m_lineageStore.getFoundingGeneration(index1) - mrcaGen);
+    int dist2 = std::abs(m_lineageStore.getFoundingGeneration(index2) - mrcaGen);
 
     return dist1 + dist2;
 }
 
 std::vector<LineageId> EvolutionaryHistoryTracker::getAncestry(LineageId lineage) const
 {
-    std::vector<LineageId> ancestry;
-
-    LineageId current = lineage;
-    while (current != 0) {
-        auto it = m_lineageRecords.find(current);
-        if (it == m_lineageRecords.end()) break;
+    std::vector<LineageIndex> indices;
+    m_lineageStore.collectAncestry(m_lineageStore.indexOf(lineage), indices);
 
-        LineageId parent = it->second.ancestorLineageId;
-        if (parent != 0) {
-            ancestry.push_back(parent);
-        }
-        current = parent;
+    std::vector<LineageId> ancestry;
+    ancestry.reserve(indices.size());
+    for (LineageIndex index : indices) {
+        ancestry.push_back(m_lineageStore.getId(index));
     }
 
     return ancestry;
@@ -838,7 +793,8 @@ void EvolutionaryHistoryTracker::recordDiversitySnapshot(const GeneticDiversityS
 // EXPORT FUNCTIONS
 // =============================================================================
 
-std::string EvolutionaryHistoryTracker::exportToNewick() const
+template <typename Sink>
+void EvolutionaryHistoryTracker::writeNewick(Sink& sink) const
 {
     // Find root species
     std::vector<SpeciesId> roots;
@@ -848,37 +804,52 @@ std::string EvolutionaryHistoryTracker::exportToNewick() const
         }
     }
 
-    if (roots.empty()) {
-        return ";";
-    }
+    writeNewickForest<SpeciesId>(sink, std::span<const SpeciesId>(roots),
+        [this](SpeciesId speciesId) -> std::span<const SpeciesId> {
+            auto it = m_phylogeneticRecords.find(speciesId);
+            if (it == m_phylogeneticRecords.end()) return {};
+            return it->second.daughterSpecies;
+        },
+        [this](Sink& out, SpeciesId speciesId) {
+            auto it = m_phylogeneticRecords.find(speciesId);
+            if (it == m_phylogeneticRecords.end()) {
+                out.write("Unknown_");
+                out.writeUInt(speciesId);
+                return;
+            }
 
-    // Build Newick string from each root
-    std::string newick;
-    if (roots.size() == 1) {
-        newick = newickForSpecies(roots[0]);
-    } else {
-        // Multiple roots - create a polytomy
-        newick = "(";
-        for (size_t i = 0; i < roots.size(); i++) {
-            if (i > 0) newick += ",";
-            newick += newickForSpecies(roots[i]);
-        }
-        newick += ")";
-    }
+            // Branch length is the founding gap to the parent species
+            const PhylogeneticRecord& record = it->second;
+            float branchLength = 0.0f;
+            if (record.parentSpeciesId != 0) {
+                auto parentIt = m_phylogeneticRecords.find(record.parentSpeciesId);
+                if (parentIt != m_phylogeneticRecords.end()) {
+                    branchLength = static_cast<float>(record.foundingGeneration -
+                                                       parentIt->second.foundingGeneration);
+                }
+            }
+            writeSpeciesNewickLabel(out, speciesId, record.speciesName, branchLength);
+        });
+}
 
-    return newick + ";";
+std::string EvolutionaryHistoryTracker::exportToNewick() const
+{
+    std::string newick;
+    StringExportSink sink(newick);
+    writeNewick(sink);
+    return newick;
 }
 
 bool EvolutionaryHistoryTracker::exportNewickToFile(const std::string& filename) const
 {
-    std::ofstream file(filename);
-    if (!file.is_open()) {
+    BufferedFileWriter file;
+    if (!file.open(filename)) {
         return false;
     }
 
-    file << exportToNewick() << std::endl;
-    file.close();
-    return true;
+    writeNewick(file);
+    file.put('\n');
+    return file.close();
 }
 
 bool EvolutionaryHistoryTracker::exportToCSV(const std::string& baseFilename) const
@@ -893,78 +864,162 @@ bool EvolutionaryHistoryTracker::exportToCSV(const std::string& baseFilename) co
     return success;
 }
 
+namespace {
+
+LineageExportRow makeLineageRow(LineageId lineageId, const LineageRecord& record)
+{
+    LineageExportRow row;
+    row.lineageId = lineageId;
+    row.ancestorId = record.ancestorLineageId;
+    row.foundingGeneration = record.foundingGeneration;
+    row.extinctionGeneration = record.extinctionGeneration;
+    row.peakPopulation = record.peakPopulation;
+    row.totalDescendants = record.totalDescendants;
+    row.survivingDescendants = record.survivingDescendants;
+    row.averageFitness = record.averageFitness;
+    return row;
+}
+
+SpeciesExportRow makeSpeciesRow(SpeciesId speciesId, const PhylogeneticRecord& record)
+{
+    SpeciesExportRow row;
+    row.speciesId = speciesId;
+    row.parentSpeciesId = record.parentSpeciesId;
+    row.foundingGeneration = record.foundingGeneration;
+    row.extinctionGeneration = record.extinctionGeneration;
+    row.founderPopulationSize = record.founderPopulationSize;
+    row.peakPopulation = record.peakPopulation;
+    row.descendantCount = record.descendantCount;
+    row.extinctionCause = static_cast<int>(record.extinctionCause);
+    return row;
+}
+
+TraitExportRow makeTraitRow(SpeciesId speciesId, const TraitChange& change)
+{
+    TraitExportRow row;
+    row.generation = change.generation;
+    row.speciesId = speciesId;
+    row.traitType = static_cast<int>(change.traitType);
+    row.oldValue = change.oldValue;
+    row.newValue = change.newValue;
+    row.changeType = static_cast<int>(change.changeType);
+    row.selectionPressure = static_cast<int>(change.selectionPressure);
+    return row;
+}
+
+DiversityExportRow makeDiversityRow(const GeneticDiversitySnapshot& snapshot)
+{
+    DiversityExportRow row;
+    row.generation = snapshot.generation;
+    row.overallHeterozygosity = snapshot.overallHeterozygosity;
+    row.nucleotideDiversity = snapshot.nucleotideDiversity;
+    row.numberOfAlleles = snapshot.numberOfAlleles;
+    row.effectivePopulationSize = snapshot.effectivePopulationSize;
+    return row;
+}
+
+} // namespace
+
 bool EvolutionaryHistoryTracker::exportDataToCSV(const std::string& filename,
                                                   const std::string& dataType) const
 {
-    std::ofstream file(filename);
-    if (!file.is_open()) {
+    if (dataType != "lineages" && dataType != "species" &&
+        dataType != "traits" && dataType != "diversity") {
         return false;
     }
 
-    if (dataType == "lineages") {
-        // Header
-        file << "LineageId,AncestorId,FoundingGeneration,ExtinctionGeneration,"
-             << "PeakPopulation,TotalDescendants,SurvivingDescendants,AverageFitness\n";
+    BufferedFileWriter file;
+    if (!file.open(filename)) {
+        return false;
+    }
 
+    if (dataType == "lineages") {
+        writeLineageCsvHeader(file);
         for (const auto& [lineageId, record] : m_lineageRecords) {
-            file << lineageId << ","
-                 << record.ancestorLineageId << ","
-                 << record.foundingGeneration << ","
-                 << record.extinctionGeneration << ","
-                 << record.peakPopulation << ","
-                 << record.totalDescendants << ","
-                 << record.survivingDescendants << ","
-                 << record.averageFitness << "\n";
+            writeLineageCsvRow(file, makeLineageRow(lineageId, record));
         }
     } else if (dataType == "species") {
-        // Header
-        file << "SpeciesId,ParentSpeciesId,FoundingGeneration,ExtinctionGeneration,"
-             << "FounderPopulation,PeakPopulation,DescendantCount,ExtinctionCause\n";
-
+        writeSpeciesCsvHeader(file);
         for (const auto& [speciesId, record] : m_phylogeneticRecords) {
-            file << speciesId << ","
-                 << record.parentSpeciesId << ","
-                 << record.foundingGeneration << ","
-                 << record.extinctionGeneration << ","
-                 << record.founderPopulationSize << ","
-                 << record.peakPopulation << ","
-                 << record.descendantCount << ","
-                 << static_cast<int>(record.extinctionCause) << "\n";
+            writeSpeciesCsvRow(file, makeSpeciesRow(speciesId, record));
         }
     } else if (dataType == "traits") {
-        // Header
-        file << "Generation,SpeciesId,TraitType,OldValue,NewValue,ChangeType,SelectionPressure\n";
-
+        writeTraitCsvHeader(file);
         for (const auto& [speciesId, changes] : m_traitChangesBySpecies) {
             for (const TraitChange& change : changes) {
-                file << change.generation << ","
-                     << speciesId << ","
-                     << static_cast<int>(change.traitType) << ","
-                     << change.oldValue << ","
-                     << change.newValue << ","
-                     << static_cast<int>(change.changeType) << ","
-                     << static_cast<int>(change.selectionPressure) << "\n";
+                writeTraitCsvRow(file, makeTraitRow(speciesId, change));
             }
         }
-    } else if (dataType == "diversity") {
-        // Header
-        file << "Generation,OverallHeterozygosity,NucleotideDiversity,"
-             << "NumberOfAlleles,EffectivePopulationSize\n";
-
+    } else {
+        writeDiversityCsvHeader(file);
         for (const auto& snapshot : m_diversityHistory) {
-            file << snapshot.generation << ","
-                 << snapshot.overallHeterozygosity << ","
-                 << snapshot.nucleotideDiversity << ","
-                 << snapshot.numberOfAlleles << ","
-                 << snapshot.effectivePopulationSize << "\n";
+            writeDiversityCsvRow(file, makeDiversityRow(snapshot));
         }
-    } else {
-        file.close();
-        return false;
     }
 
-    file.close();
-    return true;
+    return file.close();
+}
+
+std::shared_ptr<const HistoryExportSnapshot> EvolutionaryHistoryTracker::createExportSnapshot() const
+{
+    auto snapshot = std::make_shared<HistoryExportSnapshot>();
+    snapshot->generation = m_currentGeneration;
+
+    snapshot->lineages.reserve(m_lineageRecords.size());
+    for (const auto& [lineageId, record] : m_lineageRecords) {
+        snapshot->lineages.push_back(makeLineageRow(lineageId, record));
+    }
+
+    // Species rows are sorted by ID so the snapshot can binary-search them
+    std::vector<SpeciesId> speciesIds;
+    speciesIds.reserve(m_phylogeneticRecords.size());
+    for (const auto& [speciesId, record] : m_phylogeneticRecords) {
+        speciesIds.push_back(speciesId);
+    }
+    std::sort(speciesIds.begin(), speciesIds.end());
+
+    snapshot->species.reserve(speciesIds.size());
+    for (SpeciesId speciesId : speciesIds) {
+        const PhylogeneticRecord& record = m_phylogeneticRecords.at(speciesId);
+        SpeciesExportRow row = makeSpeciesRow(speciesId, record);
+
+        if (record.parentSpeciesId != 0) {
+            auto parentIt = m_phylogeneticRecords.find(record.parentSpeciesId);
+            if (parentIt != m_phylogeneticRecords.end()) {
+                row.branchLength = static_cast<float>(record.foundingGeneration -
+                                                       parentIt->second.foundingGeneration);
+            }
+        }
+
+        row.nameOffset = static_cast<uint32_t>(snapshot->names.size());
+        row.nameLength = static_cast<uint32_t>(record.speciesName.size());
+        snapshot->names += record.speciesName;
+
+        row.firstDaughter = static_cast<uint32_t>(snapshot->daughters.size());
+        row.daughterCount = static_cast<uint32_t>(record.daughterSpecies.size());
+        snapshot->daughters.insert(snapshot->daughters.end(),
+                                   record.daughterSpecies.begin(), record.daughterSpecies.end());
+
+        snapshot->species.push_back(row);
+    }
+
+    for (const auto& [speciesId, changes] : m_traitChangesBySpecies) {
+        for (const TraitChange& change : changes) {
+            snapshot->traits.push_back(makeTraitRow(speciesId, change));
+        }
+    }
+
+    snapshot->diversity.reserve(m_diversityHistory.size());
+    for (const auto& diversity : m_diversityHistory) {
+        snapshot->diversity.push_back(makeDiversityRow(diversity));
+    }
+
+    return snapshot;
+}
+
+std::future<bool> EvolutionaryHistoryTracker::exportAsync(const std::string& baseFilename) const
+{
+    return exportSnapshotAsync(createExportSnapshot(), baseFilename);
 }
 
 // =============================================================================
@@ -980,13 +1035,18 @@ int EvolutionaryHistoryTracker::pruneOldRecords(Generation generationThreshold,
     std::unordered_set<LineageId> preservedLineages;
 
     if (preserveAncestry) {
+        std::vector<LineageIndex> ancestry;
         for (const auto& [lineageId, record] : m_lineageRecords) {
             if (record.isExtant()) {
-                // Keep this lineage and all its ancestors
+                // Keep this lineage and all its ancestors. An ancestor already
+                // in the set has had its own ancestry added, so stop there.
                 preservedLineages.insert(lineageId);
-                auto ancestry = getAncestry(lineageId);
-                for (LineageId ancestorId : ancestry) {
-                    preservedLineages.insert(ancestorId);
+                ancestry.clear();
+                m_lineageStore.collectAncestry(m_lineageStore.indexOf(lineageId), ancestry);
+                for (LineageIndex ancestor : ancestry) {
+                    if (!preservedLineages.insert(m_lineageStore.getId(ancestor)).second) {
+                        break;
+                    }
                 }
             }
         }
@@ -1003,22 +1063,24 @@ int EvolutionaryHistoryTracker::pruneOldRecords(Generation generationThreshold,
         }
     }
 
+    std::unordered_set<LineageId> removed(toRemove.begin(), toRemove.end());
     for (LineageId id : toRemove) {
         m_lineageRecords.erase(id);
         m_lineageTree.erase(id);
         prunedCount++;
+    }
 
-        // Update parent's child list
+    // Update child lists in a single pass over the survivors
+    if (!removed.empty()) {
+        auto isRemoved = [&removed](LineageId id) { return removed.count(id) > 0; };
         for (auto& [parentId, record] : m_lineageRecords) {
             auto& children = record.childLineages;
-            children.erase(std::remove(children.begin(), children.end(), id),
+            children.erase(std::remove_if(children.begin(), children.end(), isRemoved),
                           children.end());
         }
-
-        // Update tree parent's child list
         for (auto& [parentId, node] : m_lineageTree) {
             auto& children = node.childrenIds;
-            children.erase(std::remove(children.begin(), children.end(), id),
+            children.erase(std::remove_if(children.begin(), children.end(), isRemoved),
                           children.end());
         }
     }
@@ -1032,8 +1094,8 @@ int EvolutionaryHistoryTracker::pruneOldRecords(Generation generationThreshold,
         changes.erase(newEnd, changes.end());
     }
 
-    // Clear ancestor cache (may contain stale entries)
-    m_ancestorCache.clear();
+    // Fold dead side branches of the ancestry store into their survivors
+    m_lineageStore.coalesceExtinctBranches(generationThreshold);
 
     return prunedCount;
 }
@@ -1072,8 +1134,8 @@ size_t EvolutionaryHistoryTracker::getMemoryUsage() const
     usage += m_speciationsByGeneration.size() * (sizeof(Generation) + sizeof(int));
     usage += m_extinctionsByGeneration.size() * (sizeof(Generation) + sizeof(int));
 
-    // Ancestor cache
-    usage += m_ancestorCache.size() * (sizeof(uint64_t) + sizeof(LineageId));
+    // Columnar lineage store
+    usage += m_lineageStore.getMemoryUsage();
 
     return usage;
 }
@@ -1084,6 +1146,17 @@ void EvolutionaryHistoryTracker::setMaxRecords(size_t maxLineages, size_t maxSpe
     m_maxSpeciesRecords = maxSpecies;
 }
 
+bool EvolutionaryHistoryTracker::spillLineageStore(const std::string& filename)
+{
+    return m_lineageStore.spillToFile(filename);
+}
+
+void EvolutionaryHistoryTracker::setLineageSpillFile(const std::string& filename, size_t spillEvery)
+{
+    m_lineageSpillFile = filename;
+    m_lineageSpillInterval = std::max<size_t>(1, spillEvery);
+}
+
 void EvolutionaryHistoryTracker::clear()
 {
     m_lineageRecords.clear();
@@ -1093,7 +1166,7 @@ void EvolutionaryHistoryTracker::clear()
     m_diversityHistory.clear();
     m_speciationsByGeneration.clear();
     m_extinctionsByGeneration.clear();
-    m_ancestorCache.clear();
+    m_lineageStore.clear();
 
     m_currentGeneration = 0;
     m_totalBirths = 0;
@@ -1203,12 +1276,22 @@ LineageId EvolutionaryHistoryTracker::createLineageRecord(const Creature* creatu
 
     const DiploidGenome& genome = creature->getDiploidGenome();
 
-    // Store founder genome
-    record.founderGenome = genome;
+    // Store founder genome (compact storage keeps only the store's quantized snapshot)
+    if (!m_compactLineageStorage) {
+        record.founderGenome = genome;
+    }
     record.founderFitness = creature->getFitness();
 
-    // Initialize species history
+    // Ancestry queries read the store, so a lineage it rejects is not recorded
     SpeciesId currentSpecies = genome.getSpeciesId();
+    if (m_lineageStore.append(newId, parentLineage, m_currentGeneration, currentSpecies, &genome) ==
+        INVALID_LINEAGE_INDEX) {
+        std::cerr << "EvolutionaryHistoryTracker: lineage " << newId
+                  << " is out of order for the lineage store; not recorded" << std::endl;
+        return 0;
+    }
+
+    // Initialize species history
     if (currentSpecies != 0) {
         record.speciesHistory.emplace_back(m_currentGeneration, currentSpecies);
     }
@@ -1234,68 +1317,6 @@ void EvolutionaryHistoryTracker::updateLineageOnDeath(LineageId lineageId)
     record.survivingDescendants = std::max(0, record.survivingDescendants - 1);
 }
 
-std::unordered_set<LineageId> EvolutionaryHistoryTracker::buildAncestorSet(LineageId lineage) const
-{
-    std::unordered_set<LineageId> ancestors;
-
-    LineageId current = lineage;
-    while (current != 0) {
-        auto it = m_lineageRecords.find(current);
-        if (it == m_lineageRecords.end()) break;
-
-        LineageId parent = it->second.ancestorLineageId;
-        if (parent != 0) {
-            ancestors.insert(parent);
-        }
-        current = parent;
-    }
-
-    return ancestors;
-}
-
-std::string EvolutionaryHistoryTracker::newickForSpecies(SpeciesId speciesId) const
-{
-    auto it = m_phylogeneticRecords.find(speciesId);
-    if (it == m_phylogeneticRecords.end()) {
-        return "Unknown_" + std::to_string(speciesId);
-    }
-
-    const PhylogeneticRecord& record = it->second;
-    std::stringstream ss;
-
-    // Check if this species has descendants
-    if (!record.daughterSpecies.empty()) {
-        ss << "(";
-        for (size_t i = 0; i < record.daughterSpecies.size(); i++) {
-            if (i > 0) ss << ",";
-            ss << newickForSpecies(record.daughterSpecies[i]);
-        }
-        ss << ")";
-    }
-
-    // Add species name
-    if (!record.speciesName.empty()) {
-        ss << record.speciesName;
-    } else {
-        ss << "Species_" << speciesId;
-    }
-
-    // Add branch length (duration if extinct, time since founding if extant)
-    float branchLength = 0.0f;
-    if (record.parentSpeciesId != 0) {
-        auto parentIt = m_phylogeneticRecords.find(record.parentSpeciesId);
-        if (parentIt != m_phylogeneticRecords.end()) {
-            branchLength = static_cast<float>(record.foundingGeneration -
-                                               parentIt->second.foundingGeneration);
-        }
-    }
-    if (branchLength > 0) {
-        ss << ":" << branchLength;
-    }
-
-    return ss.str();
-}
-
 float EvolutionaryHistoryTracker::calculateSuccessScore(const LineageRecord& record) const
 {
     // Weighted composite score for lineage success
@@ -1348,10 +1369,21 @@ void EvolutionaryHistoryTracker::autoPruneIfNeeded()
             std::sort(extinctionGens.begin(), extinctionGens.end());
             size_t targetIndex = extinctionGens.size() / 5;  // 20%
             Generation threshold = extinctionGens[targetIndex];
-            pruneOldRecords(threshold, true);
+            // Compact storage keeps ancestry in the lineage store, so the
+            // record map does not need to pin ancestors of extant lineages
+            pruneOldRecords(threshold, !m_compactLineageStorage);
         }
     }
 
+    // Move the store's columns out of the heap once enough have accumulated
+    if (!m_lineageSpillFile.empty() &&
+        m_lineageStore.getUnspilledCount() >= m_lineageSpillInterval &&
+        !m_lineageStore.spillToFile(m_lineageSpillFile)) {
+        std::cerr << "EvolutionaryHistoryTracker: could not spill lineage store to "
+                  << m_lineageSpillFile << "; automatic spilling disabled" << std::endl;
+        m_lineageSpillFile.clear();
+    }
+
     // Check species records (less aggressive pruning)
     if (m_maxSpeciesRecords > 0 && m_phylogeneticRecords.size() > m_maxSpeciesRecords) {
         // Remove oldest extinct species with no extant descendants
@@ -1372,32 +1404,6 @@ void EvolutionaryHistoryTracker::autoPruneIfNeeded()
     }
 }
 
-uint64_t EvolutionaryHistoryTracker::makeAncestorCacheKey(LineageId l1, LineageId l2) const
-{
-    // Ensure consistent ordering for cache key
-    if (l1 > l2) std::swap(l1, l2);
-    return (static_cast<uint64_t>(l1) << 32) | static_cast<uint64_t>(l2);
-}
-
-void EvolutionaryHistoryTracker::invalidateAncestorCache(LineageId lineage)
-{
-    // Simple approach: clear entries involving this lineage
-    // For a more efficient approach, we could track cache dependencies
-    std::vector<uint64_t> keysToRemove;
-
-    for (const auto& [key, value] : m_ancestorCache) {
-        LineageId l1 = static_cast<LineageId>(key >> 32);
-        LineageId l2 = static_cast<LineageId>(key & 0xFFFFFFFF);
-        if (l1 == lineage || l2 == lineage) {
-            keysToRemove.push_back(key);
-        }
-    }
-
-    for (uint64_t key : keysToRemove) {
-        m_ancestorCache.erase(key);
-    }
-}
-
 // =============================================================================
 // ADDITIONAL METHODS FROM HEADER
 // =============================================================================
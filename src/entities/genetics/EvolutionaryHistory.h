@@ -21,6 +21,8 @@
 
 #include "DiploidGenome.h"
 #include "Species.h"
+#include "LineageStore.h"
+#include "PhylogenyExport.h"
 #include <vector>
 #include <map>
 #include <unordered_map>
@@ -28,6 +30,7 @@
 #include <string>
 #include <memory>
 #include <functional>
+#include <future>
 #include <optional>
 #include <cstdint>
 
@@ -1036,8 +1039,8 @@ class EvolutionaryHistoryTracker {
     /**
      * @brief Finds the most recent common ancestor of two lineages.
      *
-     * Traverses ancestry trees to find the nearest shared ancestor.
-     * Returns 0 if lineages are unrelated.
+     * Answered from the lineage store's jump pointers in O(log depth),
+     * so no per-pair cache is kept. Returns 0 if lineages are unrelated.
      *
      * @param lineage1 First lineage ID.
      * @param lineage2 Second lineage ID.
@@ -1337,14 +1340,18 @@ class EvolutionaryHistoryTracker {
      * @brief Exports the phylogenetic tree in Newick format.
      *
      * Newick format is a standard for representing tree structures
-     * and can be read by most phylogenetic analysis software.
+     * and can be read by most phylogenetic analysis software. The tree is
+     * written iteratively, so deep histories do not recurse. Prefer
+     * exportNewickToFile() for large histories; it streams to disk.
      *
      * @return String in Newick format representing the species tree.
      */
     std::string exportToNewick() const;
 
     /**
-     * @brief Exports phylogenetic tree to a Newick file.
+     * @brief Streams the phylogenetic tree to a Newick file.
+     *
+     * Writes through a fixed-size buffer without building the tree string.
      *
      * @param filename Path to output file.
      * @return True if export succeeded.
@@ -1376,6 +1383,29 @@ class EvolutionaryHistoryTracker {
     bool exportDataToCSV(const std::string& filename,
                          const std::string& dataType) const;
 
+    /**
+     * @brief Takes a flat, immutable copy of all exportable history.
+     *
+     * The snapshot holds only plain rows (no genomes or per-record
+     * containers) and can be exported on another thread while the
+     * simulation keeps updating this tracker.
+     *
+     * @return Shared snapshot for exportSnapshotAsync() or synchronous writers.
+     */
+    std::shared_ptr<const HistoryExportSnapshot> createExportSnapshot() const;
+
+    /**
+     * @brief Exports Newick and CSV files on a worker thread.
+     *
+     * Takes a snapshot on the calling thread, then writes
+     * <baseFilename>.nwk and the <baseFilename>_*.csv tables in the
+     * background.
+     *
+     * @param baseFilename Base filename (extensions will be added).
+     * @return Future resolving to true if all files were written.
+     */
+    std::future<bool> exportAsync(const std::string& baseFilename) const;
+
     // =========================================================================
     // MEMORY MANAGEMENT
     // =========================================================================
@@ -1405,13 +1435,55 @@ class EvolutionaryHistoryTracker {
      * @brief Sets the maximum records to retain.
      *
      * When exceeded, oldest records are automatically pruned.
-     * Set to 0 to disable automatic pruning.
+     * Set to 0 to disable automatic pruning. Lineage records are capped at
+     * DEFAULT_MAX_LINEAGE_RECORDS unless changed here.
      *
      * @param maxLineages Maximum lineage records.
      * @param maxSpecies Maximum species records.
      */
     void setMaxRecords(size_t maxLineages, size_t maxSpecies);
 
+    /**
+     * @brief Enables compact lineage storage for long runs (default on).
+     *
+     * In compact mode, founder genomes are kept only as the quantized trait
+     * snapshot in the lineage store, trait changes are stored once per
+     * species instead of being copied into every extant lineage record, and
+     * automatic pruning drops extinct lineage records freely (ancestry is
+     * preserved by the lineage store, which coalesces dead side branches).
+     *
+     * @param enabled True to enable compact storage.
+     */
+    void setCompactLineageStorage(bool enabled);
+
+    /**
+     * @brief Moves the immutable lineage store columns to a memory-mapped file.
+     *
+     * @param filename Path of the spill file (overwritten).
+     * @return True if the columns were written and mapped.
+     */
+    bool spillLineageStore(const std::string& filename);
+
+    /**
+     * @brief Spills the lineage store automatically as it grows.
+     *
+     * Once @p spillEvery lineages have been appended since the last spill,
+     * the next birth moves the store's columns into @p filename. An empty
+     * filename disables automatic spilling (the default).
+     *
+     * @param filename Path of the spill file (overwritten on every spill).
+     * @param spillEvery In-memory lineages that trigger a spill.
+     */
+    void setLineageSpillFile(const std::string& filename,
+                             size_t spillEvery = DEFAULT_SPILL_INTERVAL);
+
+    /**
+     * @brief Gets the columnar lineage store backing ancestry queries.
+     *
+     * @return Const reference to the lineage store.
+     */
+    const LineageStore& getLineageStore() const;
+
     /**
      * @brief Clears all recorded history.
      *
@@ -1481,6 +1553,12 @@ class EvolutionaryHistoryTracker {
      */
     std::string getDebugSummary() const;
 
+    /// Lineage record cap applied by default (see setMaxRecords)
+    static constexpr size_t DEFAULT_MAX_LINEAGE_RECORDS = 20000;
+
+    /// In-memory lineages between automatic spills (see setLineageSpillFile)
+    static constexpr size_t DEFAULT_SPILL_INTERVAL = 65536;
+
 private:
     // =========================================================================
     // INTERNAL DATA STRUCTURES
@@ -1510,6 +1588,9 @@ class EvolutionaryHistoryTracker {
     /// Whether to track detailed genomic changes
     bool m_detailedGenomicTracking;
 
+    /// Whether to use compact lineage storage (see setCompactLineageStorage)
+    bool m_compactLineageStorage;
+
     /// Maximum records before automatic pruning (0 = no limit)
     size_t m_maxLineageRecords;
     size_t m_maxSpeciesRecords;
@@ -1524,8 +1605,12 @@ class EvolutionaryHistoryTracker {
     std::map<Generation, int> m_speciationsByGeneration;
     std::map<Generation, int> m_extinctionsByGeneration;
 
-    /// Cache for common ancestor queries
-    mutable std::unordered_map<uint64_t, LineageId> m_ancestorCache;
+    /// Columnar parent/generation/trait store for ancestry queries
+    LineageStore m_lineageStore;
+
+    /// Automatic spill target and trigger (empty path: never spill)
+    std::string m_lineageSpillFile;
+    size_t m_lineageSpillInterval;
 
     // =========================================================================
     // INTERNAL HELPER METHODS
@@ -1536,7 +1621,7 @@ class EvolutionaryHistoryTracker {
      *
      * @param creature The creature to create a record for.
      * @param parentLineage Parent lineage ID (0 if new founder).
-     * @return The newly created lineage ID.
+     * @return The newly created lineage ID, or 0 if the lineage store rejected it.
      */
     LineageId createLineageRecord(const Creature* creature,
                                   LineageId parentLineage);
@@ -1549,20 +1634,12 @@ class EvolutionaryHistoryTracker {
     void updateLineageOnDeath(LineageId lineageId);
 
     /**
-     * @brief Builds ancestor chain for MRCA calculations.
-     *
-     * @param lineage Starting lineage.
-     * @return Set of all ancestor lineage IDs.
-     */
-    std::unordered_set<LineageId> buildAncestorSet(LineageId lineage) const;
-
-    /**
-     * @brief Generates Newick string recursively.
+     * @brief Streams the species tree in Newick format to a sink.
      *
-     * @param speciesId Current species node.
-     * @return Newick substring for this subtree.
+     * @param sink BufferedFileWriter or StringExportSink.
      */
-    std::string newickForSpecies(SpeciesId speciesId) const;
+    template <typename Sink>
+    void writeNewick(Sink& sink) const;
 
     /**
      * @brief Calculates composite success score for a lineage.
@@ -1577,22 +1654,6 @@ class EvolutionaryHistoryTracker {
      */
     void autoPruneIfNeeded();
 
-    /**
-     * @brief Creates cache key for ancestor pair.
-     *
-     * @param l1 First lineage.
-     * @param l2 Second lineage.
-     * @return Unique cache key.
-     */
-    uint64_t makeAncestorCacheKey(LineageId l1, LineageId l2) const;
-
-    /**
-     * @brief Invalidates ancestor cache entries affected by changes.
-     *
-     * @param lineage Lineage that was modified.
-     */
-    void invalidateAncestorCache(LineageId lineage);
-
     /// Next lineage ID to assign
     static LineageId s_nextLineageId;
 };
@@ -1617,6 +1678,14 @@ inline void EvolutionaryHistoryTracker::setDetailedGenomicTracking(bool enabled)
     m_detailedGenomicTracking = enabled;
 }
 
+inline void EvolutionaryHistoryTracker::setCompactLineageStorage(bool enabled) {
+    m_compactLineageStorage = enabled;
+}
+
+inline const LineageStore& EvolutionaryHistoryTracker::getLineageStore() const {
+    return m_lineageStore;
+}
+
 inline const std::unordered_map<LineageId, LineageRecord>&
 EvolutionaryHistoryTracker::getAllLineageRecords() const {
     return m_lineageRecords;
@@ -130,7 +130,7 @@ std::unique_ptr<Creature> GeneticsManager::handleReproduction(
         DiploidGenome childGenome = parent1.getDiploidGenome();
         childGenome.mutate(config.baseMutationRate * 1.5f, config.mutationStrength);  // Higher mutation
 
-        offspring = std::make_unique<Creature>(spawnPos, childGenome, parent1.getType());
+        offspring = std::make_unique<Creature>(spawnPos, std::move(childGenome), parent1.getType());
         offspring->setGeneration(parent1.getGeneration() + 1);
 
         float cost;
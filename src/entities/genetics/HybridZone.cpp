@@ -309,7 +309,7 @@ std::unique_ptr<Creature> HybridZoneManager::attemptHybridMating(
     }
 
     // Create hybrid creature
-    auto hybrid = std::make_unique<Creature>(spawnPos, hybridGenome, parent1.getType());
+    auto hybrid = std::make_unique<Creature>(spawnPos, std::move(hybridGenome), parent1.getType());
 
     // Set generation to max of parents + 1 (essential for evolution tracking)
     hybrid->setGeneration(std::max(parent1.getGeneration(), parent2.getGeneration()) + 1);
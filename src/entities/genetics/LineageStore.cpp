@@ -0,0 +1,484 @@
+/**
+ * @file LineageStore.cpp
+ * @brief Implementation of the columnar lineage store.
+ */
+
+#include "LineageStore.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace genetics {
+
+namespace {
+
+constexpr uint32_t SPILL_MAGIC = 0x4C4E4753; // "LNGS"
+constexpr uint32_t SPILL_VERSION = 1;
+
+struct SpillHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t count;
+};
+
+uint16_t quantizeTrait(float value, const GeneValueRange& range) {
+    float span = range.max - range.min;
+    if (span <= 0.0f) return 0;
+    float t = std::clamp((value - range.min) / span, 0.0f, 1.0f);
+    return static_cast<uint16_t>(std::lround(t * 65535.0f));
+}
+
+float dequantizeTrait(uint16_t value, const GeneValueRange& range) {
+    return range.min + (range.max - range.min) * (static_cast<float>(value) / 65535.0f);
+}
+
+size_t alignUp(size_t offset) {
+    return (offset + 7) & ~static_cast<size_t>(7);
+}
+
+template <typename T>
+void writeColumn(std::ofstream& file, size_t& offset, const std::vector<T>& values) {
+    size_t aligned = alignUp(offset);
+    static const char padding[8] = {};
+    file.write(padding, static_cast<std::streamsize>(aligned - offset));
+    file.write(reinterpret_cast<const char*>(values.data()),
+               static_cast<std::streamsize>(values.size() * sizeof(T)));
+    offset = aligned + values.size() * sizeof(T);
+}
+
+template <typename T>
+const T* columnAt(const uint8_t* base, size_t& offset, size_t count) {
+    offset = alignUp(offset);
+    const T* ptr = reinterpret_cast<const T*>(base + offset);
+    offset += count * sizeof(T);
+    return ptr;
+}
+
+} // namespace
+
+// =============================================================================
+// APPENDING & UPDATING
+// =============================================================================
+
+const std::array<GeneType, LineageStore::SNAPSHOT_TRAIT_COUNT>& LineageStore::getSnapshotTraits() {
+    static const std::array<GeneType, SNAPSHOT_TRAIT_COUNT> traits = {
+        GeneType::SIZE, GeneType::SPEED, GeneType::VISION_RANGE, GeneType::EFFICIENCY,
+        GeneType::METABOLIC_RATE, GeneType::FERTILITY, GeneType::AGGRESSION, GeneType::SOCIALITY
+    };
+    return traits;
+}
+
+LineageIndex LineageStore::append(LineageId id, LineageId parentId, Generation generation,
+                                  SpeciesId species, const DiploidGenome* founder)
+{
+    size_t count = size();
+    if (count > 0 && id <= m_ids[count - 1]) {
+        return INVALID_LINEAGE_INDEX;
+    }
+
+    LineageIndex parent = parentId != 0 ? indexOf(parentId) : INVALID_LINEAGE_INDEX;
+    LineageIndex index = static_cast<LineageIndex>(count);
+
+    m_ids.push_back(id);
+    m_parents.push_back(parent);
+    m_depths.push_back(parent != INVALID_LINEAGE_INDEX ? m_depths[parent] + 1 : 0);
+    m_jumps.push_back(parent != INVALID_LINEAGE_INDEX ? computeJump(parent) : index);
+    m_founded.push_back(generation);
+
+    const auto& traits = getSnapshotTraits();
+    for (size_t c = 0; c < SNAPSHOT_TRAIT_COUNT; c++) {
+        GeneValueRange range = getGeneValueRange(traits[c]);
+        float value = founder ? founder->getTrait(traits[c]) : range.defaultVal;
+        m_traitColumns[c].push_back(quantizeTrait(value, range));
+    }
+
+    m_extinct.push_back(-1);
+    m_species.push_back(species);
+    m_living.push_back(1);
+    m_totals.push_back(1);
+
+    if (int32_t* slot = generationSlot(m_birthsByGeneration, generation)) {
+        (*slot)++;
+    }
+
+    return index;
+}
+
+void LineageStore::recordBirth(LineageIndex index, Generation generation)
+{
+    if (index >= size()) return;
+
+    m_living[index]++;
+    m_totals[index]++;
+    m_extinct[index] = -1;
+
+    if (int32_t* slot = generationSlot(m_birthsByGeneration, generation)) {
+        (*slot)++;
+    }
+}
+
+void LineageStore::recordDeath(LineageIndex index, Generation generation)
+{
+    if (index >= size()) return;
+
+    m_living[index] = std::max(0, m_living[index] - 1);
+    if (m_living[index] == 0 && m_extinct[index] < 0) {
+        m_extinct[index] = generation;
+    }
+
+    if (int32_t* slot = generationSlot(m_deathsByGeneration, generation)) {
+        (*slot)++;
+    }
+}
+
+void LineageStore::setSpecies(LineageIndex index, SpeciesId species)
+{
+    if (index < size()) {
+        m_species[index] = species;
+    }
+}
+
+// =============================================================================
+// LOOKUP
+// =============================================================================
+
+LineageIndex LineageStore::indexOf(LineageId id) const
+{
+    size_t lo = 0;
+    size_t hi = size();
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (m_ids[mid] < id) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo < size() && m_ids[lo] == id) {
+        return static_cast<LineageIndex>(lo);
+    }
+    return INVALID_LINEAGE_INDEX;
+}
+
+float LineageStore::getSnapshotTrait(LineageIndex index, size_t column) const
+{
+    if (index >= size() || column >= SNAPSHOT_TRAIT_COUNT) return 0.0f;
+    return dequantizeTrait(m_traitColumns[column][index],
+                           getGeneValueRange(getSnapshotTraits()[column]));
+}
+
+// =============================================================================
+// ANCESTRY QUERIES
+// =============================================================================
+
+LineageIndex LineageStore::computeJump(LineageIndex parent) const
+{
+    // Skew-binary jump pointers: if the parent's jump and its jump's jump
+    // span equal depth ranges, merge them into one longer jump.
+    LineageIndex j1 = m_jumps[parent];
+    LineageIndex j2 = m_jumps[j1];
+    if (m_depths[parent] - m_depths[j1] == m_depths[j1] - m_depths[j2]) {
+        return j2;
+    }
+    return parent;
+}
+
+LineageIndex LineageStore::getAncestorAtDepth(LineageIndex index, uint32_t depth) const
+{
+    if (index >= size() || m_depths[index] < depth) return INVALID_LINEAGE_INDEX;
+
+    while (m_depths[index] > depth) {
+        LineageIndex jump = m_jumps[index];
+        index = m_depths[jump] >= depth ? jump : m_parents[index];
+    }
+    return index;
+}
+
+LineageIndex LineageStore::getMostRecentCommonAncestor(LineageIndex a, LineageIndex b) const
+{
+    if (a >= size() || b >= size()) return INVALID_LINEAGE_INDEX;
+
+    uint32_t depth = std::min(m_depths[a], m_depths[b]);
+    a = getAncestorAtDepth(a, depth);
+    b = getAncestorAtDepth(b, depth);
+
+    // Both nodes share a depth, and jump targets depend only on depth,
+    // so the jumps stay level with each other.
+    while (a != b) {
+        if (m_parents[a] == INVALID_LINEAGE_INDEX) {
+            return INVALID_LINEAGE_INDEX;  // Different root founders
+        }
+        if (m_jumps[a] != m_jumps[b]) {
+            a = m_jumps[a];
+            b = m_jumps[b];
+        } else {
+            a = m_parents[a];
+            b = m_parents[b];
+        }
+    }
+    return a;
+}
+
+void LineageStore::collectAncestry(LineageIndex index, std::vector<LineageIndex>& out) const
+{
+    if (index >= size()) return;
+
+    LineageIndex current = m_parents[index];
+    while (current != INVALID_LINEAGE_INDEX) {
+        out.push_back(current);
+        current = m_parents[current];
+    }
+}
+
+// =============================================================================
+// GENERATION-ORDERED EVENT COUNTS
+// =============================================================================
+
+int32_t* LineageStore::generationSlot(std::vector<int32_t>& counts, Generation generation)
+{
+    if (m_birthsByGeneration.empty() && m_deathsByGeneration.empty()) {
+        m_firstGeneration = generation;
+    }
+    if (generation < m_firstGeneration) return nullptr;
+
+    size_t offset = static_cast<size_t>(generation - m_firstGeneration);
+    if (offset >= counts.size()) {
+        counts.resize(offset + 1, 0);
+    }
+    return &counts[offset];
+}
+
+int LineageStore::getBirthsInGeneration(Generation generation) const
+{
+    if (generation < m_firstGeneration) return 0;
+    size_t offset = static_cast<size_t>(generation - m_firstGeneration);
+    return offset < m_birthsByGeneration.size() ? m_birthsByGeneration[offset] : 0;
+}
+
+int LineageStore::getDeathsInGeneration(Generation generation) const
+{
+    if (generation < m_firstGeneration) return 0;
+    size_t offset = static_cast<size_t>(generation - m_firstGeneration);
+    return offset < m_deathsByGeneration.size() ? m_deathsByGeneration[offset] : 0;
+}
+
+// =============================================================================
+// MEMORY MANAGEMENT
+// =============================================================================
+
+size_t LineageStore::coalesceExtinctBranches(Generation extinctBefore)
+{
+    const size_t count = size();
+    if (count == 0) return 0;
+
+    // Mark lineages to keep, then propagate to ancestors. Parents always
+    // precede children, so a single reverse sweep covers whole subtrees.
+    std::vector<uint8_t> keep(count, 0);
+    for (size_t i = 0; i < count; i++) {
+        keep[i] = (m_extinct[i] < 0 || m_extinct[i] >= extinctBefore) ? 1 : 0;
+    }
+
+    std::vector<uint32_t> folded(count, 0);
+    for (size_t i = count; i-- > 0;) {
+        LineageIndex parent = m_parents[i];
+        if (keep[i]) {
+            m_totals[i] += folded[i];
+            if (parent != INVALID_LINEAGE_INDEX) keep[parent] = 1;
+        } else if (parent != INVALID_LINEAGE_INDEX) {
+            folded[parent] += m_totals[i] + folded[i];
+        }
+    }
+
+    size_t kept = 0;
+    for (uint8_t k : keep) kept += k;
+    if (kept == count) return 0;
+
+    std::vector<LineageIndex> remap(count, INVALID_LINEAGE_INDEX);
+    std::vector<LineageId> ids;
+    std::vector<LineageIndex> parents;
+    std::vector<LineageIndex> jumps;
+    std::vector<uint32_t> depths;
+    std::vector<Generation> founded;
+    std::array<std::vector<uint16_t>, SNAPSHOT_TRAIT_COUNT> traits;
+    ids.reserve(kept);
+    parents.reserve(kept);
+    jumps.reserve(kept);
+    depths.reserve(kept);
+    founded.reserve(kept);
+    for (auto& column : traits) column.reserve(kept);
+
+    std::vector<Generation> extinct;
+    std::vector<SpeciesId> species;
+    std::vector<int32_t> living;
+    std::vector<uint32_t> totals;
+    extinct.reserve(kept);
+    species.reserve(kept);
+    living.reserve(kept);
+    totals.reserve(kept);
+
+    for (size_t i = 0; i < count; i++) {
+        if (!keep[i]) continue;
+
+        LineageIndex newIndex = static_cast<LineageIndex>(ids.size());
+        remap[i] = newIndex;
+
+        LineageIndex oldParent = m_parents[i];
+        LineageIndex parent = oldParent != INVALID_LINEAGE_INDEX ? remap[oldParent] : INVALID_LINEAGE_INDEX;
+
+        ids.push_back(m_ids[i]);
+        parents.push_back(parent);
+        depths.push_back(m_depths[i]);
+        founded.push_back(m_founded[i]);
+        for (size_t c = 0; c < SNAPSHOT_TRAIT_COUNT; c++) {
+            traits[c].push_back(m_traitColumns[c][i]);
+        }
+
+        // Ancestors are all kept, so depths are unchanged; jumps are
+        // rebuilt against the new indices.
+        if (parent == INVALID_LINEAGE_INDEX) {
+            jumps.push_back(newIndex);
+        } else {
+            LineageIndex j1 = jumps[parent];
+            LineageIndex j2 = jumps[j1];
+            jumps.push_back(depths[parent] - depths[j1] == depths[j1] - depths[j2] ? j2 : parent);
+        }
+
+        extinct.push_back(m_extinct[i]);
+        species.push_back(m_species[i]);
+        living.push_back(m_living[i]);
+        totals.push_back(m_totals[i]);
+    }
+
+    m_ids.assign(std::move(ids));
+    m_parents.assign(std::move(parents));
+    m_jumps.assign(std::move(jumps));
+    m_depths.assign(std::move(depths));
+    m_founded.assign(std::move(founded));
+    for (size_t c = 0; c < SNAPSHOT_TRAIT_COUNT; c++) {
+        m_traitColumns[c].assign(std::move(traits[c]));
+    }
+    m_extinct = std::move(extinct);
+    m_species = std::move(species);
+    m_living = std::move(living);
+    m_totals = std::move(totals);
+    m_spillFile.close();
+
+    return count - kept;
+}
+
+bool LineageStore::spillToFile(const std::string& path)
+{
+    const size_t count = size();
+    if (count == 0) return false;
+
+    // Materialize first: the previous mapping may be the file we overwrite.
+    std::vector<LineageId> ids = m_ids.toVector();
+    std::vector<LineageIndex> parents = m_parents.toVector();
+    std::vector<LineageIndex> jumps = m_jumps.toVector();
+    std::vector<uint32_t> depths = m_depths.toVector();
+    std::vector<Generation> founded = m_founded.toVector();
+    std::array<std::vector<uint16_t>, SNAPSHOT_TRAIT_COUNT> traits;
+    for (size_t c = 0; c < SNAPSHOT_TRAIT_COUNT; c++) {
+        traits[c] = m_traitColumns[c].toVector();
+    }
+
+    auto restore = [&]() {
+        m_ids.assign(std::move(ids));
+        m_parents.assign(std::move(parents));
+        m_jumps.assign(std::move(jumps));
+        m_depths.assign(std::move(depths));
+        m_founded.assign(std::move(founded));
+        for (size_t c = 0; c < SNAPSHOT_TRAIT_COUNT; c++) {
+            m_traitColumns[c].assign(std::move(traits[c]));
+        }
+    };
+
+    m_spillFile.close();
+
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            restore();
+            return false;
+        }
+
+        SpillHeader header{SPILL_MAGIC, SPILL_VERSION, static_cast<uint64_t>(count)};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        size_t offset = sizeof(header);
+        writeColumn(file, offset, ids);
+        writeColumn(file, offset, parents);
+        writeColumn(file, offset, jumps);
+        writeColumn(file, offset, depths);
+        writeColumn(file, offset, founded);
+        for (const auto& column : traits) {
+            writeColumn(file, offset, column);
+        }
+        if (!file.good()) {
+            restore();
+            return false;
+        }
+    }
+
+    if (!m_spillFile.open(path)) {
+        restore();
+        return false;
+    }
+
+    const uint8_t* base = m_spillFile.data();
+    size_t offset = sizeof(SpillHeader);
+    m_ids.map(columnAt<LineageId>(base, offset, count), count);
+    m_parents.map(columnAt<LineageIndex>(base, offset, count), count);
+    m_jumps.map(columnAt<LineageIndex>(base, offset, count), count);
+    m_depths.map(columnAt<uint32_t>(base, offset, count), count);
+    m_founded.map(columnAt<Generation>(base, offset, count), count);
+    for (auto& column : m_traitColumns) {
+        column.map(columnAt<uint16_t>(base, offset, count), count);
+    }
+
+    return true;
+}
+
+size_t LineageStore::getMemoryUsage() const
+{
+    size_t usage = sizeof(*this);
+
+    usage += m_ids.heapBytes();
+    usage += m_parents.heapBytes();
+    usage += m_jumps.heapBytes();
+    usage += m_depths.heapBytes();
+    usage += m_founded.heapBytes();
+    for (const auto& column : m_traitColumns) {
+        usage += column.heapBytes();
+    }
+
+    usage += m_extinct.capacity() * sizeof(Generation);
+    usage += m_species.capacity() * sizeof(SpeciesId);
+    usage += m_living.capacity() * sizeof(int32_t);
+    usage += m_totals.capacity() * sizeof(uint32_t);
+    usage += m_birthsByGeneration.capacity() * sizeof(int32_t);
+    usage += m_deathsByGeneration.capacity() * sizeof(int32_t);
+
+    return usage;
+}
+
+void LineageStore::clear()
+{
+    m_ids.clear();
+    m_parents.clear();
+    m_jumps.clear();
+    m_depths.clear();
+    m_founded.clear();
+    for (auto& column : m_traitColumns) {
+        column.clear();
+    }
+    m_extinct.clear();
+    m_species.clear();
+    m_living.clear();
+    m_totals.clear();
+    m_firstGeneration = 0;
+    m_birthsByGeneration.clear();
+    m_deathsByGeneration.clear();
+    m_spillFile.close();
+}
+
+} // namespace genetics
@@ -0,0 +1,241 @@
+#pragma once
+
+/**
+ * @file LineageStore.h
+ * @brief Compact, append-only columnar storage for lineage ancestry.
+ *
+ * LineageStore keeps the parts of evolutionary history that grow with every
+ * new lineage - parent links, founding/extinction generations, descendant
+ * counters and a quantized trait snapshot of each founder - in flat
+ * per-field arrays indexed by a dense LineageIndex. Lineages are appended in
+ * founding order, so a parent always has a smaller index than its children.
+ *
+ * Ancestry and MRCA queries use a single skew-binary jump pointer per node
+ * (the compact form of binary lifting), giving O(log n) queries with one
+ * extra 32-bit word per lineage instead of a log(n)-wide table.
+ *
+ * Memory is bounded by two mechanisms:
+ * - coalesceExtinctBranches() drops side branches whose whole subtree died
+ *   out before a cutoff, folding their descendant counts into the nearest
+ *   surviving ancestor.
+ * - spillToFile() moves the immutable columns into a memory-mapped file so
+ *   they live in the OS page cache instead of the heap.
+ *
+ * Thread Safety: Not thread-safe, same as EvolutionaryHistoryTracker.
+ */
+
+#include "DiploidGenome.h"
+#include "../../utils/MappedFile.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace genetics {
+
+using LineageId = uint64_t;
+using Generation = int;
+
+/**
+ * @brief Dense index of a lineage inside a LineageStore.
+ *
+ * Indices are only stable until the next coalesceExtinctBranches() call.
+ * Use LineageId for anything that must survive compaction.
+ */
+using LineageIndex = uint32_t;
+constexpr LineageIndex INVALID_LINEAGE_INDEX = 0xFFFFFFFFu;
+
+class LineageStore {
+public:
+    /// Number of quantized founder trait columns kept per lineage
+    static constexpr size_t SNAPSHOT_TRAIT_COUNT = 8;
+
+    LineageStore() = default;
+    ~LineageStore() = default;
+
+    LineageStore(const LineageStore&) = delete;
+    LineageStore& operator=(const LineageStore&) = delete;
+    LineageStore(LineageStore&&) noexcept = default;
+    LineageStore& operator=(LineageStore&&) noexcept = default;
+
+    // =========================================================================
+    // Appending & Updating
+    // =========================================================================
+
+    /**
+     * @brief Appends a newly founded lineage.
+     *
+     * Lineage IDs must be appended in increasing order (the tracker hands
+     * them out sequentially); lookups rely on the ID column being sorted.
+     *
+     * @param id New lineage ID (greater than every stored ID).
+     * @param parentId Parent lineage ID, or 0 for a founder.
+     * @param generation Founding generation.
+     * @param species Species of the founding individual.
+     * @param founder Founder genome for the trait snapshot (optional).
+     * @return Index of the new lineage, or INVALID_LINEAGE_INDEX if the ID is out of order.
+     */
+    LineageIndex append(LineageId id, LineageId parentId, Generation generation,
+                        SpeciesId species, const DiploidGenome* founder);
+
+    /// Records one more living member of a lineage.
+    void recordBirth(LineageIndex index, Generation generation);
+
+    /// Records a member death; marks the lineage extinct when none remain.
+    void recordDeath(LineageIndex index, Generation generation);
+
+    /// Updates the species a lineage currently belongs to.
+    void setSpecies(LineageIndex index, SpeciesId species);
+
+    // =========================================================================
+    // Lookup
+    // =========================================================================
+
+    /// Finds the index for a lineage ID (binary search over the ID column).
+    LineageIndex indexOf(LineageId id) const;
+
+    size_t size() const { return m_ids.size(); }
+    bool empty() const { return m_ids.size() == 0; }
+
+    LineageId getId(LineageIndex index) const { return m_ids[index]; }
+    LineageIndex getParent(LineageIndex index) const { return m_parents[index]; }
+    uint32_t getDepth(LineageIndex index) const { return m_depths[index]; }
+    Generation getFoundingGeneration(LineageIndex index) const { return m_founded[index]; }
+    Generation getExtinctionGeneration(LineageIndex index) const { return m_extinct[index]; }
+    bool isExtant(LineageIndex index) const { return m_extinct[index] < 0; }
+    SpeciesId getSpecies(LineageIndex index) const { return m_species[index]; }
+    int getLivingCount(LineageIndex index) const { return m_living[index]; }
+    uint32_t getTotalDescendants(LineageIndex index) const { return m_totals[index]; }
+
+    /// Trait types captured in the founder snapshot columns.
+    static const std::array<GeneType, SNAPSHOT_TRAIT_COUNT>& getSnapshotTraits();
+
+    /// Dequantized founder trait value for a snapshot column.
+    float getSnapshotTrait(LineageIndex index, size_t column) const;
+
+    // =========================================================================
+    // Ancestry Queries
+    // =========================================================================
+
+    /// Ancestor of a lineage at a given tree depth (INVALID if deeper than the node).
+    LineageIndex getAncestorAtDepth(LineageIndex index, uint32_t depth) const;
+
+    /// Most recent common ancestor, or INVALID_LINEAGE_INDEX if in different trees.
+    LineageIndex getMostRecentCommonAncestor(LineageIndex a, LineageIndex b) const;
+
+    /// Appends ancestor indices from nearest to root (excluding the node itself).
+    void collectAncestry(LineageIndex index, std::vector<LineageIndex>& out) const;
+
+    // =========================================================================
+    // Generation-Ordered Event Counts
+    // =========================================================================
+
+    int getBirthsInGeneration(Generation generation) const;
+    int getDeathsInGeneration(Generation generation) const;
+
+    // =========================================================================
+    // Memory Management
+    // =========================================================================
+
+    /**
+     * @brief Removes extinct side branches that died out before a cutoff.
+     *
+     * A lineage is kept if it or any descendant is extant, or went extinct
+     * at or after the cutoff. Removed lineages fold their total descendant
+     * counts into their closest kept ancestor. Invalidates all LineageIndex
+     * values and materializes any spilled columns back into memory.
+     *
+     * @param extinctBefore Extinct subtrees older than this are coalesced.
+     * @return Number of lineages removed.
+     */
+    size_t coalesceExtinctBranches(Generation extinctBefore);
+
+    /**
+     * @brief Moves the immutable columns into a memory-mapped file.
+     *
+     * Parent links, jump pointers, depths, IDs, founding generations and
+     * trait snapshots are written to @p path and read back through a
+     * read-only mapping. Lineages appended afterwards go to an in-memory
+     * tail until the next spill.
+     *
+     * @return True if the file was written and mapped.
+     */
+    bool spillToFile(const std::string& path);
+
+    bool isSpilled() const { return m_spillFile.isOpen(); }
+
+    /// Lineages whose immutable columns are still on the heap.
+    size_t getUnspilledCount() const { return m_ids.tailSize(); }
+
+    /// Approximate heap usage in bytes (mapped pages are not counted).
+    size_t getMemoryUsage() const;
+
+    void clear();
+
+private:
+    /**
+     * @brief Column whose prefix may live in a read-only mapped file.
+     */
+    template <typename T>
+    class Column {
+    public:
+        const T& operator[](size_t i) const {
+            return i < m_mappedCount ? m_mapped[i] : m_tail[i - m_mappedCount];
+        }
+        void push_back(const T& value) { m_tail.push_back(value); }
+        size_t size() const { return m_mappedCount + m_tail.size(); }
+        size_t tailSize() const { return m_tail.size(); }
+        size_t heapBytes() const { return m_tail.capacity() * sizeof(T); }
+
+        void assign(std::vector<T>&& values) {
+            m_mapped = nullptr;
+            m_mappedCount = 0;
+            m_tail = std::move(values);
+        }
+        void map(const T* data, size_t count) {
+            m_mapped = data;
+            m_mappedCount = count;
+            m_tail.clear();
+            m_tail.shrink_to_fit();
+        }
+        std::vector<T> toVector() const {
+            std::vector<T> out;
+            out.reserve(size());
+            out.insert(out.end(), m_mapped, m_mapped + m_mappedCount);
+            out.insert(out.end(), m_tail.begin(), m_tail.end());
+            return out;
+        }
+        void clear() { assign({}); }
+
+    private:
+        const T* m_mapped = nullptr;
+        size_t m_mappedCount = 0;
+        std::vector<T> m_tail;
+    };
+
+    // Immutable columns (spillable)
+    Column<LineageId> m_ids;
+    Column<LineageIndex> m_parents;
+    Column<LineageIndex> m_jumps;
+    Column<uint32_t> m_depths;
+    Column<Generation> m_founded;
+    std::array<Column<uint16_t>, SNAPSHOT_TRAIT_COUNT> m_traitColumns;
+
+    // Mutable columns (always in memory)
+    std::vector<Generation> m_extinct;
+    std::vector<SpeciesId> m_species;
+    std::vector<int32_t> m_living;
+    std::vector<uint32_t> m_totals;
+
+    // Per-generation birth/death counts, indexed from m_firstGeneration
+    Generation m_firstGeneration = 0;
+    std::vector<int32_t> m_birthsByGeneration;
+    std::vector<int32_t> m_deathsByGeneration;
+
+    MappedFile m_spillFile;
+
+    LineageIndex computeJump(LineageIndex parent) const;
+    int32_t* generationSlot(std::vector<int32_t>& counts, Generation generation);
+};
+
+} // namespace genetics
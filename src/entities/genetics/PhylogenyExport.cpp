@@ -0,0 +1,190 @@
+/**
+ * @file PhylogenyExport.cpp
+ * @brief Streaming Newick/CSV export implementation.
+ */
+
+#include "PhylogenyExport.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace genetics {
+
+void StringExportSink::writeFloat(double value)
+{
+    char text[32];
+    int len = std::snprintf(text, sizeof(text), "%g", value);
+    m_out.append(text, static_cast<size_t>(len));
+}
+
+// =============================================================================
+// SNAPSHOT LOOKUP
+// =============================================================================
+
+const SpeciesExportRow* HistoryExportSnapshot::findSpecies(SpeciesId id) const
+{
+    auto it = std::lower_bound(species.begin(), species.end(), id,
+        [](const SpeciesExportRow& row, SpeciesId value) { return row.speciesId < value; });
+    if (it == species.end() || it->speciesId != id) return nullptr;
+    return &*it;
+}
+
+std::span<const SpeciesId> HistoryExportSnapshot::getDaughters(SpeciesId id) const
+{
+    const SpeciesExportRow* row = findSpecies(id);
+    if (!row || row->daughterCount == 0) return {};
+    return std::span<const SpeciesId>(daughters.data() + row->firstDaughter, row->daughterCount);
+}
+
+// =============================================================================
+// CSV ROW WRITERS
+// =============================================================================
+
+void writeLineageCsvHeader(BufferedFileWriter& out)
+{
+    out.write("LineageId,AncestorId,FoundingGeneration,ExtinctionGeneration,"
+              "PeakPopulation,TotalDescendants,SurvivingDescendants,AverageFitness\n");
+}
+
+void writeLineageCsvRow(BufferedFileWriter& out, const LineageExportRow& row)
+{
+    out.writeUInt(row.lineageId);            out.put(',');
+    out.writeUInt(row.ancestorId);           out.put(',');
+    out.writeInt(row.foundingGeneration);    out.put(',');
+    out.writeInt(row.extinctionGeneration);  out.put(',');
+    out.writeInt(row.peakPopulation);        out.put(',');
+    out.writeInt(row.totalDescendants);      out.put(',');
+    out.writeInt(row.survivingDescendants);  out.put(',');
+    out.writeFloat(row.averageFitness);      out.put('\n');
+}
+
+void writeSpeciesCsvHeader(BufferedFileWriter& out)
+{
+    out.write("SpeciesId,ParentSpeciesId,FoundingGeneration,ExtinctionGeneration,"
+              "FounderPopulation,PeakPopulation,DescendantCount,ExtinctionCause\n");
+}
+
+void writeSpeciesCsvRow(BufferedFileWriter& out, const SpeciesExportRow& row)
+{
+    out.writeUInt(row.speciesId);             out.put(',');
+    out.writeUInt(row.parentSpeciesId);       out.put(',');
+    out.writeInt(row.foundingGeneration);     out.put(',');
+    out.writeInt(row.extinctionGeneration);   out.put(',');
+    out.writeInt(row.founderPopulationSize);  out.put(',');
+    out.writeInt(row.peakPopulation);         out.put(',');
+    out.writeInt(row.descendantCount);        out.put(',');
+    out.writeInt(row.extinctionCause);        out.put('\n');
+}
+
+void writeTraitCsvHeader(BufferedFileWriter& out)
+{
+    out.write("Generation,SpeciesId,TraitType,OldValue,NewValue,ChangeType,SelectionPressure\n");
+}
+
+void writeTraitCsvRow(BufferedFileWriter& out, const TraitExportRow& row)
+{
+    out.writeInt(row.generation);         out.put(',');
+    out.writeUInt(row.speciesId);         out.put(',');
+    out.writeInt(row.traitType);          out.put(',');
+    out.writeFloat(row.oldValue);         out.put(',');
+    out.writeFloat(row.newValue);         out.put(',');
+    out.writeInt(row.changeType);         out.put(',');
+    out.writeInt(row.selectionPressure);  out.put('\n');
+}
+
+void writeDiversityCsvHeader(BufferedFileWriter& out)
+{
+    out.write("Generation,OverallHeterozygosity,NucleotideDiversity,"
+              "NumberOfAlleles,EffectivePopulationSize\n");
+}
+
+void writeDiversityCsvRow(BufferedFileWriter& out, const DiversityExportRow& row)
+{
+    out.writeInt(row.generation);                out.put(',');
+    out.writeFloat(row.overallHeterozygosity);   out.put(',');
+    out.writeFloat(row.nucleotideDiversity);     out.put(',');
+    out.writeInt(row.numberOfAlleles);           out.put(',');
+    out.writeFloat(row.effectivePopulationSize); out.put('\n');
+}
+
+// =============================================================================
+// SNAPSHOT EXPORT
+// =============================================================================
+
+bool exportSnapshotNewick(const HistoryExportSnapshot& snapshot, const std::string& filename)
+{
+    BufferedFileWriter out;
+    if (!out.open(filename)) {
+        return false;
+    }
+
+    std::vector<SpeciesId> roots;
+    for (const SpeciesExportRow& row : snapshot.species) {
+        if (row.parentSpeciesId == 0) {
+            roots.push_back(row.speciesId);
+        }
+    }
+
+    writeNewickForest<SpeciesId>(out, std::span<const SpeciesId>(roots),
+        [&snapshot](SpeciesId id) { return snapshot.getDaughters(id); },
+        [&snapshot](BufferedFileWriter& sink, SpeciesId id) {
+            const SpeciesExportRow* row = snapshot.findSpecies(id);
+            if (!row) {
+                sink.write("Unknown_");
+                sink.writeUInt(id);
+                return;
+            }
+            std::string_view name(snapshot.names.data() + row->nameOffset, row->nameLength);
+            writeSpeciesNewickLabel(sink, id, name, row->branchLength);
+        });
+    out.put('\n');
+
+    return out.close();
+}
+
+bool exportSnapshotCSV(const HistoryExportSnapshot& snapshot, const std::string& filename,
+                       const std::string& dataType)
+{
+    if (dataType != "lineages" && dataType != "species" &&
+        dataType != "traits" && dataType != "diversity") {
+        return false;
+    }
+
+    BufferedFileWriter out;
+    if (!out.open(filename)) {
+        return false;
+    }
+
+    if (dataType == "lineages") {
+        writeLineageCsvHeader(out);
+        for (const auto& row : snapshot.lineages) writeLineageCsvRow(out, row);
+    } else if (dataType == "species") {
+        writeSpeciesCsvHeader(out);
+        for (const auto& row : snapshot.species) writeSpeciesCsvRow(out, row);
+    } else if (dataType == "traits") {
+        writeTraitCsvHeader(out);
+        for (const auto& row : snapshot.traits) writeTraitCsvRow(out, row);
+    } else {
+        writeDiversityCsvHeader(out);
+        for (const auto& row : snapshot.diversity) writeDiversityCsvRow(out, row);
+    }
+
+    return out.close();
+}
+
+std::future<bool> exportSnapshotAsync(std::shared_ptr<const HistoryExportSnapshot> snapshot,
+                                      std::string baseFilename)
+{
+    return std::async(std::launch::async,
+        [snapshot = std::move(snapshot), base = std::move(baseFilename)]() {
+            if (!snapshot) return false;
+
+            bool success = exportSnapshotNewick(*snapshot, base + ".nwk");
+            success &= exportSnapshotCSV(*snapshot, base + "_lineages.csv", "lineages");
+            success &= exportSnapshotCSV(*snapshot, base + "_species.csv", "species");
+            success &= exportSnapshotCSV(*snapshot, base + "_traits.csv", "traits");
+            success &= exportSnapshotCSV(*snapshot, base + "_diversity.csv", "diversity");
+            return success;
+        });
+}
+
+} // namespace genetics
@@ -0,0 +1,246 @@
+#pragma once
+
+/**
+ * @file PhylogenyExport.h
+ * @brief Streaming Newick/CSV writers for evolutionary history exports.
+ *
+ * Exporters here write directly into a sink (BufferedFileWriter for files,
+ * StringExportSink for in-memory callers) instead of assembling the output
+ * from nested std::string concatenations. Newick trees are emitted with an
+ * explicit heap stack, so arbitrarily deep phylogenies never recurse.
+ *
+ * HistoryExportSnapshot is a flat, self-contained copy of everything the
+ * exporters need. It is cheap to take on the simulation thread and can be
+ * written out on a worker thread (exportSnapshotAsync) while the
+ * simulation keeps mutating the live tracker.
+ */
+
+#include "DiploidGenome.h"
+#include "../../utils/BufferedFileWriter.h"
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace genetics {
+
+// =============================================================================
+// SINKS
+// =============================================================================
+
+/**
+ * @brief In-memory sink with the same write interface as BufferedFileWriter.
+ *
+ * Used by callers that still want the export as a string (e.g. toNewick()).
+ */
+class StringExportSink {
+public:
+    explicit StringExportSink(std::string& out) : m_out(out) {}
+
+    void write(std::string_view text) { m_out.append(text); }
+    void put(char c) { m_out.push_back(c); }
+    void writeInt(int64_t value) { m_out += std::to_string(value); }
+    void writeUInt(uint64_t value) { m_out += std::to_string(value); }
+    void writeFloat(double value);
+
+private:
+    std::string& m_out;
+};
+
+// =============================================================================
+// ITERATIVE NEWICK WRITER
+// =============================================================================
+
+/**
+ * @brief Writes a forest in Newick format without recursion.
+ *
+ * A single root is written as "tree;", several roots as the polytomy
+ * "(tree1,tree2);". Memory use is proportional to tree depth (one frame
+ * per open subtree), not to output size.
+ *
+ * @param sink Output sink (write/put interface).
+ * @param roots Root node IDs.
+ * @param childrenOf Callable returning std::span<const Id> of a node's children.
+ * @param writeLabel Callable (Sink&, Id) writing the node label and branch length.
+ */
+template <typename Id, typename Sink, typename ChildrenFn, typename LabelFn>
+void writeNewickForest(Sink& sink, std::span<const Id> roots,
+                       ChildrenFn&& childrenOf, LabelFn&& writeLabel)
+{
+    if (roots.empty()) {
+        sink.put(';');
+        return;
+    }
+
+    struct Frame {
+        Id node;
+        std::span<const Id> children;
+        size_t next;
+    };
+    std::vector<Frame> stack;
+
+    auto open = [&](Id node) {
+        std::span<const Id> children = childrenOf(node);
+        if (!children.empty()) sink.put('(');
+        stack.push_back({node, children, 0});
+    };
+
+    const bool polytomy = roots.size() > 1;
+    if (polytomy) sink.put('(');
+
+    for (size_t r = 0; r < roots.size(); r++) {
+        if (r > 0) sink.put(',');
+        open(roots[r]);
+
+        while (!stack.empty()) {
+            Frame& top = stack.back();
+            if (top.next < top.children.size()) {
+                if (top.next > 0) sink.put(',');
+                Id child = top.children[top.next++];
+                open(child);  // May reallocate; 'top' is not used after this
+                continue;
+            }
+
+            if (!top.children.empty()) sink.put(')');
+            Id node = top.node;
+            stack.pop_back();
+            writeLabel(sink, node);
+        }
+    }
+
+    if (polytomy) sink.put(')');
+    sink.put(';');
+}
+
+// =============================================================================
+// EXPORT ROWS
+// =============================================================================
+
+/// One row of the lineages CSV.
+struct LineageExportRow {
+    uint64_t lineageId = 0;
+    uint64_t ancestorId = 0;
+    int foundingGeneration = 0;
+    int extinctionGeneration = -1;
+    int peakPopulation = 0;
+    int totalDescendants = 0;
+    int survivingDescendants = 0;
+    float averageFitness = 0.0f;
+};
+
+/// One row of the species CSV, plus the tree links used for Newick output.
+struct SpeciesExportRow {
+    SpeciesId speciesId = 0;
+    SpeciesId parentSpeciesId = 0;
+    int foundingGeneration = 0;
+    int extinctionGeneration = -1;
+    int founderPopulationSize = 0;
+    int peakPopulation = 0;
+    int descendantCount = 0;
+    int extinctionCause = 0;
+    float branchLength = 0.0f;
+    uint32_t nameOffset = 0;      ///< Offset into HistoryExportSnapshot::names
+    uint32_t nameLength = 0;
+    uint32_t firstDaughter = 0;   ///< Offset into HistoryExportSnapshot::daughters
+    uint32_t daughterCount = 0;
+};
+
+/// One row of the trait changes CSV.
+struct TraitExportRow {
+    int generation = 0;
+    SpeciesId speciesId = 0;
+    int traitType = 0;
+    float oldValue = 0.0f;
+    float newValue = 0.0f;
+    int changeType = 0;
+    int selectionPressure = 0;
+};
+
+/// One row of the diversity CSV.
+struct DiversityExportRow {
+    int generation = 0;
+    float overallHeterozygosity = 0.0f;
+    float nucleotideDiversity = 0.0f;
+    int numberOfAlleles = 0;
+    float effectivePopulationSize = 0.0f;
+};
+
+/**
+ * @brief Immutable, flat copy of the exportable evolutionary history.
+ *
+ * Species rows are sorted by ID; daughter lists and names are stored in
+ * shared arrays referenced by offset, so the snapshot is a handful of
+ * contiguous allocations regardless of tree size.
+ */
+struct HistoryExportSnapshot {
+    int generation = 0;
+    std::vector<LineageExportRow> lineages;
+    std::vector<SpeciesExportRow> species;
+    std::vector<SpeciesId> daughters;
+    std::string names;
+    std::vector<TraitExportRow> traits;
+    std::vector<DiversityExportRow> diversity;
+
+    const SpeciesExportRow* findSpecies(SpeciesId id) const;
+    std::span<const SpeciesId> getDaughters(SpeciesId id) const;
+};
+
+// =============================================================================
+// CSV ROW WRITERS
+// =============================================================================
+
+void writeLineageCsvHeader(BufferedFileWriter& out);
+void writeLineageCsvRow(BufferedFileWriter& out, const LineageExportRow& row);
+
+void writeSpeciesCsvHeader(BufferedFileWriter& out);
+void writeSpeciesCsvRow(BufferedFileWriter& out, const SpeciesExportRow& row);
+
+void writeTraitCsvHeader(BufferedFileWriter& out);
+void writeTraitCsvRow(BufferedFileWriter& out, const TraitExportRow& row);
+
+void writeDiversityCsvHeader(BufferedFileWriter& out);
+void writeDiversityCsvRow(BufferedFileWriter& out, const DiversityExportRow& row);
+
+/**
+ * @brief Writes a Newick node label: name (or Species_<id>) and ":length" if positive.
+ */
+template <typename Sink>
+void writeSpeciesNewickLabel(Sink& sink, SpeciesId id, std::string_view name, float branchLength)
+{
+    if (!name.empty()) {
+        sink.write(name);
+    } else {
+        sink.write("Species_");
+        sink.writeUInt(id);
+    }
+    if (branchLength > 0) {
+        sink.put(':');
+        sink.writeFloat(branchLength);
+    }
+}
+
+// =============================================================================
+// SNAPSHOT EXPORT
+// =============================================================================
+
+/// Writes the snapshot's species tree in Newick format.
+bool exportSnapshotNewick(const HistoryExportSnapshot& snapshot, const std::string& filename);
+
+/// Writes one CSV table: "lineages", "species", "traits" or "diversity".
+bool exportSnapshotCSV(const HistoryExportSnapshot& snapshot, const std::string& filename,
+                       const std::string& dataType);
+
+/**
+ * @brief Writes <base>.nwk and the four <base>_*.csv tables on a worker thread.
+ *
+ * The snapshot is shared, so the caller may drop its reference immediately.
+ *
+ * @return Future resolving to true if every file was written.
+ */
+std::future<bool> exportSnapshotAsync(std::shared_ptr<const HistoryExportSnapshot> snapshot,
+                                      std::string baseFilename);
+
+} // namespace genetics
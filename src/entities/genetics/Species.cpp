@@ -1,4 +1,5 @@
 #include "Species.h"
+#include "PhylogenyExport.h"
 #include "../Creature.h"
 #include "../../utils/Random.h"
 #include <algorithm>
@@ -402,39 +403,36 @@ const PhyloNode* PhylogeneticTree::getNodeForSpecies(SpeciesId speciesId) const
     return getNode(it->second);
 }
 
-std::string PhylogeneticTree::toNewick() const {
-    if (rootId == 0) return ";";
-    return nodeToNewick(rootId) + ";";
-}
-
-std::string PhylogeneticTree::nodeToNewick(uint64_t nodeId) const {
-    auto it = nodes.find(nodeId);
-    if (it == nodes.end()) return "";
-
-    const PhyloNode& node = it->second;
-    std::stringstream ss;
+template <typename Sink>
+void PhylogeneticTree::writeNewick(Sink& sink) const {
+    std::vector<uint64_t> roots;
+    if (rootId != 0) roots.push_back(rootId);
 
-    if (!node.childrenIds.empty()) {
-        ss << "(";
-        for (size_t i = 0; i < node.childrenIds.size(); i++) {
-            if (i > 0) ss << ",";
-            ss << nodeToNewick(node.childrenIds[i]);
-        }
-        ss << ")";
-    }
-
-    ss << "Species_" << node.speciesId;
-    if (node.branchLength > 0) {
-        ss << ":" << node.branchLength;
-    }
+    writeNewickForest<uint64_t>(sink, std::span<const uint64_t>(roots),
+        [this](uint64_t nodeId) -> std::span<const uint64_t> {
+            auto it = nodes.find(nodeId);
+            if (it == nodes.end()) return {};
+            return it->second.childrenIds;
+        },
+        [this](Sink& out, uint64_t nodeId) {
+            auto it = nodes.find(nodeId);
+            if (it == nodes.end()) return;
+            writeSpeciesNewickLabel(out, it->second.speciesId, {}, it->second.branchLength);
+        });
+}
 
-    return ss.str();
+std::string PhylogeneticTree::toNewick() const {
+    std::string newick;
+    StringExportSink sink(newick);
+    writeNewick(sink);
+    return newick;
 }
 
 void PhylogeneticTree::exportNewick(const std::string& filename) const {
-    std::ofstream file(filename);
-    if (file.is_open()) {
-        file << toNewick() << std::endl;
+    BufferedFileWriter file;
+    if (file.open(filename)) {
+        writeNewick(file);
+        file.put('\n');
         file.close();
     }
 }
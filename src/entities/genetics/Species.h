@@ -425,7 +425,9 @@ class PhylogeneticTree {
     uint64_t rootId;
     uint64_t nextNodeId;
 
-    std::string nodeToNewick(uint64_t nodeId) const;
+    // Streams the tree in Newick format without recursion (see PhylogenyExport.h)
+    template <typename Sink>
+    void writeNewick(Sink& sink) const;
     void collectDescendants(uint64_t nodeId, std::vector<SpeciesId>& result) const;
 };
 
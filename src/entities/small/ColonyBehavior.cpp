@@ -2,6 +2,7 @@
 #include "SmallCreatures.h"
 #include <algorithm>
 #include <cmath>
+#include <iostream>
 #include <random>
 
 namespace small {
@@ -525,162 +526,238 @@ ColonyTask::Type Colony::decideNextPriority() {
 
 PheromoneSystem::PheromoneSystem(float worldSize)
     : worldSize_(worldSize) {
-    points_.reserve(MAX_POINTS);
+    cellsPerSide_ = std::clamp(static_cast<int>(std::ceil(worldSize / CELL_SIZE)), 1, MAX_CELLS_PER_SIDE);
 }
 
 PheromoneSystem::~PheromoneSystem() = default;
 
+PheromoneSystem::Layer* PheromoneSystem::findLayer(uint32_t colonyID, PheromonePoint::Type type) {
+    for (auto& layer : layers_) {
+        if (layer.colonyID == colonyID && layer.type == type) return &layer;
+    }
+    return nullptr;
+}
+
+bool PheromoneSystem::matches(const Layer& layer, uint32_t colonyID, PheromonePoint::Type type) const {
+    if (colonyID != 0 && layer.colonyID != colonyID) return false;
+    if (type != static_cast<PheromonePoint::Type>(-1) && layer.type != type) return false;
+    return true;
+}
+
 void PheromoneSystem::addPheromone(const XMFLOAT3& position, uint32_t colonyID,
                                     PheromonePoint::Type type, float strength) {
-    // Check for nearby point to merge with
-    for (auto& point : points_) {
-        if (point.colonyID != colonyID || point.type != type) continue;
-
-        float dx = point.position.x - position.x;
-        float dy = point.position.y - position.y;
-        float dz = point.position.z - position.z;
-        float distSq = dx * dx + dy * dy + dz * dz;
-
-        if (distSq < MERGE_DISTANCE * MERGE_DISTANCE) {
-            // Merge: add strength
-            point.strength = std::min(point.strength + strength, 2.0f);
-            point.maxStrength = std::max(point.maxStrength, point.strength);
+    Layer* layer = findLayer(colonyID, type);
+    if (!layer) {
+        if (layers_.size() >= MAX_LAYERS) {
+            // Out of layers: the deposit is lost, so say so once per system
+            if (droppedDeposits_++ == 0) {
+                std::cerr << "PheromoneSystem: layer limit (" << MAX_LAYERS
+                          << ") reached, dropping deposits for new colony/type pairs" << std::endl;
+            }
             return;
         }
+        layers_.push_back({ colonyID, type, DiffusionField(worldSize_, cellsPerSide_) });
+        layer = &layers_.back();
     }
 
-    // Create new point
-    if (points_.size() < MAX_POINTS) {
-        PheromonePoint point;
-        point.position = position;
-        point.strength = strength;
-        point.maxStrength = strength;
-        point.colonyID = colonyID;
-        point.type = type;
-        point.age = 0.0f;
-        points_.push_back(point);
-    }
+    layer->field.deposit(position.x, position.z, strength, MAX_STRENGTH);
+    pointCacheValid_ = false;
 }
 
 void PheromoneSystem::update(float deltaTime) {
-    // Decay all pheromones
-    for (auto& point : points_) {
-        point.strength -= DECAY_RATE * deltaTime;
-        point.age += deltaTime;
+    for (auto& layer : layers_) {
+        layer.field.step(DIFFUSION_RATE * deltaTime, 1.0f, DECAY_RATE * deltaTime, MIN_STRENGTH);
     }
 
-    // Cleanup weak pheromones
-    cleanup();
+    // Release layers whose trails have fully decayed
+    layers_.erase(
+        std::remove_if(layers_.begin(), layers_.end(),
+            [](const Layer& layer) { return !layer.field.isActive(); }),
+        layers_.end()
+    );
+    pointCacheValid_ = false;
 }
 
-std::vector<PheromonePoint*> PheromoneSystem::queryNearby(const XMFLOAT3& position, float radius,
-                                                          uint32_t colonyID,
-                                                          PheromonePoint::Type type) {
-    std::vector<PheromonePoint*> result;
-    float radiusSq = radius * radius;
-
-    for (auto& point : points_) {
-        if (colonyID != 0 && point.colonyID != colonyID) continue;
-        if (type != static_cast<PheromonePoint::Type>(-1) && point.type != type) continue;
+float PheromoneSystem::sample(const XMFLOAT3& position, uint32_t colonyID, PheromonePoint::Type type) const {
+    float total = 0.0f;
+    for (const auto& layer : layers_) {
+        if (matches(layer, colonyID, type)) {
+            total += layer.field.sample(position.x, position.z);
+        }
+    }
+    return total;
+}
 
-        float dx = point.position.x - position.x;
-        float dy = point.position.y - position.y;
-        float dz = point.position.z - position.z;
-        float distSq = dx * dx + dy * dy + dz * dz;
+template <typename Fn>
+void PheromoneSystem::forEachCellInRadius(const XMFLOAT3& position, float radius, uint32_t colonyID,
+                                          PheromonePoint::Type type, Fn&& fn) const {
+    float radiusSq = radius * radius;
 
-        if (distSq <= radiusSq) {
-            result.push_back(&point);
+    for (const auto& layer : layers_) {
+        if (!matches(layer, colonyID, type)) continue;
+
+        const DiffusionField& field = layer.field;
+        int minX = field.cellX(position.x - radius);
+        int maxX = field.cellX(position.x + radius);
+        int minZ = field.cellZ(position.z - radius);
+        int maxZ = field.cellZ(position.z + radius);
+
+        for (int z = minZ; z <= maxZ; ++z) {
+            float dz = field.cellCenterZ(z) - position.z;
+            for (int x = minX; x <= maxX; ++x) {
+                float strength = field.at(x, z);
+                if (strength <= 0.0f) continue;
+
+                float dx = field.cellCenterX(x) - position.x;
+                float distSq = dx * dx + dz * dz;
+                if (distSq <= radiusSq) {
+                    fn(layer, x, z, strength, distSq);
+                }
+            }
         }
     }
+}
+
+std::vector<PheromonePoint> PheromoneSystem::queryNearby(const XMFLOAT3& position, float radius,
+                                                         uint32_t colonyID,
+                                                         PheromonePoint::Type type) const {
+    std::vector<PheromonePoint> result;
+
+    forEachCellInRadius(position, radius, colonyID, type,
+        [&](const Layer& layer, int x, int z, float strength, float) {
+            PheromonePoint point;
+            point.position = { layer.field.cellCenterX(x), position.y, layer.field.cellCenterZ(z) };
+            point.strength = strength;
+            point.maxStrength = strength;
+            point.colonyID = layer.colonyID;
+            point.type = layer.type;
+            point.age = 0.0f;
+            result.push_back(point);
+        });
 
     return result;
 }
 
-PheromonePoint* PheromoneSystem::getStrongestInDirection(const XMFLOAT3& position,
-                                                          const XMFLOAT3& direction,
-                                                          float coneAngle,
-                                                          uint32_t colonyID,
-                                                          PheromonePoint::Type type) {
-    PheromonePoint* strongest = nullptr;
+bool PheromoneSystem::findStrongest(const XMFLOAT3& position, float radius, uint32_t colonyID,
+                                    PheromonePoint::Type type, PheromonePoint& out) const {
+    XMFLOAT3 anyDirection = { 0, 0, 0 };
+    return getStrongestInDirection(position, anyDirection, 3.14159265f, radius, colonyID, type, out);
+}
+
+bool PheromoneSystem::getStrongestInDirection(const XMFLOAT3& position,
+                                              const XMFLOAT3& direction,
+                                              float coneAngle,
+                                              float radius,
+                                              uint32_t colonyID,
+                                              PheromonePoint::Type type,
+                                              PheromonePoint& out) const {
+    const Layer* strongest = nullptr;
+    int strongestX = 0, strongestZ = 0;
+    float maxScore = 0.0f;
     float maxStrength = 0.0f;
     float cosConeAngle = cosf(coneAngle);
 
-    // Normalize direction
-    float dirLen = sqrtf(direction.x * direction.x + direction.y * direction.y + direction.z * direction.z);
-    XMFLOAT3 normDir = direction;
-    if (dirLen > 0.001f) {
-        normDir.x /= dirLen;
-        normDir.y /= dirLen;
-        normDir.z /= dirLen;
-    }
-
-    for (auto& point : points_) {
-        if (point.colonyID != colonyID || point.type != type) continue;
-
-        float dx = point.position.x - position.x;
-        float dy = point.position.y - position.y;
-        float dz = point.position.z - position.z;
-        float dist = sqrtf(dx * dx + dy * dy + dz * dz);
-
-        if (dist < 0.01f) continue;
+    // Normalize direction (in the ground plane, like the grid)
+    float dirLen = sqrtf(direction.x * direction.x + direction.z * direction.z);
+    bool anyDirection = dirLen <= 0.001f;
+    float dirX = anyDirection ? 0.0f : direction.x / dirLen;
+    float dirZ = anyDirection ? 0.0f : direction.z / dirLen;
+
+    forEachCellInRadius(position, radius, colonyID, type,
+        [&](const Layer& layer, int x, int z, float strength, float distSq) {
+            float dist = sqrtf(distSq);
+            if (!anyDirection) {
+                if (dist < 0.01f) return;
+
+                // Check if within cone
+                float dx = layer.field.cellCenterX(x) - position.x;
+                float dz = layer.field.cellCenterZ(z) - position.z;
+                float dot = (dx * dirX + dz * dirZ) / dist;
+                if (dot < cosConeAngle) return;
+            }
 
-        // Check if within cone
-        float dot = (dx * normDir.x + dy * normDir.y + dz * normDir.z) / dist;
-        if (dot < cosConeAngle) continue;
+            // Weight by strength and distance
+            float score = strength / (1.0f + dist * 0.5f);
+            if (score > maxScore) {
+                maxScore = score;
+                maxStrength = strength;
+                strongest = &layer;
+                strongestX = x;
+                strongestZ = z;
+            }
+        });
 
-        // Weight by strength and distance
-        float score = point.strength / (1.0f + dist * 0.5f);
-        if (score > maxStrength) {
-            maxStrength = score;
-            strongest = &point;
-        }
-    }
+    if (!strongest) return false;
 
-    return strongest;
+    out.position = { strongest->field.cellCenterX(strongestX), position.y, strongest->field.cellCenterZ(strongestZ) };
+    out.strength = maxStrength;
+    out.maxStrength = maxStrength;
+    out.colonyID = strongest->colonyID;
+    out.type = strongest->type;
+    out.age = 0.0f;
+    return true;
 }
 
 XMFLOAT3 PheromoneSystem::getGradientDirection(const XMFLOAT3& position, float radius,
-                                                uint32_t colonyID, PheromonePoint::Type type) {
+                                                uint32_t colonyID, PheromonePoint::Type type) const {
     XMFLOAT3 gradient = { 0, 0, 0 };
-    float totalWeight = 0.0f;
-
-    auto nearby = queryNearby(position, radius, colonyID, type);
-
-    for (auto* point : nearby) {
-        float dx = point->position.x - position.x;
-        float dy = point->position.y - position.y;
-        float dz = point->position.z - position.z;
-        float dist = sqrtf(dx * dx + dy * dy + dz * dz);
 
-        if (dist < 0.01f) continue;
+    for (const auto& layer : layers_) {
+        if (!matches(layer, colonyID, type)) continue;
 
-        // Weight by strength
-        float weight = point->strength;
-        gradient.x += (dx / dist) * weight;
-        gradient.y += (dy / dist) * weight;
-        gradient.z += (dz / dist) * weight;
-        totalWeight += weight;
+        // Central differences across the radius, at least one cell apart
+        int stepCells = std::max(1, static_cast<int>(radius * 0.5f / layer.field.getCellSize()));
+        float dx, dz;
+        layer.field.gradient(position.x, position.z, stepCells, dx, dz);
+        gradient.x += dx;
+        gradient.z += dz;
     }
 
-    if (totalWeight > 0.01f) {
-        gradient.x /= totalWeight;
-        gradient.y /= totalWeight;
-        gradient.z /= totalWeight;
+    float length = sqrtf(gradient.x * gradient.x + gradient.z * gradient.z);
+    if (length > 0.0001f) {
+        gradient.x /= length;
+        gradient.z /= length;
+    } else {
+        gradient = { 0, 0, 0 };
     }
 
     return gradient;
 }
 
-void PheromoneSystem::clear() {
-    points_.clear();
+const std::vector<PheromonePoint>& PheromoneSystem::getPoints() const {
+    if (pointCacheValid_) return pointCache_;
+
+    pointCache_.clear();
+    for (const auto& layer : layers_) {
+        const DiffusionField& field = layer.field;
+        const float* cells = field.data();
+        const int side = field.getCellsPerSide();
+
+        for (int z = 0; z < side; ++z) {
+            for (int x = 0; x < side; ++x) {
+                float strength = cells[static_cast<size_t>(z) * side + x];
+                if (strength <= 0.0f) continue;
+
+                PheromonePoint point;
+                point.position = { field.cellCenterX(x), 0.0f, field.cellCenterZ(z) };
+                point.strength = strength;
+                point.maxStrength = strength;
+                point.colonyID = layer.colonyID;
+                point.type = layer.type;
+                point.age = 0.0f;
+                pointCache_.push_back(point);
+            }
+        }
+    }
+
+    pointCacheValid_ = true;
+    return pointCache_;
 }
 
-void PheromoneSystem::cleanup() {
-    points_.erase(
-        std::remove_if(points_.begin(), points_.end(),
-            [](const PheromonePoint& p) { return p.strength < MIN_STRENGTH; }),
-        points_.end()
-    );
+void PheromoneSystem::clear() {
+    layers_.clear();
+    pointCache_.clear();
+    pointCacheValid_ = false;
 }
 
 // =============================================================================
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "SmallCreatureType.h"
+#include "../../utils/DiffusionField.h"
 #include <DirectXMath.h>
 #include <vector>
 #include <memory>
@@ -192,7 +193,12 @@ struct PheromonePoint {
     float age;            // Time since creation
 };
 
-// Pheromone system for trail following
+// Pheromone system for trail following.
+// Each (colony, type) pair has a dense concentration layer, created on the
+// first deposit and released once it has fully decayed. Deposits add to a
+// grid cell instead of appending points, and update() runs one diffuse/decay
+// pass per layer, so the cost depends on the number of layers and not on how
+// many creatures are laying trails.
 class PheromoneSystem {
 public:
     PheromoneSystem(float worldSize);
@@ -202,45 +208,77 @@ class PheromoneSystem {
     void addPheromone(const XMFLOAT3& position, uint32_t colonyID,
                       PheromonePoint::Type type, float strength = 1.0f);
 
-    // Update (decay pheromones)
+    // Update (decay and spread pheromones)
     void update(float deltaTime);
 
-    // Query pheromones
-    std::vector<PheromonePoint*> queryNearby(const XMFLOAT3& position, float radius,
-                                              uint32_t colonyID = 0,
-                                              PheromonePoint::Type type = static_cast<PheromonePoint::Type>(-1));
-
-    // Get strongest pheromone in direction
-    PheromonePoint* getStrongestInDirection(const XMFLOAT3& position,
-                                             const XMFLOAT3& direction,
-                                             float coneAngle,
-                                             uint32_t colonyID,
-                                             PheromonePoint::Type type);
-
-    // Get gradient direction (for trail following)
+    // Strength at position (colonyID 0 = all colonies combined)
+    float sample(const XMFLOAT3& position, uint32_t colonyID, PheromonePoint::Type type) const;
+
+    // Query pheromones: occupied cells within radius, as points at the cell
+    // centres (y taken from the query position)
+    std::vector<PheromonePoint> queryNearby(const XMFLOAT3& position, float radius,
+                                            uint32_t colonyID = 0,
+                                            PheromonePoint::Type type = static_cast<PheromonePoint::Type>(-1)) const;
+
+    // Strongest cell within radius; false if there is none
+    bool findStrongest(const XMFLOAT3& position, float radius, uint32_t colonyID,
+                       PheromonePoint::Type type, PheromonePoint& out) const;
+
+    // Strongest cell within radius inside a cone around direction
+    bool getStrongestInDirection(const XMFLOAT3& position,
+                                 const XMFLOAT3& direction,
+                                 float coneAngle,
+                                 float radius,
+                                 uint32_t colonyID,
+                                 PheromonePoint::Type type,
+                                 PheromonePoint& out) const;
+
+    // Get gradient direction (for trail following): unit XZ direction of
+    // increasing strength, differenced across the radius, or zero
     XMFLOAT3 getGradientDirection(const XMFLOAT3& position, float radius,
-                                   uint32_t colonyID, PheromonePoint::Type type);
+                                  uint32_t colonyID, PheromonePoint::Type type) const;
 
-    // Access all points (for rendering)
-    std::vector<PheromonePoint>& getPoints() { return points_; }
-    const std::vector<PheromonePoint>& getPoints() const { return points_; }
+    // All occupied cells as points (for rendering); y is 0
+    const std::vector<PheromonePoint>& getPoints() const;
 
     // Clear all pheromones
     void clear();
 
     // Statistics
-    size_t getPointCount() const { return points_.size(); }
+    size_t getPointCount() const { return getPoints().size(); }
+    size_t getLayerCount() const { return layers_.size(); }
+    size_t getDroppedDepositCount() const { return droppedDeposits_; }  // Lost to MAX_LAYERS
 
 private:
-    void cleanup();  // Remove weak pheromones
+    struct Layer {
+        uint32_t colonyID;
+        PheromonePoint::Type type;
+        DiffusionField field;
+    };
 
-    std::vector<PheromonePoint> points_;
+    Layer* findLayer(uint32_t colonyID, PheromonePoint::Type type);
+    bool matches(const Layer& layer, uint32_t colonyID, PheromonePoint::Type type) const;
+
+    // Calls fn(layer, cellX, cellZ, strength, distSq) for occupied cells within radius
+    template <typename Fn>
+    void forEachCellInRadius(const XMFLOAT3& position, float radius, uint32_t colonyID,
+                             PheromonePoint::Type type, Fn&& fn) const;
+
+    std::vector<Layer> layers_;
     float worldSize_;
+    int cellsPerSide_;
+
+    mutable std::vector<PheromonePoint> pointCache_;
+    mutable bool pointCacheValid_ = false;
+    size_t droppedDeposits_ = 0;
 
     static constexpr float DECAY_RATE = 0.1f;       // Per second
-    static constexpr float MIN_STRENGTH = 0.01f;    // Cleanup threshold
-    static constexpr size_t MAX_POINTS = 50000;     // Memory limit
-    static constexpr float MERGE_DISTANCE = 0.1f;   // Merge nearby points
+    static constexpr float DIFFUSION_RATE = 0.05f;  // Share exchanged with neighbours per second
+    static constexpr float MIN_STRENGTH = 0.01f;    // Cells below this are cleared
+    static constexpr float MAX_STRENGTH = 2.0f;     // Per-cell cap
+    static constexpr float CELL_SIZE = 0.5f;        // Preferred cell size
+    static constexpr int MAX_CELLS_PER_SIDE = 512;  // Memory limit per layer
+    static constexpr size_t MAX_LAYERS = 64;        // Memory limit
 };
 
 // Swarm behavior for non-colonial aggregations
@@ -744,7 +744,6 @@ void MicroSpatialGrid::clear() {
     for (auto& cell : cells_) {
         cell.creatures.clear();
         cell.food.clear();
-        cell.pheromones.clear();
     }
 }
 
@@ -780,11 +779,6 @@ void MicroSpatialGrid::insertFood(MicroFood* food) {
     cells_[idx].food.push_back(food);
 }
 
-void MicroSpatialGrid::insertPheromone(PheromonePoint* pheromone) {
-    int idx = getCellIndex(pheromone->position.x, pheromone->position.z);
-    cells_[idx].pheromones.push_back(pheromone);
-}
-
 std::vector<SmallCreature*> MicroSpatialGrid::queryCreatures(const XMFLOAT3& pos, float radius) const {
     std::vector<SmallCreature*> result;
     float radiusSq = radius * radius;
@@ -853,31 +847,6 @@ std::vector<MicroFood*> MicroSpatialGrid::queryFood(const XMFLOAT3& pos, float r
     return result;
 }
 
-std::vector<PheromonePoint*> MicroSpatialGrid::queryPheromones(const XMFLOAT3& pos, float radius,
-                                                               PheromonePoint::Type filterType) const {
-    std::vector<PheromonePoint*> result;
-    float radiusSq = radius * radius;
-
-    int minX, maxX, minZ, maxZ;
-    getCellRange(pos, radius, minX, maxX, minZ, maxZ);
-
-    for (int z = minZ; z <= maxZ; ++z) {
-        for (int x = minX; x <= maxX; ++x) {
-            const auto& cell = cells_[z * gridDimension_ + x];
-            for (auto* p : cell.pheromones) {
-                if (filterType != static_cast<PheromonePoint::Type>(-1) && p->type != filterType)
-                    continue;
-                float dx = p->position.x - pos.x;
-                float dz = p->position.z - pos.z;
-                if (dx * dx + dz * dz <= radiusSq) {
-                    result.push_back(p);
-                }
-            }
-        }
-    }
-    return result;
-}
-
 SmallCreature* MicroSpatialGrid::findNearest(const XMFLOAT3& pos, float maxRadius,
                                               std::function<bool(SmallCreature*)> filter) const {
     SmallCreature* nearest = nullptr;
@@ -1194,14 +1163,9 @@ void SmallCreatureManager::update(float deltaTime, Terrain* terrain) {
         }
     }
 
-    // Update pheromone system
+    // Update pheromone system (queried directly; its layers are already a grid)
     pheromoneSystem_->update(deltaTime);
 
-    // Insert pheromones into spatial grid for queries
-    for (auto& point : pheromoneSystem_->getPoints()) {
-        spatialGrid_->insertPheromone(&point);
-    }
-
     // Insert food sources
     for (auto& food : foodSources_) {
         spatialGrid_->insertFood(&food);
@@ -1384,22 +1348,13 @@ void SmallCreatureManager::updateAntBehavior(SmallCreature& creature, float delt
     }
 
     // Follow pheromone trails
-    auto pheromones = spatialGrid_->queryPheromones(
-        creature.position, creature.genome->smellRange, PheromonePoint::Type::FOOD_TRAIL);
-
-    if (!pheromones.empty() && creature.hunger > 20.0f && !creature.isCarryingFood()) {
-        // Find strongest pheromone
-        PheromonePoint* strongest = nullptr;
-        float maxStrength = 0.0f;
-        for (auto* p : pheromones) {
-            if (p->colonyID == creature.colonyID && p->strength > maxStrength) {
-                maxStrength = p->strength;
-                strongest = p;
-            }
-        }
-        if (strongest) {
-            creature.targetPosition = strongest->position;
-        }
+    PheromonePoint strongest;
+    bool smellsTrail = creature.hunger > 20.0f && !creature.isCarryingFood() &&
+        pheromoneSystem_->findStrongest(creature.position, creature.genome->smellRange,
+                                        creature.colonyID, PheromonePoint::Type::FOOD_TRAIL, strongest);
+
+    if (smellsTrail) {
+        creature.targetPosition = strongest.position;
     } else if (creature.isCarryingFood()) {
         // Return to nest, lay trail
         creature.targetPosition = colony->getNestPosition();
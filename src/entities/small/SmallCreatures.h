@@ -201,14 +201,11 @@ class MicroSpatialGrid {
     void clear();
     void insert(SmallCreature* creature);
     void insertFood(MicroFood* food);
-    void insertPheromone(PheromonePoint* pheromone);
 
     // Queries
     std::vector<SmallCreature*> queryCreatures(const XMFLOAT3& pos, float radius) const;
     std::vector<SmallCreature*> queryByType(const XMFLOAT3& pos, float radius, SmallCreatureType type) const;
     std::vector<MicroFood*> queryFood(const XMFLOAT3& pos, float radius) const;
-    std::vector<PheromonePoint*> queryPheromones(const XMFLOAT3& pos, float radius,
-                                                  PheromonePoint::Type type = static_cast<PheromonePoint::Type>(-1)) const;
 
     SmallCreature* findNearest(const XMFLOAT3& pos, float maxRadius,
                                std::function<bool(SmallCreature*)> filter = nullptr) const;
@@ -219,7 +216,6 @@ class MicroSpatialGrid {
     struct Cell {
         std::vector<SmallCreature*> creatures;
         std::vector<MicroFood*> food;
-        std::vector<PheromonePoint*> pheromones;
     };
 
     int getCellIndex(float x, float z) const;
@@ -1,8 +1,10 @@
 #include "BiomeSystem.h"
 #include "PlanetTheme.h"
 #include "IslandGenerator.h"
+#include "../utils/ThreadPool.h"
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <queue>
 #include <cstring>
 #include <iostream>
@@ -468,14 +470,8 @@ void BiomeSystem::generateBiomeMap(const std::vector<float>& heightmap, int widt
     m_biomeMap.resize(width * height);
     m_distanceToWaterMap.resize(width * height);
 
-    // First pass: calculate distance to water for all cells
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            int idx = y * width + x;
-            float h = heightmap[idx];
-            m_distanceToWaterMap[idx] = calculateDistanceToWater(heightmap, x, y, width, height, m_waterLevel);
-        }
-    }
+    // First pass: exact distance to water for all cells
+    computeDistanceToWaterMap(heightmap, width, height, m_waterLevel);
 
     // Second pass: determine biomes based on environmental factors
     std::mt19937 rng(seed);
@@ -842,49 +838,100 @@ float BiomeSystem::calculateSlope(const std::vector<float>& heightmap, int x, in
     return glm::clamp(gradient * 10.0f, 0.0f, 1.0f);
 }
 
-float BiomeSystem::calculateDistanceToWater(const std::vector<float>& heightmap, int x, int y, int width, int height, float waterLevel) const {
-    // Simple flood-fill distance calculation
-    // For large maps, this should use a distance transform algorithm
-
-    float currentHeight = heightmap[y * width + x];
-    if (currentHeight < waterLevel) {
-        return 0.0f; // Already in water
+namespace {
+
+// Lower envelope of parabolas (Felzenszwalb & Huttenlocher): for each i,
+// out[i] = min_q (i - q)^2 + f[q]. Linear in n; v/z are caller scratch.
+void distanceTransform1D(const float* f, float* out, int n, size_t stride,
+                         std::vector<int>& v, std::vector<double>& z) {
+    v.resize(n);
+    z.resize(n + 1);
+
+    auto value = [&](int q) { return static_cast<double>(f[q * stride]); };
+
+    int k = 0;
+    v[0] = 0;
+    z[0] = -std::numeric_limits<double>::infinity();
+    z[1] = std::numeric_limits<double>::infinity();
+
+    for (int q = 1; q < n; ++q) {
+        double s;
+        for (;;) {
+            int p = v[k];
+            s = ((value(q) + double(q) * q) - (value(p) + double(p) * p)) / (2.0 * (q - p));
+            if (s > z[k] || k == 0) break;
+            --k;
+        }
+        ++k;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = std::numeric_limits<double>::infinity();
     }
 
-    // BFS to find nearest water
-    float maxSearchDist = 50.0f; // Maximum search distance in cells
-    float minDist = maxSearchDist;
-
-    // Sample in expanding rings for efficiency
-    for (int radius = 1; radius < static_cast<int>(maxSearchDist); ++radius) {
-        bool foundWater = false;
-
-        for (int dx = -radius; dx <= radius; ++dx) {
-            for (int dy = -radius; dy <= radius; ++dy) {
-                // Only check perimeter of current radius
-                if (std::abs(dx) != radius && std::abs(dy) != radius) continue;
-
-                int nx = x + dx;
-                int ny = y + dy;
-
-                if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+    k = 0;
+    for (int q = 0; q < n; ++q) {
+        while (z[k + 1] < q) ++k;
+        double d = q - v[k];
+        out[q * stride] = static_cast<float>(d * d + value(v[k]));
+    }
+}
 
-                float neighborHeight = heightmap[ny * width + nx];
-                if (neighborHeight < waterLevel) {
-                    float dist = std::sqrt(static_cast<float>(dx * dx + dy * dy));
-                    if (dist < minDist) {
-                        minDist = dist;
-                        foundWater = true;
-                    }
-                }
+} // namespace
+
+void BiomeSystem::computeDistanceToWaterMap(const std::vector<float>& heightmap, int width, int height, float waterLevel) {
+    // Exact Euclidean distance transform, separable into a column pass and a
+    // row pass. Both passes are independent per column/row and run on the
+    // shared pool; results don't depend on the thread count.
+    const float maxSearchDist = 50.0f; // Distances are capped and normalized by this (cells)
+    const size_t cellCount = static_cast<size_t>(width) * height;
+    m_distanceToWaterMap.resize(cellCount);
+    if (cellCount == 0) return;
+
+    // Larger than any real squared distance on this map, but still finite so
+    // the envelope intersections stay well defined.
+    const float far = static_cast<float>(width) * width + static_cast<float>(height) * height + 1.0f;
+
+    // Column pass: squared vertical distance to the nearest water cell.
+    // Chunks are column strips walked row by row for contiguous access.
+    std::vector<float> columnDist(cellCount);
+    ThreadPool::shared().parallelFor(static_cast<size_t>(width), 64, [&](size_t begin, size_t end) {
+        std::vector<float> run(end - begin, far);
+        for (int y = 0; y < height; ++y) {
+            size_t row = static_cast<size_t>(y) * width;
+            for (size_t x = begin; x < end; ++x) {
+                float& d = run[x - begin];
+                d = heightmap[row + x] < waterLevel ? 0.0f : (d >= far ? far : d + 1.0f);
+                columnDist[row + x] = d;
             }
         }
+        std::fill(run.begin(), run.end(), far);
+        for (int y = height - 1; y >= 0; --y) {
+            size_t row = static_cast<size_t>(y) * width;
+            for (size_t x = begin; x < end; ++x) {
+                float& d = run[x - begin];
+                d = columnDist[row + x] == 0.0f ? 0.0f : (d >= far ? far : d + 1.0f);
+                float best = std::min(columnDist[row + x], d);
+                columnDist[row + x] = best >= far ? far : best * best;
+            }
+        }
+    });
 
-        if (foundWater) break;
-    }
-
-    // Normalize distance
-    return minDist / maxSearchDist;
+    // Row pass: exact squared Euclidean distance, then normalize like the
+    // old ring search did (water = 0, >= maxSearchDist cells = 1).
+    ThreadPool::shared().parallelFor(static_cast<size_t>(height), 16, [&](size_t begin, size_t end) {
+        std::vector<float> rowDist(width);
+        std::vector<int> v;
+        std::vector<double> z;
+        for (size_t y = begin; y < end; ++y) {
+            size_t row = y * width;
+            distanceTransform1D(columnDist.data() + row, rowDist.data(), width, 1, v, z);
+            for (int x = 0; x < width; ++x) {
+                // No water reachable in this row's envelope: treat as beyond the cap
+                float dist = rowDist[x] >= far ? maxSearchDist : std::sqrt(rowDist[x]);
+                m_distanceToWaterMap[row + x] = std::min(dist, maxSearchDist) / maxSearchDist;
+            }
+        }
+    });
 }
 
 void BiomeSystem::smoothTransitions(int iterations) {
@@ -1295,6 +1342,19 @@ float BiomeSystem::getTransitionFactor(BiomeType from, BiomeType to, float dista
     return t * t * (3.0f - 2.0f * t);
 }
 
+bool BiomeSystem::restoreBiomeMap(const BiomeCell* cells, size_t cellCount, int width, int height) {
+    if (!cells || width <= 0 || height <= 0 ||
+        cellCount != static_cast<size_t>(width) * static_cast<size_t>(height)) {
+        return false;
+    }
+
+    m_width = width;
+    m_height = height;
+    m_biomeMap.assign(cells, cells + cellCount);
+    m_distanceToWaterMap.assign(cellCount, 0.0f);
+    return true;
+}
+
 // Serialization
 void BiomeSystem::serialize(std::vector<uint8_t>& data) const {
     // Calculate total size needed
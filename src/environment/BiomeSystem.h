@@ -159,6 +159,14 @@ class BiomeSystem {
     // Generate biome map from IslandData
     void generateFromIslandData(const struct IslandData& islandData);
 
+    // Replace the biome map with previously generated cells (e.g. from the
+    // world cache). Returns false if the cell count doesn't match the size.
+    bool restoreBiomeMap(const BiomeCell* cells, size_t cellCount, int width, int height);
+    const std::vector<BiomeCell>& getBiomeMap() const { return m_biomeMap; }
+
+    // Distance to the nearest water cell, normalized by and capped at 50 cells
+    const std::vector<float>& getDistanceToWaterMap() const { return m_distanceToWaterMap; }
+
     // Query biome at position
     BiomeQuery queryBiome(float worldX, float worldZ) const;
     BiomeQuery queryBiomeNormalized(float u, float v) const;  // 0-1 coords
@@ -231,7 +239,10 @@ class BiomeSystem {
     float calculateTemperature(float height, float latitude, float localVariation) const;
     float calculateMoisture(float height, float distanceToWater, float windExposure) const;
     float calculateSlope(const std::vector<float>& heightmap, int x, int y, int width) const;
-    float calculateDistanceToWater(const std::vector<float>& heightmap, int x, int y, int width, int height, float waterLevel) const;
+
+    // Fills m_distanceToWaterMap (normalized, capped at 50 cells) with an
+    // exact Euclidean distance transform of the water mask
+    void computeDistanceToWaterMap(const std::vector<float>& heightmap, int width, int height, float waterLevel);
 
     // Transition smoothing
     void smoothTransitions(int iterations);
@@ -1,6 +1,8 @@
 #include "ClimateSystem.h"
 #include "Terrain.h"
+#include "TerrainField.h"
 #include "SeasonManager.h"
+#include "../utils/ThreadPool.h"
 #include <cmath>
 #include <algorithm>
 #include <random>
@@ -290,7 +292,7 @@ void ClimateSystem::update(float deltaTime) {
     }
 
     // Update biome transitions based on climate changes
-    updateBiomeTransitions(deltaTime);
+    updateBiomeTransitions();
 
     // Record temperature history for graphing
     m_historyRecordTimer += deltaTime;
@@ -305,10 +307,39 @@ ClimateData ClimateSystem::getClimateAt(const glm::vec3& worldPos) const {
 }
 
 ClimateData ClimateSystem::getClimateAt(float x, float z) const {
-    ClimateData data;
+    if (m_climateCache.empty()) {
+        return computeClimateAt(x, z);
+    }
+    return composeClimate(sampleClimateCache(x, z), z);
+}
+
+void ClimateSystem::getClimateAt(const glm::vec3* positions, ClimateData* out, size_t count) const {
+    if (!m_climateCache.empty()) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = composeClimate(sampleClimateCache(positions[i].x, positions[i].z), positions[i].z);
+        }
+        return;
+    }
+
+    const TerrainField* field = terrain ? terrain->getTerrainField() : nullptr;
+    if (!field) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = computeClimateAt(positions[i].x, positions[i].z);
+        }
+        return;
+    }
+
+    std::vector<TerrainFieldSample> surfaces(count);
+    field->sample(positions, surfaces.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = composeClimate(computeSample(positions[i].x, positions[i].z, surfaces[i]), positions[i].z);
+    }
+}
 
+ClimateData ClimateSystem::computeClimateAt(float x, float z) const {
     if (!terrain) {
         // Default values if no terrain
+        ClimateData data;
         data.temperature = 0.5f;
         data.moisture = 0.5f;
         data.elevation = 0.3f;
@@ -318,17 +349,63 @@ ClimateData ClimateSystem::getClimateAt(float x, float z) const {
         return data;
     }
 
+    return composeClimate(computeSample(x, z), z);
+}
+
+ClimateSample ClimateSystem::computeSample(float x, float z) const {
+    if (const TerrainField* field = terrain->getTerrainField()) {
+        return computeSample(x, z, field->sample(x, z));
+    }
+
+    ClimateSample sample;
+
     // Get elevation from terrain (normalized 0-1)
     float height = terrain->getHeight(x, z);
     float maxHeight = 30.0f; // HEIGHT_SCALE from terrain
-    data.elevation = std::clamp(height / maxHeight, 0.0f, 1.0f);
+    sample.elevation = std::clamp(height / maxHeight, 0.0f, 1.0f);
+
+    // Temperature based on elevation and latitude
+    float normalizedZ = z / (terrain->getDepth() * terrain->getScale());
+    sample.baseTemperature = calculateBaseTemperature(sample.elevation, (normalizedZ - 0.5f) * 2.0f);
+
+    // Moisture from precomputed map + local factors
+    sample.moisture = calculateMoisture(x, z, sample.elevation);
+
+    // Terrain slope
+    sample.slope = calculateSlope(x, z);
+
+    // Distance to water
+    sample.distanceToWater = calculateDistanceToWater(x, z);
+
+    return sample;
+}
+
+ClimateSample ClimateSystem::computeSample(float x, float z, const TerrainFieldSample& surface) const {
+    ClimateSample sample;
+
+    float maxHeight = 30.0f; // HEIGHT_SCALE from terrain
+    sample.elevation = std::clamp(surface.height / maxHeight, 0.0f, 1.0f);
+
+    float normalizedZ = z / (terrain->getDepth() * terrain->getScale());
+    sample.baseTemperature = calculateBaseTemperature(sample.elevation, (normalizedZ - 0.5f) * 2.0f);
+    sample.moisture = calculateMoisture(x, z, sample.elevation);
+
+    // Baked per cell, so no neighbour probes
+    sample.slope = surface.slope;
+    sample.distanceToWater = surface.isWater() ? 0.0f : std::min(surface.distanceToWater, WATER_SEARCH_DISTANCE);
+
+    return sample;
+}
+
+ClimateData ClimateSystem::composeClimate(const ClimateSample& sample, float z) const {
+    ClimateData data;
+    data.elevation = sample.elevation;
 
     // Calculate latitude effect (simulate position on globe)
     float normalizedZ = z / (terrain->getDepth() * terrain->getScale());
     data.latitude = (normalizedZ - 0.5f) * 2.0f; // -1 to 1
 
-    // Temperature based on elevation and latitude
-    data.temperature = calculateBaseTemperature(data.elevation, data.latitude);
+    data.temperature = sample.baseTemperature;
 
     // Apply seasonal modifier
     if (seasonManager) {
@@ -336,16 +413,92 @@ ClimateData ClimateSystem::getClimateAt(float x, float z) const {
         data.temperature = data.temperature * 0.7f + seasonTemp * 0.3f;
     }
 
-    // Moisture from precomputed map + local factors
-    data.moisture = calculateMoisture(x, z, data.elevation);
+    data.moisture = sample.moisture;
+    data.slope = sample.slope;
+    data.distanceToWater = sample.distanceToWater;
 
-    // Terrain slope
-    data.slope = calculateSlope(x, z);
+    return data;
+}
 
-    // Distance to water
-    data.distanceToWater = calculateDistanceToWater(x, z);
+void ClimateSystem::rebuildClimateCache() {
+    m_climateCache.clear();
+    m_cacheWidth = 0;
+    m_cacheDepth = 0;
+    if (!terrain || terrain->getWidth() <= 1 || terrain->getDepth() <= 1) return;
+
+    // Nodes from the terrain's minimum corner up to (at least) its last cell
+    const float scale = terrain->getScale();
+    const int width = (terrain->getWidth() - 2) / CACHE_NODE_STRIDE + 2;
+    const int depth = (terrain->getDepth() - 2) / CACHE_NODE_STRIDE + 2;
+    const float spacing = scale * CACHE_NODE_STRIDE;
+    const float originX = -terrain->getWidth() / 2.0f * scale;
+    const float originZ = -terrain->getDepth() / 2.0f * scale;
+
+    // Nodes are independent, so rows are spread over the shared pool. With a
+    // baked field each row's terrain terms come from one batch query.
+    const TerrainField* field = terrain->getTerrainField();
+    std::vector<ClimateSample> cache(static_cast<size_t>(width) * depth);
+    ThreadPool::shared().parallelFor(static_cast<size_t>(depth), 4, [&](size_t begin, size_t end) {
+        std::vector<float> rowX(width), rowZ(width);
+        std::vector<TerrainFieldSample> surfaces(field ? width : 0);
+        for (size_t z = begin; z < end; ++z) {
+            const float worldZ = originZ + z * spacing;
+            if (!field) {
+                for (int x = 0; x < width; ++x) {
+                    cache[z * width + x] = computeSample(originX + x * spacing, worldZ);
+                }
+                continue;
+            }
 
-    return data;
+            for (int x = 0; x < width; ++x) {
+                rowX[x] = originX + x * spacing;
+                rowZ[x] = worldZ;
+            }
+            field->sample(rowX.data(), rowZ.data(), surfaces.data(), width);
+            for (int x = 0; x < width; ++x) {
+                cache[z * width + x] = computeSample(rowX[x], worldZ, surfaces[x]);
+            }
+        }
+    });
+
+    m_climateCache = std::move(cache);
+    m_cacheWidth = width;
+    m_cacheDepth = depth;
+    m_cacheSpacing = spacing;
+    m_cacheOriginX = originX;
+    m_cacheOriginZ = originZ;
+}
+
+ClimateSample ClimateSystem::sampleClimateCache(float x, float z) const {
+    // Clamped to the grid; NaN coordinates land on the far edge
+    float gx = std::max(0.0f, std::min(static_cast<float>(m_cacheWidth - 1), (x - m_cacheOriginX) / m_cacheSpacing));
+    float gz = std::max(0.0f, std::min(static_cast<float>(m_cacheDepth - 1), (z - m_cacheOriginZ) / m_cacheSpacing));
+
+    int x0 = static_cast<int>(gx);
+    int z0 = static_cast<int>(gz);
+    int x1 = std::min(x0 + 1, m_cacheWidth - 1);
+    int z1 = std::min(z0 + 1, m_cacheDepth - 1);
+    float tx = gx - x0;
+    float tz = gz - z0;
+
+    const ClimateSample& s00 = m_climateCache[z0 * m_cacheWidth + x0];
+    const ClimateSample& s10 = m_climateCache[z0 * m_cacheWidth + x1];
+    const ClimateSample& s01 = m_climateCache[z1 * m_cacheWidth + x0];
+    const ClimateSample& s11 = m_climateCache[z1 * m_cacheWidth + x1];
+
+    auto blend = [&](float ClimateSample::*field) {
+        float top = s00.*field + (s10.*field - s00.*field) * tx;
+        float bottom = s01.*field + (s11.*field - s01.*field) * tx;
+        return top + (bottom - top) * tz;
+    };
+
+    ClimateSample result;
+    result.elevation = blend(&ClimateSample::elevation);
+    result.baseTemperature = blend(&ClimateSample::baseTemperature);
+    result.moisture = blend(&ClimateSample::moisture);
+    result.slope = blend(&ClimateSample::slope);
+    result.distanceToWater = blend(&ClimateSample::distanceToWater);
+    return result;
 }
 
 BiomeBlend ClimateSystem::calculateBiomeBlend(const ClimateData& climate) const {
@@ -461,6 +614,9 @@ void ClimateSystem::simulateMoisture() {
 
         moistureMap = newMoisture;
     }
+
+    // Cached climate samples include moisture, so refresh them
+    rebuildClimateCache();
 }
 
 VegetationDensity ClimateSystem::getVegetationDensity(const glm::vec3& worldPos) const {
@@ -576,7 +732,7 @@ float ClimateSystem::calculateDistanceToWater(float x, float z) const {
     if (terrain->isWater(x, z)) return 0.0f;
 
     // Sample in expanding circles to find nearest water
-    float maxDist = 50.0f;
+    float maxDist = WATER_SEARCH_DISTANCE;
     float step = 5.0f;
 
     for (float dist = step; dist <= maxDist; dist += step) {
@@ -645,6 +801,8 @@ void ClimateSystem::initializeClimateGrid() {
         }
     }
 
+    m_transitionRowTime.assign(m_gridHeight, m_simulationTime);
+    m_transitionRowCursor = 0;
     m_gridInitialized = true;
 }
 
@@ -757,13 +915,22 @@ void ClimateSystem::updateMoisturePatterns(float deltaTime) {
     }
 }
 
-void ClimateSystem::updateBiomeTransitions(float deltaTime) {
+void ClimateSystem::updateBiomeTransitions() {
     if (!m_gridInitialized || m_climateGrid.empty()) return;
 
     // Transition speed (how fast biomes change)
     const float transitionSpeed = 0.05f;  // Takes ~20 seconds to fully transition
 
-    for (int z = 0; z < m_gridHeight; z++) {
+    // Visit a slice of rows per tick; a full sweep takes TRANSITION_UPDATE_SLICES ticks
+    const int rowsPerTick = (m_gridHeight + TRANSITION_UPDATE_SLICES - 1) / TRANSITION_UPDATE_SLICES;
+    for (int row = 0; row < rowsPerTick; row++) {
+        const int z = m_transitionRowCursor;
+        m_transitionRowCursor = (m_transitionRowCursor + 1) % m_gridHeight;
+
+        // Time since this row was last visited
+        const float elapsed = m_simulationTime - m_transitionRowTime[z];
+        m_transitionRowTime[z] = m_simulationTime;
+
         for (int x = 0; x < m_gridWidth; x++) {
             ClimateGridCell& cell = m_climateGrid[z * m_gridWidth + x];
 
@@ -782,10 +949,11 @@ void ClimateSystem::updateBiomeTransitions(float deltaTime) {
             float worldZ = z * m_gridCellSize;
 
             if (terrain) {
-                float height = terrain->getHeight(worldX, worldZ);
-                tempData.elevation = std::clamp(height / 30.0f, 0.0f, 1.0f);
-                tempData.slope = calculateSlope(worldX, worldZ);
-                tempData.distanceToWater = calculateDistanceToWater(worldX, worldZ);
+                ClimateSample sample = m_climateCache.empty() ? computeSample(worldX, worldZ)
+                                                              : sampleClimateCache(worldX, worldZ);
+                tempData.elevation = sample.elevation;
+                tempData.slope = sample.slope;
+                tempData.distanceToWater = sample.distanceToWater;
             } else {
                 tempData.elevation = 0.3f;
                 tempData.slope = 0.0f;
@@ -806,7 +974,7 @@ void ClimateSystem::updateBiomeTransitions(float deltaTime) {
 
             // Progress transition
             if (cell.isTransitioning) {
-                cell.transitionProgress += deltaTime * transitionSpeed;
+                cell.transitionProgress += elapsed * transitionSpeed;
                 if (cell.transitionProgress >= 1.0f) {
                     cell.transitionProgress = 1.0f;
                     cell.isTransitioning = false;
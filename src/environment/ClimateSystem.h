@@ -8,6 +8,7 @@
 // Forward declarations
 class Terrain;
 class SeasonManager;
+struct TerrainFieldSample;
 
 // Climate events that can affect the world
 enum class ClimateEvent {
@@ -95,6 +96,15 @@ struct ClimateGridCell {
     bool isTransitioning = false;
 };
 
+// Season-independent climate terms at one node of the cached climate grid
+struct ClimateSample {
+    float elevation = 0.3f;
+    float baseTemperature = 0.5f;   // From elevation and latitude, before seasonal blending
+    float moisture = 0.5f;
+    float slope = 0.0f;
+    float distanceToWater = 100.0f;
+};
+
 // Vegetation density parameters per biome
 struct VegetationDensity {
     float treeDensity;      // 0-1
@@ -118,10 +128,23 @@ class ClimateSystem {
     // Update climate simulation (call each frame for dynamic weather)
     void update(float deltaTime);
 
-    // Get climate data at a world position
+    // Get climate data at a world position. Once the climate cache is built
+    // this is a bilinear lookup; seasonal blending is applied per query.
     ClimateData getClimateAt(const glm::vec3& worldPos) const;
     ClimateData getClimateAt(float x, float z) const;
 
+    // Batch lookup (x/z used): out[i] is getClimateAt(positions[i]). Without
+    // a cache, terrain terms come from the terrain's baked field in one pass.
+    void getClimateAt(const glm::vec3* positions, ClimateData* out, size_t count) const;
+
+    // Full per-point evaluation against the terrain (what the cache stores)
+    ClimateData computeClimateAt(float x, float z) const;
+
+    // Recompute the cached climate grid from the terrain and moisture map.
+    // Called by simulateMoisture(); only terrain or moisture changes need it.
+    void rebuildClimateCache();
+    bool hasClimateCache() const { return !m_climateCache.empty(); }
+
     // Get biome blend for smooth transitions
     BiomeBlend calculateBiomeBlend(const ClimateData& climate) const;
 
@@ -181,11 +204,32 @@ class ClimateSystem {
     int moistureMapWidth = 0;
     int moistureMapDepth = 0;
 
+    // Cached climate grid: nodes every m_cacheSpacing world units across
+    // the terrain, starting at its minimum corner
+    std::vector<ClimateSample> m_climateCache;
+    int m_cacheWidth = 0;
+    int m_cacheDepth = 0;
+    float m_cacheOriginX = 0.0f;
+    float m_cacheOriginZ = 0.0f;
+    float m_cacheSpacing = 1.0f;
+    static constexpr int CACHE_NODE_STRIDE = 8;  // Terrain cells between cache nodes
+
+    ClimateSample sampleClimateCache(float x, float z) const;
+
+    // Season-independent terms straight from the terrain
+    ClimateSample computeSample(float x, float z) const;
+    // Same terms with elevation, slope and shoreline distance taken from a
+    // baked terrain field sample
+    ClimateSample computeSample(float x, float z, const TerrainFieldSample& surface) const;
+    // Adds latitude and seasonal blending to a sample
+    ClimateData composeClimate(const ClimateSample& sample, float z) const;
+
     // Climate calculation helpers
     float calculateBaseTemperature(float elevation, float latitude) const;
     float calculateMoisture(float x, float z, float elevation) const;
     float calculateSlope(float x, float z) const;
     float calculateDistanceToWater(float x, float z) const;
+    static constexpr float WATER_SEARCH_DISTANCE = 50.0f;  // Farther shorelines read as this
 
     // Biome determination using Whittaker diagram
     ClimateBiome whittakerDiagram(float temperature, float precipitation) const;
@@ -193,7 +237,7 @@ class ClimateSystem {
     // Dynamic climate update helpers
     void updateGlobalTemperature(float deltaTime);
     void updateMoisturePatterns(float deltaTime);
-    void updateBiomeTransitions(float deltaTime);
+    void updateBiomeTransitions();
     void applyClimateEvent(float deltaTime);
     void initializeClimateGrid();
     void recordTemperatureHistory();
@@ -217,6 +261,12 @@ class ClimateSystem {
     float m_gridCellSize = 10.0f;  // World units per grid cell
     bool m_gridInitialized = false;
 
+    // Biome transitions are updated a slice of rows per tick; each row
+    // remembers when it was last visited to advance by the elapsed time
+    std::vector<float> m_transitionRowTime;
+    int m_transitionRowCursor = 0;
+    static constexpr int TRANSITION_UPDATE_SLICES = 8;
+
     // Temperature history for UI graphing
     std::deque<float> m_temperatureHistory;
     float m_historyRecordTimer = 0.0f;
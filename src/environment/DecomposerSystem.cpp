@@ -9,6 +9,8 @@ DecomposerSystem::DecomposerSystem(ProducerSystem* producerSystem)
     , baseDecompositionRate(2.0f)  // 2 biomass units per second
     , currentDecompositionRate(2.0f)
 {
+    buckets.resize(HASH_BUCKETS);
+    wheel.resize(WHEEL_SLOTS);
 }
 
 void DecomposerSystem::update(float deltaTime, const SeasonManager* seasonMgr) {
@@ -18,14 +20,46 @@ void DecomposerSystem::update(float deltaTime, const SeasonManager* seasonMgr) {
     }
     currentDecompositionRate = baseDecompositionRate * seasonMult;
 
-    // Update each corpse
-    for (auto& corpse : corpses) {
-        corpse.age += deltaTime;
-        decomposeCorpse(corpse, deltaTime, seasonMult);
+    // Advance the wheel; only corpses whose step falls in a passed slot are touched
+    wheelAccumulator += deltaTime;
+    while (wheelAccumulator >= WHEEL_TICK) {
+        wheelAccumulator -= WHEEL_TICK;
+        wheelTime += WHEEL_TICK;
+        wheelCursor = (wheelCursor + 1) % WHEEL_SLOTS;
+        processWheelSlot(seasonMult);
     }
+}
+
+void DecomposerSystem::processWheelSlot(float seasonMult) {
+    // Rescheduling always lands in a later slot, so this one isn't appended to
+    std::vector<WheelEntry>& due = wheel[wheelCursor];
+
+    for (const WheelEntry& entry : due) {
+        // Skip corpses scavenged away (and slots reused) since scheduling
+        if (slotGeneration[entry.slot] != entry.generation) continue;
+        uint32_t index = slotToIndex[entry.slot];
+        if (index == INVALID_INDEX) continue;
+
+        Corpse& corpse = corpses[index];
+        float elapsed = wheelTime - corpse.lastDecomposeTime;
+        corpse.lastDecomposeTime = wheelTime;
+        corpse.age += elapsed;
+        decomposeCorpse(corpse, elapsed, seasonMult);
+
+        if (corpse.isFullyDecomposed()) {
+            removeCorpse(entry.slot);
+        } else {
+            scheduleDecomposition(entry.slot, DECOMPOSE_INTERVAL);
+        }
+    }
+
+    due.clear();
+}
 
-    // Remove fully decomposed corpses
-    removeDecomposedCorpses();
+void DecomposerSystem::scheduleDecomposition(uint32_t slot, float delay) {
+    int ticks = static_cast<int>(std::ceil(delay / WHEEL_TICK));
+    ticks = std::clamp(ticks, 1, WHEEL_SLOTS - 1);
+    wheel[(wheelCursor + ticks) % WHEEL_SLOTS].push_back({ slot, slotGeneration[slot] });
 }
 
 void DecomposerSystem::decomposeCorpse(Corpse& corpse, float deltaTime, float seasonMult) {
@@ -75,19 +109,117 @@ void DecomposerSystem::releaseNutrients(const glm::vec3& position, float decompo
     producerSystem->addDetritus(position, detritusContribution);
 }
 
-void DecomposerSystem::removeDecomposedCorpses() {
-    corpses.erase(
-        std::remove_if(corpses.begin(), corpses.end(),
-            [](const Corpse& c) { return c.isFullyDecomposed(); }),
-        corpses.end()
-    );
+// ============================================================================
+// Corpse Pool and Spatial Index
+// ============================================================================
+
+int DecomposerSystem::bucketFor(int cellX, int cellZ) const {
+    uint32_t hash = static_cast<uint32_t>(cellX) * 73856093u ^ static_cast<uint32_t>(cellZ) * 19349663u;
+    return static_cast<int>(hash & (HASH_BUCKETS - 1));
+}
+
+int DecomposerSystem::bucketFor(const glm::vec3& position) const {
+    return bucketFor(static_cast<int>(std::floor(position.x / CELL_SIZE)),
+                     static_cast<int>(std::floor(position.z / CELL_SIZE)));
 }
 
 void DecomposerSystem::addCorpse(const glm::vec3& position, CreatureType type, float size, float energy) {
     // Minimum energy threshold for creating a corpse
     if (energy < 10.0f) return;
 
+    uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(slotToIndex.size());
+        slotToIndex.push_back(INVALID_INDEX);
+        slotGeneration.push_back(0);
+    }
+
+    slotToIndex[slot] = static_cast<uint32_t>(corpses.size());
     corpses.emplace_back(position, type, size, energy);
+    corpses.back().poolSlot = slot;
+    corpses.back().lastDecomposeTime = wheelTime;
+    corpsePositions.push_back(position);
+    buckets[bucketFor(position)].push_back(slot);
+
+    // Stagger first steps across the interval so a burst of deaths
+    // doesn't come due on the same tick
+    float stagger = static_cast<float>(slot % 4) * 0.25f;
+    scheduleDecomposition(slot, DECOMPOSE_INTERVAL * (0.25f + stagger));
+}
+
+void DecomposerSystem::removeCorpse(uint32_t slot) {
+    uint32_t index = slotToIndex[slot];
+    if (index == INVALID_INDEX) return;
+
+    std::vector<uint32_t>& bucket = buckets[bucketFor(corpsePositions[index])];
+    auto it = std::find(bucket.begin(), bucket.end(), slot);
+    if (it != bucket.end()) {
+        *it = bucket.back();
+        bucket.pop_back();
+    }
+
+    // Swap-remove from the dense arrays
+    uint32_t last = static_cast<uint32_t>(corpses.size() - 1);
+    if (index != last) {
+        corpses[index] = std::move(corpses[last]);
+        corpsePositions[index] = corpsePositions[last];
+        slotToIndex[corpses[index].poolSlot] = index;
+    }
+    corpses.pop_back();
+    corpsePositions.pop_back();
+
+    slotToIndex[slot] = INVALID_INDEX;
+    slotGeneration[slot]++;
+    freeSlots.push_back(slot);
+}
+
+const std::vector<const Corpse*>& DecomposerSystem::queryCorpses(const glm::vec3& position, float radius) const {
+    queryBuffer.clear();
+    float radiusSq = radius * radius;
+
+    auto consider = [&](const Corpse& corpse, const glm::vec3& corpsePos) {
+        float dx = corpsePos.x - position.x;
+        float dz = corpsePos.z - position.z;
+        if (dx * dx + dz * dz <= radiusSq) {
+            queryBuffer.push_back(&corpse);
+        }
+    };
+
+    int minX = static_cast<int>(std::floor((position.x - radius) / CELL_SIZE));
+    int maxX = static_cast<int>(std::floor((position.x + radius) / CELL_SIZE));
+    int minZ = static_cast<int>(std::floor((position.z - radius) / CELL_SIZE));
+    int maxZ = static_cast<int>(std::floor((position.z + radius) / CELL_SIZE));
+
+    // Wide queries visit more buckets than there are; scan the dense array instead
+    int64_t cellCount = static_cast<int64_t>(maxX - minX + 1) * (maxZ - minZ + 1);
+    if (cellCount >= HASH_BUCKETS || cellCount >= static_cast<int64_t>(corpses.size())) {
+        for (size_t i = 0; i < corpses.size(); ++i) {
+            consider(corpses[i], corpsePositions[i]);
+        }
+        return queryBuffer;
+    }
+
+    // Distinct cells can share a bucket; the distance test filters strays, and
+    // a bucket is only scanned once per query
+    uint32_t visited[HASH_BUCKETS / 32] = {};
+    for (int cz = minZ; cz <= maxZ; ++cz) {
+        for (int cx = minX; cx <= maxX; ++cx) {
+            int bucket = bucketFor(cx, cz);
+            uint32_t bit = 1u << (bucket & 31);
+            if (visited[bucket >> 5] & bit) continue;
+            visited[bucket >> 5] |= bit;
+
+            for (uint32_t slot : buckets[bucket]) {
+                uint32_t index = slotToIndex[slot];
+                consider(corpses[index], corpsePositions[index]);
+            }
+        }
+    }
+
+    return queryBuffer;
 }
 
 float DecomposerSystem::scavengeCorpse(const glm::vec3& position, float amount) {
@@ -102,36 +234,31 @@ float DecomposerSystem::scavengeCorpse(const glm::vec3& position, float amount)
     corpse->biomass -= scavenged;
     corpse->scavengedAmount += scavenged;
 
+    // Picked clean: drop it now rather than at its next decomposition step
+    if (corpse->isFullyDecomposed()) {
+        removeCorpse(corpse->poolSlot);
+    }
+
     // Return energy gained (scavengers get more energy per biomass than decomposition)
     return scavenged * 3.0f;  // 3 energy per biomass unit scavenged
 }
 
 Corpse* DecomposerSystem::findNearestCorpse(const glm::vec3& position, float range) {
-    Corpse* nearest = nullptr;
+    const Corpse* nearest = nullptr;
     float nearestDist = range;
 
-    for (auto& corpse : corpses) {
-        if (corpse.isFullyDecomposed()) continue;
+    for (const Corpse* corpse : queryCorpses(position, range)) {
+        if (corpse->isFullyDecomposed()) continue;
 
-        float dist = glm::length(glm::vec2(corpse.position.x - position.x,
-                                           corpse.position.z - position.z));
+        float dist = glm::length(glm::vec2(corpse->position.x - position.x,
+                                           corpse->position.z - position.z));
         if (dist < nearestDist) {
             nearestDist = dist;
-            nearest = &corpse;
+            nearest = corpse;
         }
     }
 
-    return nearest;
-}
-
-std::vector<glm::vec3> DecomposerSystem::getCorpsePositions() const {
-    std::vector<glm::vec3> positions;
-    for (const auto& corpse : corpses) {
-        if (!corpse.isFullyDecomposed()) {
-            positions.push_back(corpse.position);
-        }
-    }
-    return positions;
+    return const_cast<Corpse*>(nearest);
 }
 
 float DecomposerSystem::getTotalBiomass() const {
@@ -151,15 +278,15 @@ float DecomposerSystem::getCarrionDensity(const glm::vec3& position, float radiu
     float radiusSq = radius * radius;
 
     // Sum nearby corpse biomass
-    for (const auto& corpse : corpses) {
-        if (corpse.isFullyDecomposed()) continue;
-        float dx = corpse.position.x - position.x;
-        float dz = corpse.position.z - position.z;
+    for (const Corpse* corpse : queryCorpses(position, radius)) {
+        if (corpse->isFullyDecomposed()) continue;
+        float dx = corpse->position.x - position.x;
+        float dz = corpse->position.z - position.z;
         float distSq = dx * dx + dz * dz;
         if (distSq <= radiusSq) {
             // Weight by distance (closer = more dense)
             float influence = 1.0f - std::sqrt(distSq) / radius;
-            corpseBiomass += corpse.biomass * influence;
+            corpseBiomass += corpse->biomass * influence;
         }
     }
 
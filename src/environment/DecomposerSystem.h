@@ -1,6 +1,7 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include <cstdint>
 #include <vector>
 #include "../entities/CreatureType.h"
 
@@ -20,6 +21,10 @@ struct Corpse {
     bool beingScavenged;
     float scavengedAmount;      // Amount removed by scavengers
 
+    // DecomposerSystem bookkeeping
+    uint32_t poolSlot = 0;          // Stable handle while the corpse exists
+    float lastDecomposeTime = 0.0f; // Wheel time of the last decomposition step
+
     Corpse(const glm::vec3& pos, CreatureType type, float creatureSize, float energy)
         : position(pos)
         , biomass(energy * 0.5f)  // 50% of energy becomes decomposable biomass
@@ -40,6 +45,12 @@ struct Corpse {
     }
 };
 
+// Corpses live in a pooled store: a dense array (swap-removed, so it never
+// needs compacting) addressed through stable pool slots. A hashed grid over
+// the slots answers radius queries, and a timer wheel schedules each corpse's
+// next decomposition step, so a tick only touches the corpses that are due
+// rather than every corpse in the world. Steps are staggered across wheel
+// slots, which keeps mass-mortality spikes from landing on a single frame.
 class DecomposerSystem {
 public:
     DecomposerSystem(ProducerSystem* producerSystem);
@@ -52,13 +63,17 @@ class DecomposerSystem {
     // Called by scavengers to consume corpse
     float scavengeCorpse(const glm::vec3& position, float amount);
 
-    // Get corpse positions for scavengers
-    std::vector<glm::vec3> getCorpsePositions() const;
+    // Positions of all corpses, parallel to getCorpses(); maintained in place
+    const std::vector<glm::vec3>& getCorpsePositions() const { return corpsePositions; }
     const std::vector<Corpse>& getCorpses() const { return corpses; }
 
     // Find nearest corpse within range
     Corpse* findNearestCorpse(const glm::vec3& position, float range);
 
+    // Corpses within radius (XZ plane)
+    // Returns reference to internal buffer (no allocation); valid until the next query
+    const std::vector<const Corpse*>& queryCorpses(const glm::vec3& position, float radius) const;
+
     // Statistics
     int getCorpseCount() const { return static_cast<int>(corpses.size()); }
     float getTotalBiomass() const;
@@ -75,7 +90,34 @@ class DecomposerSystem {
 
 private:
     ProducerSystem* producerSystem;
-    std::vector<Corpse> corpses;
+
+    // Pooled corpse store
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+    std::vector<Corpse> corpses;                // Dense, unordered
+    std::vector<glm::vec3> corpsePositions;     // Parallel to corpses
+    std::vector<uint32_t> slotToIndex;          // Pool slot -> dense index
+    std::vector<uint32_t> slotGeneration;       // Bumped when a slot is freed
+    std::vector<uint32_t> freeSlots;
+
+    // Spatial index: pool slots bucketed by hashed grid cell
+    static constexpr float CELL_SIZE = 16.0f;
+    static constexpr int HASH_BUCKETS = 1024;   // Power of two
+    std::vector<std::vector<uint32_t>> buckets;
+    mutable std::vector<const Corpse*> queryBuffer;
+
+    // Timer wheel for decomposition steps
+    struct WheelEntry {
+        uint32_t slot;
+        uint32_t generation;
+    };
+    static constexpr float WHEEL_TICK = 0.25f;          // Seconds per wheel slot
+    static constexpr int WHEEL_SLOTS = 16;              // Horizon of 4 seconds
+    static constexpr float DECOMPOSE_INTERVAL = 1.0f;   // Seconds between steps per corpse
+    std::vector<std::vector<WheelEntry>> wheel;
+    int wheelCursor = 0;
+    float wheelTime = 0.0f;
+    float wheelAccumulator = 0.0f;
+
     float nutrientFeedbackRate = 1.0f;  // Multiplier for nutrient release to soil
 
     // Base decomposition parameters
@@ -89,5 +131,11 @@ class DecomposerSystem {
 
     void decomposeCorpse(Corpse& corpse, float deltaTime, float seasonMult);
     void releaseNutrients(const glm::vec3& position, float decomposedAmount);
-    void removeDecomposedCorpses();
+
+    void processWheelSlot(float seasonMult);
+    void scheduleDecomposition(uint32_t slot, float delay);
+    void removeCorpse(uint32_t slot);
+
+    int bucketFor(int cellX, int cellZ) const;
+    int bucketFor(const glm::vec3& position) const;
 };
@@ -1,4 +1,5 @@
 #include "IslandGenerator.h"
+#include "WorldGenContext.h"
 #include <cmath>
 #include <algorithm>
 #include <numeric>
@@ -74,6 +75,23 @@ IslandGenerator::IslandGenerator()
 
 IslandGenerator::~IslandGenerator() = default;
 
+template <typename Fn>
+void IslandGenerator::forEachRow(int first, int last, Fn&& fn) const {
+    if (last <= first) return;
+
+    if (m_context) {
+        m_context->parallelRows(last - first, [&](int row) { fn(first + row); });
+        return;
+    }
+
+    ThreadPool::shared().parallelFor(static_cast<size_t>(last - first), WorldGenContext::ROW_GRAIN,
+        [&](size_t begin, size_t end) {
+            for (size_t row = begin; row < end; ++row) {
+                fn(first + static_cast<int>(row));
+            }
+        });
+}
+
 void IslandGenerator::initializeNoise(uint32_t seed) {
     m_currentSeed = seed;
     m_rng.seed(seed);
@@ -94,6 +112,7 @@ void IslandGenerator::initializeNoise(uint32_t seed) {
         m_perm[i] = base[i];
         m_perm[i + 256] = base[i];
     }
+    m_batchNoise.setPermutation(m_perm.data());
 }
 
 // ============================================================================
@@ -177,6 +196,51 @@ float IslandGenerator::ridgedNoise(float x, float y, int octaves) const {
     return total / maxValue;
 }
 
+namespace {
+    void rowCoordinates(int y, int size, float scale, float offset, float* xs, float* ys) {
+        float ny = static_cast<float>(y) / size * scale + offset;
+        for (int x = 0; x < size; ++x) {
+            xs[x] = static_cast<float>(x) / size * scale + offset;
+            ys[x] = ny;
+        }
+    }
+}
+
+void IslandGenerator::fbmRow(int y, int size, float scale, float offset, int octaves,
+                             float persistence, float lacunarity, float* out) const {
+    std::vector<float> xs(size), ys(size);
+    rowCoordinates(y, size, scale, offset, xs.data(), ys.data());
+    m_batchNoise.fbm(xs.data(), ys.data(), out, size, octaves, persistence, lacunarity);
+}
+
+void IslandGenerator::ridgedRow(int y, int size, float scale, float offset, int octaves, float* out) const {
+    std::vector<float> xs(size), ys(size);
+    rowCoordinates(y, size, scale, offset, xs.data(), ys.data());
+    m_batchNoise.ridged(xs.data(), ys.data(), out, size, octaves);
+}
+
+void IslandGenerator::domainWarpRow(int y, int size, float scale, float strength, float* out) const {
+    std::vector<float> xs(size), ys(size), sx(size), sy(size), warpX(size), warpY(size);
+    rowCoordinates(y, size, scale, 0.0f, xs.data(), ys.data());
+
+    for (int x = 0; x < size; ++x) {
+        sx[x] = xs[x] + 5.3f;
+        sy[x] = ys[x] + 1.3f;
+    }
+    m_batchNoise.fbm(sx.data(), sy.data(), warpX.data(), size, 4, 0.5f, 2.0f);
+    for (int x = 0; x < size; ++x) {
+        sx[x] = xs[x] + 1.7f;
+        sy[x] = ys[x] + 9.2f;
+    }
+    m_batchNoise.fbm(sx.data(), sy.data(), warpY.data(), size, 4, 0.5f, 2.0f);
+
+    for (int x = 0; x < size; ++x) {
+        sx[x] = xs[x] + warpX[x] * strength;
+        sy[x] = ys[x] + warpY[x] * strength;
+    }
+    m_batchNoise.fbm(sx.data(), sy.data(), out, size, 6, 0.5f, 2.0f);
+}
+
 float IslandGenerator::voronoi(float x, float y, float& cellId) const {
     int xi = static_cast<int>(std::floor(x));
     int yi = static_cast<int>(std::floor(y));
@@ -295,7 +359,7 @@ void IslandGenerator::generateCircularMask(std::vector<float>& mask, int size, f
     float center = size / 2.0f;
     float maxDist = size * radius;
 
-    for (int y = 0; y < size; ++y) {
+    forEachRow(0, size, [&](int y) {
         for (int x = 0; x < size; ++x) {
             float dx = x - center;
             float dy = y - center;
@@ -309,7 +373,7 @@ void IslandGenerator::generateCircularMask(std::vector<float>& mask, int size, f
             float value = 1.0f - smoothstep(adjustedRadius * 0.7f, adjustedRadius, dist);
             mask[y * size + x] = value;
         }
-    }
+    });
 }
 
 void IslandGenerator::generateArchipelagoMask(std::vector<float>& mask, int size, int islandCount, float spread, float irregularity) {
@@ -339,7 +403,7 @@ void IslandGenerator::generateArchipelagoMask(std::vector<float>& mask, int size
     for (size_t i = 0; i < centers.size(); ++i) {
         float islandSize = (i == 0 ? 0.2f : sizeDist(m_rng)) * size;
 
-        for (int y = 0; y < size; ++y) {
+        forEachRow(0, size, [&](int y) {
             for (int x = 0; x < size; ++x) {
                 float dx = x - centers[i].x;
                 float dy = y - centers[i].y;
@@ -352,7 +416,7 @@ void IslandGenerator::generateArchipelagoMask(std::vector<float>& mask, int size
                 float value = 1.0f - smoothstep(adjustedRadius * 0.6f, adjustedRadius, dist);
                 mask[y * size + x] = std::max(mask[y * size + x], value);
             }
-        }
+        });
     }
 }
 
@@ -363,7 +427,10 @@ void IslandGenerator::generateCrescentMask(std::vector<float>& mask, int size, f
     float cutoutRadius = mainRadius * 0.7f;
     float cutoutOffset = mainRadius * 0.4f;
 
-    for (int y = 0; y < size; ++y) {
+    forEachRow(0, size, [&](int y) {
+        std::vector<float> noiseRow(size);
+        fbmRow(y, size, 5.0f, 0.0f, 4, 0.5f, 2.0f, noiseRow.data());
+
         for (int x = 0; x < size; ++x) {
             float dx = x - center;
             float dy = y - center;
@@ -375,34 +442,32 @@ void IslandGenerator::generateCrescentMask(std::vector<float>& mask, int size, f
             float distCutout = std::sqrt(dxCut * dxCut + dy * dy);
 
             // Add noise for irregularity
-            float nx = static_cast<float>(x) / size * 5.0f;
-            float ny = static_cast<float>(y) / size * 5.0f;
-            float noiseVal = fbm(nx, ny, 4, 0.5f, 2.0f) * irregularity * mainRadius * 0.3f;
+            float noiseVal = noiseRow[x] * irregularity * mainRadius * 0.3f;
 
             float mainValue = 1.0f - smoothstep(mainRadius * 0.7f + noiseVal, mainRadius + noiseVal, distMain);
             float cutoutValue = smoothstep(cutoutRadius * 0.8f, cutoutRadius, distCutout);
 
             mask[y * size + x] = mainValue * cutoutValue;
         }
-    }
+    });
 }
 
 void IslandGenerator::generateIrregularMask(std::vector<float>& mask, int size, float coverage, float irregularity) {
     mask.resize(size * size);
     float center = size / 2.0f;
 
-    for (int y = 0; y < size; ++y) {
-        for (int x = 0; x < size; ++x) {
-            float nx = static_cast<float>(x) / size;
-            float ny = static_cast<float>(y) / size;
+    forEachRow(0, size, [&](int y) {
+        // Domain-warped noise for organic shapes
+        std::vector<float> warpedRow(size);
+        domainWarpRow(y, size, 4.0f, irregularity * 2.0f, warpedRow.data());
 
+        for (int x = 0; x < size; ++x) {
             // Distance from center for island falloff
             float dx = (x - center) / center;
             float dy = (y - center) / center;
             float dist = std::sqrt(dx * dx + dy * dy);
 
-            // Domain-warped noise for organic shapes
-            float warpedNoise = domainWarp(nx * 4.0f, ny * 4.0f, irregularity * 2.0f);
+            float warpedNoise = warpedRow[x];
 
             // Combine noise with radial falloff
             float baseShape = 1.0f - smoothstep(coverage * 0.5f, coverage, dist);
@@ -413,7 +478,7 @@ void IslandGenerator::generateIrregularMask(std::vector<float>& mask, int size,
 
             mask[y * size + x] = value;
         }
-    }
+    });
 }
 
 void IslandGenerator::generateVolcanicMask(std::vector<float>& mask, int size, float radius, float craterSize) {
@@ -422,7 +487,7 @@ void IslandGenerator::generateVolcanicMask(std::vector<float>& mask, int size, f
     float mainRadius = size * radius;
     float craterRadius = mainRadius * craterSize;
 
-    for (int y = 0; y < size; ++y) {
+    forEachRow(0, size, [&](int y) {
         for (int x = 0; x < size; ++x) {
             float dx = x - center;
             float dy = y - center;
@@ -451,7 +516,7 @@ void IslandGenerator::generateVolcanicMask(std::vector<float>& mask, int size, f
 
             mask[y * size + x] = islandValue * std::max(0.0f, peakValue);
         }
-    }
+    });
 }
 
 void IslandGenerator::generateAtollMask(std::vector<float>& mask, int size, float radius, float lagoonSize, float reefWidth) {
@@ -461,7 +526,7 @@ void IslandGenerator::generateAtollMask(std::vector<float>& mask, int size, floa
     float innerRadius = outerRadius * (1.0f - reefWidth * 2.0f);
     float lagoonRadius = innerRadius * lagoonSize;
 
-    for (int y = 0; y < size; ++y) {
+    forEachRow(0, size, [&](int y) {
         for (int x = 0; x < size; ++x) {
             float dx = x - center;
             float dy = y - center;
@@ -488,14 +553,19 @@ void IslandGenerator::generateAtollMask(std::vector<float>& mask, int size, floa
 
             mask[y * size + x] = ringValue;
         }
-    }
+    });
 }
 
 void IslandGenerator::generateContinentalMask(std::vector<float>& mask, int size, float coverage) {
     mask.resize(size * size);
     float center = size / 2.0f;
 
-    for (int y = 0; y < size; ++y) {
+    forEachRow(0, size, [&](int y) {
+        // Multiple noise layers for complex coastline
+        std::vector<float> continentalRow(size), detailRow(size);
+        fbmRow(y, size, 2.0f, 0.0f, 4, 0.6f, 2.0f, continentalRow.data());
+        fbmRow(y, size, 8.0f, 100.0f, 3, 0.5f, 2.0f, detailRow.data());
+
         for (int x = 0; x < size; ++x) {
             float nx = static_cast<float>(x) / size;
             float ny = static_cast<float>(y) / size;
@@ -505,9 +575,8 @@ void IslandGenerator::generateContinentalMask(std::vector<float>& mask, int size
             float dy = (y - center) / center;
             float dist = std::sqrt(dx * dx + dy * dy);
 
-            // Multiple noise layers for complex coastline
-            float continental = fbm(nx * 2.0f, ny * 2.0f, 4, 0.6f, 2.0f);
-            float detail = fbm(nx * 8.0f + 100.0f, ny * 8.0f + 100.0f, 3, 0.5f, 2.0f);
+            float continental = continentalRow[x];
+            float detail = detailRow[x];
 
             // Voronoi for coastal features (bays, peninsulas)
             float cellId;
@@ -523,7 +592,7 @@ void IslandGenerator::generateContinentalMask(std::vector<float>& mask, int size
 
             mask[y * size + x] = value;
         }
-    }
+    });
 }
 
 // ============================================================================
@@ -544,14 +613,15 @@ IslandData IslandGenerator::generateCircular(const IslandGenParams& params, int
     generateCircularMask(mask, size, params.islandRadius, params.coastalIrregularity);
 
     // Add terrain features
-    for (int y = 0; y < size; ++y) {
-        for (int x = 0; x < size; ++x) {
-            float nx = static_cast<float>(x) / size;
-            float ny = static_cast<float>(y) / size;
+    forEachRow(0, size, [&](int y) {
+        std::vector<float> mountainsRow(size), hillsRow(size);
+        ridgedRow(y, size, 4.0f, 0.0f, 6, mountainsRow.data());
+        fbmRow(y, size, 8.0f, 50.0f, 4, 0.5f, 2.0f, hillsRow.data());
 
+        for (int x = 0; x < size; ++x) {
             // Multi-octave terrain
-            float mountains = ridgedNoise(nx * 4.0f, ny * 4.0f, 6) * params.mountainousness;
-            float hills = fbm(nx * 8.0f + 50.0f, ny * 8.0f + 50.0f, 4, 0.5f, 2.0f) * 0.3f;
+            float mountains = mountainsRow[x] * params.mountainousness;
+            float hills = hillsRow[x] * 0.3f;
 
             float terrain = mountains * 0.6f + hills * 0.4f;
             float height = mask[y * size + x] * (0.4f + terrain * 0.6f);
@@ -563,7 +633,7 @@ IslandData IslandGenerator::generateCircular(const IslandGenParams& params, int
 
             data.heightmap[y * size + x] = height;
         }
-    }
+    });
 
     // Post-processing
     applyCoastalErosion(data, static_cast<int>(params.coastalErosion * 10.0f));
@@ -592,13 +662,14 @@ IslandData IslandGenerator::generateArchipelago(const IslandGenParams& params, i
     std::vector<float> mask;
     generateArchipelagoMask(mask, size, params.archipelagoIslandCount, params.archipelagoSpread, params.coastalIrregularity);
 
-    for (int y = 0; y < size; ++y) {
-        for (int x = 0; x < size; ++x) {
-            float nx = static_cast<float>(x) / size;
-            float ny = static_cast<float>(y) / size;
+    forEachRow(0, size, [&](int y) {
+        std::vector<float> mountainsRow(size), hillsRow(size);
+        ridgedRow(y, size, 5.0f, 0.0f, 5, mountainsRow.data());
+        fbmRow(y, size, 10.0f, 30.0f, 3, 0.5f, 2.0f, hillsRow.data());
 
-            float mountains = ridgedNoise(nx * 5.0f, ny * 5.0f, 5) * params.mountainousness;
-            float hills = fbm(nx * 10.0f + 30.0f, ny * 10.0f + 30.0f, 3, 0.5f, 2.0f) * 0.25f;
+        for (int x = 0; x < size; ++x) {
+            float mountains = mountainsRow[x] * params.mountainousness;
+            float hills = hillsRow[x] * 0.25f;
 
             float terrain = mountains * 0.5f + hills * 0.5f;
             float height = mask[y * size + x] * (0.35f + terrain * 0.65f);
@@ -609,7 +680,7 @@ IslandData IslandGenerator::generateArchipelago(const IslandGenParams& params, i
 
             data.heightmap[y * size + x] = height;
         }
-    }
+    });
 
     applyCoastalErosion(data, static_cast<int>(params.coastalErosion * 8.0f));
     carveRivers(data);
@@ -635,13 +706,14 @@ IslandData IslandGenerator::generateCrescent(const IslandGenParams& params, int
     std::vector<float> mask;
     generateCrescentMask(mask, size, params.islandRadius, params.coastalIrregularity);
 
-    for (int y = 0; y < size; ++y) {
-        for (int x = 0; x < size; ++x) {
-            float nx = static_cast<float>(x) / size;
-            float ny = static_cast<float>(y) / size;
+    forEachRow(0, size, [&](int y) {
+        std::vector<float> mountainsRow(size), hillsRow(size);
+        ridgedRow(y, size, 4.0f, 20.0f, 5, mountainsRow.data());
+        fbmRow(y, size, 7.0f, 0.0f, 4, 0.5f, 2.0f, hillsRow.data());
 
-            float mountains = ridgedNoise(nx * 4.0f + 20.0f, ny * 4.0f + 20.0f, 5) * params.mountainousness;
-            float hills = fbm(nx * 7.0f, ny * 7.0f, 4, 0.5f, 2.0f) * 0.3f;
+        for (int x = 0; x < size; ++x) {
+            float mountains = mountainsRow[x] * params.mountainousness;
+            float hills = hillsRow[x] * 0.3f;
 
             float terrain = mountains * 0.55f + hills * 0.45f;
             float height = mask[y * size + x] * (0.38f + terrain * 0.62f);
@@ -652,7 +724,7 @@ IslandData IslandGenerator::generateCrescent(const IslandGenParams& params, int
 
             data.heightmap[y * size + x] = height;
         }
-    }
+    });
 
     applyCoastalErosion(data, static_cast<int>(params.coastalErosion * 10.0f));
     carveRivers(data);
@@ -678,14 +750,16 @@ IslandData IslandGenerator::generateIrregular(const IslandGenParams& params, int
     std::vector<float> mask;
     generateIrregularMask(mask, size, params.islandRadius * 1.5f, params.coastalIrregularity);
 
-    for (int y = 0; y < size; ++y) {
-        for (int x = 0; x < size; ++x) {
-            float nx = static_cast<float>(x) / size;
-            float ny = static_cast<float>(y) / size;
+    forEachRow(0, size, [&](int y) {
+        std::vector<float> mountainsRow(size), hillsRow(size), valleysRow(size);
+        ridgedRow(y, size, 3.5f, 0.0f, 6, mountainsRow.data());
+        fbmRow(y, size, 6.0f, 80.0f, 4, 0.5f, 2.0f, hillsRow.data());
+        fbmRow(y, size, 4.0f, 40.0f, 3, 0.5f, 2.0f, valleysRow.data());
 
-            float mountains = ridgedNoise(nx * 3.5f, ny * 3.5f, 6) * params.mountainousness;
-            float hills = fbm(nx * 6.0f + 80.0f, ny * 6.0f + 80.0f, 4, 0.5f, 2.0f) * 0.35f;
-            float valleys = 1.0f - std::abs(fbm(nx * 4.0f + 40.0f, ny * 4.0f + 40.0f, 3, 0.5f, 2.0f));
+        for (int x = 0; x < size; ++x) {
+            float mountains = mountainsRow[x] * params.mountainousness;
+            float hills = hillsRow[x] * 0.35f;
+            float valleys = 1.0f - std::abs(valleysRow[x]);
 
             float terrain = mountains * 0.5f + hills * 0.3f + valleys * 0.2f;
             float height = mask[y * size + x] * (0.35f + terrain * 0.65f);
@@ -696,7 +770,7 @@ IslandData IslandGenerator::generateIrregular(const IslandGenParams& params, int
 
             data.heightmap[y * size + x] = height;
         }
-    }
+    });
 
     applyCoastalErosion(data, static_cast<int>(params.coastalErosion * 12.0f));
     carveRivers(data);
@@ -724,7 +798,7 @@ IslandData IslandGenerator::generateVolcanic(const IslandGenParams& params, int
 
     float center = size / 2.0f;
 
-    for (int y = 0; y < size; ++y) {
+    forEachRow(0, size, [&](int y) {
         for (int x = 0; x < size; ++x) {
             float nx = static_cast<float>(x) / size;
             float ny = static_cast<float>(y) / size;
@@ -753,7 +827,7 @@ IslandData IslandGenerator::generateVolcanic(const IslandGenParams& params, int
 
             data.heightmap[y * size + x] = std::min(1.0f, height);
         }
-    }
+    });
 
     applyCoastalErosion(data, static_cast<int>(params.coastalErosion * 5.0f));
     generateUnderwaterTerrain(data);
@@ -779,7 +853,7 @@ IslandData IslandGenerator::generateAtoll(const IslandGenParams& params, int siz
     float center = size / 2.0f;
     float lagoonRadius = size * params.islandRadius * (1.0f - params.reefWidth * 2.0f) * (1.0f - params.lagoonDepth);
 
-    for (int y = 0; y < size; ++y) {
+    forEachRow(0, size, [&](int y) {
         for (int x = 0; x < size; ++x) {
             float nx = static_cast<float>(x) / size;
             float ny = static_cast<float>(y) / size;
@@ -802,7 +876,7 @@ IslandData IslandGenerator::generateAtoll(const IslandGenParams& params, int siz
 
             data.heightmap[y * size + x] = height;
         }
-    }
+    });
 
     generateUnderwaterTerrain(data);
     smoothCoastlines(data, 2);
@@ -832,15 +906,20 @@ IslandData IslandGenerator::generateContinental(const IslandGenParams& params, i
     std::vector<float> mask;
     generateContinentalMask(mask, size, params.islandRadius * 1.8f);
 
-    for (int y = 0; y < size; ++y) {
+    forEachRow(0, size, [&](int y) {
+        std::vector<float> mountainsRow(size), hillsRow(size), plainsRow(size);
+        ridgedRow(y, size, 3.0f, 0.0f, 7, mountainsRow.data());
+        fbmRow(y, size, 6.0f, 100.0f, 5, 0.55f, 2.0f, hillsRow.data());
+        fbmRow(y, size, 2.0f, 50.0f, 3, 0.5f, 2.0f, plainsRow.data());
+
         for (int x = 0; x < size; ++x) {
             float nx = static_cast<float>(x) / size;
             float ny = static_cast<float>(y) / size;
 
             // Continental terrain with mountain ranges
-            float mountains = ridgedNoise(nx * 3.0f, ny * 3.0f, 7) * params.mountainousness;
-            float hills = fbm(nx * 6.0f + 100.0f, ny * 6.0f + 100.0f, 5, 0.55f, 2.0f) * 0.35f;
-            float plains = fbm(nx * 2.0f + 50.0f, ny * 2.0f + 50.0f, 3, 0.5f, 2.0f) * 0.15f;
+            float mountains = mountainsRow[x] * params.mountainousness;
+            float hills = hillsRow[x] * 0.35f;
+            float plains = plainsRow[x] * 0.15f;
 
             // Mountain range bias (linear feature across the continent)
             float rangeBias = std::sin(nx * 3.14159f + ny * 2.0f) * 0.3f + 0.7f;
@@ -855,7 +934,7 @@ IslandData IslandGenerator::generateContinental(const IslandGenParams& params, i
 
             data.heightmap[y * size + x] = height;
         }
-    }
+    });
 
     applyCoastalErosion(data, static_cast<int>(params.coastalErosion * 15.0f));
     carveRivers(data);
@@ -875,33 +954,33 @@ IslandData IslandGenerator::generateContinental(const IslandGenParams& params, i
 // ============================================================================
 
 void IslandGenerator::generateMountains(std::vector<float>& heightmap, int size, float intensity) {
-    for (int y = 0; y < size; ++y) {
-        for (int x = 0; x < size; ++x) {
-            float nx = static_cast<float>(x) / size;
-            float ny = static_cast<float>(y) / size;
+    forEachRow(0, size, [&](int y) {
+        std::vector<float> mountainRow(size);
+        ridgedRow(y, size, 4.0f, 0.0f, 6, mountainRow.data());
 
-            float mountain = ridgedNoise(nx * 4.0f, ny * 4.0f, 6);
+        for (int x = 0; x < size; ++x) {
+            float mountain = mountainRow[x];
             heightmap[y * size + x] += mountain * intensity * 0.3f;
         }
-    }
+    });
 }
 
 void IslandGenerator::generateValleys(std::vector<float>& heightmap, int size, float intensity) {
-    for (int y = 0; y < size; ++y) {
-        for (int x = 0; x < size; ++x) {
-            float nx = static_cast<float>(x) / size;
-            float ny = static_cast<float>(y) / size;
+    forEachRow(0, size, [&](int y) {
+        std::vector<float> valleyRow(size);
+        fbmRow(y, size, 3.0f, 0.0f, 4, 0.5f, 2.0f, valleyRow.data());
 
-            float valley = 1.0f - std::abs(fbm(nx * 3.0f, ny * 3.0f, 4, 0.5f, 2.0f));
+        for (int x = 0; x < size; ++x) {
+            float valley = 1.0f - std::abs(valleyRow[x]);
             valley = valley * valley;
             heightmap[y * size + x] -= valley * intensity * 0.15f;
             heightmap[y * size + x] = std::max(0.0f, heightmap[y * size + x]);
         }
-    }
+    });
 }
 
 void IslandGenerator::generatePlateaus(std::vector<float>& heightmap, int size, float intensity) {
-    for (int y = 0; y < size; ++y) {
+    forEachRow(0, size, [&](int y) {
         for (int x = 0; x < size; ++x) {
             float h = heightmap[y * size + x];
 
@@ -912,7 +991,7 @@ void IslandGenerator::generatePlateaus(std::vector<float>& heightmap, int size,
 
             heightmap[y * size + x] = lerp(stepped, h, 1.0f - intensity + blend * intensity);
         }
-    }
+    });
 }
 
 void IslandGenerator::generateBeaches(std::vector<float>& heightmap, std::vector<uint8_t>& coastalMap, int size,
@@ -1474,7 +1553,7 @@ void IslandGenerator::coastalErosion(std::vector<float>& heightmap, int size, fl
     for (int iter = 0; iter < iterations; ++iter) {
         std::vector<float> erosion(size * size, 0.0f);
 
-        for (int y = 1; y < size - 1; ++y) {
+        forEachRow(1, size - 1, [&](int y) {
             for (int x = 1; x < size - 1; ++x) {
                 float h = heightmap[y * size + x];
 
@@ -1495,7 +1574,7 @@ void IslandGenerator::coastalErosion(std::vector<float>& heightmap, int size, fl
                     }
                 }
             }
-        }
+        });
 
         // Apply erosion
         for (int i = 0; i < size * size; ++i) {
@@ -1510,17 +1589,18 @@ void IslandGenerator::coastalErosion(std::vector<float>& heightmap, int size, fl
 // ============================================================================
 
 void IslandGenerator::generateSeafloor(std::vector<float>& underwater, int size, float maxDepth) {
-    for (int y = 0; y < size; ++y) {
-        for (int x = 0; x < size; ++x) {
-            float nx = static_cast<float>(x) / size;
-            float ny = static_cast<float>(y) / size;
+    forEachRow(0, size, [&](int y) {
+        std::vector<float> baseRow(size), ridgesRow(size);
+        fbmRow(y, size, 3.0f, 200.0f, 4, 0.5f, 2.0f, baseRow.data());
+        ridgedRow(y, size, 5.0f, 300.0f, 3, ridgesRow.data());
 
+        for (int x = 0; x < size; ++x) {
             // Base seafloor with gentle undulations
-            float base = fbm(nx * 3.0f + 200.0f, ny * 3.0f + 200.0f, 4, 0.5f, 2.0f);
+            float base = baseRow[x];
             base = (base + 1.0f) * 0.5f;
 
             // Add some ridge features
-            float ridges = ridgedNoise(nx * 5.0f + 300.0f, ny * 5.0f + 300.0f, 3) * 0.2f;
+            float ridges = ridgesRow[x] * 0.2f;
 
             // Depth increases toward edges
             float dx = (x - size / 2.0f) / (size / 2.0f);
@@ -1531,11 +1611,11 @@ void IslandGenerator::generateSeafloor(std::vector<float>& underwater, int size,
             float depth = maxDepth * (0.3f + depthFactor * 0.7f);
             underwater[y * size + x] = -depth * (base * 0.7f + ridges + 0.3f);
         }
-    }
+    });
 }
 
 void IslandGenerator::generateCoralReefs(std::vector<float>& underwater, int size, float waterLevel) {
-    for (int y = 0; y < size; ++y) {
+    forEachRow(0, size, [&](int y) {
         for (int x = 0; x < size; ++x) {
             float depth = -underwater[y * size + x];
 
@@ -1552,13 +1632,13 @@ void IslandGenerator::generateCoralReefs(std::vector<float>& underwater, int siz
                 }
             }
         }
-    }
+    });
 }
 
 void IslandGenerator::generateKelpForests(std::vector<float>& underwater, int size, float waterLevel) {
     // Kelp forests are marked by slightly elevated seafloor areas
     // The actual kelp would be rendered separately
-    for (int y = 0; y < size; ++y) {
+    forEachRow(0, size, [&](int y) {
         for (int x = 0; x < size; ++x) {
             float depth = -underwater[y * size + x];
 
@@ -1575,7 +1655,7 @@ void IslandGenerator::generateKelpForests(std::vector<float>& underwater, int si
                 }
             }
         }
-    }
+    });
 }
 
 // ============================================================================
@@ -1622,7 +1702,7 @@ void IslandGenerator::generateUnderwaterTerrain(IslandData& data) {
     float shallowWaterEnd = data.params.waterLevel;                         // Water surface
 
     // Blend underwater terrain with main heightmap at coastlines
-    for (int y = 0; y < data.height; ++y) {
+    forEachRow(0, data.height, [&](int y) {
         for (int x = 0; x < data.width; ++x) {
             float h = data.heightmap[y * data.width + x];
 
@@ -1649,12 +1729,12 @@ void IslandGenerator::generateUnderwaterTerrain(IslandData& data) {
                 data.underwaterHeightmap[y * data.width + x] = h;
             }
         }
-    }
+    });
 
     // Smooth underwater terrain near coastlines to eliminate dropoffs
     std::vector<float> smoothed = data.underwaterHeightmap;
     for (int pass = 0; pass < 2; ++pass) {
-        for (int y = 1; y < data.height - 1; ++y) {
+        forEachRow(1, data.height - 1, [&](int y) {
             for (int x = 1; x < data.width - 1; ++x) {
                 float h = data.heightmap[y * data.width + x];
 
@@ -1673,7 +1753,7 @@ void IslandGenerator::generateUnderwaterTerrain(IslandData& data) {
                     smoothed[y * data.width + x] = sum / count;
                 }
             }
-        }
+        });
         data.underwaterHeightmap = smoothed;
     }
 
@@ -1688,7 +1768,7 @@ void IslandGenerator::smoothCoastlines(IslandData& data, int iterations) {
     for (int iter = 0; iter < iterations; ++iter) {
         std::vector<float> smoothed = data.heightmap;
 
-        for (int y = 1; y < data.height - 1; ++y) {
+        forEachRow(1, data.height - 1, [&](int y) {
             for (int x = 1; x < data.width - 1; ++x) {
                 float h = data.heightmap[y * data.width + x];
 
@@ -1707,7 +1787,7 @@ void IslandGenerator::smoothCoastlines(IslandData& data, int iterations) {
                     smoothed[y * data.width + x] = sum / count;
                 }
             }
-        }
+        });
 
         data.heightmap = smoothed;
     }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../utils/BatchNoise.h"
 #include <glm/glm.hpp>
 #include <vector>
 #include <cstdint>
@@ -9,6 +10,7 @@
 // Forward declarations
 class BiomeSystem;
 class PlanetTheme;
+class WorldGenContext;
 
 // Island shape types for procedural generation
 enum class IslandShape {
@@ -165,7 +167,15 @@ class IslandGenerator {
     static IslandShape randomShape(std::mt19937& rng);
     static IslandGenParams randomParams(uint32_t seed);
 
+    // Optional progress/cancellation context for row-parallel passes (not owned)
+    void setContext(WorldGenContext* context) { m_context = context; }
+
 private:
+    // Run fn(y) for y in [first, last) on the shared thread pool.
+    // Rows must only write their own cells.
+    template <typename Fn>
+    void forEachRow(int first, int last, Fn&& fn) const;
+
     // Noise functions
     float perlin2D(float x, float y) const;
     float fbm(float x, float y, int octaves, float persistence, float lacunarity) const;
@@ -173,6 +183,14 @@ class IslandGenerator {
     float voronoi(float x, float y, float& cellId) const;
     float domainWarp(float x, float y, float strength) const;
 
+    // Row-batched fbm/ridgedNoise/domainWarp: out[x] for x in [0, size) of
+    // row y, sampled at (nx * scale + offset, ny * scale + offset) with
+    // nx = x / size and ny = y / size. Same values as the per-cell calls.
+    void fbmRow(int y, int size, float scale, float offset, int octaves,
+                float persistence, float lacunarity, float* out) const;
+    void ridgedRow(int y, int size, float scale, float offset, int octaves, float* out) const;
+    void domainWarpRow(int y, int size, float scale, float strength, float* out) const;
+
     // Shape mask generators
     void generateCircularMask(std::vector<float>& mask, int size, float radius, float irregularity);
     void generateArchipelagoMask(std::vector<float>& mask, int size, int islandCount, float spread, float irregularity);
@@ -213,10 +231,13 @@ class IslandGenerator {
 
     // Permutation table for noise
     std::vector<int> m_perm;
+    BatchNoise m_batchNoise;
     std::mt19937 m_rng;
 
     // Current seed for reproducibility
     uint32_t m_currentSeed;
 
+    WorldGenContext* m_context = nullptr;
+
     void initializeNoise(uint32_t seed);
 };
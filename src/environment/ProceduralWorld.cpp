@@ -1,6 +1,8 @@
 #include "ProceduralWorld.h"
 #include "Terrain.h"
 #include "PlanetSeed.h"
+#include "WorldGenContext.h"
+#include "WorldCache.h"
 #include <chrono>
 #include <algorithm>
 #include <sstream>
@@ -78,9 +80,6 @@ const GeneratedWorld& ProceduralWorld::generate(const WorldGenConfig& config) {
 
     // Ensure we have a valid seed
     uint32_t seed = ensureSeed(config.seed);
-    m_lastSeed = seed;
-    m_lastConfig = config;
-    m_lastConfig.seed = seed;
 
     // Initialize planet seed system
     world.planetSeed.setMasterSeed(seed);
@@ -132,95 +131,137 @@ const GeneratedWorld& ProceduralWorld::generate(const WorldGenConfig& config) {
     // Vary mountainousness based on terrain seed
     islandParams.mountainousness = 0.3f + terrainVar.ridgeBias * 0.5f;
 
-    logLine("Generating island heightmap...");
-    reportProgress(0.15f, "Generating terrain...");
-    // Generate the island
-    world.islandData = m_islandGenerator.generate(islandParams, config.heightmapResolution, config.heightmapResolution);
-
-    // Post-processing with seed-driven erosion parameters
-    int erosionPasses = 3 + static_cast<int>(terrainVar.erosionStrength * 4.0f);
-    logLine("Applying coastal erosion passes: " + std::to_string(erosionPasses));
-    reportProgress(0.25f, "Applying erosion...");
-    m_islandGenerator.applyCoastalErosion(world.islandData, erosionPasses);
-
-    if (config.generateRivers) {
-        logLine("Carving rivers...");
-        reportProgress(0.30f, "Carving rivers...");
-        m_islandGenerator.carveRivers(world.islandData);
+    // A cache hit restores the island and biome cells; the theme, biome
+    // system settings and statistics are still rebuilt since they are cheap.
+    const uint64_t cacheKey = m_worldCache ? WorldCache::computeKey(config, seed) : 0;
+    WorldCache::Entry cachedWorld;
+    if (m_worldCache && m_worldCache->loadWorld(cacheKey, cachedWorld)) {
+        world.loadedFromCache = WorldCache::restoreIslandData(cachedWorld, world.islandData);
     }
-    if (config.generateLakes) {
-        logLine("Creating lakes...");
-        reportProgress(0.33f, "Creating lakes...");
-        m_islandGenerator.createLakes(world.islandData);
-    }
-    if (config.generateCaves) {
-        logLine("Marking cave entrances...");
-        reportProgress(0.36f, "Generating caves...");
-        m_islandGenerator.markCaveEntrances(world.islandData);
-    }
-    reportProgress(0.40f, "Generating seafloor...");
-    m_islandGenerator.generateUnderwaterTerrain(world.islandData);
-
-    int smoothPasses = 2 + static_cast<int>((1.0f - terrainVar.ridgeBias) * 3.0f);
-    logLine("Smoothing coastlines: " + std::to_string(smoothPasses));
-    reportProgress(0.45f, "Smoothing coastlines...");
-    m_islandGenerator.smoothCoastlines(world.islandData, smoothPasses);
 
-    // Create planet theme with weighted selection if enabled
-    world.planetTheme = std::make_unique<PlanetTheme>();
-    logLine("Building planet theme...");
-    reportProgress(0.55f, "Building planet theme...");
-
-    if (config.randomizeTheme) {
-        // Full random theme
-        world.planetTheme->generateRandom(world.planetSeed.paletteSeed);
-        world.themeName = "Random Planet";
-        world.themeRarity = ThemeRarity::COMMON;
-    } else if (config.useWeightedThemeSelection) {
-        // Use theme profile registry for weighted, varied selection
-        const auto& registry = ThemeProfileRegistry::getInstance();
-        const ThemeProfile& profile = registry.selectTheme(world.planetSeed.paletteSeed);
-
-        world.planetTheme->initializePreset(profile.basePreset, world.planetSeed.paletteSeed);
-        applyThemeVariation(*world.planetTheme, world.planetSeed, profile);
+    // Stages run in dependency order on this thread; row passes inside them
+    // fan out over the shared pool. The planet theme only depends on the
+    // seed, so it is built on a pool worker while the terrain stages run.
+    // Nothing on 'this' that describes the current world changes until the
+    // last cancellation point has passed.
+    WorldGenContext context(m_progressCallback, &m_cancelRequested);
+    std::future<void> themeTask;
+    std::vector<uint8_t> biomeMapRGBA;
+
+    try {
+        logLine("Building planet theme (background)...");
+        themeTask = ThreadPool::shared().submit([this, &world, &config]() {
+            buildPlanetTheme(world, config);
+        });
+
+        if (world.loadedFromCache) {
+            logLine("Loaded island from world cache.");
+            context.beginStage("Loading cached terrain...", 0.15f, 0.55f);
+        } else {
+            logLine("Generating island heightmap...");
+            context.beginStage("Generating terrain...", 0.15f, 0.25f);
+            m_islandGenerator.setContext(&context);
+            // Generate the island
+            world.islandData = m_islandGenerator.generate(islandParams, config.heightmapResolution, config.heightmapResolution);
+
+            // Post-processing with seed-driven erosion parameters
+            int erosionPasses = 3 + static_cast<int>(terrainVar.erosionStrength * 4.0f);
+            logLine("Applying coastal erosion passes: " + std::to_string(erosionPasses));
+            context.beginStage("Applying erosion...", 0.25f, 0.30f);
+            m_islandGenerator.applyCoastalErosion(world.islandData, erosionPasses);
+
+            if (config.generateRivers) {
+                logLine("Carving rivers...");
+                context.beginStage("Carving rivers...", 0.30f, 0.33f);
+                m_islandGenerator.carveRivers(world.islandData);
+            }
+            if (config.generateLakes) {
+                logLine("Creating lakes...");
+                context.beginStage("Creating lakes...", 0.33f, 0.36f);
+                m_islandGenerator.createLakes(world.islandData);
+            }
+            if (config.generateCaves) {
+                logLine("Marking cave entrances...");
+                context.beginStage("Generating caves...", 0.36f, 0.40f);
+                m_islandGenerator.markCaveEntrances(world.islandData);
+            }
+            context.beginStage("Generating seafloor...", 0.40f, 0.45f);
+            m_islandGenerator.generateUnderwaterTerrain(world.islandData);
+
+            int smoothPasses = 2 + static_cast<int>((1.0f - terrainVar.ridgeBias) * 3.0f);
+            logLine("Smoothing coastlines: " + std::to_string(smoothPasses));
+            context.beginStage("Smoothing coastlines...", 0.45f, 0.55f);
+            m_islandGenerator.smoothCoastlines(world.islandData, smoothPasses);
+            m_islandGenerator.setContext(nullptr);
+        }
 
-        world.themeName = profile.name;
-        world.themeRarity = profile.rarity;
-    } else {
-        // Use explicit preset
-        world.planetTheme->initializePreset(config.themePreset, world.planetSeed.paletteSeed);
-        world.themeName = presetToString(config.themePreset);
-        world.themeRarity = ThemeRarity::COMMON;
+        context.beginStage("Building planet theme...", 0.55f, 0.65f);
+        themeTask.get();
+
+        logLine("Initializing biome system...");
+        logLine("  World scale: " + std::to_string(config.terrainScale) + " units");
+        logLine("  Heightmap resolution: " + std::to_string(config.heightmapResolution));
+        logLine("  Noise frequency: " + std::to_string(config.noiseFrequency));
+        context.beginStage("Generating biomes...", 0.65f, 0.72f);
+        // Create biome system and apply theme with climate variation
+        world.biomeSystem = std::make_unique<BiomeSystem>();
+        world.biomeSystem->setWorldScale(config.terrainScale);
+        world.biomeSystem->initializeWithTheme(*world.planetTheme);
+        applyClimateVariation(*world.biomeSystem, world.planetSeed);
+        applyBiomeWeights(*world.biomeSystem, config.biomeWeights);
+        bool biomesRestored = false;
+        if (world.loadedFromCache) {
+            auto cells = cachedWorld.array<BiomeCell>(WorldCache::Section::BIOME_CELLS);
+            biomesRestored = world.biomeSystem->restoreBiomeMap(
+                cells.data(), cells.size(), world.islandData.width, world.islandData.height);
+        }
+        if (!biomesRestored) {
+            world.biomeSystem->generateFromIslandData(world.islandData);
+        }
+        cachedWorld = WorldCache::Entry();
+
+        // Generate biome map texture
+        context.beginStage("Building biome map...", 0.72f, 0.78f);
+        generateBiomeMapTexture(world, biomeMapRGBA, context);
+
+        // Calculate statistics
+        context.beginStage("Computing statistics...", 0.78f, 0.80f);
+        calculateStatistics(world, context);
+        calculateBiomeDistribution(world);
+        context.throwIfCancelled();
+
+        if (m_worldCache && !world.loadedFromCache) {
+            context.beginStage("Caching world...", 0.80f, 0.82f);
+            if (!m_worldCache->storeWorld(cacheKey, world)) {
+                logLine("Failed to write world cache entry.");
+            }
+        }
+        context.throwIfCancelled();
+    } catch (const WorldGenCancelled&) {
+        // The request has been honoured; later runs start clean
+        m_cancelRequested.store(false);
+        m_islandGenerator.setContext(nullptr);
+        if (themeTask.valid()) {
+            themeTask.wait();
+        }
+        logLine("World generation cancelled.");
+        throw;
+    } catch (...) {
+        // The theme task writes into 'world'; it must finish before unwinding
+        m_islandGenerator.setContext(nullptr);
+        if (themeTask.valid()) {
+            themeTask.wait();
+        }
+        logLine("World generation aborted.");
+        throw;
     }
 
-    // Enforce contrast budget
-    ContrastBudget::enforceContrast(
-        world.planetTheme->getMutableData().terrain,
-        world.planetTheme->getMutableData().atmosphere,
-        0.8f
-    );
-
-    logLine("Initializing biome system...");
-    logLine("  World scale: " + std::to_string(config.terrainScale) + " units");
-    logLine("  Heightmap resolution: " + std::to_string(config.heightmapResolution));
-    logLine("  Noise frequency: " + std::to_string(config.noiseFrequency));
-    reportProgress(0.65f, "Generating biomes...");
-    // Create biome system and apply theme with climate variation
-    world.biomeSystem = std::make_unique<BiomeSystem>();
-    world.biomeSystem->setWorldScale(config.terrainScale);
-    world.biomeSystem->initializeWithTheme(*world.planetTheme);
-    applyClimateVariation(*world.biomeSystem, world.planetSeed);
-    applyBiomeWeights(*world.biomeSystem, config.biomeWeights);
-    world.biomeSystem->generateFromIslandData(world.islandData);
-
-    // Generate biome map texture
-    reportProgress(0.72f, "Building biome map...");
-    generateBiomeMapTexture();
-
-    // Calculate statistics
-    reportProgress(0.78f, "Computing statistics...");
-    calculateStatistics(world);
-    calculateBiomeDistribution(world);
+    // Past the last cancellation point: commit the new world's state
+    m_lastSeed = seed;
+    m_lastConfig = config;
+    m_lastConfig.seed = seed;
+    m_lastCacheKey = cacheKey;
+    m_biomeMapRGBA = std::move(biomeMapRGBA);
 
     // Cache palette variation and terrain params for shader integration
     reportProgress(0.82f, "Finalizing palette...");
@@ -253,6 +294,40 @@ const GeneratedWorld& ProceduralWorld::generate(const WorldGenConfig& config) {
     return *m_currentWorld;
 }
 
+void ProceduralWorld::buildPlanetTheme(GeneratedWorld& world, const WorldGenConfig& config) {
+    // Create planet theme with weighted selection if enabled
+    world.planetTheme = std::make_unique<PlanetTheme>();
+
+    if (config.randomizeTheme) {
+        // Full random theme
+        world.planetTheme->generateRandom(world.planetSeed.paletteSeed);
+        world.themeName = "Random Planet";
+        world.themeRarity = ThemeRarity::COMMON;
+    } else if (config.useWeightedThemeSelection) {
+        // Use theme profile registry for weighted, varied selection
+        const auto& registry = ThemeProfileRegistry::getInstance();
+        const ThemeProfile& profile = registry.selectTheme(world.planetSeed.paletteSeed);
+
+        world.planetTheme->initializePreset(profile.basePreset, world.planetSeed.paletteSeed);
+        applyThemeVariation(*world.planetTheme, world.planetSeed, profile);
+
+        world.themeName = profile.name;
+        world.themeRarity = profile.rarity;
+    } else {
+        // Use explicit preset
+        world.planetTheme->initializePreset(config.themePreset, world.planetSeed.paletteSeed);
+        world.themeName = presetToString(config.themePreset);
+        world.themeRarity = ThemeRarity::COMMON;
+    }
+
+    // Enforce contrast budget
+    ContrastBudget::enforceContrast(
+        world.planetTheme->getMutableData().terrain,
+        world.planetTheme->getMutableData().atmosphere,
+        0.8f
+    );
+}
+
 const GeneratedWorld& ProceduralWorld::generateRandom(uint32_t seed) {
     seed = ensureSeed(seed);
 
@@ -397,47 +472,66 @@ const GeneratedWorld& ProceduralWorld::regenerate() {
     return generate(m_lastConfig);
 }
 
-void ProceduralWorld::generateBiomeMapTexture() {
-    if (!m_currentWorld || !m_currentWorld->biomeSystem) return;
+void ProceduralWorld::generateBiomeMapTexture(const GeneratedWorld& world, std::vector<uint8_t>& rgba,
+                                              WorldGenContext& context) {
+    if (!world.biomeSystem) return;
 
-    int width = m_currentWorld->biomeSystem->getWidth();
-    int height = m_currentWorld->biomeSystem->getHeight();
+    const BiomeSystem& biomes = *world.biomeSystem;
+    int width = biomes.getWidth();
+    int height = biomes.getHeight();
 
-    m_biomeMapRGBA.resize(width * height * 4);
+    rgba.resize(width * height * 4);
 
-    for (int y = 0; y < height; ++y) {
+    context.parallelRows(height, [&](int y) {
         for (int x = 0; x < width; ++x) {
-            const BiomeCell& cell = m_currentWorld->biomeSystem->getCell(x, y);
+            const BiomeCell& cell = biomes.getCell(x, y);
 
             int idx = (y * width + x) * 4;
             // R = primary biome (0-31 mapped to 0-255)
-            m_biomeMapRGBA[idx + 0] = static_cast<uint8_t>(cell.primaryBiome) * 8;
+            rgba[idx + 0] = static_cast<uint8_t>(cell.primaryBiome) * 8;
             // G = secondary biome
-            m_biomeMapRGBA[idx + 1] = static_cast<uint8_t>(cell.secondaryBiome) * 8;
+            rgba[idx + 1] = static_cast<uint8_t>(cell.secondaryBiome) * 8;
             // B = blend factor (0-1 mapped to 0-255)
-            m_biomeMapRGBA[idx + 2] = static_cast<uint8_t>(cell.blendFactor * 255.0f);
+            rgba[idx + 2] = static_cast<uint8_t>(cell.blendFactor * 255.0f);
             // A = flags (reserved)
-            m_biomeMapRGBA[idx + 3] = 255;
+            rgba[idx + 3] = 255;
         }
-    }
+    });
 }
 
-void ProceduralWorld::calculateStatistics(GeneratedWorld& world) {
+void ProceduralWorld::calculateStatistics(GeneratedWorld& world, WorldGenContext& context) {
     const auto& heightmap = world.islandData.heightmap;
-    int size = world.islandData.width * world.islandData.height;
+    int width = world.islandData.width;
+    int rows = world.islandData.height;
+    int size = width * rows;
     float waterLevel = world.islandData.params.waterLevel;
 
-    int landCount = 0;
-    float totalElevation = 0.0f;
+    // Per-row partials, summed in row order so the result is deterministic
+    std::vector<int> rowLand(rows, 0);
+    std::vector<float> rowElevation(rows, 0.0f);
 
-    for (int i = 0; i < size; ++i) {
-        if (heightmap[i] > waterLevel) {
-            landCount++;
-            totalElevation += heightmap[i];
+    context.parallelRows(rows, [&](int y) {
+        const float* row = heightmap.data() + static_cast<size_t>(y) * width;
+        int landCount = 0;
+        float totalElevation = 0.0f;
+        for (int x = 0; x < width; ++x) {
+            if (row[x] > waterLevel) {
+                landCount++;
+                totalElevation += row[x];
+            }
         }
+        rowLand[y] = landCount;
+        rowElevation[y] = totalElevation;
+    });
+
+    int landCount = 0;
+    float totalElevation = 0.0f;
+    for (int y = 0; y < rows; ++y) {
+        landCount += rowLand[y];
+        totalElevation += rowElevation[y];
     }
 
-    world.landPercentage = static_cast<float>(landCount) / size * 100.0f;
+    world.landPercentage = size > 0 ? static_cast<float>(landCount) / size * 100.0f : 0.0f;
     world.waterPercentage = 100.0f - world.landPercentage;
     world.averageElevation = landCount > 0 ? totalElevation / landCount : 0.0f;
     world.riverCount = static_cast<int>(world.islandData.rivers.size());
@@ -5,6 +5,7 @@
 #include "PlanetTheme.h"
 #include "PlanetSeed.h"
 #include "PlanetChemistry.h"
+#include <atomic>
 #include <memory>
 #include <functional>
 #include <random>
@@ -12,6 +13,8 @@
 // Forward declarations
 class Terrain;
 class VegetationManager;
+class WorldGenContext;
+class WorldCache;
 
 // ============================================================================
 // STAR TYPE SYSTEM - Run-to-Run Variety
@@ -309,6 +312,9 @@ struct GeneratedWorld {
 
     // Generation timing
     float generationTimeMs;
+
+    // True if terrain and biomes were restored from the world cache
+    bool loadedFromCache = false;
 };
 
 // Main procedural world generation manager
@@ -321,9 +327,24 @@ class ProceduralWorld {
     using ProgressCallback = std::function<void(float, const char*)>;
     void setProgressCallback(ProgressCallback cb) { m_progressCallback = std::move(cb); }
 
-    // Generate a complete world
+    // Generate a complete world. Throws WorldGenCancelled if requestCancel()
+    // is called while it runs; the previous world is kept in that case.
     const GeneratedWorld& generate(const WorldGenConfig& config);
 
+    // Ask a running generate() to stop at the next stage or row chunk.
+    // Safe to call from any thread. A request made before generate() starts
+    // cancels that run; the flag clears once a run has been cancelled.
+    void requestCancel() { m_cancelRequested.store(true); }
+    bool isCancelRequested() const { return m_cancelRequested.load(); }
+
+    // On-disk cache of generated worlds (optional). When set, generate()
+    // restores terrain and biomes for a known seed/config instead of
+    // regenerating them, and stores newly generated worlds.
+    void setWorldCache(std::shared_ptr<WorldCache> cache) { m_worldCache = std::move(cache); }
+    const std::shared_ptr<WorldCache>& getWorldCache() const { return m_worldCache; }
+    // Cache key of the last generate() call (0 when no cache is set)
+    uint64_t getLastCacheKey() const { return m_lastCacheKey; }
+
     // Generate with just a seed (uses random settings)
     const GeneratedWorld& generateRandom(uint32_t seed = 0);
 
@@ -455,6 +476,10 @@ class ProceduralWorld {
 
 private:
     void reportProgress(float progress, const char* stage) const;
+
+    // Build world.planetTheme and theme metadata; only reads the planet seed,
+    // so it can run concurrently with the terrain stages
+    void buildPlanetTheme(GeneratedWorld& world, const WorldGenConfig& config);
     // Apply seed-driven variation to theme
     void applyThemeVariation(PlanetTheme& theme, const PlanetSeed& seed, const ThemeProfile& profile);
 
@@ -480,10 +505,11 @@ class ProceduralWorld {
     uint32_t ensureSeed(uint32_t seed);
 
     // Convert biome map to RGBA texture format
-    void generateBiomeMapTexture();
+    void generateBiomeMapTexture(const GeneratedWorld& world, std::vector<uint8_t>& rgba,
+                                 WorldGenContext& context);
 
     // Calculate world statistics
-    void calculateStatistics(GeneratedWorld& world);
+    void calculateStatistics(GeneratedWorld& world, WorldGenContext& context);
 
     IslandGenerator m_islandGenerator;
     std::unique_ptr<GeneratedWorld> m_currentWorld;
@@ -505,6 +531,10 @@ class ProceduralWorld {
     std::random_device m_rd;
     std::mt19937 m_rng;
     ProgressCallback m_progressCallback;
+    std::atomic<bool> m_cancelRequested{false};
+
+    std::shared_ptr<WorldCache> m_worldCache;
+    uint64_t m_lastCacheKey = 0;
 };
 
 // Integration helpers
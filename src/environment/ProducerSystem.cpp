@@ -1,5 +1,6 @@
 #include "ProducerSystem.h"
 #include "Terrain.h"
+#include "TerrainSampler.h"
 #include "SeasonManager.h"
 #include "VegetationManager.h"
 #include <random>
@@ -7,6 +8,224 @@
 #include <cmath>
 #include <iostream>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PRODUCER_SSE2 1
+#endif
+
+// ============================================================================
+// Producer Patches
+// ============================================================================
+
+void ProducerPatches::clear() {
+    posX.clear(); posY.clear(); posZ.clear();
+    biomass.clear();
+    maxBiomass.clear();
+    regrowth.clear();
+    energyPerUnit.clear();
+    pressure.clear();
+    nutrients.clear();
+    soilTiles.clear();
+    types.clear();
+    cellStart.clear();
+    gridCells = 0;
+}
+
+void ProducerPatches::add(const FoodPatch& patch, uint32_t soilTile) {
+    posX.push_back(patch.position.x);
+    posY.push_back(patch.position.y);
+    posZ.push_back(patch.position.z);
+    biomass.push_back(patch.currentBiomass);
+    maxBiomass.push_back(patch.maxBiomass);
+    regrowth.push_back(patch.regrowthRate);
+    energyPerUnit.push_back(patch.energyPerUnit);
+    pressure.push_back(patch.consumptionPressure);
+    nutrients.push_back(1.0f);
+    soilTiles.push_back(soilTile);
+    types.push_back(patch.type);
+}
+
+int ProducerPatches::cellCoord(float world) const {
+    float cell = (world - gridMin) / cellSize;
+    cell = std::max(0.0f, std::min(cell, static_cast<float>(gridCells - 1)));
+    return static_cast<int>(cell);
+}
+
+void ProducerPatches::finalize(float worldMin, float worldSize, float newCellSize) {
+    gridMin = worldMin;
+    cellSize = newCellSize;
+    gridCells = std::max(1, static_cast<int>(std::ceil(worldSize / newCellSize)));
+
+    const size_t count = size();
+    const size_t cellCount = static_cast<size_t>(gridCells) * gridCells;
+
+    // Counting sort by cell; stable, so patches keep generation order within a cell
+    std::vector<uint32_t> cellOf(count);
+    cellStart.assign(cellCount + 1, 0);
+    for (size_t i = 0; i < count; ++i) {
+        cellOf[i] = static_cast<uint32_t>(cellCoord(posZ[i]) * gridCells + cellCoord(posX[i]));
+        cellStart[cellOf[i] + 1]++;
+    }
+    for (size_t c = 0; c < cellCount; ++c) {
+        cellStart[c + 1] += cellStart[c];
+    }
+
+    std::vector<uint32_t> order(count);
+    std::vector<uint32_t> cursor(cellStart.begin(), cellStart.end() - 1);
+    for (size_t i = 0; i < count; ++i) {
+        order[cursor[cellOf[i]]++] = static_cast<uint32_t>(i);
+    }
+
+    auto permute = [&order](auto& column) {
+        auto sorted = column;
+        for (size_t i = 0; i < order.size(); ++i) {
+            sorted[i] = column[order[i]];
+        }
+        column.swap(sorted);
+    };
+    permute(posX); permute(posY); permute(posZ);
+    permute(biomass);
+    permute(maxBiomass);
+    permute(regrowth);
+    permute(energyPerUnit);
+    permute(pressure);
+    permute(nutrients);
+    permute(soilTiles);
+    permute(types);
+}
+
+int ProducerPatches::findNearest(float x, float z, float range, FoodSourceType type, bool matchType) const {
+    if (empty() || gridCells == 0) return -1;
+
+    const int cx0 = cellCoord(x - range);
+    const int cx1 = cellCoord(x + range);
+    const int cz0 = cellCoord(z - range);
+    const int cz1 = cellCoord(z + range);
+
+    int nearest = -1;
+    float nearestDistSq = range * range;
+
+    for (int cz = cz0; cz <= cz1; ++cz) {
+        for (int cx = cx0; cx <= cx1; ++cx) {
+            const size_t cell = static_cast<size_t>(cz) * gridCells + cx;
+            for (uint32_t i = cellStart[cell]; i < cellStart[cell + 1]; ++i) {
+                if (matchType && types[i] != type) continue;
+                if (!isAvailable(i)) continue;
+
+                float dx = posX[i] - x;
+                float dz = posZ[i] - z;
+                float distSq = dx * dx + dz * dz;
+                if (distSq < nearestDistSq) {
+                    nearestDistSq = distSq;
+                    nearest = static_cast<int>(i);
+                }
+            }
+        }
+    }
+
+    return nearest;
+}
+
+float ProducerPatches::consume(size_t i, float amount) {
+    float consumed = std::min(amount, biomass[i]);
+    biomass[i] -= consumed;
+    pressure[i] = std::min(1.0f, pressure[i] + 0.2f);
+    return consumed * energyPerUnit[i];
+}
+
+void ProducerPatches::grow(const float* soilGrowth, float seasonMultiplier,
+                           const PatchGrowthParams& params, float deltaTime) {
+    const size_t count = size();
+    if (count == 0) return;
+
+    // Gather the soil term once so the sweep below is purely columnar
+    if (params.soilLimited) {
+        for (size_t i = 0; i < count; ++i) {
+            nutrients[i] = soilGrowth[soilTiles[i]] * seasonMultiplier;
+        }
+    } else {
+        std::fill(nutrients.begin(), nutrients.end(), seasonMultiplier);
+    }
+
+    // Biomass never exceeds its maximum, so clamping unconditionally matches
+    // growing only patches below it. Operand order follows the scalar code.
+    float* bio = biomass.data();
+    float* press = pressure.data();
+    const float* maxBio = maxBiomass.data();
+    const float* rate = regrowth.data();
+    const float* growth = nutrients.data();
+    const float decay = params.pressureDecay * deltaTime;
+    size_t i = 0;
+
+#if defined(PRODUCER_SSE2)
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 decayV = _mm_set1_ps(decay);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 minPressureMult = _mm_set1_ps(0.2f);
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 p = _mm_loadu_ps(press + i);
+        __m128 r = _mm_mul_ps(_mm_loadu_ps(rate + i), _mm_loadu_ps(growth + i));
+        if (params.pressureLimitsGrowth) {
+            r = _mm_mul_ps(r, _mm_max_ps(minPressureMult, _mm_sub_ps(one, p)));
+        }
+        __m128 b = _mm_add_ps(_mm_loadu_ps(bio + i), _mm_mul_ps(r, dt));
+        _mm_storeu_ps(bio + i, _mm_min_ps(b, _mm_loadu_ps(maxBio + i)));
+        _mm_storeu_ps(press + i, _mm_max_ps(zero, _mm_sub_ps(p, decayV)));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        float r = rate[i] * growth[i];
+        if (params.pressureLimitsGrowth) {
+            r *= std::max(0.2f, 1.0f - press[i]);
+        }
+        bio[i] = std::min(bio[i] + r * deltaTime, maxBio[i]);
+        press[i] = std::max(0.0f, press[i] - decay);
+    }
+}
+
+void ProducerPatches::scale(float factor) {
+    for (size_t i = 0; i < size(); ++i) {
+        maxBiomass[i] *= factor;
+        biomass[i] = std::min(biomass[i] * factor, maxBiomass[i]);
+        regrowth[i] *= factor;
+    }
+}
+
+float ProducerPatches::getTotalBiomass() const {
+    float total = 0.0f;
+    for (float b : biomass) {
+        total += b;
+    }
+    return total;
+}
+
+int ProducerPatches::getAvailableCount() const {
+    int count = 0;
+    for (float b : biomass) {
+        if (b > 0.1f) count++;
+    }
+    return count;
+}
+
+void ProducerPatches::appendAvailablePositions(std::vector<glm::vec3>& out) const {
+    for (size_t i = 0; i < size(); ++i) {
+        if (isAvailable(i)) out.push_back(getPosition(i));
+    }
+}
+
+void ProducerPatches::appendAvailablePositions(std::vector<glm::vec3>& out, FoodSourceType type) const {
+    for (size_t i = 0; i < size(); ++i) {
+        if (types[i] == type && isAvailable(i)) out.push_back(getPosition(i));
+    }
+}
+
+// ============================================================================
+// Producer System
+// ============================================================================
+
 ProducerSystem::ProducerSystem(Terrain* terrain, int gridResolution)
     : terrain(terrain)
     , gridResolution(gridResolution)
@@ -18,15 +237,16 @@ void ProducerSystem::init(unsigned int seed) {
     float terrainWidth = terrain->getWidth() * terrain->getScale();
     soilTileSize = terrainWidth / gridResolution;
 
-    soilGrid.resize(gridResolution);
+    soilGrid.resize(static_cast<size_t>(gridResolution) * gridResolution);
+    soilGrowth.assign(soilGrid.size(), 1.0f);
     for (int i = 0; i < gridResolution; i++) {
-        soilGrid[i].resize(gridResolution);
         for (int j = 0; j < gridResolution; j++) {
             float x = (i - gridResolution/2) * soilTileSize;
             float z = (j - gridResolution/2) * soilTileSize;
-            float height = terrain->getHeight(x, z);
+            // Bands below are in normalized height; getHeight is in world units
+            float height = terrain->getHeight(x, z) / TerrainSampler::HEIGHT_SCALE;
 
-            SoilTile& tile = soilGrid[i][j];
+            SoilTile& tile = soilGrid[static_cast<size_t>(i) * gridResolution + j];
 
             if (height > 0.5f && height < 0.75f) {
                 tile.nitrogen = 60.0f + (std::rand() % 20);
@@ -49,6 +269,15 @@ void ProducerSystem::init(unsigned int seed) {
     generateBushPatches(seed);
     linkTreePatches();
     generateAquaticPatches(seed);
+    finalizePatches();
+}
+
+void ProducerSystem::finalizePatches() {
+    float terrainWidth = terrain->getWidth() * terrain->getScale();
+    for (ProducerPatches* patches : {&grassPatches, &bushPatches, &treePatches,
+                                     &planktonPatches, &algaePatches, &seaweedPatches}) {
+        patches->finalize(-terrainWidth * 0.5f, terrainWidth, PATCH_CELL_SIZE);
+    }
 }
 
 void ProducerSystem::generateGrassPatches(unsigned int seed) {
@@ -66,11 +295,12 @@ void ProducerSystem::generateGrassPatches(unsigned int seed) {
 
             if (terrain->isWater(x, z)) continue;
 
-            float height = terrain->getHeight(x, z);
+            float worldHeight = terrain->getHeight(x, z);
+            float height = worldHeight / TerrainSampler::HEIGHT_SCALE;
             if (height < 0.35f || height > 0.75f) continue;
 
             FoodPatch patch;
-            patch.position = glm::vec3(x, height, z);
+            patch.position = glm::vec3(x, worldHeight, z);
             patch.type = FoodSourceType::GRASS;
             patch.maxBiomass = 10.0f + (height - 0.35f) * 20.0f;
             patch.currentBiomass = patch.maxBiomass * 0.8f;
@@ -83,7 +313,7 @@ void ProducerSystem::generateGrassPatches(unsigned int seed) {
             patch.soilNitrogen = soil.nitrogen;
             patch.soilMoisture = soil.moisture;
 
-            grassPatches.push_back(patch);
+            grassPatches.add(patch, soilTileIndex(patch.position));
         }
     }
 }
@@ -103,12 +333,13 @@ void ProducerSystem::generateBushPatches(unsigned int seed) {
 
             if (terrain->isWater(x, z)) continue;
 
-            float height = terrain->getHeight(x, z);
+            float worldHeight = terrain->getHeight(x, z);
+            float height = worldHeight / TerrainSampler::HEIGHT_SCALE;
             if (height < 0.45f || height > 0.7f) continue;
             if ((rng() % 100) > 40) continue;
 
             FoodPatch patch;
-            patch.position = glm::vec3(x, height, z);
+            patch.position = glm::vec3(x, worldHeight, z);
             patch.type = FoodSourceType::BUSH_BERRY;
             patch.maxBiomass = 20.0f;
             patch.currentBiomass = patch.maxBiomass * 0.7f;
@@ -121,7 +352,7 @@ void ProducerSystem::generateBushPatches(unsigned int seed) {
             patch.soilNitrogen = soil.nitrogen;
             patch.soilMoisture = soil.moisture;
 
-            bushPatches.push_back(patch);
+            bushPatches.add(patch, soilTileIndex(patch.position));
         }
     }
 }
@@ -139,12 +370,13 @@ void ProducerSystem::linkTreePatches() {
 
             if (terrain->isWater(x, z)) continue;
 
-            float height = terrain->getHeight(x, z);
+            float worldHeight = terrain->getHeight(x, z);
+            float height = worldHeight / TerrainSampler::HEIGHT_SCALE;
             if (height < 0.55f || height > 0.8f) continue;
             if ((rng() % 100) > 50) continue;
 
             FoodPatch fruitPatch;
-            fruitPatch.position = glm::vec3(x, height, z);
+            fruitPatch.position = glm::vec3(x, worldHeight, z);
             fruitPatch.type = FoodSourceType::TREE_FRUIT;
             fruitPatch.maxBiomass = 30.0f;
             fruitPatch.currentBiomass = fruitPatch.maxBiomass * 0.5f;
@@ -154,7 +386,7 @@ void ProducerSystem::linkTreePatches() {
             fruitPatch.consumptionPressure = 0.0f;
 
             FoodPatch leafPatch;
-            leafPatch.position = glm::vec3(x, height, z);
+            leafPatch.position = glm::vec3(x, worldHeight, z);
             leafPatch.type = FoodSourceType::TREE_LEAF;
             leafPatch.maxBiomass = 50.0f;
             leafPatch.currentBiomass = leafPatch.maxBiomass * 0.8f;
@@ -163,8 +395,9 @@ void ProducerSystem::linkTreePatches() {
             leafPatch.lastConsumedTime = 0.0f;
             leafPatch.consumptionPressure = 0.0f;
 
-            treePatches.push_back(fruitPatch);
-            treePatches.push_back(leafPatch);
+            uint32_t soilTile = soilTileIndex(fruitPatch.position);
+            treePatches.add(fruitPatch, soilTile);
+            treePatches.add(leafPatch, soilTile);
         }
     }
 }
@@ -182,69 +415,25 @@ void ProducerSystem::update(float deltaTime, const SeasonManager* seasonMgr) {
 }
 
 void ProducerSystem::updateGrowth(float deltaTime, float seasonMultiplier) {
-    for (auto& patch : grassPatches) {
-        if (patch.currentBiomass < patch.maxBiomass) {
-            const SoilTile& soil = getSoilAt(patch.position);
-            float growthMult = soil.getGrowthMultiplier() * seasonMultiplier;
-            float pressureMult = std::max(0.2f, 1.0f - patch.consumptionPressure);
-
-            patch.currentBiomass += patch.regrowthRate * growthMult * pressureMult * deltaTime;
-            patch.currentBiomass = std::min(patch.currentBiomass, patch.maxBiomass);
-        }
-        patch.consumptionPressure = std::max(0.0f, patch.consumptionPressure - 0.1f * deltaTime);
+    for (size_t k = 0; k < soilGrid.size(); ++k) {
+        soilGrowth[k] = soilGrid[k].getGrowthMultiplier();
     }
 
-    for (auto& patch : bushPatches) {
-        if (patch.currentBiomass < patch.maxBiomass) {
-            const SoilTile& soil = getSoilAt(patch.position);
-            float growthMult = soil.getGrowthMultiplier() * seasonMultiplier;
-            patch.currentBiomass += patch.regrowthRate * growthMult * deltaTime;
-            patch.currentBiomass = std::min(patch.currentBiomass, patch.maxBiomass);
-        }
-        patch.consumptionPressure = std::max(0.0f, patch.consumptionPressure - 0.1f * deltaTime);
-    }
-
-    for (auto& patch : treePatches) {
-        if (patch.currentBiomass < patch.maxBiomass) {
-            const SoilTile& soil = getSoilAt(patch.position);
-            float growthMult = soil.getGrowthMultiplier() * seasonMultiplier;
-            patch.currentBiomass += patch.regrowthRate * growthMult * deltaTime;
-            patch.currentBiomass = std::min(patch.currentBiomass, patch.maxBiomass);
-        }
-        patch.consumptionPressure = std::max(0.0f, patch.consumptionPressure - 0.05f * deltaTime);
-    }
-
-    // Update aquatic patches (plankton regrows fast, seaweed slower)
-    for (auto& patch : planktonPatches) {
-        if (patch.currentBiomass < patch.maxBiomass) {
-            // Plankton grows fast, affected by sunlight (season)
-            patch.currentBiomass += patch.regrowthRate * seasonMultiplier * deltaTime;
-            patch.currentBiomass = std::min(patch.currentBiomass, patch.maxBiomass);
-        }
-        patch.consumptionPressure = std::max(0.0f, patch.consumptionPressure - 0.15f * deltaTime);
-    }
-
-    for (auto& patch : algaePatches) {
-        if (patch.currentBiomass < patch.maxBiomass) {
-            patch.currentBiomass += patch.regrowthRate * seasonMultiplier * deltaTime;
-            patch.currentBiomass = std::min(patch.currentBiomass, patch.maxBiomass);
-        }
-        patch.consumptionPressure = std::max(0.0f, patch.consumptionPressure - 0.1f * deltaTime);
-    }
+    // Grass is grazing-limited; trees recover from browsing more slowly
+    grassPatches.grow(soilGrowth.data(), seasonMultiplier, {0.1f, true, true}, deltaTime);
+    bushPatches.grow(soilGrowth.data(), seasonMultiplier, {0.1f, true, false}, deltaTime);
+    treePatches.grow(soilGrowth.data(), seasonMultiplier, {0.05f, true, false}, deltaTime);
 
-    for (auto& patch : seaweedPatches) {
-        if (patch.currentBiomass < patch.maxBiomass) {
-            patch.currentBiomass += patch.regrowthRate * seasonMultiplier * deltaTime;
-            patch.currentBiomass = std::min(patch.currentBiomass, patch.maxBiomass);
-        }
-        patch.consumptionPressure = std::max(0.0f, patch.consumptionPressure - 0.08f * deltaTime);
-    }
+    // Aquatic patches follow sunlight (season) only; plankton regrows fast, seaweed slower
+    planktonPatches.grow(nullptr, seasonMultiplier, {0.15f, false, false}, deltaTime);
+    algaePatches.grow(nullptr, seasonMultiplier, {0.1f, false, false}, deltaTime);
+    seaweedPatches.grow(nullptr, seasonMultiplier, {0.08f, false, false}, deltaTime);
 }
 
 void ProducerSystem::updateSoilNutrients(float deltaTime) {
     for (int i = 1; i < gridResolution - 1; i++) {
         for (int j = 1; j < gridResolution - 1; j++) {
-            SoilTile& tile = soilGrid[i][j];
+            SoilTile& tile = soilGrid[static_cast<size_t>(i) * gridResolution + j];
 
             tile.nitrogen += 0.001f * deltaTime;
             tile.nitrogen = std::min(tile.nitrogen, 100.0f);
@@ -263,150 +452,79 @@ void ProducerSystem::updateSoilNutrients(float deltaTime) {
 }
 
 float ProducerSystem::consumeAt(const glm::vec3& position, FoodSourceType preferredType, float amount, float range) {
-    FoodPatch* patch = findNearestPatch(position, preferredType, range);
+    ProducerPatches* patches = patchesFor(preferredType);
+    if (!patches) return 0.0f;
 
-    if (!patch || patch->currentBiomass < 0.1f) {
+    // Trees hold fruit and leaf patches side by side; only the asked-for kind counts
+    bool matchType = preferredType == FoodSourceType::TREE_FRUIT || preferredType == FoodSourceType::TREE_LEAF;
+    int patch = patches->findNearest(position.x, position.z, range, preferredType, matchType);
+    if (patch < 0) {
         return 0.0f;
     }
 
-    float consumed = std::min(amount, patch->currentBiomass);
-    patch->currentBiomass -= consumed;
-    patch->consumptionPressure = std::min(1.0f, patch->consumptionPressure + 0.2f);
-
-    return consumed * patch->energyPerUnit;
+    return patches->consume(static_cast<size_t>(patch), amount);
 }
 
 void ProducerSystem::applyBiomassScale(float scale) {
     float clampedScale = std::clamp(scale, 0.2f, 3.0f);
-    auto scalePatch = [clampedScale](FoodPatch& patch) {
-        patch.maxBiomass *= clampedScale;
-        patch.currentBiomass = std::min(patch.currentBiomass * clampedScale, patch.maxBiomass);
-        patch.regrowthRate *= clampedScale;
-    };
-
-    for (auto& patch : grassPatches) {
-        scalePatch(patch);
-    }
-    for (auto& patch : bushPatches) {
-        scalePatch(patch);
-    }
-    for (auto& patch : treePatches) {
-        scalePatch(patch);
-    }
-    for (auto& patch : planktonPatches) {
-        scalePatch(patch);
-    }
-    for (auto& patch : algaePatches) {
-        scalePatch(patch);
-    }
-    for (auto& patch : seaweedPatches) {
-        scalePatch(patch);
-    }
+    grassPatches.scale(clampedScale);
+    bushPatches.scale(clampedScale);
+    treePatches.scale(clampedScale);
+    planktonPatches.scale(clampedScale);
+    algaePatches.scale(clampedScale);
+    seaweedPatches.scale(clampedScale);
 }
 
-FoodPatch* ProducerSystem::findNearestPatch(const glm::vec3& pos, FoodSourceType type, float range) {
-    std::vector<FoodPatch>* patches = nullptr;
-
+ProducerPatches* ProducerSystem::patchesFor(FoodSourceType type) {
     switch (type) {
         case FoodSourceType::GRASS:
-            patches = &grassPatches;
-            break;
+            return &grassPatches;
         case FoodSourceType::BUSH_BERRY:
-            patches = &bushPatches;
-            break;
+            return &bushPatches;
         case FoodSourceType::TREE_FRUIT:
         case FoodSourceType::TREE_LEAF:
-            patches = &treePatches;
-            break;
+            return &treePatches;
         case FoodSourceType::PLANKTON:
-            patches = &planktonPatches;
-            break;
+            return &planktonPatches;
         case FoodSourceType::ALGAE:
-            patches = &algaePatches;
-            break;
+            return &algaePatches;
         case FoodSourceType::SEAWEED:
         case FoodSourceType::KELP:
-            patches = &seaweedPatches;
-            break;
+            return &seaweedPatches;
         default:
-            break;
+            return nullptr;
     }
-
-    if (!patches) return nullptr;
-
-    FoodPatch* nearest = nullptr;
-    float nearestDist = range;
-
-    for (auto& patch : *patches) {
-        if (type == FoodSourceType::TREE_FRUIT || type == FoodSourceType::TREE_LEAF) {
-            if (patch.type != type) continue;
-        }
-
-        if (!patch.isAvailable()) continue;
-
-        float dist = glm::length(glm::vec2(patch.position.x - pos.x, patch.position.z - pos.z));
-        if (dist < nearestDist) {
-            nearestDist = dist;
-            nearest = &patch;
-        }
-    }
-
-    return nearest;
 }
 
 std::vector<glm::vec3> ProducerSystem::getGrassPositions() const {
     std::vector<glm::vec3> positions;
-    for (const auto& patch : grassPatches) {
-        if (patch.isAvailable()) {
-            positions.push_back(patch.position);
-        }
-    }
+    grassPatches.appendAvailablePositions(positions);
     return positions;
 }
 
 std::vector<glm::vec3> ProducerSystem::getBushPositions() const {
     std::vector<glm::vec3> positions;
-    for (const auto& patch : bushPatches) {
-        if (patch.isAvailable()) {
-            positions.push_back(patch.position);
-        }
-    }
+    bushPatches.appendAvailablePositions(positions);
     return positions;
 }
 
 std::vector<glm::vec3> ProducerSystem::getTreeFruitPositions() const {
     std::vector<glm::vec3> positions;
-    for (const auto& patch : treePatches) {
-        if (patch.type == FoodSourceType::TREE_FRUIT && patch.isAvailable()) {
-            positions.push_back(patch.position);
-        }
-    }
+    treePatches.appendAvailablePositions(positions, FoodSourceType::TREE_FRUIT);
     return positions;
 }
 
 std::vector<glm::vec3> ProducerSystem::getTreeLeafPositions() const {
     std::vector<glm::vec3> positions;
-    for (const auto& patch : treePatches) {
-        if (patch.type == FoodSourceType::TREE_LEAF && patch.isAvailable()) {
-            positions.push_back(patch.position);
-        }
-    }
+    treePatches.appendAvailablePositions(positions, FoodSourceType::TREE_LEAF);
     return positions;
 }
 
 std::vector<glm::vec3> ProducerSystem::getAllFoodPositions() const {
     std::vector<glm::vec3> positions;
-
-    for (const auto& patch : grassPatches) {
-        if (patch.isAvailable()) positions.push_back(patch.position);
-    }
-    for (const auto& patch : bushPatches) {
-        if (patch.isAvailable()) positions.push_back(patch.position);
-    }
-    for (const auto& patch : treePatches) {
-        if (patch.isAvailable()) positions.push_back(patch.position);
-    }
-
+    grassPatches.appendAvailablePositions(positions);
+    bushPatches.appendAvailablePositions(positions);
+    treePatches.appendAvailablePositions(positions);
     return positions;
 }
 
@@ -414,7 +532,7 @@ void ProducerSystem::addNutrients(const glm::vec3& position, float nitrogen, flo
     auto [i, j] = worldToSoilIndex(position.x, position.z);
 
     if (i >= 0 && i < gridResolution && j >= 0 && j < gridResolution) {
-        SoilTile& tile = soilGrid[i][j];
+        SoilTile& tile = soilGrid[static_cast<size_t>(i) * gridResolution + j];
         tile.nitrogen = std::min(100.0f, tile.nitrogen + nitrogen);
         tile.phosphorus = std::min(100.0f, tile.phosphorus + phosphorus);
         tile.organicMatter = std::min(100.0f, tile.organicMatter + organicMatter);
@@ -422,17 +540,18 @@ void ProducerSystem::addNutrients(const glm::vec3& position, float nitrogen, flo
 }
 
 SoilTile& ProducerSystem::getSoilAt(const glm::vec3& position) {
-    auto [i, j] = worldToSoilIndex(position.x, position.z);
-    i = std::clamp(i, 0, gridResolution - 1);
-    j = std::clamp(j, 0, gridResolution - 1);
-    return soilGrid[i][j];
+    return soilGrid[soilTileIndex(position)];
 }
 
 const SoilTile& ProducerSystem::getSoilAt(const glm::vec3& position) const {
+    return soilGrid[soilTileIndex(position)];
+}
+
+uint32_t ProducerSystem::soilTileIndex(const glm::vec3& position) const {
     auto [i, j] = worldToSoilIndex(position.x, position.z);
     i = std::clamp(i, 0, gridResolution - 1);
     j = std::clamp(j, 0, gridResolution - 1);
-    return soilGrid[i][j];
+    return static_cast<uint32_t>(i * gridResolution + j);
 }
 
 std::pair<int, int> ProducerSystem::worldToSoilIndex(float x, float z) const {
@@ -447,50 +566,21 @@ float ProducerSystem::getTotalBiomass() const {
 }
 
 float ProducerSystem::getGrassBiomass() const {
-    float total = 0.0f;
-    for (const auto& patch : grassPatches) {
-        total += patch.currentBiomass;
-    }
-    return total;
+    return grassPatches.getTotalBiomass();
 }
 
 float ProducerSystem::getBushBiomass() const {
-    float total = 0.0f;
-    for (const auto& patch : bushPatches) {
-        total += patch.currentBiomass;
-    }
-    return total;
+    return bushPatches.getTotalBiomass();
 }
 
 float ProducerSystem::getTreeBiomass() const {
-    float total = 0.0f;
-    for (const auto& patch : treePatches) {
-        total += patch.currentBiomass;
-    }
-    return total;
+    return treePatches.getTotalBiomass();
 }
 
 int ProducerSystem::getActivePatches() const {
-    int count = 0;
-    for (const auto& patch : grassPatches) {
-        if (patch.isAvailable()) count++;
-    }
-    for (const auto& patch : bushPatches) {
-        if (patch.isAvailable()) count++;
-    }
-    for (const auto& patch : treePatches) {
-        if (patch.isAvailable()) count++;
-    }
-    for (const auto& patch : planktonPatches) {
-        if (patch.isAvailable()) count++;
-    }
-    for (const auto& patch : algaePatches) {
-        if (patch.isAvailable()) count++;
-    }
-    for (const auto& patch : seaweedPatches) {
-        if (patch.isAvailable()) count++;
-    }
-    return count;
+    return grassPatches.getAvailableCount() + bushPatches.getAvailableCount() +
+           treePatches.getAvailableCount() + planktonPatches.getAvailableCount() +
+           algaePatches.getAvailableCount() + seaweedPatches.getAvailableCount();
 }
 
 // ============================================================================
@@ -500,7 +590,8 @@ int ProducerSystem::getActivePatches() const {
 void ProducerSystem::addDetritus(const glm::vec3& position, float amount) {
     auto [i, j] = worldToSoilIndex(position.x, position.z);
     if (i >= 0 && i < gridResolution && j >= 0 && j < gridResolution) {
-        soilGrid[i][j].detritus = std::min(100.0f, soilGrid[i][j].detritus + amount);
+        SoilTile& tile = soilGrid[static_cast<size_t>(i) * gridResolution + j];
+        tile.detritus = std::min(100.0f, tile.detritus + amount);
     }
 }
 
@@ -516,7 +607,7 @@ float ProducerSystem::getDetritusAt(const glm::vec3& position, float radius) con
             int i = centerI + di;
             int j = centerJ + dj;
             if (i >= 0 && i < gridResolution && j >= 0 && j < gridResolution) {
-                totalDetritus += soilGrid[i][j].detritus;
+                totalDetritus += soilGrid[static_cast<size_t>(i) * gridResolution + j].detritus;
                 count++;
             }
         }
@@ -528,13 +619,14 @@ float ProducerSystem::getDetritusAt(const glm::vec3& position, float radius) con
 float ProducerSystem::consumeDetritus(const glm::vec3& position, float amount) {
     auto [i, j] = worldToSoilIndex(position.x, position.z);
     if (i >= 0 && i < gridResolution && j >= 0 && j < gridResolution) {
-        float available = soilGrid[i][j].detritus;
+        SoilTile& tile = soilGrid[static_cast<size_t>(i) * gridResolution + j];
+        float available = tile.detritus;
         float consumed = std::min(amount, available);
-        soilGrid[i][j].detritus -= consumed;
+        tile.detritus -= consumed;
 
         // Consuming detritus releases some nutrients back to soil
-        soilGrid[i][j].nitrogen += consumed * 0.2f;
-        soilGrid[i][j].organicMatter += consumed * 0.3f;
+        tile.nitrogen += consumed * 0.2f;
+        tile.organicMatter += consumed * 0.3f;
 
         return consumed;
     }
@@ -547,7 +639,7 @@ std::vector<glm::vec3> ProducerSystem::getDetritusHotspots() const {
 
     for (int i = 0; i < gridResolution; ++i) {
         for (int j = 0; j < gridResolution; ++j) {
-            if (soilGrid[i][j].detritus > threshold) {
+            if (soilGrid[static_cast<size_t>(i) * gridResolution + j].detritus > threshold) {
                 float x = (i - gridResolution / 2.0f) * soilTileSize;
                 float z = (j - gridResolution / 2.0f) * soilTileSize;
                 float y = terrain->getHeight(x, z);
@@ -562,28 +654,24 @@ std::vector<glm::vec3> ProducerSystem::getDetritusHotspots() const {
 void ProducerSystem::updateDetritus(float deltaTime) {
     // Detritus slowly converts to nutrients and organic matter
     // Also naturally accumulates from plant death/leaf fall
-    for (int i = 0; i < gridResolution; ++i) {
-        for (int j = 0; j < gridResolution; ++j) {
-            SoilTile& tile = soilGrid[i][j];
-
-            // Detritus decay: converts to nutrients over time
-            if (tile.detritus > 5.0f) {
-                float decayRate = 0.01f * deltaTime;  // 1% per second base
-                // Faster decay in warm, moist conditions
-                decayRate *= (0.5f + tile.moisture / 200.0f);
-
-                float decayed = tile.detritus * decayRate;
-                tile.detritus -= decayed;
-                tile.nitrogen += decayed * 0.3f;
-                tile.phosphorus += decayed * 0.15f;
-                tile.organicMatter += decayed * 0.4f;
-            }
-
-            // Natural detritus accumulation (leaf fall, dead roots) - very slow
-            // Higher near plants
-            tile.detritus += 0.001f * deltaTime;
-            tile.detritus = std::min(100.0f, tile.detritus);
+    for (SoilTile& tile : soilGrid) {
+        // Detritus decay: converts to nutrients over time
+        if (tile.detritus > 5.0f) {
+            float decayRate = 0.01f * deltaTime;  // 1% per second base
+            // Faster decay in warm, moist conditions
+            decayRate *= (0.5f + tile.moisture / 200.0f);
+
+            float decayed = tile.detritus * decayRate;
+            tile.detritus -= decayed;
+            tile.nitrogen += decayed * 0.3f;
+            tile.phosphorus += decayed * 0.15f;
+            tile.organicMatter += decayed * 0.4f;
         }
+
+        // Natural detritus accumulation (leaf fall, dead roots) - very slow
+        // Higher near plants
+        tile.detritus += 0.001f * deltaTime;
+        tile.detritus = std::min(100.0f, tile.detritus);
     }
 }
 
@@ -630,7 +718,7 @@ void ProducerSystem::updateSeasonalBlooms(float deltaTime, const SeasonManager*
                 // Add extra detritus during fall (leaf drop)
                 for (int i = 0; i < gridResolution; i += 5) {
                     for (int j = 0; j < gridResolution; j += 5) {
-                        soilGrid[i][j].detritus += 0.1f * deltaTime;
+                        soilGrid[static_cast<size_t>(i) * gridResolution + j].detritus += 0.1f * deltaTime;
                     }
                 }
             }
@@ -697,7 +785,7 @@ void ProducerSystem::generateAquaticPatches(unsigned int seed) {
             patch.soilNitrogen = 50.0f;
             patch.soilMoisture = 100.0f;
 
-            planktonPatches.push_back(patch);
+            planktonPatches.add(patch, soilTileIndex(patch.position));
         }
     }
 
@@ -734,7 +822,7 @@ void ProducerSystem::generateAquaticPatches(unsigned int seed) {
             patch.soilNitrogen = 50.0f;
             patch.soilMoisture = 100.0f;
 
-            algaePatches.push_back(patch);
+            algaePatches.add(patch, soilTileIndex(patch.position));
         }
     }
 
@@ -771,7 +859,7 @@ void ProducerSystem::generateAquaticPatches(unsigned int seed) {
             patch.soilNitrogen = 50.0f;
             patch.soilMoisture = 100.0f;
 
-            seaweedPatches.push_back(patch);
+            seaweedPatches.add(patch, soilTileIndex(patch.position));
         }
     }
 
@@ -782,46 +870,26 @@ void ProducerSystem::generateAquaticPatches(unsigned int seed) {
 
 std::vector<glm::vec3> ProducerSystem::getPlanktonPositions() const {
     std::vector<glm::vec3> positions;
-    for (const auto& patch : planktonPatches) {
-        if (patch.isAvailable()) {
-            positions.push_back(patch.position);
-        }
-    }
+    planktonPatches.appendAvailablePositions(positions);
     return positions;
 }
 
 std::vector<glm::vec3> ProducerSystem::getAlgaePositions() const {
     std::vector<glm::vec3> positions;
-    for (const auto& patch : algaePatches) {
-        if (patch.isAvailable()) {
-            positions.push_back(patch.position);
-        }
-    }
+    algaePatches.appendAvailablePositions(positions);
     return positions;
 }
 
 std::vector<glm::vec3> ProducerSystem::getSeaweedPositions() const {
     std::vector<glm::vec3> positions;
-    for (const auto& patch : seaweedPatches) {
-        if (patch.isAvailable()) {
-            positions.push_back(patch.position);
-        }
-    }
+    seaweedPatches.appendAvailablePositions(positions);
     return positions;
 }
 
 std::vector<glm::vec3> ProducerSystem::getAllAquaticFoodPositions() const {
     std::vector<glm::vec3> positions;
-
-    for (const auto& patch : planktonPatches) {
-        if (patch.isAvailable()) positions.push_back(patch.position);
-    }
-    for (const auto& patch : algaePatches) {
-        if (patch.isAvailable()) positions.push_back(patch.position);
-    }
-    for (const auto& patch : seaweedPatches) {
-        if (patch.isAvailable()) positions.push_back(patch.position);
-    }
-
+    planktonPatches.appendAvailablePositions(positions);
+    algaePatches.appendAvailablePositions(positions);
+    seaweedPatches.appendAvailablePositions(positions);
     return positions;
 }
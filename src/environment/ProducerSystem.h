@@ -2,13 +2,16 @@
 
 #include "../entities/CreatureType.h"  // For shared FoodSourceType enum
 #include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <memory>
 
 class Terrain;
 class SeasonManager;
 
-// A consumable food patch with growth dynamics
+// A consumable food patch with growth dynamics. Used to describe patches
+// when generating them; live state is kept in ProducerPatches.
 struct FoodPatch {
     glm::vec3 position;
     FoodSourceType type;
@@ -52,6 +55,76 @@ struct SoilTile {
     }
 };
 
+// Growth behaviour shared by every patch of one producer category
+struct PatchGrowthParams {
+    float pressureDecay;        // Consumption pressure recovered per second
+    bool soilLimited;           // Regrowth scaled by the local soil tile
+    bool pressureLimitsGrowth;  // Grazing pressure slows regrowth
+};
+
+// ============================================================================
+// PRODUCER PATCHES
+// ============================================================================
+// Food patches of one producer category in struct-of-arrays form. Once
+// finalize() has run, patches are ordered by the uniform grid cell they fall
+// in, and each cell's patches are contiguous, so a nearest-patch query only
+// visits the few cells its range overlaps. Growth runs as SIMD sweeps over
+// the biomass, regrowth and nutrient columns.
+//
+// Patches are only added at generation time; indices stay valid afterwards.
+
+class ProducerPatches {
+public:
+    size_t size() const { return biomass.size(); }
+    bool empty() const { return biomass.empty(); }
+
+    glm::vec3 getPosition(size_t i) const { return glm::vec3(posX[i], posY[i], posZ[i]); }
+    FoodSourceType getType(size_t i) const { return types[i]; }
+    float getBiomass(size_t i) const { return biomass[i]; }
+    float getMaxBiomass(size_t i) const { return maxBiomass[i]; }
+    bool isAvailable(size_t i) const { return biomass[i] > 0.1f; }
+
+    // Generation: add() patches, then finalize() once to bucket them
+    void clear();
+    void add(const FoodPatch& patch, uint32_t soilTile);
+    void finalize(float worldMin, float worldSize, float cellSize);
+
+    // Nearest available patch within range, or -1. With matchType set only
+    // patches of exactly that type count (trees mix fruit and leaves).
+    int findNearest(float x, float z, float range, FoodSourceType type, bool matchType) const;
+
+    // Remove up to amount biomass from patch i; returns the energy gained
+    float consume(size_t i, float amount);
+
+    // soilGrowth: per soil tile growth multiplier (flat soil grid order)
+    void grow(const float* soilGrowth, float seasonMultiplier, const PatchGrowthParams& params, float deltaTime);
+
+    void scale(float factor);
+    float getTotalBiomass() const;
+    int getAvailableCount() const;
+    void appendAvailablePositions(std::vector<glm::vec3>& out) const;
+    void appendAvailablePositions(std::vector<glm::vec3>& out, FoodSourceType type) const;
+
+private:
+    std::vector<float> posX, posY, posZ;
+    std::vector<float> biomass;         // Current available food (0-maxBiomass)
+    std::vector<float> maxBiomass;
+    std::vector<float> regrowth;        // Biomass units per second at full nutrients
+    std::vector<float> energyPerUnit;
+    std::vector<float> pressure;        // How heavily each patch is being grazed
+    std::vector<float> nutrients;       // Growth multiplier gathered from soil each tick
+    std::vector<uint32_t> soilTiles;    // Flat soil grid index per patch
+    std::vector<FoodSourceType> types;
+
+    // Patches in grid cell c are [cellStart[c], cellStart[c + 1])
+    std::vector<uint32_t> cellStart;
+    float gridMin = 0.0f;
+    float cellSize = 1.0f;
+    int gridCells = 0;
+
+    int cellCoord(float world) const;
+};
+
 class ProducerSystem {
 public:
     ProducerSystem(Terrain* terrain, int gridResolution = 50);
@@ -102,28 +175,32 @@ class ProducerSystem {
     void applyBiomassScale(float scale);
     
     // For rendering
-    const std::vector<FoodPatch>& getGrassPatches() const { return grassPatches; }
-    const std::vector<FoodPatch>& getBushPatches() const { return bushPatches; }
-    const std::vector<FoodPatch>& getTreePatches() const { return treePatches; }
-    const std::vector<FoodPatch>& getPlanktonPatches() const { return planktonPatches; }
-    const std::vector<FoodPatch>& getAlgaePatches() const { return algaePatches; }
-    const std::vector<FoodPatch>& getSeaweedPatches() const { return seaweedPatches; }
+    const ProducerPatches& getGrassPatches() const { return grassPatches; }
+    const ProducerPatches& getBushPatches() const { return bushPatches; }
+    const ProducerPatches& getTreePatches() const { return treePatches; }
+    const ProducerPatches& getPlanktonPatches() const { return planktonPatches; }
+    const ProducerPatches& getAlgaePatches() const { return algaePatches; }
+    const ProducerPatches& getSeaweedPatches() const { return seaweedPatches; }
 
 private:
     Terrain* terrain;
     int gridResolution;
     
-    std::vector<FoodPatch> grassPatches;
-    std::vector<FoodPatch> bushPatches;
-    std::vector<FoodPatch> treePatches;
+    ProducerPatches grassPatches;
+    ProducerPatches bushPatches;
+    ProducerPatches treePatches;
 
     // Aquatic food patches
-    std::vector<FoodPatch> planktonPatches;  // Floating in water column
-    std::vector<FoodPatch> algaePatches;     // On sea floor/rocks
-    std::vector<FoodPatch> seaweedPatches;   // Larger underwater plants
+    ProducerPatches planktonPatches;  // Floating in water column
+    ProducerPatches algaePatches;     // On sea floor/rocks
+    ProducerPatches seaweedPatches;   // Larger underwater plants
+
+    // World units per patch lookup cell; a 10 unit feeding range spans at most 3x3 cells
+    static constexpr float PATCH_CELL_SIZE = 16.0f;
     
-    // Soil nutrient grid
-    std::vector<std::vector<SoilTile>> soilGrid;
+    // Soil nutrient grid, flat: tile (i, j) at i * gridResolution + j
+    std::vector<SoilTile> soilGrid;
+    std::vector<float> soilGrowth;  // Per-tile growth multiplier, refreshed each update
     float soilTileSize;
     
     void generateGrassPatches(unsigned int seed);
@@ -143,7 +220,10 @@ class ProducerSystem {
 
     // Convert world position to soil grid index
     std::pair<int, int> worldToSoilIndex(float x, float z) const;
+    // Flat soil grid index for a world position, clamped to the grid
+    uint32_t soilTileIndex(const glm::vec3& position) const;
 
-    // Find nearest food patch of type within range
-    FoodPatch* findNearestPatch(const glm::vec3& pos, FoodSourceType type, float range);
+    // Patch store holding a food type, or nullptr
+    ProducerPatches* patchesFor(FoodSourceType type);
+    void finalizePatches();
 };
@@ -6,6 +6,7 @@
 #endif
 #include <glm/gtc/matrix_transform.hpp>
 #include "TerrainSampler.h"
+#include "TerrainField.h"
 #include <cmath>
 #include <algorithm>
 #include <iostream>
@@ -149,20 +150,27 @@ void Terrain::initializeDX12(DX12Device* device, ID3D12PipelineState* pso, ID3D1
 }
 
 void Terrain::generate(unsigned int seed) {
+    generateHeightField(seed);
+    buildMesh();
+}
+
+void Terrain::generateHeightField(unsigned int /*seed*/) {
     heightMap.resize(width * depth);
     waterLevel = TerrainSampler::WATER_LEVEL;
 
-    // Generate height map using the shared terrain noise profile
+    // Generate height map using the shared terrain noise profile, a row at a time
+    std::vector<float> rowX(width);
+    std::vector<float> rowZ(width);
     for (int z = 0; z < depth; z++) {
         for (int x = 0; x < width; x++) {
-            float worldX = (x - width / 2.0f) * scale;
-            float worldZ = (z - depth / 2.0f) * scale;
-            float height = TerrainSampler::SampleHeightNormalized(worldX, worldZ);
-
-            heightMap[z * width + x] = height;
+            rowX[x] = (x - width / 2.0f) * scale;
+            rowZ[x] = (z - depth / 2.0f) * scale;
         }
+        TerrainSampler::SampleHeightNormalizedBatch(rowX.data(), rowZ.data(), &heightMap[z * width], width);
     }
+}
 
+void Terrain::buildMesh() {
     setupMesh();
 }
 
@@ -486,6 +494,10 @@ float Terrain::getHeight(float x, float z) const {
         return 0.0f;
     }
 
+    if (terrainField) {
+        return terrainField->getHeight(x, z);
+    }
+
     int x0 = static_cast<int>(std::floor(gridXf));
     int z0 = static_cast<int>(std::floor(gridZf));
     int x1 = std::min(x0 + 1, width - 1);
@@ -527,6 +539,11 @@ bool Terrain::getHeightSafe(float x, float z, float& outHeight) const {
         return false;
     }
 
+    if (terrainField) {
+        outHeight = terrainField->getHeight(x, z);
+        return true;
+    }
+
     int x0 = static_cast<int>(std::floor(gridXf));
     int z0 = static_cast<int>(std::floor(gridZf));
     int x1 = std::min(x0 + 1, width - 1);
@@ -586,6 +603,10 @@ bool Terrain::isWater(float x, float z) const {
 }
 
 glm::vec3 Terrain::getNormal(float x, float z) const {
+    if (terrainField) {
+        return terrainField->sample(x, z).normal;
+    }
+
     // Compute normal from surrounding height samples using central differences
     float eps = scale * 0.5f;  // Half grid step
     float hL = getHeight(x - eps, z);
@@ -602,6 +623,10 @@ glm::vec3 Terrain::getNormal(float x, float z) const {
     return normal;
 }
 
+void Terrain::setTerrainField(const TerrainField* field) {
+    terrainField = (field && field->isBaked()) ? field : nullptr;
+}
+
 glm::vec3 Terrain::getTerrainColor(float height) {
     // Water
     if (height < TerrainSampler::WATER_LEVEL) {
@@ -11,6 +11,7 @@
 #include "../graphics/DX12Device.h"
 struct ID3D12PipelineState;
 struct ID3D12RootSignature;
+class TerrainField;
 
 using Microsoft::WRL::ComPtr;
 
@@ -31,6 +32,11 @@ class Terrain {
 
     void generate(unsigned int seed);
 
+    // generate() in two steps: the height field is pure CPU work and safe to
+    // build on worker threads; the mesh/GPU upload must run on the render thread
+    void generateHeightField(unsigned int seed);
+    void buildMesh();
+
     // Render terrain using the provided command list
     // Caller must have already set the PSO and root signature
     void render(ID3D12GraphicsCommandList* commandList);
@@ -74,6 +80,14 @@ class Terrain {
      */
     glm::vec3 getNormal(float x, float z) const;
 
+    /**
+     * Answer height, water and normal queries from a baked TerrainField
+     * covering the same world extent instead of this terrain's own height
+     * map. Pass nullptr to go back to the height map.
+     */
+    void setTerrainField(const TerrainField* field);
+    const TerrainField* getTerrainField() const { return terrainField; }
+
     // DX12 buffer views (for advanced use cases)
     D3D12_VERTEX_BUFFER_VIEW getVertexBufferView() const { return vertexBufferView; }
     D3D12_INDEX_BUFFER_VIEW getIndexBufferView() const { return indexBufferView; }
@@ -86,6 +100,7 @@ class Terrain {
 
     std::vector<float> heightMap;
     unsigned int indexCount;
+    const TerrainField* terrainField = nullptr;
 
     // DX12 resources
     DX12Device* dx12Device = nullptr;
@@ -1,4 +1,6 @@
 #include "TerrainErosion.h"
+#include "PlanetSeed.h"
+#include "../utils/ThreadPool.h"
 #include <cmath>
 #include <algorithm>
 #include <numeric>
@@ -104,51 +106,73 @@ void TerrainErosion::setSeed(unsigned int seed) {
     rng.seed(seed);
 }
 
-void TerrainErosion::initializeErosionBrush(int radius, int mapWidth, int mapDepth) {
-    erosionBrushWeights.clear();
-    erosionBrushIndices.clear();
+void TerrainErosion::initializeErosionBrush(int radius) {
+    if (erosionBrush.radius == radius) return;
 
-    int brushSize = (2 * radius + 1) * (2 * radius + 1);
-    erosionBrushWeights.resize(mapWidth * mapDepth);
-    erosionBrushIndices.resize(mapWidth * mapDepth);
+    erosionBrush.radius = radius;
+    erosionBrush.offsets.clear();
+    erosionBrush.weights.clear();
 
-    // Precompute weights and indices for each cell
-    for (int z = 0; z < mapDepth; z++) {
-        for (int x = 0; x < mapWidth; x++) {
-            int cellIndex = z * mapWidth + x;
-
-            std::vector<float>& weights = erosionBrushWeights[cellIndex];
-            std::vector<glm::ivec2>& indices = erosionBrushIndices[cellIndex];
-
-            float weightSum = 0.0f;
-
-            for (int dz = -radius; dz <= radius; dz++) {
-                for (int dx = -radius; dx <= radius; dx++) {
-                    int nx = x + dx;
-                    int nz = z + dz;
-
-                    // Check bounds
-                    if (nx >= 0 && nx < mapWidth && nz >= 0 && nz < mapDepth) {
-                        float dist = std::sqrt(static_cast<float>(dx * dx + dz * dz));
-                        if (dist <= radius) {
-                            float weight = 1.0f - dist / radius;
-                            weight = weight * weight; // Quadratic falloff
-                            weights.push_back(weight);
-                            indices.push_back({nx, nz});
-                            weightSum += weight;
-                        }
-                    }
-                }
+    float weightSum = 0.0f;
+    for (int dz = -radius; dz <= radius; dz++) {
+        for (int dx = -radius; dx <= radius; dx++) {
+            float dist = std::sqrt(static_cast<float>(dx * dx + dz * dz));
+            if (dist <= radius) {
+                float weight = radius > 0 ? 1.0f - dist / radius : 1.0f;
+                weight = weight * weight; // Quadratic falloff
+                erosionBrush.offsets.push_back({dx, dz});
+                erosionBrush.weights.push_back(weight);
+                weightSum += weight;
             }
+        }
+    }
 
-            // Normalize weights
-            if (weightSum > 0.0f) {
-                for (float& w : weights) {
-                    w /= weightSum;
-                }
+    // Normalize weights
+    if (weightSum > 0.0f) {
+        for (float& w : erosionBrush.weights) {
+            w /= weightSum;
+        }
+    }
+}
+
+float TerrainErosion::erodeWithBrush(Heightmap& heightmap, int cx, int cz, float amount) const {
+    const int mapWidth = heightmap.getWidth();
+    const int mapDepth = heightmap.getDepth();
+    const int radius = erosionBrush.radius;
+    std::vector<float>& data = heightmap.getData();
+
+    // Interior cells use the stencil as-is; edge cells renormalize over the
+    // taps that land inside the map, matching a per-cell clipped brush.
+    float scale = 1.0f;
+    bool clipped = cx - radius < 0 || cx + radius >= mapWidth ||
+                   cz - radius < 0 || cz + radius >= mapDepth;
+    if (clipped) {
+        float inBounds = 0.0f;
+        for (size_t j = 0; j < erosionBrush.offsets.size(); j++) {
+            int ex = cx + erosionBrush.offsets[j].x;
+            int ez = cz + erosionBrush.offsets[j].y;
+            if (ex >= 0 && ex < mapWidth && ez >= 0 && ez < mapDepth) {
+                inBounds += erosionBrush.weights[j];
             }
         }
+        if (inBounds <= 0.0f) return 0.0f;
+        scale = 1.0f / inBounds;
     }
+
+    float eroded = 0.0f;
+    for (size_t j = 0; j < erosionBrush.offsets.size(); j++) {
+        int ex = cx + erosionBrush.offsets[j].x;
+        int ez = cz + erosionBrush.offsets[j].y;
+        if (clipped && (ex < 0 || ex >= mapWidth || ez < 0 || ez >= mapDepth)) continue;
+
+        float& currentHeight = data[ez * mapWidth + ex];
+
+        // Don't erode below 0
+        float actualErode = std::min(amount * erosionBrush.weights[j] * scale, currentHeight);
+        currentHeight -= actualErode;
+        eroded += actualErode;
+    }
+    return eroded;
 }
 
 void TerrainErosion::simulateHydraulicErosion(Heightmap& heightmap, int iterations) {
@@ -158,125 +182,175 @@ void TerrainErosion::simulateHydraulicErosion(Heightmap& heightmap, int iteratio
 }
 
 void TerrainErosion::simulateHydraulicErosion(Heightmap& heightmap, const HydraulicErosionParams& params) {
-    int mapWidth = heightmap.getWidth();
-    int mapDepth = heightmap.getDepth();
+    const int mapWidth = heightmap.getWidth();
+    const int mapDepth = heightmap.getDepth();
+    if (mapWidth < 3 || mapDepth < 3 || params.numIterations <= 0) return;
 
-    // Initialize erosion brush
-    initializeErosionBrush(params.erosionRadius, mapWidth, mapDepth);
+    initializeErosionBrush(params.erosionRadius);
 
     reportProgress(0.0f, "Hydraulic erosion");
 
-    std::uniform_real_distribution<float> distX(0.0f, static_cast<float>(mapWidth - 2));
-    std::uniform_real_distribution<float> distZ(0.0f, static_cast<float>(mapDepth - 2));
-
+    // Every droplet gets its own seed, so the result depends only on the
+    // erosion seed, never on thread count or scheduling.
+    const uint32_t baseSeed = rng();
+
+    // Droplets are binned into square tiles by start position. A droplet can
+    // only touch cells within 'reach' of its start, so with tiles at least
+    // 2 * reach wide, tiles of the same 2x2 colour never touch the same cells
+    // and can run concurrently. Colours run one after another, and droplets
+    // within a tile run in index order, which keeps the output deterministic.
+    const int reach = std::max(params.maxDropletLifetime, 0) + std::max(params.erosionRadius, 0) + 2;
+    const int tileSize = std::max(2 * reach, 32);
+    const int tilesX = (mapWidth + tileSize - 1) / tileSize;
+    const int tilesZ = (mapDepth + tileSize - 1) / tileSize;
+    const size_t tileCount = static_cast<size_t>(tilesX) * tilesZ;
+
+    // Counting sort of droplet indices by start tile
+    std::vector<uint32_t> dropletTile(params.numIterations);
+    std::vector<uint32_t> tileStart(tileCount + 1, 0);
     for (int i = 0; i < params.numIterations; i++) {
-        // Random starting position
-        float posX = distX(rng);
-        float posZ = distZ(rng);
-
-        float dirX = 0.0f;
-        float dirZ = 0.0f;
-        float speed = params.initialSpeed;
-        float water = params.initialWaterVolume;
-        float sediment = 0.0f;
-
-        for (int lifetime = 0; lifetime < params.maxDropletLifetime; lifetime++) {
-            int nodeX = static_cast<int>(posX);
-            int nodeZ = static_cast<int>(posZ);
-            int dropletIndex = nodeZ * mapWidth + nodeX;
-
-            // Get height and gradient at current position
-            float height = heightmap.getBilinear(posX, posZ);
-            glm::vec2 gradient = heightmap.getGradient(posX, posZ);
-
-            // Calculate new direction (blend old direction with gradient)
-            dirX = dirX * params.inertia - gradient.x * (1.0f - params.inertia);
-            dirZ = dirZ * params.inertia - gradient.y * (1.0f - params.inertia);
-
-            // Normalize direction
-            float len = std::sqrt(dirX * dirX + dirZ * dirZ);
-            if (len > 0.0001f) {
-                dirX /= len;
-                dirZ /= len;
-            } else {
-                // Random direction if on flat terrain
-                float angle = std::uniform_real_distribution<float>(0.0f, 6.28318f)(rng);
-                dirX = std::cos(angle);
-                dirZ = std::sin(angle);
-            }
+        std::mt19937 dropletRng(PlanetSeed::getSubSeed(baseSeed, static_cast<uint32_t>(i)));
+        float posX = std::uniform_real_distribution<float>(0.0f, static_cast<float>(mapWidth - 2))(dropletRng);
+        float posZ = std::uniform_real_distribution<float>(0.0f, static_cast<float>(mapDepth - 2))(dropletRng);
+        int tx = std::min(static_cast<int>(posX) / tileSize, tilesX - 1);
+        int tz = std::min(static_cast<int>(posZ) / tileSize, tilesZ - 1);
+        dropletTile[i] = static_cast<uint32_t>(tz * tilesX + tx);
+        tileStart[dropletTile[i] + 1]++;
+    }
+    for (size_t t = 0; t < tileCount; t++) {
+        tileStart[t + 1] += tileStart[t];
+    }
+    std::vector<uint32_t> tileDroplets(params.numIterations);
+    {
+        std::vector<uint32_t> cursor(tileStart.begin(), tileStart.end() - 1);
+        for (int i = 0; i < params.numIterations; i++) {
+            tileDroplets[cursor[dropletTile[i]]++] = static_cast<uint32_t>(i);
+        }
+    }
 
-            // Move droplet
-            posX += dirX;
-            posZ += dirZ;
+    auto runTile = [&](size_t tile) {
+        for (uint32_t k = tileStart[tile]; k < tileStart[tile + 1]; k++) {
+            uint32_t i = tileDroplets[k];
+            simulateDroplet(heightmap, params, PlanetSeed::getSubSeed(baseSeed, i));
+        }
+    };
+
+    int dropletsDone = 0;
+    std::vector<size_t> colourTiles;
+    for (int colour = 0; colour < 4; colour++) {
+        colourTiles.clear();
+        for (int tz = colour >> 1; tz < tilesZ; tz += 2) {
+            for (int tx = colour & 1; tx < tilesX; tx += 2) {
+                size_t tile = static_cast<size_t>(tz) * tilesX + tx;
+                if (tileStart[tile + 1] > tileStart[tile]) {
+                    colourTiles.push_back(tile);
+                    dropletsDone += static_cast<int>(tileStart[tile + 1] - tileStart[tile]);
+                }
+            }
+        }
 
-            // Check bounds
-            if (posX < 0 || posX >= mapWidth - 1 || posZ < 0 || posZ >= mapDepth - 1) {
-                break;
+        if (params.parallel) {
+            ThreadPool::shared().parallelFor(colourTiles.size(), 1, [&](size_t begin, size_t end) {
+                for (size_t t = begin; t < end; t++) {
+                    runTile(colourTiles[t]);
+                }
+            });
+        } else {
+            for (size_t tile : colourTiles) {
+                runTile(tile);
             }
+        }
 
-            // Get new height
-            float newHeight = heightmap.getBilinear(posX, posZ);
-            float heightDiff = newHeight - height;
+        reportProgress(static_cast<float>(dropletsDone) / params.numIterations, "Hydraulic erosion");
+    }
 
-            // Calculate sediment capacity
-            float sedimentCapacity = std::max(-heightDiff * speed * water * params.sedimentCapacityFactor,
-                                               params.minSedimentCapacity);
+    reportProgress(1.0f, "Hydraulic erosion complete");
+}
 
-            // Erode or deposit
-            if (sediment > sedimentCapacity || heightDiff > 0) {
-                // Deposit sediment
-                float depositAmount = (heightDiff > 0) ?
-                    std::min(heightDiff, sediment) :
-                    (sediment - sedimentCapacity) * params.depositSpeed;
+void TerrainErosion::simulateDroplet(Heightmap& heightmap, const HydraulicErosionParams& params, uint32_t seed) const {
+    const int mapWidth = heightmap.getWidth();
+    const int mapDepth = heightmap.getDepth();
+
+    // Same draw order as the binning pass, so the start position matches
+    std::mt19937 dropletRng(seed);
+    float posX = std::uniform_real_distribution<float>(0.0f, static_cast<float>(mapWidth - 2))(dropletRng);
+    float posZ = std::uniform_real_distribution<float>(0.0f, static_cast<float>(mapDepth - 2))(dropletRng);
+
+    float dirX = 0.0f;
+    float dirZ = 0.0f;
+    float speed = params.initialSpeed;
+    float water = params.initialWaterVolume;
+    float sediment = 0.0f;
+
+    for (int lifetime = 0; lifetime < params.maxDropletLifetime; lifetime++) {
+        int nodeX = static_cast<int>(posX);
+        int nodeZ = static_cast<int>(posZ);
+
+        // Get height and gradient at current position
+        float height = heightmap.getBilinear(posX, posZ);
+        glm::vec2 gradient = heightmap.getGradient(posX, posZ);
+
+        // Calculate new direction (blend old direction with gradient)
+        dirX = dirX * params.inertia - gradient.x * (1.0f - params.inertia);
+        dirZ = dirZ * params.inertia - gradient.y * (1.0f - params.inertia);
+
+        // Normalize direction
+        float len = std::sqrt(dirX * dirX + dirZ * dirZ);
+        if (len > 0.0001f) {
+            dirX /= len;
+            dirZ /= len;
+        } else {
+            // Random direction if on flat terrain
+            float angle = std::uniform_real_distribution<float>(0.0f, 6.28318f)(dropletRng);
+            dirX = std::cos(angle);
+            dirZ = std::sin(angle);
+        }
 
-                sediment -= depositAmount;
+        // Move droplet
+        posX += dirX;
+        posZ += dirZ;
 
-                // Deposit at old position using brush
-                if (nodeX >= 0 && nodeX < mapWidth && nodeZ >= 0 && nodeZ < mapDepth) {
-                    depositAt(heightmap, static_cast<float>(nodeX), static_cast<float>(nodeZ), depositAmount);
-                }
-            } else {
-                // Erode terrain
-                float erodeAmount = std::min((sedimentCapacity - sediment) * params.erodeSpeed, -heightDiff);
-
-                // Erode using brush
-                if (dropletIndex >= 0 && static_cast<size_t>(dropletIndex) < erosionBrushWeights.size()) {
-                    const auto& weights = erosionBrushWeights[dropletIndex];
-                    const auto& indices = erosionBrushIndices[dropletIndex];
-
-                    for (size_t j = 0; j < weights.size(); j++) {
-                        float weightedErode = erodeAmount * weights[j];
-                        int ex = indices[j].x;
-                        int ez = indices[j].y;
-                        float currentHeight = heightmap.get(ex, ez);
-
-                        // Don't erode below 0
-                        float actualErode = std::min(weightedErode, currentHeight);
-                        heightmap.set(ex, ez, currentHeight - actualErode);
-                        sediment += actualErode;
-                    }
-                }
-            }
+        // Check bounds
+        if (posX < 0 || posX >= mapWidth - 1 || posZ < 0 || posZ >= mapDepth - 1) {
+            break;
+        }
 
-            // Update speed (accelerate downhill, decelerate uphill)
-            speed = std::sqrt(std::max(0.0f, speed * speed + heightDiff * params.gravity));
+        // Get new height
+        float newHeight = heightmap.getBilinear(posX, posZ);
+        float heightDiff = newHeight - height;
+
+        // Calculate sediment capacity
+        float sedimentCapacity = std::max(-heightDiff * speed * water * params.sedimentCapacityFactor,
+                                           params.minSedimentCapacity);
+
+        // Erode or deposit
+        if (sediment > sedimentCapacity || heightDiff > 0) {
+            // Deposit sediment
+            float depositAmount = (heightDiff > 0) ?
+                std::min(heightDiff, sediment) :
+                (sediment - sedimentCapacity) * params.depositSpeed;
+
+            sediment -= depositAmount;
+
+            // Deposit at old position
+            depositAt(heightmap, static_cast<float>(nodeX), static_cast<float>(nodeZ), depositAmount);
+        } else {
+            // Erode terrain using brush
+            float erodeAmount = std::min((sedimentCapacity - sediment) * params.erodeSpeed, -heightDiff);
+            sediment += erodeWithBrush(heightmap, nodeX, nodeZ, erodeAmount);
+        }
 
-            // Evaporate water
-            water *= (1.0f - params.evaporateSpeed);
+        // Update speed (accelerate downhill, decelerate uphill)
+        speed = std::sqrt(std::max(0.0f, speed * speed + heightDiff * params.gravity));
 
-            // Stop if water depleted
-            if (water < 0.01f) {
-                break;
-            }
-        }
+        // Evaporate water
+        water *= (1.0f - params.evaporateSpeed);
 
-        // Progress update
-        if (i % 5000 == 0) {
-            reportProgress(static_cast<float>(i) / params.numIterations, "Hydraulic erosion");
+        // Stop if water depleted
+        if (water < 0.01f) {
+            break;
         }
     }
-
-    reportProgress(1.0f, "Hydraulic erosion complete");
 }
 
 void TerrainErosion::simulateThermalErosion(Heightmap& heightmap, float talusAngle) {
@@ -373,7 +447,7 @@ void TerrainErosion::simulateFullErosion(Heightmap& heightmap, int hydraulicIter
     simulateThermalErosion(heightmap, thermalParams);
 }
 
-void TerrainErosion::depositAt(Heightmap& heightmap, float x, float z, float amount) {
+void TerrainErosion::depositAt(Heightmap& heightmap, float x, float z, float amount) const {
     // Simple single-point deposition
     int ix = static_cast<int>(x);
     int iz = static_cast<int>(z);
@@ -384,46 +458,6 @@ void TerrainErosion::depositAt(Heightmap& heightmap, float x, float z, float amo
     }
 }
 
-void TerrainErosion::erodeAt(Heightmap& heightmap, float x, float z, float amount, int radius) {
-    int cx = static_cast<int>(x);
-    int cz = static_cast<int>(z);
-
-    float totalWeight = 0.0f;
-
-    // Calculate total weight first
-    for (int dz = -radius; dz <= radius; dz++) {
-        for (int dx = -radius; dx <= radius; dx++) {
-            float dist = std::sqrt(static_cast<float>(dx * dx + dz * dz));
-            if (dist <= radius) {
-                float weight = 1.0f - dist / radius;
-                totalWeight += weight * weight;
-            }
-        }
-    }
-
-    if (totalWeight < 0.0001f) return;
-
-    // Apply erosion
-    for (int dz = -radius; dz <= radius; dz++) {
-        for (int dx = -radius; dx <= radius; dx++) {
-            int nx = cx + dx;
-            int nz = cz + dz;
-
-            if (nx >= 0 && nx < heightmap.getWidth() && nz >= 0 && nz < heightmap.getDepth()) {
-                float dist = std::sqrt(static_cast<float>(dx * dx + dz * dz));
-                if (dist <= radius) {
-                    float weight = 1.0f - dist / radius;
-                    weight = weight * weight / totalWeight;
-
-                    float h = heightmap.get(nx, nz);
-                    float erode = std::min(amount * weight, h);
-                    heightmap.set(nx, nz, h - erode);
-                }
-            }
-        }
-    }
-}
-
 void TerrainErosion::reportProgress(float progress, const std::string& stage) {
     if (progressCallback) {
         progressCallback(progress, stage);
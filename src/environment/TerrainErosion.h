@@ -2,6 +2,8 @@
 
 #include <vector>
 #include <random>
+#include <functional>
+#include <string>
 #include <glm/glm.hpp>
 
 // Erosion parameters for fine-tuning
@@ -20,6 +22,8 @@ struct HydraulicErosionParams {
     int erosionRadius = 3;           // Brush radius for erosion/deposition
     float initialWaterVolume = 1.0f;
     float initialSpeed = 1.0f;
+
+    bool parallel = true;            // Simulate droplets on the shared thread pool
 };
 
 struct ThermalErosionParams {
@@ -96,19 +100,26 @@ class TerrainErosion {
     std::mt19937 rng;
     ProgressCallback progressCallback;
 
-    // Precomputed erosion/deposition brush weights
-    std::vector<std::vector<float>> erosionBrushWeights;
-    std::vector<std::vector<glm::ivec2>> erosionBrushIndices;
+    // Erosion stencil for a given radius, shared by every map cell.
+    // Weights use quadratic falloff and are normalized over the full disc;
+    // cells near the map edge renormalize over their in-bounds taps.
+    struct ErosionBrush {
+        int radius = -1;
+        std::vector<glm::ivec2> offsets;
+        std::vector<float> weights;
+    };
+    ErosionBrush erosionBrush;
 
-    // Initialize brush for given radius
-    void initializeErosionBrush(int radius, int mapWidth, int mapDepth);
+    // Rebuild the brush if the radius changed
+    void initializeErosionBrush(int radius);
 
-    // Single droplet simulation step
-    void simulateDroplet(Heightmap& heightmap, const HydraulicErosionParams& params);
+    // Simulate a single droplet. Reads and writes stay within
+    // maxDropletLifetime + erosionRadius + 2 cells of the start position.
+    void simulateDroplet(Heightmap& heightmap, const HydraulicErosionParams& params, uint32_t seed) const;
 
     // Erode/deposit at position using brush
-    void erodeAt(Heightmap& heightmap, float x, float z, float amount, int radius);
-    void depositAt(Heightmap& heightmap, float x, float z, float amount);
+    float erodeWithBrush(Heightmap& heightmap, int cx, int cz, float amount) const;
+    void depositAt(Heightmap& heightmap, float x, float z, float amount) const;
 
     // Thermal erosion helpers
     void thermalErosionPass(Heightmap& heightmap, float talusAngle, float erosionRate);
@@ -0,0 +1,328 @@
+#include "TerrainField.h"
+#include "BiomeSystem.h"
+#include "../utils/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define TERRAIN_FIELD_PREFETCH 1
+#endif
+
+namespace {
+    // Queries resolved per prefetch pass in the batch paths
+    constexpr size_t QUERY_BLOCK = 64;
+
+    inline void prefetch(const void* address) {
+#if defined(TERRAIN_FIELD_PREFETCH)
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+        (void)address;
+#endif
+    }
+
+    inline int16_t packSnorm(float value) {
+        return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+    }
+
+    inline uint16_t packUnorm(float value) {
+        return static_cast<uint16_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 65535.0f));
+    }
+} // namespace
+
+// ============================================================================
+// Baking
+// ============================================================================
+
+void TerrainField::bake(const std::vector<float>& heightmap, int width, int height,
+                        float worldSize, float heightScale, float waterLevel) {
+    clear();
+    if (width <= 1 || height <= 1 || heightmap.size() < static_cast<size_t>(width) * height) {
+        return;
+    }
+
+    m_width = width;
+    m_height = height;
+    m_tilesX = (width + TILE_SIZE - 1) >> TILE_SHIFT;
+    const int tilesZ = (height + TILE_SIZE - 1) >> TILE_SHIFT;
+    m_worldSize = worldSize;
+    m_heightScale = heightScale;
+    m_waterLevel = waterLevel;
+    m_heightTiles.assign(static_cast<size_t>(m_tilesX) * tilesZ, HeightTile{});
+    m_surfaceTiles.assign(static_cast<size_t>(m_tilesX) * tilesZ, SurfaceTile{});
+
+    // World distance between neighbouring cells on each axis
+    const float cellSizeX = worldSize / static_cast<float>(width - 1);
+    const float cellSizeZ = worldSize / static_cast<float>(height - 1);
+
+    auto worldHeight = [&](int x, int z) {
+        return heightmap[static_cast<size_t>(z) * width + x] * heightScale;
+    };
+
+    // Rows are independent; chunks are whole tile rows so threads don't
+    // share cache lines
+    ThreadPool::shared().parallelFor(static_cast<size_t>(height), 2 * TILE_SIZE, [&](size_t begin, size_t end) {
+        for (int z = static_cast<int>(begin); z < static_cast<int>(end); ++z) {
+            const int zDown = std::max(z - 1, 0);
+            const int zUp = std::min(z + 1, height - 1);
+            const float spanZ = (zUp - zDown) * cellSizeZ;
+
+            for (int x = 0; x < width; ++x) {
+                const int xLeft = std::max(x - 1, 0);
+                const int xRight = std::min(x + 1, width - 1);
+                const float spanX = (xRight - xLeft) * cellSizeX;
+
+                // Central differences (one-sided at the map edge)
+                float dhdx = (worldHeight(xRight, z) - worldHeight(xLeft, z)) / spanX;
+                float dhdz = (worldHeight(x, zUp) - worldHeight(x, zDown)) / spanZ;
+                glm::vec3 normal = glm::normalize(glm::vec3(-dhdx, 1.0f, -dhdz));
+
+                heightAt(x, z) = heightmap[static_cast<size_t>(z) * width + x];
+                Surface& cell = surfaceAt(x, z);
+                cell.normalX = packSnorm(normal.x);
+                cell.normalZ = packSnorm(normal.z);
+                cell.slope = packUnorm(std::sqrt(dhdx * dhdx + dhdz * dhdz));
+                cell.biome = NO_BIOME;
+            }
+        }
+    });
+
+    bakeWaterDistance(heightmap);
+}
+
+void TerrainField::bakeWaterDistance(const std::vector<float>& heightmap) {
+    const int width = m_width;
+    const int height = m_height;
+    const float stepX = m_worldSize / static_cast<float>(width - 1);
+    const float stepZ = m_worldSize / static_cast<float>(height - 1);
+    const float stepDiagonal = std::sqrt(stepX * stepX + stepZ * stepZ);
+
+    // Two-pass chamfer transform: water cells seed 0, every other cell takes
+    // the cheapest already-visited neighbour plus the step to it
+    std::vector<float> distance(static_cast<size_t>(width) * height);
+    for (size_t i = 0; i < distance.size(); ++i) {
+        distance[i] = heightmap[i] < m_waterLevel ? 0.0f : MAX_WATER_DISTANCE;
+    }
+
+    auto relax = [&](float& d, int x, int z, float step) {
+        if (x >= 0 && x < width && z >= 0 && z < height) {
+            d = std::min(d, distance[static_cast<size_t>(z) * width + x] + step);
+        }
+    };
+
+    for (int z = 0; z < height; ++z) {
+        for (int x = 0; x < width; ++x) {
+            float& d = distance[static_cast<size_t>(z) * width + x];
+            relax(d, x - 1, z, stepX);
+            relax(d, x - 1, z - 1, stepDiagonal);
+            relax(d, x, z - 1, stepZ);
+            relax(d, x + 1, z - 1, stepDiagonal);
+        }
+    }
+    for (int z = height - 1; z >= 0; --z) {
+        for (int x = width - 1; x >= 0; --x) {
+            float& d = distance[static_cast<size_t>(z) * width + x];
+            relax(d, x + 1, z, stepX);
+            relax(d, x + 1, z + 1, stepDiagonal);
+            relax(d, x, z + 1, stepZ);
+            relax(d, x - 1, z + 1, stepDiagonal);
+        }
+    }
+
+    for (int z = 0; z < height; ++z) {
+        for (int x = 0; x < width; ++x) {
+            surfaceAt(x, z).waterDistance =
+                packUnorm(distance[static_cast<size_t>(z) * width + x] / MAX_WATER_DISTANCE);
+        }
+    }
+}
+
+void TerrainField::bakeBiomes(const BiomeSystem& biomes) {
+    const std::vector<BiomeCell>& biomeMap = biomes.getBiomeMap();
+    const int biomeWidth = biomes.getWidth();
+    const int biomeHeight = biomes.getHeight();
+    if (!isBaked() || biomeWidth <= 0 || biomeHeight <= 0 ||
+        biomeMap.size() < static_cast<size_t>(biomeWidth) * biomeHeight) {
+        return;
+    }
+
+    // Same-size maps copy straight across; otherwise use the nearest biome
+    // cell at the same normalized position, as BiomeSystem::queryBiome does
+    auto remap = [](int cell, int cells, int biomeCells) {
+        if (cells == biomeCells) return cell;
+        float u = static_cast<float>(cell) / static_cast<float>(cells - 1);
+        return std::clamp(static_cast<int>(u * (biomeCells - 1)), 0, biomeCells - 1);
+    };
+
+    for (int z = 0; z < m_height; ++z) {
+        const size_t biomeRow = static_cast<size_t>(remap(z, m_height, biomeHeight)) * biomeWidth;
+        for (int x = 0; x < m_width; ++x) {
+            const BiomeCell& biomeCell = biomeMap[biomeRow + remap(x, m_width, biomeWidth)];
+            surfaceAt(x, z).biome = static_cast<uint8_t>(biomeCell.primaryBiome);
+        }
+    }
+}
+
+void TerrainField::clear() {
+    m_heightTiles.clear();
+    m_heightTiles.shrink_to_fit();
+    m_surfaceTiles.clear();
+    m_surfaceTiles.shrink_to_fit();
+    m_width = 0;
+    m_height = 0;
+    m_tilesX = 0;
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+inline float TerrainField::toGrid(float world, int cells) const {
+    float u = world / m_worldSize + 0.5f;
+    u = std::max(0.0f, std::min(1.0f, u));
+    return u * (cells - 1);
+}
+
+inline float TerrainField::interpolate(float gridX, float gridZ, int& nearestX, int& nearestZ) const {
+    // Same arithmetic as TerrainSampler's heightmap path, so results match
+    // bit for bit. Grid coordinates are clamped non-negative, so truncation
+    // is the floor without a libm call.
+    int x0 = static_cast<int>(gridX);
+    int z0 = static_cast<int>(gridZ);
+    int x1 = std::min(x0 + 1, m_width - 1);
+    int z1 = std::min(z0 + 1, m_height - 1);
+
+    float tx = gridX - static_cast<float>(x0);
+    float tz = gridZ - static_cast<float>(z0);
+
+    float h00 = heightAt(x0, z0);
+    float h10 = heightAt(x1, z0);
+    float h01 = heightAt(x0, z1);
+    float h11 = heightAt(x1, z1);
+
+    nearestX = tx < 0.5f ? x0 : x1;
+    nearestZ = tz < 0.5f ? z0 : z1;
+
+    float hx0 = h00 + tx * (h10 - h00);
+    float hx1 = h01 + tx * (h11 - h01);
+    float h = hx0 + tz * (hx1 - hx0);
+    return std::max(0.0f, std::min(1.0f, h));
+}
+
+inline void TerrainField::fillSample(float gridX, float gridZ, TerrainFieldSample& out) const {
+    int nearestX, nearestZ;
+    float h = interpolate(gridX, gridZ, nearestX, nearestZ);
+    const Surface& cell = surfaceAt(nearestX, nearestZ);
+
+    float nx = cell.normalX * (1.0f / 32767.0f);
+    float nz = cell.normalZ * (1.0f / 32767.0f);
+
+    out.height = h * m_heightScale;
+    out.waterDepth = h < m_waterLevel ? (m_waterLevel - h) * m_heightScale : 0.0f;
+    out.normal = glm::vec3(nx, std::sqrt(std::max(0.0f, 1.0f - nx * nx - nz * nz)), nz);
+    out.distanceToWater = cell.waterDistance * (MAX_WATER_DISTANCE / 65535.0f);
+    out.slope = cell.slope * (1.0f / 65535.0f);
+    out.biome = cell.biome;
+}
+
+float TerrainField::getHeightNormalized(float worldX, float worldZ) const {
+    if (!isBaked()) return 0.0f;
+    int nearestX, nearestZ;
+    return interpolate(toGrid(worldX, m_width), toGrid(worldZ, m_height), nearestX, nearestZ);
+}
+
+float TerrainField::getHeight(float worldX, float worldZ) const {
+    return getHeightNormalized(worldX, worldZ) * m_heightScale;
+}
+
+bool TerrainField::isWater(float worldX, float worldZ) const {
+    return isBaked() && getHeightNormalized(worldX, worldZ) < m_waterLevel;
+}
+
+TerrainFieldSample TerrainField::sample(float worldX, float worldZ) const {
+    TerrainFieldSample result;
+    if (isBaked()) {
+        fillSample(toGrid(worldX, m_width), toGrid(worldZ, m_height), result);
+    }
+    return result;
+}
+
+inline void TerrainField::prefetchCells(float gridX, float gridZ, bool surface) const {
+    const int x = static_cast<int>(gridX);
+    const int z = static_cast<int>(gridZ);
+    const int zNext = std::min(z + 1, m_height - 1);
+    prefetch(&m_heightTiles[tileIndex(x, z)].heights[cellIndex(x, z)]);
+    prefetch(&m_heightTiles[tileIndex(x, zNext)].heights[cellIndex(x, zNext)]);
+    if (surface) {
+        prefetch(&surfaceAt(x, z));
+        prefetch(&surfaceAt(x, zNext));
+    }
+}
+
+// Batch queries resolve grid coordinates for a block and prefetch its tiles
+// first, so the block's cache misses overlap instead of each query waiting
+// on its own
+
+void TerrainField::sampleHeightsNormalized(const float* worldX, const float* worldZ, float* out, size_t count) const {
+    if (!isBaked()) {
+        std::fill(out, out + count, 0.0f);
+        return;
+    }
+
+    float gridX[QUERY_BLOCK];
+    float gridZ[QUERY_BLOCK];
+    int nearestX, nearestZ;
+    for (size_t base = 0; base < count; base += QUERY_BLOCK) {
+        const size_t n = std::min(QUERY_BLOCK, count - base);
+        for (size_t i = 0; i < n; ++i) {
+            gridX[i] = toGrid(worldX[base + i], m_width);
+            gridZ[i] = toGrid(worldZ[base + i], m_height);
+            prefetchCells(gridX[i], gridZ[i], false);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            out[base + i] = interpolate(gridX[i], gridZ[i], nearestX, nearestZ);
+        }
+    }
+}
+
+void TerrainField::sample(const float* worldX, const float* worldZ, TerrainFieldSample* out, size_t count) const {
+    if (!isBaked()) {
+        std::fill(out, out + count, TerrainFieldSample{});
+        return;
+    }
+
+    float gridX[QUERY_BLOCK];
+    float gridZ[QUERY_BLOCK];
+    for (size_t base = 0; base < count; base += QUERY_BLOCK) {
+        const size_t n = std::min(QUERY_BLOCK, count - base);
+        for (size_t i = 0; i < n; ++i) {
+            gridX[i] = toGrid(worldX[base + i], m_width);
+            gridZ[i] = toGrid(worldZ[base + i], m_height);
+            prefetchCells(gridX[i], gridZ[i], true);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            fillSample(gridX[i], gridZ[i], out[base + i]);
+        }
+    }
+}
+
+void TerrainField::sample(const glm::vec3* positions, TerrainFieldSample* out, size_t count) const {
+    if (!isBaked()) {
+        std::fill(out, out + count, TerrainFieldSample{});
+        return;
+    }
+
+    float gridX[QUERY_BLOCK];
+    float gridZ[QUERY_BLOCK];
+    for (size_t base = 0; base < count; base += QUERY_BLOCK) {
+        const size_t n = std::min(QUERY_BLOCK, count - base);
+        for (size_t i = 0; i < n; ++i) {
+            gridX[i] = toGrid(positions[base + i].x, m_width);
+            gridZ[i] = toGrid(positions[base + i].z, m_height);
+            prefetchCells(gridX[i], gridZ[i], true);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            fillSample(gridX[i], gridZ[i], out[base + i]);
+        }
+    }
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class BiomeSystem;
+
+// ============================================================================
+// TERRAIN FIELD
+// ============================================================================
+// Baked, read-only view of the generated terrain for runtime queries.
+// Height, surface normal, slope, distance to water and biome are precomputed
+// per heightmap cell and stored in 8x8 cell tiles aligned to cache lines, so
+// a query touches one or two tiles instead of re-deriving slope, normals and
+// shoreline distance from neighbouring height samples.
+//
+// Coordinates follow TerrainSampler's heightmap mapping (world origin at the
+// map centre, worldSize across, clamped at the edges), and heights are
+// interpolated with the same arithmetic, so getHeightNormalized() returns
+// exactly what TerrainSampler::SampleHeightNormalized() returns for the
+// heightmap the field was baked from. Water depth is derived from that
+// interpolated height, which keeps it consistent with isWater().
+//
+// Normals, slope, distance to water and biome come from the nearest cell.
+
+// Result of a full terrain query
+struct TerrainFieldSample {
+    float height = 0.0f;            // World units
+    float waterDepth = 0.0f;        // World units below the water surface, 0 on land
+    float distanceToWater = 0.0f;   // World units to the nearest water cell, saturating
+    glm::vec3 normal{0.0f, 1.0f, 0.0f};
+    float slope = 0.0f;             // Rise over run, clamped: 0 = flat, 1 = 45 degrees
+    uint8_t biome = 0xFF;           // BiomeType, or TerrainField::NO_BIOME
+
+    bool isWater() const { return waterDepth > 0.0f; }
+};
+
+class TerrainField {
+public:
+    static constexpr int TILE_SHIFT = 3;
+    static constexpr int TILE_SIZE = 1 << TILE_SHIFT;   // Cells per tile side
+    static constexpr uint8_t NO_BIOME = 0xFF;
+    static constexpr float MAX_WATER_DISTANCE = 256.0f; // World units; farther cells saturate
+
+    // Bake from a normalized [0, 1] heightmap (width * height, row-major)
+    void bake(const std::vector<float>& heightmap, int width, int height,
+              float worldSize, float heightScale, float waterLevel);
+
+    // Fill per-cell biome IDs from a generated biome map. Call after bake().
+    void bakeBiomes(const BiomeSystem& biomes);
+
+    void clear();
+    bool isBaked() const { return !m_heightTiles.empty(); }
+
+    // Single-point queries
+    float getHeightNormalized(float worldX, float worldZ) const;
+    float getHeight(float worldX, float worldZ) const;
+    bool isWater(float worldX, float worldZ) const;
+    TerrainFieldSample sample(float worldX, float worldZ) const;
+
+    // Batch queries: out[i] is the single-point result for (worldX[i], worldZ[i])
+    void sampleHeightsNormalized(const float* worldX, const float* worldZ, float* out, size_t count) const;
+    void sample(const float* worldX, const float* worldZ, TerrainFieldSample* out, size_t count) const;
+
+    // Batch query over positions (x/z used, y ignored)
+    void sample(const glm::vec3* positions, TerrainFieldSample* out, size_t count) const;
+
+    int getCellsX() const { return m_width; }
+    int getCellsZ() const { return m_height; }
+    float getWorldSize() const { return m_worldSize; }
+    float getHeightScale() const { return m_heightScale; }
+    float getWaterLevel() const { return m_waterLevel; }
+    size_t getMemoryBytes() const {
+        return m_heightTiles.size() * sizeof(HeightTile) + m_surfaceTiles.size() * sizeof(SurfaceTile);
+    }
+
+private:
+    static constexpr int TILE_CELLS = TILE_SIZE * TILE_SIZE;
+
+    // Per-cell surface attributes; normal.y is reconstructed since terrain
+    // never faces down
+    struct Surface {
+        int16_t normalX;        // snorm16
+        int16_t normalZ;        // snorm16
+        uint16_t slope;         // unorm16
+        uint16_t waterDistance; // unorm16 of MAX_WATER_DISTANCE
+        uint8_t biome;
+        uint8_t padding;
+    };
+
+    // Heights and surface attributes live in separate tile planes so
+    // height-only queries stay within the smaller one
+    struct alignas(64) HeightTile {
+        float heights[TILE_CELLS];  // Normalized heightmap values
+    };
+    struct alignas(64) SurfaceTile {
+        Surface cells[TILE_CELLS];
+    };
+
+    std::vector<HeightTile> m_heightTiles;
+    std::vector<SurfaceTile> m_surfaceTiles;
+    int m_width = 0;
+    int m_height = 0;
+    int m_tilesX = 0;
+    float m_worldSize = 1.0f;
+    float m_heightScale = 1.0f;
+    float m_waterLevel = 0.0f;
+
+    size_t tileIndex(int x, int z) const {
+        return static_cast<size_t>(z >> TILE_SHIFT) * m_tilesX + (x >> TILE_SHIFT);
+    }
+    static int cellIndex(int x, int z) {
+        return ((z & (TILE_SIZE - 1)) << TILE_SHIFT) + (x & (TILE_SIZE - 1));
+    }
+
+    float& heightAt(int x, int z) { return m_heightTiles[tileIndex(x, z)].heights[cellIndex(x, z)]; }
+    float heightAt(int x, int z) const { return m_heightTiles[tileIndex(x, z)].heights[cellIndex(x, z)]; }
+    Surface& surfaceAt(int x, int z) { return m_surfaceTiles[tileIndex(x, z)].cells[cellIndex(x, z)]; }
+    const Surface& surfaceAt(int x, int z) const { return m_surfaceTiles[tileIndex(x, z)].cells[cellIndex(x, z)]; }
+
+    // Continuous grid coordinate for a world coordinate, clamped to the map
+    float toGrid(float world, int cells) const;
+
+    // Bilinear normalized height at a grid coordinate, plus the nearest cell
+    float interpolate(float gridX, float gridZ, int& nearestX, int& nearestZ) const;
+
+    void fillSample(float gridX, float gridZ, TerrainFieldSample& out) const;
+
+    // Prefetch the tile rows a query at this grid coordinate will read
+    void prefetchCells(float gridX, float gridZ, bool surface) const;
+
+    // Chamfer distance from every cell to the nearest water cell
+    void bakeWaterDistance(const std::vector<float>& heightmap);
+};
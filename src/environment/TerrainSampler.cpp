@@ -1,4 +1,6 @@
 #include "TerrainSampler.h"
+#include "TerrainField.h"
+#include "../utils/BatchNoise.h"
 #include <algorithm>
 #include <cmath>
 #include <vector>
@@ -8,6 +10,7 @@ namespace TerrainSampler {
         const std::vector<float>* s_heightmap = nullptr;
         int s_heightmapWidth = 0;
         int s_heightmapHeight = 0;
+        const TerrainField* s_field = nullptr;
 
         inline float fade(float t) {
             return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
@@ -87,11 +90,39 @@ namespace TerrainSampler {
             return (total / maxValue + 1.0f) * 0.5f;
         }
 
+        const BatchNoise& batchNoise() {
+            static const BatchNoise noise(perm);
+            return noise;
+        }
+
         inline float smoothstep(float edge0, float edge1, float x) {
             float t = std::max(0.0f, std::min(1.0f, (x - edge0) / (edge1 - edge0)));
             return t * t * (3.0f - 2.0f * t);
         }
 
+        // Island shaping applied to the four noise layers (all in [0, 1])
+        inline float shapeHeight(float continental, float mountains, float hills, float ridgeNoise, float distance) {
+            mountains = std::pow(mountains, 1.5f);
+
+            float ridges = 1.0f - std::abs(ridgeNoise * 2.0f - 1.0f);
+            ridges = std::pow(ridges, 2.0f) * 0.3f;
+
+            float height = continental * 0.3f + mountains * 0.45f + hills * 0.15f + ridges;
+
+            if (height < 0.35f) {
+                height = height * 0.8f;
+            } else if (height > 0.7f) {
+                float excess = (height - 0.7f) / 0.3f;
+                height = 0.7f + excess * excess * 0.3f;
+            }
+
+            float islandFactor = 1.0f - smoothstep(0.4f, 0.95f, distance);
+            height = height * islandFactor;
+            height = height * 1.1f - 0.05f;
+
+            return std::max(0.0f, std::min(1.0f, height));
+        }
+
         float sampleHeightmap(float worldX, float worldZ) {
             if (!s_heightmap || s_heightmapWidth <= 1 || s_heightmapHeight <= 1) {
                 return -1.0f;
@@ -132,12 +163,14 @@ namespace TerrainSampler {
         s_heightmap = heightmap;
         s_heightmapWidth = width;
         s_heightmapHeight = height;
+        s_field = nullptr;
     }
 
     void ClearHeightmap() {
         s_heightmap = nullptr;
         s_heightmapWidth = 0;
         s_heightmapHeight = 0;
+        s_field = nullptr;
     }
 
     void SetWorldParams(float worldSize, float heightScale, float waterLevel, float beachLevel) {
@@ -145,9 +178,18 @@ namespace TerrainSampler {
         HEIGHT_SCALE = heightScale;
         WATER_LEVEL = waterLevel;
         BEACH_LEVEL = beachLevel;
+        s_field = nullptr;
+    }
+
+    void SetTerrainField(const TerrainField* field) {
+        s_field = (field && field->isBaked()) ? field : nullptr;
     }
 
     float SampleHeightNormalized(float worldX, float worldZ) {
+        if (s_field) {
+            return s_field->getHeightNormalized(worldX, worldZ);
+        }
+
         float mapHeight = sampleHeightmap(worldX, worldZ);
         if (mapHeight >= 0.0f) {
             return std::max(0.0f, std::min(1.0f, mapHeight));
@@ -162,27 +204,61 @@ namespace TerrainSampler {
 
         float continental = octaveNoise(nx * 2.0f, nz * 2.0f, 4, 0.6f);
         float mountains = octaveNoise(nx * 4.0f + 100.0f, nz * 4.0f + 100.0f, 6, 0.5f);
-        mountains = std::pow(mountains, 1.5f);
         float hills = octaveNoise(nx * 8.0f + 50.0f, nz * 8.0f + 50.0f, 4, 0.5f);
-
         float ridgeNoise = octaveNoise(nx * 3.0f + 200.0f, nz * 3.0f + 200.0f, 4, 0.5f);
-        float ridges = 1.0f - std::abs(ridgeNoise * 2.0f - 1.0f);
-        ridges = std::pow(ridges, 2.0f) * 0.3f;
 
-        float height = continental * 0.3f + mountains * 0.45f + hills * 0.15f + ridges;
+        return shapeHeight(continental, mountains, hills, ridgeNoise, distance);
+    }
 
-        if (height < 0.35f) {
-            height = height * 0.8f;
-        } else if (height > 0.7f) {
-            float excess = (height - 0.7f) / 0.3f;
-            height = 0.7f + excess * excess * 0.3f;
+    void SampleHeightNormalizedBatch(const float* worldX, const float* worldZ, float* out, size_t count) {
+        if (s_field) {
+            s_field->sampleHeightsNormalized(worldX, worldZ, out, count);
+            return;
         }
 
-        float islandFactor = 1.0f - smoothstep(0.4f, 0.95f, distance);
-        height = height * islandFactor;
-        height = height * 1.1f - 0.05f;
+        if (s_heightmap && s_heightmapWidth > 1 && s_heightmapHeight > 1) {
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = SampleHeightNormalized(worldX[i], worldZ[i]);
+            }
+            return;
+        }
+
+        constexpr size_t CHUNK = 256;
+        float nx[CHUNK], nz[CHUNK], sx[CHUNK], sz[CHUNK];
+        float continental[CHUNK], mountains[CHUNK], hills[CHUNK], ridgeNoise[CHUNK];
+        const BatchNoise& noise = batchNoise();
+
+        // One fbm layer over the chunk, remapped to [0, 1] like octaveNoise()
+        auto layer = [&](size_t n, float scale, float offset, int octaves, float persistence, float* dst) {
+            for (size_t i = 0; i < n; ++i) {
+                sx[i] = nx[i] * scale + offset;
+                sz[i] = nz[i] * scale + offset;
+            }
+            noise.fbm(sx, sz, dst, n, octaves, persistence, 2.0f);
+            for (size_t i = 0; i < n; ++i) {
+                dst[i] = (dst[i] + 1.0f) * 0.5f;
+            }
+        };
+
+        for (size_t base = 0; base < count; base += CHUNK) {
+            const size_t n = std::min(CHUNK, count - base);
+            for (size_t i = 0; i < n; ++i) {
+                nx[i] = worldX[base + i] / WORLD_SIZE + 0.5f;
+                nz[i] = worldZ[base + i] / WORLD_SIZE + 0.5f;
+            }
 
-        return std::max(0.0f, std::min(1.0f, height));
+            layer(n, 2.0f, 0.0f, 4, 0.6f, continental);
+            layer(n, 4.0f, 100.0f, 6, 0.5f, mountains);
+            layer(n, 8.0f, 50.0f, 4, 0.5f, hills);
+            layer(n, 3.0f, 200.0f, 4, 0.5f, ridgeNoise);
+
+            for (size_t i = 0; i < n; ++i) {
+                float dx = nx[i] - 0.5f;
+                float dz = nz[i] - 0.5f;
+                float distance = std::sqrt(dx * dx + dz * dz) * 2.0f;
+                out[base + i] = shapeHeight(continental[i], mountains[i], hills[i], ridgeNoise[i], distance);
+            }
+        }
     }
 
     float SampleHeight(float worldX, float worldZ) {
@@ -2,8 +2,11 @@
 
 // Shared procedural terrain sampler to keep height queries consistent across systems.
 
+#include <cstddef>
 #include <vector>
 
+class TerrainField;
+
 namespace TerrainSampler {
     inline float WORLD_SIZE = 2048.0f;
     inline float HEIGHT_SCALE = 30.0f;
@@ -17,12 +20,22 @@ namespace TerrainSampler {
     // Update world scale parameters (used by heightmap sampling and water tests).
     void SetWorldParams(float worldSize, float heightScale, float waterLevel, float beachLevel);
 
+    // Answer heightmap queries from a field baked from the current heightmap
+    // and world params. Results are unchanged; lookups hit the tiled field.
+    // Changing the heightmap or world params unregisters it.
+    void SetTerrainField(const TerrainField* field);
+
     // Normalized height in [0, 1].
     float SampleHeightNormalized(float worldX, float worldZ);
 
     // World-space height in terrain units.
     float SampleHeight(float worldX, float worldZ);
 
+    // out[i] = SampleHeightNormalized(worldX[i], worldZ[i]). The procedural
+    // path evaluates its noise layers with SIMD over the whole batch, so
+    // prefer this for rows and tiles.
+    void SampleHeightNormalizedBatch(const float* worldX, const float* worldZ, float* out, size_t count);
+
     inline float GetWaterHeight() { return WATER_LEVEL * HEIGHT_SCALE; }
 
     inline bool IsWater(float worldX, float worldZ) {
@@ -295,6 +295,16 @@ void VegetationManager::generate(unsigned int seed) {
     generateTreeMeshes();
 }
 
+void VegetationManager::restoreInstances(std::span<const TreeInstance> treeInstances,
+                                         std::span<const BushInstance> bushInstances,
+                                         std::span<const GrassCluster> grassClusters) {
+    trees.assign(treeInstances.begin(), treeInstances.end());
+    bushes.assign(bushInstances.begin(), bushInstances.end());
+    grass.assign(grassClusters.begin(), grassClusters.end());
+
+    generateTreeMeshes();
+}
+
 void VegetationManager::generateTreeMeshes() {
     // Generate meshes for all tree types that are being used
     std::set<TreeType> usedTypes;
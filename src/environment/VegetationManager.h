@@ -11,6 +11,7 @@
 #include <vector>
 #include <memory>
 #include <unordered_map>
+#include <span>
 
 struct TreeInstance {
     glm::vec3 position;
@@ -59,6 +60,12 @@ class VegetationManager {
     // Generate vegetation based on terrain and biomes
     void generate(unsigned int seed);
 
+    // Replace placements with previously generated ones (e.g. from the
+    // world cache) instead of running generate()
+    void restoreInstances(std::span<const TreeInstance> treeInstances,
+                          std::span<const BushInstance> bushInstances,
+                          std::span<const GrassCluster> grassClusters);
+
     // Clear all vegetation (for regeneration)
     void clear();
 
@@ -0,0 +1,538 @@
+#include "WorldCache.h"
+#include "ProceduralWorld.h"
+#include "VegetationManager.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+
+namespace fs = std::filesystem;
+
+// Sections are copied to and from disk as raw bytes
+static_assert(std::is_trivially_copyable_v<IslandGenParams>);
+static_assert(std::is_trivially_copyable_v<RiverSegment>);
+static_assert(std::is_trivially_copyable_v<LakeBasin>);
+static_assert(std::is_trivially_copyable_v<CaveEntrance>);
+static_assert(std::is_trivially_copyable_v<BiomeCell>);
+static_assert(std::is_trivially_copyable_v<TreeInstance>);
+static_assert(std::is_trivially_copyable_v<BushInstance>);
+static_assert(std::is_trivially_copyable_v<GrassCluster>);
+
+namespace {
+
+constexpr uint32_t CACHE_MAGIC = 0x57524C44; // "WRLD"
+
+struct CacheFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    uint64_t payloadBytes;   // Everything after this header
+    uint64_t checksum;       // PayloadChecksum over the payload
+    uint32_t sectionCount;
+    uint32_t reserved;
+};
+
+struct IslandMeta {
+    int32_t width;
+    int32_t height;
+    IslandGenParams params;
+};
+
+size_t alignUp(size_t offset) {
+    return (offset + 7) & ~static_cast<size_t>(7);
+}
+
+// FNV-1a over the config fields, used to derive the cache key
+class KeyHasher {
+public:
+    void bytes(const void* data, size_t size) {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            m_hash ^= p[i];
+            m_hash *= 0x100000001B3ull;
+        }
+    }
+
+    template <typename T>
+    void add(const T& value) {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>);
+        bytes(&value, sizeof(T));
+    }
+
+    void add(const glm::vec3& v) { add(v.x); add(v.y); add(v.z); }
+
+    void add(const std::string& s) {
+        add(static_cast<uint64_t>(s.size()));
+        bytes(s.data(), s.size());
+    }
+
+    uint64_t value() const { return m_hash; }
+
+private:
+    uint64_t m_hash = 0xCBF29CE484222325ull;
+};
+
+// Word-at-a-time integrity checksum; cheap enough to run over a few hundred
+// MB of mapped payload on every load. Streams, so the writer never has to
+// assemble the whole file in memory.
+class PayloadChecksum {
+public:
+    void update(const void* data, size_t size) {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        while (m_pendingBytes != 0 && size > 0) {
+            pushByte(*p++);
+            --size;
+        }
+        while (size >= 8) {
+            uint64_t word;
+            std::memcpy(&word, p, 8);
+            mix(word);
+            p += 8;
+            size -= 8;
+        }
+        while (size > 0) {
+            pushByte(*p++);
+            --size;
+        }
+    }
+
+    uint64_t finish() {
+        if (m_pendingBytes != 0) {
+            mix(m_pending ^ (static_cast<uint64_t>(m_pendingBytes) << 56));
+            m_pending = 0;
+            m_pendingBytes = 0;
+        }
+        return m_state;
+    }
+
+private:
+    uint64_t m_state = 0x9E3779B97F4A7C15ull;
+    uint64_t m_pending = 0;
+    uint32_t m_pendingBytes = 0;
+
+    void mix(uint64_t word) {
+        m_state = (m_state ^ word) * 0xFF51AFD7ED558CCDull;
+        m_state ^= m_state >> 32;
+    }
+
+    void pushByte(uint8_t byte) {
+        m_pending |= static_cast<uint64_t>(byte) << (8 * m_pendingBytes);
+        if (++m_pendingBytes == 8) {
+            mix(m_pending);
+            m_pending = 0;
+            m_pendingBytes = 0;
+        }
+    }
+};
+
+void hashRegion(KeyHasher& h, const RegionConfig& region) {
+    h.add(region.regionId);
+    h.add(region.name);
+    h.add(static_cast<uint64_t>(region.islandIds.size()));
+    for (int id : region.islandIds) h.add(id);
+
+    h.add(region.desertWeight);
+    h.add(region.forestWeight);
+    h.add(region.tundraWeight);
+    h.add(region.tropicalWeight);
+    h.add(region.wetlandWeight);
+    h.add(region.mountainWeight);
+    h.add(region.volcanicWeight);
+    h.add(region.coastalWeight);
+    h.add(region.temperatureOffset);
+    h.add(region.moistureMultiplier);
+    h.add(region.vegetationDensity);
+
+    const EvolutionBiasHook& bias = region.evolutionBias;
+    h.add(bias.sizeBias);
+    h.add(bias.speedBias);
+    h.add(bias.intelligenceBias);
+    h.add(bias.aggressionBias);
+    h.add(bias.socialBias);
+    h.add(bias.aquaticBias);
+    h.add(bias.flyingBias);
+    h.add(bias.venomChance);
+    h.add(bias.camouflageChance);
+    h.add(bias.bioluminescenceChance);
+    h.add(bias.predationPressure);
+    h.add(bias.resourceScarcity);
+
+    h.add(region.isolationLevel);
+    h.add(region.allowsMigration);
+}
+
+} // namespace
+
+// ============================================================================
+// Construction and keys
+// ============================================================================
+
+WorldCache::WorldCache(std::string directory, uint64_t maxBytes)
+    : m_directory(std::move(directory)), m_maxBytes(maxBytes) {
+}
+
+uint64_t WorldCache::computeKey(const WorldGenConfig& config, uint32_t seed) {
+    KeyHasher h;
+    h.add(FORMAT_VERSION);
+    h.add(seed);
+
+    h.add(config.islandShape);
+    h.add(config.islandSize);
+    h.add(config.coastComplexity);
+    h.add(config.generateRivers);
+    h.add(config.generateLakes);
+    h.add(config.generateCaves);
+    h.add(config.terrainScale);
+    h.add(config.oceanCoverage);
+
+    h.add(config.themePreset);
+    h.add(config.randomizeTheme);
+    h.add(config.useWeightedThemeSelection);
+
+    const StarType& star = config.starType;
+    h.add(star.spectralClass);
+    h.add(star.color);
+    h.add(star.intensity);
+    h.add(star.temperature);
+    h.add(star.angularSize);
+    h.add(star.dayLengthModifier);
+    h.add(star.temperatureOffset);
+    h.add(star.uvIntensity);
+    h.add(star.skyTintModifier);
+    h.add(star.twilightDuration);
+    h.add(config.randomizeStarType);
+
+    h.add(config.multiRegion.enabled);
+    h.add(static_cast<uint64_t>(config.multiRegion.regions.size()));
+    for (const RegionConfig& region : config.multiRegion.regions) {
+        hashRegion(h, region);
+    }
+    h.add(config.multiRegion.globalMigrationRate);
+    h.add(config.multiRegion.competitiveMode);
+    h.add(config.desiredRegionCount);
+
+    const VegetationDensityConfig& veg = config.vegetationConfig;
+    h.add(veg.preset);
+    h.add(veg.treeDensity);
+    h.add(veg.grassDensity);
+    h.add(veg.flowerDensity);
+    h.add(veg.shrubDensity);
+    h.add(veg.alienPlantDensity);
+    h.add(veg.biomeDensityVariation);
+
+    const BiomeWeights& weights = config.biomeWeights;
+    h.add(weights.forestWeight);
+    h.add(weights.grasslandWeight);
+    h.add(weights.desertWeight);
+    h.add(weights.tundraWeight);
+    h.add(weights.wetlandWeight);
+    h.add(weights.mountainWeight);
+    h.add(weights.volcanicWeight);
+
+    h.add(config.temperatureBias);
+    h.add(config.moistureBias);
+    h.add(config.seasonIntensity);
+    h.add(config.erosionPasses);
+    h.add(config.erosionStrength);
+    h.add(config.noiseOctaves);
+    h.add(config.noiseFrequency);
+    h.add(config.heightmapResolution);
+
+    // config.seed is replaced by the resolved seed above and planetSeed is
+    // derived from it, so neither is hashed separately.
+    return h.value();
+}
+
+std::string WorldCache::entryPath(uint64_t key, const char* extension) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(key));
+    return (fs::path(m_directory) / (std::string(name) + extension)).string();
+}
+
+void WorldCache::setMaxBytes(uint64_t maxBytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_maxBytes = maxBytes;
+    enforceSizeCap(std::string());
+}
+
+WorldCache::Stats WorldCache::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+// ============================================================================
+// Entries
+// ============================================================================
+
+std::span<const uint8_t> WorldCache::Entry::bytes(Section id) const {
+    for (const SectionRecord& record : m_sections) {
+        if (record.id == static_cast<uint32_t>(id)) {
+            return std::span<const uint8_t>(m_file.data() + record.offset, static_cast<size_t>(record.size));
+        }
+    }
+    return {};
+}
+
+bool WorldCache::loadWorld(uint64_t key, Entry& out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return loadFile(entryPath(key, ".world"), key, out);
+}
+
+bool WorldCache::loadVegetation(uint64_t key, Entry& out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return loadFile(entryPath(key, ".veg"), key, out);
+}
+
+bool WorldCache::loadFile(const std::string& path, uint64_t key, Entry& out) {
+    out.m_file.close();
+    out.m_sections.clear();
+
+    std::error_code ec;
+    if (!fs::exists(path, ec) || !out.m_file.open(path)) {
+        m_stats.misses++;
+        return false;
+    }
+
+    const uint8_t* base = out.m_file.data();
+    const size_t fileSize = out.m_file.size();
+
+    auto validate = [&]() {
+        if (fileSize < sizeof(CacheFileHeader)) return false;
+
+        CacheFileHeader header;
+        std::memcpy(&header, base, sizeof(header));
+        if (header.magic != CACHE_MAGIC || header.version != FORMAT_VERSION || header.key != key) return false;
+        if (header.payloadBytes != fileSize - sizeof(CacheFileHeader)) return false;
+
+        const size_t tableBytes = static_cast<size_t>(header.sectionCount) * sizeof(Entry::SectionRecord);
+        if (tableBytes > header.payloadBytes) return false;
+
+        const size_t dataStart = sizeof(CacheFileHeader) + tableBytes;
+        out.m_sections.resize(header.sectionCount);
+        std::memcpy(out.m_sections.data(), base + sizeof(CacheFileHeader), tableBytes);
+        for (const Entry::SectionRecord& record : out.m_sections) {
+            if (record.offset < dataStart || record.offset % 8 != 0) return false;
+            if (record.offset > fileSize || record.size > fileSize - record.offset) return false;
+            if (record.elementSize == 0 || record.size % record.elementSize != 0) return false;
+        }
+
+        PayloadChecksum checksum;
+        checksum.update(base + sizeof(CacheFileHeader), static_cast<size_t>(header.payloadBytes));
+        return checksum.finish() == header.checksum;
+    };
+
+    if (!validate()) {
+        std::cerr << "[WorldCache] Discarding corrupt or stale entry " << path << std::endl;
+        out.m_file.close();
+        out.m_sections.clear();
+        fs::remove(path, ec);
+        m_stats.corruptEntries++;
+        m_stats.misses++;
+        return false;
+    }
+
+    // Refresh the LRU timestamp
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    m_stats.hits++;
+    return true;
+}
+
+bool WorldCache::restoreIslandData(const Entry& entry, IslandData& islandData) {
+    std::span<const uint8_t> metaBytes = entry.bytes(Section::ISLAND_META);
+    if (metaBytes.size() != sizeof(IslandMeta)) return false;
+
+    IslandMeta meta;
+    std::memcpy(&meta, metaBytes.data(), sizeof(meta));
+    if (meta.width <= 0 || meta.height <= 0) return false;
+    const size_t cellCount = static_cast<size_t>(meta.width) * static_cast<size_t>(meta.height);
+
+    auto heightmap = entry.array<float>(Section::HEIGHTMAP);
+    auto underwater = entry.array<float>(Section::UNDERWATER_HEIGHTMAP);
+    auto coastal = entry.array<uint8_t>(Section::COASTAL_MAP);
+    if (heightmap.size() != cellCount || underwater.size() != cellCount || coastal.size() != cellCount) {
+        return false;
+    }
+
+    auto rivers = entry.array<RiverSegment>(Section::RIVERS);
+    auto lakes = entry.array<LakeBasin>(Section::LAKES);
+    auto caves = entry.array<CaveEntrance>(Section::CAVES);
+
+    islandData.width = meta.width;
+    islandData.height = meta.height;
+    islandData.params = meta.params;
+    islandData.heightmap.assign(heightmap.begin(), heightmap.end());
+    islandData.underwaterHeightmap.assign(underwater.begin(), underwater.end());
+    islandData.coastalTypeMap.assign(coastal.begin(), coastal.end());
+    islandData.rivers.assign(rivers.begin(), rivers.end());
+    islandData.lakes.assign(lakes.begin(), lakes.end());
+    islandData.caveEntrances.assign(caves.begin(), caves.end());
+    return true;
+}
+
+// ============================================================================
+// Storing
+// ============================================================================
+
+bool WorldCache::storeWorld(uint64_t key, const GeneratedWorld& world) {
+    const IslandData& island = world.islandData;
+
+    IslandMeta meta{};
+    meta.width = island.width;
+    meta.height = island.height;
+    meta.params = island.params;
+
+    auto section = [](Section id, const auto& values) {
+        using T = typename std::decay_t<decltype(values)>::value_type;
+        return PendingSection{id, static_cast<uint32_t>(sizeof(T)), values.data(),
+                              static_cast<uint64_t>(values.size() * sizeof(T))};
+    };
+
+    std::vector<PendingSection> sections;
+    sections.push_back({Section::ISLAND_META, static_cast<uint32_t>(sizeof(meta)), &meta, sizeof(meta)});
+    sections.push_back(section(Section::HEIGHTMAP, island.heightmap));
+    sections.push_back(section(Section::UNDERWATER_HEIGHTMAP, island.underwaterHeightmap));
+    sections.push_back(section(Section::COASTAL_MAP, island.coastalTypeMap));
+    sections.push_back(section(Section::RIVERS, island.rivers));
+    sections.push_back(section(Section::LAKES, island.lakes));
+    sections.push_back(section(Section::CAVES, island.caveEntrances));
+    if (world.biomeSystem) {
+        sections.push_back(section(Section::BIOME_CELLS, world.biomeSystem->getBiomeMap()));
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const std::string path = entryPath(key, ".world");
+    if (!writeFile(path, key, sections)) return false;
+    enforceSizeCap(path);
+    return true;
+}
+
+bool WorldCache::storeVegetation(uint64_t key,
+                                 std::span<const TreeInstance> trees,
+                                 std::span<const BushInstance> bushes,
+                                 std::span<const GrassCluster> grass) {
+    std::vector<PendingSection> sections = {
+        {Section::TREES, static_cast<uint32_t>(sizeof(TreeInstance)), trees.data(), trees.size_bytes()},
+        {Section::BUSHES, static_cast<uint32_t>(sizeof(BushInstance)), bushes.data(), bushes.size_bytes()},
+        {Section::GRASS, static_cast<uint32_t>(sizeof(GrassCluster)), grass.data(), grass.size_bytes()}
+    };
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const std::string path = entryPath(key, ".veg");
+    if (!writeFile(path, key, sections)) return false;
+    enforceSizeCap(path);
+    return true;
+}
+
+bool WorldCache::writeFile(const std::string& path, uint64_t key, const std::vector<PendingSection>& sections) {
+    std::error_code ec;
+    fs::create_directories(m_directory, ec);
+
+    // Lay out the section table and 8-byte aligned section data
+    std::vector<Entry::SectionRecord> table(sections.size());
+    size_t offset = sizeof(CacheFileHeader) + sections.size() * sizeof(Entry::SectionRecord);
+    for (size_t i = 0; i < sections.size(); ++i) {
+        offset = alignUp(offset);
+        table[i] = {static_cast<uint32_t>(sections[i].id), sections[i].elementSize, offset, sections[i].size};
+        offset += static_cast<size_t>(sections[i].size);
+    }
+    const size_t fileSize = alignUp(offset);
+
+    static const uint8_t padding[8] = {};
+    auto padTo = [&](size_t from, size_t to, auto&& sink) {
+        if (to > from) sink(padding, to - from);
+    };
+
+    // Checksum first so the header can be written in one pass
+    PayloadChecksum checksum;
+    auto hashSink = [&](const void* data, size_t size) { checksum.update(data, size); };
+    size_t position = sizeof(CacheFileHeader);
+    hashSink(table.data(), table.size() * sizeof(Entry::SectionRecord));
+    position += table.size() * sizeof(Entry::SectionRecord);
+    for (size_t i = 0; i < sections.size(); ++i) {
+        padTo(position, static_cast<size_t>(table[i].offset), hashSink);
+        hashSink(sections[i].data, static_cast<size_t>(sections[i].size));
+        position = static_cast<size_t>(table[i].offset + table[i].size);
+    }
+    padTo(position, fileSize, hashSink);
+
+    CacheFileHeader header{};
+    header.magic = CACHE_MAGIC;
+    header.version = FORMAT_VERSION;
+    header.key = key;
+    header.payloadBytes = fileSize - sizeof(CacheFileHeader);
+    header.checksum = checksum.finish();
+    header.sectionCount = static_cast<uint32_t>(sections.size());
+
+    const std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file) return false;
+
+        auto fileSink = [&](const void* data, size_t size) {
+            file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        };
+        fileSink(&header, sizeof(header));
+        fileSink(table.data(), table.size() * sizeof(Entry::SectionRecord));
+        position = sizeof(CacheFileHeader) + table.size() * sizeof(Entry::SectionRecord);
+        for (size_t i = 0; i < sections.size(); ++i) {
+            padTo(position, static_cast<size_t>(table[i].offset), fileSink);
+            fileSink(sections[i].data, static_cast<size_t>(sections[i].size));
+            position = static_cast<size_t>(table[i].offset + table[i].size);
+        }
+        padTo(position, fileSize, fileSink);
+
+        if (!file.good()) {
+            file.close();
+            fs::remove(tempPath, ec);
+            return false;
+        }
+    }
+
+    fs::rename(tempPath, path, ec);
+    if (ec) {
+        fs::remove(tempPath, ec);
+        return false;
+    }
+
+    m_stats.stores++;
+    return true;
+}
+
+void WorldCache::enforceSizeCap(const std::string& keepPath) {
+    struct CachedFile {
+        fs::path path;
+        uint64_t size;
+        fs::file_time_type lastUsed;
+    };
+
+    std::error_code ec;
+    std::vector<CachedFile> files;
+    uint64_t totalBytes = 0;
+    for (fs::directory_iterator it(m_directory, ec), end; !ec && it != end; it.increment(ec)) {
+        if (!it->is_regular_file(ec)) continue;
+        const fs::path& filePath = it->path();
+        if (filePath.extension() != ".world" && filePath.extension() != ".veg") continue;
+
+        CachedFile file{filePath, it->file_size(ec), it->last_write_time(ec)};
+        totalBytes += file.size;
+        files.push_back(std::move(file));
+    }
+    if (totalBytes <= m_maxBytes) return;
+
+    std::sort(files.begin(), files.end(), [](const CachedFile& a, const CachedFile& b) {
+        return a.lastUsed < b.lastUsed;
+    });
+
+    const fs::path keep(keepPath);
+    for (const CachedFile& file : files) {
+        if (totalBytes <= m_maxBytes) break;
+        if (!keepPath.empty() && file.path == keep) continue;
+        if (fs::remove(file.path, ec)) {
+            totalBytes -= file.size;
+            m_stats.evictions++;
+        }
+    }
+}
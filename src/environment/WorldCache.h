@@ -0,0 +1,141 @@
+#pragma once
+
+#include "../utils/MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+struct WorldGenConfig;
+struct GeneratedWorld;
+struct IslandData;
+struct TreeInstance;
+struct BushInstance;
+struct GrassCluster;
+
+// ============================================================================
+// WORLD CACHE
+// ============================================================================
+// Content-addressed on-disk cache of generated world artifacts. Entries are
+// keyed by a hash of the resolved seed and every WorldGenConfig field, so
+// re-running a known seed/config skips island generation, erosion, biome
+// classification and vegetation placement.
+//
+// Each key has up to two files in the cache directory:
+//   <key>.world - heightmaps, coastal map, rivers, lakes, caves, biome cells
+//   <key>.veg   - tree, bush and grass placements (stored once generated)
+// Files are written to a temp name and renamed into place, carry a payload
+// checksum that is verified on load, and are memory-mapped when read.
+// Corrupt or stale files are deleted and treated as misses.
+//
+// The directory is capped in bytes; when a store pushes it over the cap the
+// least recently used files (by modification time, refreshed on every hit)
+// are removed first.
+//
+// Thread Safety: load/store calls are serialized internally, so one cache
+// can be shared by the world generation thread and the main thread.
+
+class WorldCache {
+public:
+    // Bump whenever generation code changes output for the same config,
+    // so old entries stop matching instead of loading stale worlds.
+    static constexpr uint32_t FORMAT_VERSION = 1;
+    static constexpr uint64_t DEFAULT_MAX_BYTES = 2ull * 1024 * 1024 * 1024;
+
+    explicit WorldCache(std::string directory = "cache/worlds", uint64_t maxBytes = DEFAULT_MAX_BYTES);
+
+    // Hash of the resolved seed, format version and full generation config
+    static uint64_t computeKey(const WorldGenConfig& config, uint32_t seed);
+
+    // Section identifiers inside a cache file
+    enum class Section : uint32_t {
+        ISLAND_META = 1,
+        HEIGHTMAP,
+        UNDERWATER_HEIGHTMAP,
+        COASTAL_MAP,
+        RIVERS,
+        LAKES,
+        CAVES,
+        BIOME_CELLS,
+        TREES,
+        BUSHES,
+        GRASS
+    };
+
+    // Read-only view of one mapped cache file. Spans stay valid while the
+    // entry is alive.
+    class Entry {
+    public:
+        bool isOpen() const { return m_file.isOpen(); }
+        size_t fileSize() const { return m_file.size(); }
+
+        std::span<const uint8_t> bytes(Section id) const;
+
+        template <typename T>
+        std::span<const T> array(Section id) const {
+            std::span<const uint8_t> raw = bytes(id);
+            return std::span<const T>(reinterpret_cast<const T*>(raw.data()), raw.size() / sizeof(T));
+        }
+
+    private:
+        friend class WorldCache;
+
+        struct SectionRecord {
+            uint32_t id;
+            uint32_t elementSize;
+            uint64_t offset;
+            uint64_t size;
+        };
+
+        MappedFile m_file;
+        std::vector<SectionRecord> m_sections;
+    };
+
+    // Terrain and biome artifacts of a generated world
+    bool loadWorld(uint64_t key, Entry& out);
+    bool storeWorld(uint64_t key, const GeneratedWorld& world);
+
+    // Copy the island sections of a loaded entry into islandData
+    static bool restoreIslandData(const Entry& entry, IslandData& islandData);
+
+    // Vegetation placements for a world (stored after the world itself)
+    bool loadVegetation(uint64_t key, Entry& out);
+    bool storeVegetation(uint64_t key,
+                         std::span<const TreeInstance> trees,
+                         std::span<const BushInstance> bushes,
+                         std::span<const GrassCluster> grass);
+
+    void setMaxBytes(uint64_t maxBytes);
+    uint64_t getMaxBytes() const { return m_maxBytes; }
+    const std::string& getDirectory() const { return m_directory; }
+
+    // Counters since construction
+    struct Stats {
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+        uint32_t stores = 0;
+        uint32_t corruptEntries = 0;
+        uint32_t evictions = 0;
+    };
+    Stats getStats() const;
+
+private:
+    struct PendingSection {
+        Section id;
+        uint32_t elementSize;
+        const void* data;
+        uint64_t size;
+    };
+
+    std::string m_directory;
+    uint64_t m_maxBytes;
+    mutable std::mutex m_mutex;
+    Stats m_stats;
+
+    std::string entryPath(uint64_t key, const char* extension) const;
+    bool loadFile(const std::string& path, uint64_t key, Entry& out);
+    bool writeFile(const std::string& path, uint64_t key, const std::vector<PendingSection>& sections);
+    void enforceSizeCap(const std::string& keepPath);
+};
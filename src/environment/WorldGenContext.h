@@ -0,0 +1,99 @@
+#pragma once
+
+#include "../utils/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+
+// ============================================================================
+// WORLD GENERATION CONTEXT
+// ============================================================================
+// Progress and cancellation state for one world generation run. Generation
+// is split into stages, each owning a slice [start, end] of the overall
+// progress bar. Row-parallel work inside a stage goes through parallelRows(),
+// which spreads rows over the shared thread pool, reports per-chunk progress
+// and stops early once cancellation has been requested.
+
+// Thrown out of generation code when the run was cancelled
+class WorldGenCancelled : public std::runtime_error {
+public:
+    WorldGenCancelled() : std::runtime_error("World generation cancelled") {}
+};
+
+class WorldGenContext {
+public:
+    using ProgressCallback = std::function<void(float, const char*)>;
+
+    WorldGenContext(ProgressCallback callback, const std::atomic<bool>* cancelFlag)
+        : m_callback(std::move(callback)), m_cancelFlag(cancelFlag) {}
+
+    WorldGenContext(const WorldGenContext&) = delete;
+    WorldGenContext& operator=(const WorldGenContext&) = delete;
+
+    // Start a new stage; throws WorldGenCancelled if cancellation is pending
+    void beginStage(const char* name, float start, float end) {
+        throwIfCancelled();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stageName = name ? name : "";
+            m_stageStart = start;
+            m_stageEnd = std::max(start, end);
+        }
+        report(0.0f);
+    }
+
+    // Report progress within the current stage (0-1). Thread-safe; the
+    // overall value never moves backwards.
+    void report(float stageFraction) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        float fraction = std::clamp(stageFraction, 0.0f, 1.0f);
+        float overall = m_stageStart + (m_stageEnd - m_stageStart) * fraction;
+        if (overall < m_lastReported) return;
+        m_lastReported = overall;
+        if (m_callback) {
+            m_callback(overall, m_stageName);
+        }
+    }
+
+    bool isCancelled() const {
+        return m_cancelFlag && m_cancelFlag->load(std::memory_order_relaxed);
+    }
+
+    void throwIfCancelled() const {
+        if (isCancelled()) {
+            throw WorldGenCancelled();
+        }
+    }
+
+    // Runs fn(row) for every row in [0, rows) on the shared pool. Rows must
+    // be independent of each other. Progress is reported per finished chunk.
+    template <typename Fn>
+    void parallelRows(int rows, Fn&& fn) {
+        if (rows <= 0) return;
+
+        std::atomic<int> rowsDone{0};
+        ThreadPool::shared().parallelFor(static_cast<size_t>(rows), ROW_GRAIN, [&](size_t begin, size_t end) {
+            throwIfCancelled();
+            for (size_t y = begin; y < end; ++y) {
+                fn(static_cast<int>(y));
+            }
+            int done = rowsDone.fetch_add(static_cast<int>(end - begin)) + static_cast<int>(end - begin);
+            report(static_cast<float>(done) / rows);
+        });
+    }
+
+    // Rows per pool chunk: small enough to balance, large enough to amortize
+    static constexpr size_t ROW_GRAIN = 16;
+
+private:
+    ProgressCallback m_callback;
+    const std::atomic<bool>* m_cancelFlag;
+
+    std::mutex m_mutex;
+    const char* m_stageName = "";
+    float m_stageStart = 0.0f;
+    float m_stageEnd = 0.0f;
+    float m_lastReported = 0.0f;
+};
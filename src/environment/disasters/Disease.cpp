@@ -1,14 +1,34 @@
 #include "Disease.h"
 #include "../../core/CreatureManager.h"
 #include "../../entities/Creature.h"
+#include "../../utils/ThreadPool.h"
 
+#include <glm/gtc/constants.hpp>
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 using namespace Forge;
 
 namespace disasters {
 
+namespace {
+    constexpr size_t TRANSMISSION_CHUNK = 1024;     // Slots per parallel transmission task
+
+    inline uint64_t splitmix64(uint64_t z) {
+        z += 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // Uniform [0, 1) draw that depends only on the round seed and creature,
+    // so slots can be sampled in any order on any thread
+    inline float unitDraw(uint64_t roundSeed, uint32_t creatureId) {
+        return static_cast<float>(splitmix64(roundSeed + creatureId) >> 40) * (1.0f / 16777216.0f);
+    }
+} // namespace
+
 DiseaseOutbreak::DiseaseOutbreak() {
     m_infections.reserve(1000);
 }
@@ -19,11 +39,13 @@ void DiseaseOutbreak::trigger(const glm::vec3& epicenter, DisasterSeverity sever
     m_elapsedTime = 0.0f;
 
     std::random_device rd;
-    m_rng.seed(rd());
+    setSeed(rd());
 
     // Clear previous state
     m_infections.clear();
     m_immuneCreatures.clear();
+    m_slotState.clear();
+    m_slotOwner.clear();
 
     // Initialize disease strain based on severity
     initializeStrain(severity);
@@ -32,6 +54,12 @@ void DiseaseOutbreak::trigger(const glm::vec3& epicenter, DisasterSeverity sever
     m_stats = DiseaseStats{};
 }
 
+void DiseaseOutbreak::setSeed(uint32_t seed) {
+    m_rng.seed(seed);
+    m_transmissionSeed = (static_cast<uint64_t>(m_rng()) << 32) | m_rng();
+    m_transmissionRound = 0;
+}
+
 void DiseaseOutbreak::infectPatientZero(Creature* patientZero) {
     if (!patientZero || !patientZero->isAlive()) return;
 
@@ -110,11 +138,18 @@ void DiseaseOutbreak::findPatientZero(CreatureManager& creatures) {
 void DiseaseOutbreak::infectCreature(Creature* creature) {
     if (!creature || !creature->isAlive()) return;
 
-    uint32_t id = creature->getID();
+    // Slot states are refreshed from the infection map on the next update
+    if (addInfection(*creature)) {
+        m_resyncSlots = true;
+    }
+}
+
+bool DiseaseOutbreak::addInfection(const Creature& creature) {
+    uint32_t id = creature.getID();
 
     // Check if already infected or immune
-    if (m_infections.find(id) != m_infections.end()) return;
-    if (m_immuneCreatures.find(id) != m_immuneCreatures.end()) return;
+    if (m_infections.find(id) != m_infections.end()) return false;
+    if (m_immuneCreatures.find(id) != m_immuneCreatures.end()) return false;
 
     InfectionData infection;
     infection.creatureId = id;
@@ -130,12 +165,13 @@ void DiseaseOutbreak::infectCreature(Creature* creature) {
     infection.severity = severityDist(m_rng);
 
     // Immune response - some creatures naturally more resistant
-    infection.immuneResponse = calculateSusceptibility(*creature);
+    infection.immuneResponse = calculateSusceptibility(creature);
     infection.isContagious = false;
     infection.infectedOthers = 0;
 
     m_infections[id] = infection;
     m_stats.totalCases++;
+    return true;
 }
 
 void DiseaseOutbreak::update(float deltaTime, CreatureManager& creatures,
@@ -149,20 +185,17 @@ void DiseaseOutbreak::update(float deltaTime, CreatureManager& creatures,
         findPatientZero(creatures);
     }
 
+    // Match slots to their current creatures
+    syncSlots(creatures);
+
     // Update all infections
-    updateInfections(deltaTime, creatures, disaster);
+    updateInfections(deltaTime, disaster);
 
     // Attempt transmission periodically (not every frame for performance)
     m_lastTransmissionCheck += deltaTime;
     if (m_lastTransmissionCheck >= TRANSMISSION_CHECK_INTERVAL) {
-        for (auto& [id, infection] : m_infections) {
-            if (!infection.isContagious) continue;
-
-            Creature* creature = creatures.getCreatureByID(id);
-            if (creature && creature->isAlive()) {
-                attemptTransmission(*creature, creatures, m_lastTransmissionCheck, disaster);
-            }
-        }
+        accumulateExposure();
+        attemptTransmission(m_lastTransmissionCheck, disaster);
         m_lastTransmissionCheck = 0.0f;
     }
 
@@ -183,36 +216,73 @@ void DiseaseOutbreak::update(float deltaTime, CreatureManager& creatures,
     }
 }
 
-void DiseaseOutbreak::updateInfections(float deltaTime, CreatureManager& creatures,
-                                        ActiveDisaster& disaster) {
-    std::vector<uint32_t> toRemove;
+void DiseaseOutbreak::syncSlots(CreatureManager& creatures) {
+    std::fill(m_slotCreatures.begin(), m_slotCreatures.end(), nullptr);
+    creatures.forEach([&](Creature& creature, size_t slot) {
+        if (slot >= m_slotCreatures.size()) {
+            m_slotCreatures.resize(slot + 1, nullptr);
+        }
+        if (creature.isAlive()) {
+            m_slotCreatures[slot] = &creature;
+        }
+    });
+
+    const size_t slotCount = std::max(m_slotCreatures.size(), m_slotOwner.size());
+    m_slotCreatures.resize(slotCount, nullptr);
+    m_slotOwner.resize(slotCount, NO_OWNER);
+    m_slotState.resize(slotCount, SLOT_SUSCEPTIBLE);
+
+    for (size_t slot = 0; slot < slotCount; ++slot) {
+        const Creature* creature = m_slotCreatures[slot];
+        const uint32_t owner = creature ? static_cast<uint32_t>(creature->getID()) : NO_OWNER;
+        if (owner == m_slotOwner[slot] && !m_resyncSlots) continue;
+
+        // The previous occupant died from other causes
+        if (owner != m_slotOwner[slot] && m_slotOwner[slot] != NO_OWNER &&
+            (m_slotState[slot] == SLOT_INFECTED || m_slotState[slot] == SLOT_CONTAGIOUS)) {
+            m_infections.erase(m_slotOwner[slot]);
+        }
+
+        m_slotOwner[slot] = owner;
 
-    for (auto& [id, infection] : m_infections) {
-        // Skip dead or recovered
-        if (infection.state == InfectionState::DEAD ||
-            infection.state == InfectionState::RECOVERED) {
-            continue;
+        uint8_t state = SLOT_SUSCEPTIBLE;
+        if (owner != NO_OWNER) {
+            auto it = m_infections.find(owner);
+            if (it != m_infections.end()) {
+                state = it->second.isContagious ? SLOT_CONTAGIOUS : SLOT_INFECTED;
+            } else if (m_immuneCreatures.count(owner) > 0) {
+                state = SLOT_IMMUNE;
+            }
         }
+        m_slotState[slot] = state;
+    }
+    m_resyncSlots = false;
+}
+
+void DiseaseOutbreak::updateInfections(float deltaTime, ActiveDisaster& disaster) {
+    for (size_t slot = 0; slot < m_slotState.size(); ++slot) {
+        uint8_t& state = m_slotState[slot];
+        if (state != SLOT_INFECTED && state != SLOT_CONTAGIOUS) continue;
 
-        Creature* creature = creatures.getCreatureByID(id);
-        if (!creature || !creature->isAlive()) {
-            // Creature died from other causes
-            infection.state = InfectionState::DEAD;
+        auto it = m_infections.find(m_slotOwner[slot]);
+        if (it == m_infections.end()) {
+            state = SLOT_SUSCEPTIBLE;
             continue;
         }
 
-        progressInfection(infection, creature, deltaTime, disaster);
-    }
+        InfectionData& infection = it->second;
+        progressInfection(infection, m_slotCreatures[slot], deltaTime, disaster);
 
-    // Move recovered to immune list
-    for (auto it = m_infections.begin(); it != m_infections.end(); ) {
-        if (it->second.state == InfectionState::RECOVERED) {
+        // Move recovered to immune list
+        if (infection.state == InfectionState::RECOVERED) {
             m_immuneCreatures.insert(it->first);
-            it = m_infections.erase(it);
-        } else if (it->second.state == InfectionState::DEAD) {
-            it = m_infections.erase(it);
+            m_infections.erase(it);
+            state = SLOT_IMMUNE;
+        } else if (infection.state == InfectionState::DEAD) {
+            m_infections.erase(it);
+            state = SLOT_SUSCEPTIBLE;   // Slot is released with the creature
         } else {
-            ++it;
+            state = infection.isContagious ? SLOT_CONTAGIOUS : SLOT_INFECTED;
         }
     }
 }
@@ -303,33 +373,143 @@ void DiseaseOutbreak::progressInfection(InfectionData& infection, Creature* crea
     }
 }
 
-void DiseaseOutbreak::attemptTransmission(const Creature& infected, CreatureManager& creatures,
-                                           float deltaTime, ActiveDisaster& disaster) {
-    auto it = m_infections.find(infected.getID());
-    if (it == m_infections.end() || !it->second.isContagious) return;
-
-    const auto& nearbyCreatures = creatures.queryNearby(infected.getPosition(),
-                                                         m_strain.transmissionRange);
+void DiseaseOutbreak::accumulateExposure() {
+    m_cellsX = 0;
+    m_cellsZ = 0;
+
+    // Contagious creature in a slot, or nullptr. Disease damage earlier this
+    // frame may have killed it without the slot state changing.
+    auto contagiousAt = [this](size_t slot) -> const Creature* {
+        if (m_slotState[slot] != SLOT_CONTAGIOUS) return nullptr;
+        const Creature* creature = m_slotCreatures[slot];
+        return creature && creature->isAlive() ? creature : nullptr;
+    };
+
+    // Bounds of the contagious creatures
+    glm::vec2 lo(std::numeric_limits<float>::max());
+    glm::vec2 hi(std::numeric_limits<float>::lowest());
+    bool anyContagious = false;
+    for (size_t slot = 0; slot < m_slotState.size(); ++slot) {
+        const Creature* creature = contagiousAt(slot);
+        if (!creature) continue;
+        const glm::vec3& pos = creature->getPosition();
+        lo = glm::min(lo, glm::vec2(pos.x, pos.z));
+        hi = glm::max(hi, glm::vec2(pos.x, pos.z));
+        anyContagious = true;
+    }
+    if (!anyContagious) return;
+
+    // One cell spans the transmission range, coarsened when the outbreak
+    // covers more ground than the cell budget allows
+    m_cellSize = std::max(m_strain.transmissionRange, 0.1f);
+    const glm::vec2 extent = hi - lo;
+    while ((extent.x / m_cellSize + 3.0f) * (extent.y / m_cellSize + 3.0f) >
+           static_cast<float>(MAX_EXPOSURE_CELLS)) {
+        m_cellSize *= 2.0f;
+    }
 
-    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    m_cellOrigin = glm::ivec2(glm::floor(lo / m_cellSize)) - 1;
+    const glm::ivec2 last = glm::ivec2(glm::floor(hi / m_cellSize)) + 1;
+    m_cellsX = last.x - m_cellOrigin.x + 1;
+    m_cellsZ = last.y - m_cellOrigin.y + 1;
+
+    m_cellInfected.assign(static_cast<size_t>(m_cellsX) * m_cellsZ, 0.0f);
+    m_cellSource.assign(m_cellInfected.size(), NO_OWNER);
+
+    for (size_t slot = 0; slot < m_slotState.size(); ++slot) {
+        const Creature* creature = contagiousAt(slot);
+        if (!creature) continue;
+        const glm::vec3& pos = creature->getPosition();
+        const glm::ivec2 cell = glm::ivec2(glm::floor(glm::vec2(pos.x, pos.z) / m_cellSize)) - m_cellOrigin;
+        const size_t index = static_cast<size_t>(cell.y) * m_cellsX + cell.x;
+        m_cellInfected[index] += 1.0f;
+        m_cellSource[index] = m_slotOwner[slot];
+    }
+}
 
-    for (auto* nearby : nearbyCreatures) {
-        if (!nearby || nearby == &infected || !nearby->isAlive()) continue;
+void DiseaseOutbreak::attemptTransmission(float deltaTime, ActiveDisaster& disaster) {
+    if (m_cellsX == 0) return;
+
+    ++m_transmissionRound;
+    const uint64_t roundSeed = splitmix64(m_transmissionSeed + m_transmissionRound);
+
+    // Expected contacts: contagious creatures in the surrounding 3x3 cells,
+    // scaled by the share of that block the transmission disc covers
+    const float range = m_strain.transmissionRange;
+    const float contactShare = std::min(1.0f, glm::pi<float>() * range * range /
+                                              (9.0f * m_cellSize * m_cellSize));
+    const float contactRate = m_strain.transmissionRate * deltaTime * contactShare;
+
+    // Index of the cell holding pos relative to the grid, or -1 when the 3x3
+    // block around it can hold no contagious creature
+    auto cellOf = [this](const glm::vec3& pos, glm::ivec2& cell) {
+        cell = glm::ivec2(glm::floor(glm::vec2(pos.x, pos.z) / m_cellSize)) - m_cellOrigin;
+        return cell.x >= 0 && cell.y >= 0 && cell.x < m_cellsX && cell.y < m_cellsZ;
+    };
+
+    auto sampleRange = [&](size_t begin, size_t end) {
+        for (size_t slot = begin; slot < end; ++slot) {
+            if (m_slotState[slot] != SLOT_SUSCEPTIBLE) continue;
+            // Creatures the disease killed this frame still hold their slot
+            const Creature* creature = m_slotCreatures[slot];
+            if (!creature || !creature->isAlive()) continue;
+
+            glm::ivec2 cell;
+            if (!cellOf(creature->getPosition(), cell)) continue;
+
+            float infected = 0.0f;
+            for (int z = std::max(cell.y - 1, 0); z <= std::min(cell.y + 1, m_cellsZ - 1); ++z) {
+                for (int x = std::max(cell.x - 1, 0); x <= std::min(cell.x + 1, m_cellsX - 1); ++x) {
+                    infected += m_cellInfected[static_cast<size_t>(z) * m_cellsX + x];
+                }
+            }
+            if (infected <= 0.0f) continue;
 
-        uint32_t nearbyId = nearby->getID();
+            // Chance that at least one contact transmits
+            float exposure = contactRate * calculateSusceptibility(*creature) * infected;
+            float chance = 1.0f - std::exp(-exposure);
+            if (unitDraw(roundSeed, m_slotOwner[slot]) < chance) {
+                m_slotState[slot] = SLOT_NEWLY_INFECTED;
+            }
+        }
+    };
 
-        // Skip already infected or immune
-        if (m_infections.find(nearbyId) != m_infections.end()) continue;
-        if (m_immuneCreatures.find(nearbyId) != m_immuneCreatures.end()) continue;
+    const size_t slotCount = m_slotState.size();
+    if (m_parallelTransmission && slotCount > TRANSMISSION_CHUNK) {
+        ThreadPool::shared().parallelFor(slotCount, TRANSMISSION_CHUNK, sampleRange);
+    } else {
+        sampleRange(0, slotCount);
+    }
 
-        // Calculate transmission chance
-        float susceptibility = calculateSusceptibility(*nearby);
-        float transmissionChance = m_strain.transmissionRate * susceptibility * deltaTime;
+    // Create infection records serially; they draw from m_rng
+    for (size_t slot = 0; slot < slotCount; ++slot) {
+        if (m_slotState[slot] != SLOT_NEWLY_INFECTED) continue;
 
-        if (dist(m_rng) < transmissionChance) {
-            infectCreature(nearby);
+        const Creature& creature = *m_slotCreatures[slot];
+        if (!addInfection(creature)) {
+            m_slotState[slot] = SLOT_SUSCEPTIBLE;
+            continue;
+        }
+        m_slotState[slot] = SLOT_INFECTED;
+        disaster.creaturesAffected++;
+
+        // Credit the densest neighbouring cell's source, for R0
+        glm::ivec2 cell;
+        cellOf(creature.getPosition(), cell);
+        float densest = 0.0f;
+        uint32_t source = NO_OWNER;
+        for (int z = std::max(cell.y - 1, 0); z <= std::min(cell.y + 1, m_cellsZ - 1); ++z) {
+            for (int x = std::max(cell.x - 1, 0); x <= std::min(cell.x + 1, m_cellsX - 1); ++x) {
+                const size_t index = static_cast<size_t>(z) * m_cellsX + x;
+                if (m_cellInfected[index] > densest) {
+                    densest = m_cellInfected[index];
+                    source = m_cellSource[index];
+                }
+            }
+        }
+        auto it = m_infections.find(source);
+        if (it != m_infections.end()) {
             it->second.infectedOthers++;
-            disaster.creaturesAffected++;
         }
     }
 }
@@ -411,6 +591,10 @@ void DiseaseOutbreak::reset() {
     m_active = false;
     m_infections.clear();
     m_immuneCreatures.clear();
+    m_slotState.clear();
+    m_slotOwner.clear();
+    m_cellsX = 0;
+    m_cellsZ = 0;
     m_stats = DiseaseStats{};
     m_elapsedTime = 0.0f;
 }
@@ -152,14 +152,29 @@ class DiseaseOutbreak {
     void setMortalityRate(float rate) { m_strain.baseMortalityRate = rate; }
     void setRecoveryRate(float rate) { m_strain.recoveryRate = rate; }
 
+    /**
+     * @brief Reseed the outbreak's random streams
+     *
+     * trigger() seeds from std::random_device; call this afterwards so a
+     * seeded run rolls the same incubations and transmissions.
+     */
+    void setSeed(uint32_t seed);
+
+    // When off, transmission is sampled on the calling thread. A seeded
+    // outbreak infects the same creatures either way.
+    void setParallelTransmission(bool enabled) { m_parallelTransmission = enabled; }
+    bool isParallelTransmission() const { return m_parallelTransmission; }
+
 private:
     // === Internal Methods ===
     void initializeStrain(DisasterSeverity severity);
     void findPatientZero(CreatureManager& creatures);
     void infectCreature(Creature* creature);
-    void updateInfections(float deltaTime, CreatureManager& creatures, ActiveDisaster& disaster);
-    void attemptTransmission(const Creature& infected, CreatureManager& creatures,
-                             float deltaTime, ActiveDisaster& disaster);
+    bool addInfection(const Creature& creature);
+    void syncSlots(CreatureManager& creatures);
+    void updateInfections(float deltaTime, ActiveDisaster& disaster);
+    void accumulateExposure();
+    void attemptTransmission(float deltaTime, ActiveDisaster& disaster);
     void progressInfection(InfectionData& infection, Creature* creature,
                            float deltaTime, ActiveDisaster& disaster);
 
@@ -178,6 +193,38 @@ class DiseaseOutbreak {
     std::unordered_map<uint32_t, InfectionData> m_infections;
     std::unordered_set<uint32_t> m_immuneCreatures;
 
+    // === Per-Slot State ===
+    // One entry per CreatureManager slot, so transmission reads a byte
+    // instead of probing the maps above for every neighbour. m_slotOwner
+    // detects slots that were released and reused by a new creature.
+    enum SlotState : uint8_t {
+        SLOT_SUSCEPTIBLE,
+        SLOT_INFECTED,          // Incubating or recovering, not spreading
+        SLOT_CONTAGIOUS,
+        SLOT_IMMUNE,
+        SLOT_NEWLY_INFECTED     // Caught this round; infection data not yet created
+    };
+    static constexpr uint32_t NO_OWNER = 0xFFFFFFFFu;
+
+    std::vector<uint8_t> m_slotState;
+    std::vector<uint32_t> m_slotOwner;
+    std::vector<Creature*> m_slotCreatures;     // Active creature per slot this frame
+    bool m_resyncSlots = false;                 // Rebuild slot state from the maps
+
+    // === Exposure Grid ===
+    // Contagious creatures per XZ cell over the contagious bounding box
+    // (plus a one-cell margin), rebuilt every transmission round
+    static constexpr size_t MAX_EXPOSURE_CELLS = 1u << 20;
+    std::vector<float> m_cellInfected;
+    std::vector<uint32_t> m_cellSource;         // A contagious creature in each cell
+    glm::ivec2 m_cellOrigin{0};
+    int m_cellsX = 0;
+    int m_cellsZ = 0;
+    float m_cellSize = 1.0f;
+    uint64_t m_transmissionRound = 0;
+    uint64_t m_transmissionSeed = 0;
+    bool m_parallelTransmission = true;
+
     // === Timing ===
     float m_lastTransmissionCheck = 0.0f;
     static constexpr float TRANSMISSION_CHECK_INTERVAL = 0.5f; // Check every 0.5s
@@ -80,6 +80,8 @@
 // Creature Manager (Phase 10)
 #include "core/CreatureManager.h"
 #include "core/FoodChainManager.h"
+// Headless archipelago mode (--archipelago)
+#include "core/ArchipelagoRunner.h"
 // Day/Night Cycle
 #include "core/DayNightCycle.h"
 
@@ -104,12 +106,15 @@
 #include "graphics/rendering/GrassRenderer_DX12.h"
 #include "environment/GrassSystem.h"
 #include "environment/TerrainSampler.h"
+#include "environment/TerrainField.h"
 
 // Tree Rendering System (Phase 5 - 3D World)
 #include "graphics/rendering/TreeRenderer_DX12.h"
 #include "environment/VegetationManager.h"
 #include "environment/Terrain.h"
 #include "environment/ProceduralWorld.h"
+#include "environment/WorldGenContext.h"
+#include "environment/WorldCache.h"
 
 // Climate/Weather
 #include "environment/ClimateSystem.h"
@@ -1947,6 +1952,14 @@ struct CreatureMeshDX12 {
     }
 };
 
+// Offspring queued during the unified creature update and spawned after it
+struct ReproCandidate {
+    CreatureType type;
+    glm::vec3 position;
+    Genome genome;
+    int generation = 0;
+};
+
 // ============================================================================
 // Application State
 // ============================================================================
@@ -1988,6 +2001,9 @@ struct AppState {
     bool useUnifiedSimulation = false;
     const Creature* followCreature = nullptr;
     std::mt19937 unifiedRng;
+    std::vector<ReproCandidate> unifiedReproQueue;  // Kept across frames so birth bursts don't reallocate
+    std::vector<glm::vec3> unifiedClimatePositions;  // Per-creature climate batch, reused across frames
+    std::vector<ClimateData> unifiedClimates;
 
     // ImGui
     ComPtr<ID3D12DescriptorHeap> imguiSrvHeap;
@@ -2170,6 +2186,7 @@ struct AppState {
     std::unique_ptr<TreeRendererDX12> treeRenderer;
     std::unique_ptr<VegetationManager> vegetationManager;
     std::unique_ptr<Terrain> terrain;  // Needed by VegetationManager
+    TerrainField terrainField;  // Baked height/normal/slope/water/biome for runtime queries
     UniquePtr<IShader> treeVertexShader;
     UniquePtr<IShader> treePixelShader;
     UniquePtr<IPipeline> treePipeline;
@@ -2276,6 +2293,9 @@ static void StartWorldGeneration(const ui::WorldGenConfig& menuConfig,
     if (!g_app.proceduralWorld) {
         g_app.proceduralWorld = std::make_unique<ProceduralWorld>();
     }
+    if (!g_app.proceduralWorld->getWorldCache()) {
+        g_app.proceduralWorld->setWorldCache(std::make_shared<WorldCache>());
+    }
 
     g_app.pendingProceduralConfig = ui::translateToProceduralWorldConfig(menuConfig);
     g_app.pendingEvolutionPreset = evolutionPreset;
@@ -2370,12 +2390,19 @@ static void ApplyGeneratedWorldData(const WorldGenConfig& proceduralConfig,
     TerrainSampler::SetHeightmap(&world->islandData.heightmap,
                                  world->islandData.width,
                                  world->islandData.height);
+    g_app.terrainField.bake(world->islandData.heightmap,
+                            world->islandData.width,
+                            world->islandData.height,
+                            worldSize, heightScale, waterLevel);
+    g_app.terrainField.bakeBiomes(*world->biomeSystem);
+    TerrainSampler::SetTerrainField(&g_app.terrainField);
 
     SetLoadingStatus("Building terrain...", 0.92f);
     AppendWorldGenMainLog("Building terrain instance.");
     const float terrainScale = worldSize / static_cast<float>(std::max(1, world->islandData.width));
     g_app.terrain = std::make_unique<Terrain>(world->islandData.width, world->islandData.height, terrainScale);
     g_app.terrain->generate(world->planetSeed.terrainSeed);
+    g_app.terrain->setTerrainField(&g_app.terrainField);
     AppendWorldGenMainLog("Terrain instance ready.");
 
     g_app.world.terrainSeed = world->planetSeed.terrainSeed;
@@ -2396,12 +2423,34 @@ static void ApplyGeneratedWorldData(const WorldGenConfig& proceduralConfig,
                                    world->biomeSystem.get(),
                                    g_app.terrain.get());
     g_app.behaviorCoordinator.reset();
+    g_app.creatureManager->setBehaviorCoordinator(&g_app.behaviorCoordinator);
     AppendWorldGenMainLog("Creature manager initialized.");
 
     SetLoadingStatus("Generating vegetation...", 0.94f);
     AppendWorldGenMainLog("Generating vegetation.");
     g_app.vegetationManager = std::make_unique<VegetationManager>(g_app.terrain.get());
-    g_app.vegetationManager->generate(world->planetSeed.vegetationSeed);
+    {
+        // Placements are cached next to the world so a known seed/config
+        // skips vegetation placement as well
+        const auto& worldCache = g_app.proceduralWorld->getWorldCache();
+        const uint64_t cacheKey = g_app.proceduralWorld->getLastCacheKey();
+        WorldCache::Entry cachedVegetation;
+        if (worldCache && worldCache->loadVegetation(cacheKey, cachedVegetation)) {
+            g_app.vegetationManager->restoreInstances(
+                cachedVegetation.array<TreeInstance>(WorldCache::Section::TREES),
+                cachedVegetation.array<BushInstance>(WorldCache::Section::BUSHES),
+                cachedVegetation.array<GrassCluster>(WorldCache::Section::GRASS));
+            AppendWorldGenMainLog("Vegetation restored from world cache.");
+        } else {
+            g_app.vegetationManager->generate(world->planetSeed.vegetationSeed);
+            if (worldCache) {
+                worldCache->storeVegetation(cacheKey,
+                                            g_app.vegetationManager->getTreeInstances(),
+                                            g_app.vegetationManager->getBushInstances(),
+                                            g_app.vegetationManager->getGrassClusters());
+            }
+        }
+    }
     g_app.vegetationManager->initializeAquaticPlants(nullptr, world->planetSeed.vegetationSeed);
     AppendWorldGenMainLog("Vegetation generated.");
 
@@ -2678,6 +2727,9 @@ static void UpdateUnifiedSimulation(float dt) {
 
     std::vector<glm::vec3> landFoodPositions;
     std::vector<glm::vec3> aquaticFoodPositions;
+    // Scavengers see only the corpses the decomposer's index returns within
+    // their vision range; the buffer is refilled per scavenger
+    DecomposerSystem* decomposers = nullptr;
     std::vector<glm::vec3> scavengerFoodPositions;
     std::vector<glm::vec3> amphibianFoodPositions;
     size_t totalFoodPositions = 0;
@@ -2687,9 +2739,7 @@ static void UpdateUnifiedSimulation(float dt) {
             landFoodPositions = producers->getAllFoodPositions();
             aquaticFoodPositions = producers->getAllAquaticFoodPositions();
         }
-        if (DecomposerSystem* decomposers = g_app.ecosystemManager->getDecomposers()) {
-            scavengerFoodPositions = decomposers->getCorpsePositions();
-        }
+        decomposers = g_app.ecosystemManager->getDecomposers();
     }
 
     if (!landFoodPositions.empty() && !aquaticFoodPositions.empty()) {
@@ -2704,7 +2754,8 @@ static void UpdateUnifiedSimulation(float dt) {
         amphibianFoodPositions = aquaticFoodPositions;
     }
 
-    totalFoodPositions = landFoodPositions.size() + aquaticFoodPositions.size() + scavengerFoodPositions.size();
+    totalFoodPositions = landFoodPositions.size() + aquaticFoodPositions.size() +
+                         (decomposers ? static_cast<size_t>(decomposers->getCorpseCount()) : 0);
     if (g_app.worldDiagnostics && g_app.worldDiagnosticsFrames > 0) {
         LogWorldDiag("Unified step: food positions=" + std::to_string(totalFoodPositions));
     }
@@ -2722,20 +2773,28 @@ static void UpdateUnifiedSimulation(float dt) {
     g_app.behaviorCoordinator.update(scaledDt);
     LogWorldDiag("Unified step: spatial grids rebuilt + behavior updated");
 
-    struct ReproCandidate {
-        CreatureType type;
-        glm::vec3 position;
-        Genome genome;
-        int generation = 0;
-    };
-    std::vector<ReproCandidate> reproQueue;
-    reproQueue.reserve(64);
+    // Offspring genomes are built (copied + mutated) straight into recycled
+    // genome storage and later moved into the new creature.
+    std::vector<ReproCandidate>& reproQueue = g_app.unifiedReproQueue;
+    reproQueue.clear();
+
+    // Climate for every creature in one batch query, at the position each
+    // starts the step from
+    std::vector<glm::vec3>& climatePositions = g_app.unifiedClimatePositions;
+    std::vector<ClimateData>& climates = g_app.unifiedClimates;
+    climatePositions.resize(creatures.size());
+    climates.resize(creatures.size());
+    for (size_t i = 0; i < creatures.size(); ++i) {
+        climatePositions[i] = creatures[i] ? creatures[i]->getPosition() : glm::vec3(0.0f);
+    }
+    g_app.climateSystem.getClimateAt(climatePositions.data(), climates.data(), climatePositions.size());
 
     std::uniform_real_distribution<float> reproChance(0.0f, 1.0f);
     const float reproRate = 0.015f;
 
     int debugLogged = 0;
-    for (Creature* creature : creatures) {
+    for (size_t creatureIndex = 0; creatureIndex < creatures.size(); ++creatureIndex) {
+        Creature* creature = creatures[creatureIndex];
         if (!creature || !creature->isAlive()) {
             continue;
         }
@@ -2745,6 +2804,13 @@ static void UpdateUnifiedSimulation(float dt) {
         }
         const std::vector<glm::vec3>* foodList = &landFoodPositions;
         if (creature->getType() == CreatureType::SCAVENGER) {
+            scavengerFoodPositions.clear();
+            if (decomposers) {
+                for (const Corpse* corpse : decomposers->queryCorpses(creature->getPosition(),
+                                                                      creature->getVisionRange())) {
+                    scavengerFoodPositions.push_back(corpse->position);
+                }
+            }
             foodList = &scavengerFoodPositions;
         } else if (creature->getType() == CreatureType::AMPHIBIAN) {
             foodList = &amphibianFoodPositions;
@@ -2766,11 +2832,10 @@ static void UpdateUnifiedSimulation(float dt) {
             LogWorldDiag("Unified creature update end id=" + std::to_string(creature->getID()));
         }
 
-        ClimateData climate = g_app.climateSystem.getClimateAt(creature->getPosition());
         if (debugLogged < 3) {
             LogWorldDiag("Unified climate response begin id=" + std::to_string(creature->getID()));
         }
-        creature->updateClimateResponse(climate, &g_app.climateSystem, scaledDt);
+        creature->updateClimateResponse(climates[creatureIndex], &g_app.climateSystem, scaledDt);
         if (debugLogged < 3) {
             LogWorldDiag("Unified climate response end id=" + std::to_string(creature->getID()));
         }
@@ -2788,7 +2853,7 @@ static void UpdateUnifiedSimulation(float dt) {
             reproQueue.push_back({
                 creature->getType(),
                 creature->getPosition(),
-                creature->getGenome(),
+                g_app.creatureManager->makeOffspringGenome(creature->getGenome()),
                 creature->getGeneration()
             });
         }
@@ -2800,11 +2865,11 @@ static void UpdateUnifiedSimulation(float dt) {
     LogWorldDiag("Unified step: creature updates done");
 
     if (!reproQueue.empty()) {
-        for (const auto& entry : reproQueue) {
+        for (auto& entry : reproQueue) {
             Forge::CreatureHandle handle = g_app.creatureManager->spawn(
                 entry.type,
                 entry.position,
-                &entry.genome
+                std::move(entry.genome)
             );
             if (Creature* child = g_app.creatureManager->get(handle)) {
                 child->setGeneration(entry.generation + 1);
@@ -5974,6 +6039,11 @@ void UpdateFrame() {
                                             g_app.pendingEvolutionPreset,
                                             g_app.pendingGodMode);
                     AppendRuntimeDiagLog("ApplyGeneratedWorldData returned.");
+                } catch (const WorldGenCancelled&) {
+                    g_app.isLoading = false;
+                    g_app.worldGenInProgress = false;
+                    g_app.mainMenu.setActive(true);
+                    AppendWorldGenMainLog("World generation cancelled.");
                 } catch (const std::exception& ex) {
                     g_app.statusMessage = std::string("World generation failed: ") + ex.what();
                     g_app.statusMessageTimer = 5.0f;
@@ -6904,6 +6974,10 @@ void HandleInput() {
 // ============================================================================
 void Cleanup() {
     if (g_app.worldGenFuture.valid()) {
+        // Don't sit through the rest of a world we're about to throw away
+        if (g_app.proceduralWorld) {
+            g_app.proceduralWorld->requestCancel();
+        }
         g_app.worldGenFuture.wait();
     }
 
@@ -6932,7 +7006,13 @@ void Cleanup() {
 // ============================================================================
 // Main Entry Point
 // ============================================================================
-int main() {
+int main(int argc, char* argv[]) {
+    // Headless archipelago run: no window or device
+    ArchipelagoRunOptions archipelagoOptions;
+    if (parseArchipelagoArgs(argc, argv, archipelagoOptions)) {
+        return runArchipelago(archipelagoOptions);
+    }
+
     std::cout << "==================================================" << std::endl;
     std::cout << "    OrganismEvolution - Evolution Simulator       " << std::endl;
     std::cout << "    DirectX 12 Build with GPU Compute             " << std::endl;
@@ -0,0 +1,302 @@
+#include "BatchNoise.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BATCH_NOISE_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BATCH_NOISE_SSE2 1
+#endif
+
+namespace {
+
+// Points processed per fbm/ridged pass; keeps the scratch rows on the stack
+constexpr size_t CHUNK = 256;
+
+inline float fade(float t) {
+    return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
+}
+
+inline float lerp(float a, float b, float t) {
+    return a + t * (b - a);
+}
+
+inline float grad(int hash, float x, float y) {
+    int h = hash & 7;
+    float u = h < 4 ? x : y;
+    float v = h < 4 ? y : x;
+    return ((h & 1) ? -u : u) + ((h & 2) ? -2.0f * v : 2.0f * v);
+}
+
+#if defined(BATCH_NOISE_AVX2)
+
+inline __m256 fadeV(__m256 t) {
+    __m256 inner = _mm256_add_ps(
+        _mm256_mul_ps(t, _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)), _mm256_set1_ps(15.0f))),
+        _mm256_set1_ps(10.0f));
+    return _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(t, t), t), inner);
+}
+
+inline __m256 lerpV(__m256 a, __m256 b, __m256 t) {
+    return _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+}
+
+// grad() without branches: swap x/y on bit 2, negate on bits 0 and 1
+inline __m256 gradV(__m256i hash, __m256 x, __m256 y) {
+    __m256i swap = _mm256_cmpeq_epi32(_mm256_and_si256(hash, _mm256_set1_epi32(4)), _mm256_set1_epi32(4));
+    __m256 swapMask = _mm256_castsi256_ps(swap);
+    __m256 u = _mm256_blendv_ps(x, y, swapMask);
+    __m256 v = _mm256_blendv_ps(y, x, swapMask);
+    __m256 signU = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(hash, _mm256_set1_epi32(1)), 31));
+    __m256 signV = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(hash, _mm256_set1_epi32(2)), 30));
+    v = _mm256_mul_ps(v, _mm256_set1_ps(2.0f));
+    return _mm256_add_ps(_mm256_xor_ps(u, signU), _mm256_xor_ps(v, signV));
+}
+
+inline __m256 perlin8(const uint8_t* cornerHash, int stride, __m256 x, __m256 y) {
+    __m256 fx = _mm256_floor_ps(x);
+    __m256 fy = _mm256_floor_ps(y);
+    __m256i mask = _mm256_set1_epi32(255);
+    __m256i X = _mm256_and_si256(_mm256_cvttps_epi32(fx), mask);
+    __m256i Y = _mm256_and_si256(_mm256_cvttps_epi32(fy), mask);
+    x = _mm256_sub_ps(x, fx);
+    y = _mm256_sub_ps(y, fy);
+
+    __m256 u = fadeV(x);
+    __m256 v = fadeV(y);
+
+    // Byte gathers: load 32 bits at each corner's offset, keep the low byte
+    const int* table = reinterpret_cast<const int*>(cornerHash);
+    __m256i AA = _mm256_add_epi32(_mm256_mullo_epi32(X, _mm256_set1_epi32(stride)), Y);
+    __m256i BA = _mm256_add_epi32(AA, _mm256_set1_epi32(stride));
+    __m256i one = _mm256_set1_epi32(1);
+    __m256i hAA = _mm256_and_si256(_mm256_i32gather_epi32(table, AA, 1), mask);
+    __m256i hBA = _mm256_and_si256(_mm256_i32gather_epi32(table, BA, 1), mask);
+    __m256i hAB = _mm256_and_si256(_mm256_i32gather_epi32(table, _mm256_add_epi32(AA, one), 1), mask);
+    __m256i hBB = _mm256_and_si256(_mm256_i32gather_epi32(table, _mm256_add_epi32(BA, one), 1), mask);
+
+    __m256 x1 = _mm256_sub_ps(x, _mm256_set1_ps(1.0f));
+    __m256 y1 = _mm256_sub_ps(y, _mm256_set1_ps(1.0f));
+    return lerpV(
+        lerpV(gradV(hAA, x, y), gradV(hBA, x1, y), u),
+        lerpV(gradV(hAB, x, y1), gradV(hBB, x1, y1), u),
+        v);
+}
+
+#elif defined(BATCH_NOISE_SSE2)
+
+inline __m128 floorV(__m128 x) {
+    __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+    return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, x), _mm_set1_ps(1.0f)));
+}
+
+inline __m128 fadeV(__m128 t) {
+    __m128 inner = _mm_add_ps(
+        _mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))),
+        _mm_set1_ps(10.0f));
+    return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, t), t), inner);
+}
+
+inline __m128 lerpV(__m128 a, __m128 b, __m128 t) {
+    return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+}
+
+inline __m128 selectV(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, b), _mm_andnot_ps(mask, a));
+}
+
+// grad() without branches: swap x/y on bit 2, negate on bits 0 and 1
+inline __m128 gradV(__m128i hash, __m128 x, __m128 y) {
+    __m128 swapMask = _mm_castsi128_ps(
+        _mm_cmpeq_epi32(_mm_and_si128(hash, _mm_set1_epi32(4)), _mm_set1_epi32(4)));
+    __m128 u = selectV(swapMask, x, y);
+    __m128 v = selectV(swapMask, y, x);
+    __m128 signU = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(hash, _mm_set1_epi32(1)), 31));
+    __m128 signV = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(hash, _mm_set1_epi32(2)), 30));
+    v = _mm_mul_ps(v, _mm_set1_ps(2.0f));
+    return _mm_add_ps(_mm_xor_ps(u, signU), _mm_xor_ps(v, signV));
+}
+
+inline __m128 perlin4(const uint8_t* cornerHash, int stride, __m128 x, __m128 y) {
+    __m128 fx = floorV(x);
+    __m128 fy = floorV(y);
+    __m128i mask = _mm_set1_epi32(255);
+    alignas(16) int32_t X[4];
+    alignas(16) int32_t Y[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(X), _mm_and_si128(_mm_cvttps_epi32(fx), mask));
+    _mm_store_si128(reinterpret_cast<__m128i*>(Y), _mm_and_si128(_mm_cvttps_epi32(fy), mask));
+    x = _mm_sub_ps(x, fx);
+    y = _mm_sub_ps(y, fy);
+
+    __m128 u = fadeV(x);
+    __m128 v = fadeV(y);
+
+    // SSE2 has no gather; the lookups are scalar, the arithmetic is not.
+    // Lanes are assembled in registers to avoid store-forwarding stalls.
+    const uint8_t* c0 = cornerHash + X[0] * stride + Y[0];
+    const uint8_t* c1 = cornerHash + X[1] * stride + Y[1];
+    const uint8_t* c2 = cornerHash + X[2] * stride + Y[2];
+    const uint8_t* c3 = cornerHash + X[3] * stride + Y[3];
+    auto corners = [&](int offset) {
+        return _mm_set_epi32(c3[offset], c2[offset], c1[offset], c0[offset]);
+    };
+
+    __m128 x1 = _mm_sub_ps(x, _mm_set1_ps(1.0f));
+    __m128 y1 = _mm_sub_ps(y, _mm_set1_ps(1.0f));
+    return lerpV(
+        lerpV(gradV(corners(0), x, y), gradV(corners(stride), x1, y), u),
+        lerpV(gradV(corners(1), x, y1), gradV(corners(stride + 1), x1, y1), u),
+        v);
+}
+
+#endif
+
+} // namespace
+
+BatchNoise::BatchNoise() {
+    int identity[512];
+    std::iota(identity, identity + 256, 0);
+    std::iota(identity + 256, identity + 512, 0);
+    setPermutation(identity);
+}
+
+BatchNoise::BatchNoise(const int* permutation) {
+    setPermutation(permutation);
+}
+
+void BatchNoise::setPermutation(const int* permutation) {
+    for (int i = 0; i < 512; ++i) {
+        m_perm[i] = permutation[i] & 255;
+    }
+
+    for (int X = 0; X < HASH_STRIDE; ++X) {
+        for (int Y = 0; Y < HASH_STRIDE; ++Y) {
+            m_cornerHash[X * HASH_STRIDE + Y] = static_cast<uint8_t>(m_perm[m_perm[X] + Y]);
+        }
+    }
+    std::fill(std::begin(m_cornerHash) + HASH_STRIDE * HASH_STRIDE, std::end(m_cornerHash), uint8_t(0));
+}
+
+float BatchNoise::perlin(float x, float y) const {
+    int X = static_cast<int>(std::floor(x)) & 255;
+    int Y = static_cast<int>(std::floor(y)) & 255;
+
+    x -= std::floor(x);
+    y -= std::floor(y);
+
+    float u = fade(x);
+    float v = fade(y);
+
+    int A = m_perm[X] + Y;
+    int B = m_perm[X + 1] + Y;
+
+    return lerp(
+        lerp(grad(m_perm[A], x, y), grad(m_perm[B], x - 1, y), u),
+        lerp(grad(m_perm[A + 1], x, y - 1), grad(m_perm[B + 1], x - 1, y - 1), u),
+        v
+    );
+}
+
+void BatchNoise::perlinBlock(const float* x, const float* y, float* out) const {
+#if defined(BATCH_NOISE_AVX2)
+    _mm256_storeu_ps(out, perlin8(m_cornerHash, HASH_STRIDE, _mm256_loadu_ps(x), _mm256_loadu_ps(y)));
+#elif defined(BATCH_NOISE_SSE2)
+    _mm_storeu_ps(out, perlin4(m_cornerHash, HASH_STRIDE, _mm_loadu_ps(x), _mm_loadu_ps(y)));
+    _mm_storeu_ps(out + 4, perlin4(m_cornerHash, HASH_STRIDE, _mm_loadu_ps(x + 4), _mm_loadu_ps(y + 4)));
+#else
+    for (size_t i = 0; i < LANES; ++i) {
+        out[i] = perlin(x[i], y[i]);
+    }
+#endif
+}
+
+void BatchNoise::perlin(const float* x, const float* y, float* out, size_t count) const {
+    size_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        perlinBlock(x + i, y + i, out + i);
+    }
+
+    if (i < count) {
+        // Pad the tail to a full block
+        float tx[LANES] = {};
+        float ty[LANES] = {};
+        float result[LANES];
+        size_t remaining = count - i;
+        std::copy(x + i, x + count, tx);
+        std::copy(y + i, y + count, ty);
+        perlinBlock(tx, ty, result);
+        std::copy(result, result + remaining, out + i);
+    }
+}
+
+void BatchNoise::fbm(const float* x, const float* y, float* out, size_t count,
+                     int octaves, float persistence, float lacunarity) const {
+    alignas(32) float sx[CHUNK];
+    alignas(32) float sy[CHUNK];
+    alignas(32) float noise[CHUNK];
+    alignas(32) float total[CHUNK];
+
+    for (size_t base = 0; base < count; base += CHUNK) {
+        const size_t n = std::min(CHUNK, count - base);
+        std::fill(total, total + n, 0.0f);
+
+        float frequency = 1.0f;
+        float amplitude = 1.0f;
+        float maxValue = 0.0f;
+        for (int octave = 0; octave < octaves; ++octave) {
+            for (size_t i = 0; i < n; ++i) {
+                sx[i] = x[base + i] * frequency;
+                sy[i] = y[base + i] * frequency;
+            }
+            perlin(sx, sy, noise, n);
+            for (size_t i = 0; i < n; ++i) {
+                total[i] += noise[i] * amplitude;
+            }
+            maxValue += amplitude;
+            amplitude *= persistence;
+            frequency *= lacunarity;
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            out[base + i] = total[i] / maxValue;
+        }
+    }
+}
+
+void BatchNoise::ridged(const float* x, const float* y, float* out, size_t count, int octaves) const {
+    alignas(32) float sx[CHUNK];
+    alignas(32) float sy[CHUNK];
+    alignas(32) float noise[CHUNK];
+    alignas(32) float total[CHUNK];
+
+    for (size_t base = 0; base < count; base += CHUNK) {
+        const size_t n = std::min(CHUNK, count - base);
+        std::fill(total, total + n, 0.0f);
+
+        float frequency = 1.0f;
+        float amplitude = 1.0f;
+        float maxValue = 0.0f;
+        for (int octave = 0; octave < octaves; ++octave) {
+            for (size_t i = 0; i < n; ++i) {
+                sx[i] = x[base + i] * frequency;
+                sy[i] = y[base + i] * frequency;
+            }
+            perlin(sx, sy, noise, n);
+            for (size_t i = 0; i < n; ++i) {
+                float r = 1.0f - std::abs(noise[i]);
+                total[i] += r * r * amplitude;
+            }
+            maxValue += amplitude;
+            amplitude *= 0.5f;
+            frequency *= 2.0f;
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            out[base + i] = total[i] / maxValue;
+        }
+    }
+}
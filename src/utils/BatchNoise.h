@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class BatchNoise
+ * @brief 2D gradient (Perlin) noise evaluated over arrays of sample points.
+ *
+ * Same noise as the per-point perlin2D used by TerrainSampler and
+ * IslandGenerator (256-entry permutation, 8 gradient directions), but
+ * evaluated LANES points at a time: SSE2 on x86-64, AVX2 with gathered
+ * permutation lookups when built with AVX2 enabled, and a scalar loop
+ * elsewhere. Results match the scalar path to within float rounding.
+ *
+ * Callers compute the sample coordinates exactly as their per-point code
+ * did, then hand whole rows or tiles to perlin()/fbm()/ridged().
+ */
+class BatchNoise {
+public:
+    static constexpr size_t LANES = 8;
+
+    BatchNoise();
+    // permutation: 512 entries (a 256-entry shuffle repeated twice)
+    explicit BatchNoise(const int* permutation);
+
+    void setPermutation(const int* permutation);
+
+    // Scalar reference; identical to the per-point perlin2D. Range ~[-1, 1].
+    float perlin(float x, float y) const;
+
+    // out[i] = perlin(x[i], y[i])
+    void perlin(const float* x, const float* y, float* out, size_t count) const;
+
+    // out[i] = sum over octaves of perlin(x[i] * f, y[i] * f) * a, normalized
+    // by the amplitude sum (f *= lacunarity, a *= persistence per octave)
+    void fbm(const float* x, const float* y, float* out, size_t count,
+             int octaves, float persistence = 0.5f, float lacunarity = 2.0f) const;
+
+    // Ridged multifractal: (1 - |perlin|)^2 per octave, halving amplitude
+    void ridged(const float* x, const float* y, float* out, size_t count, int octaves) const;
+
+private:
+    // Corner hashes perm[perm[X] + Y] for X, Y in [0, 256], so each lane
+    // needs four independent lookups instead of two dependent rounds.
+    // Padded so 32-bit gathers at the last entry stay in bounds.
+    static constexpr int HASH_STRIDE = 257;
+
+    alignas(32) int32_t m_perm[512];
+    alignas(32) uint8_t m_cornerHash[HASH_STRIDE * HASH_STRIDE + 3];
+
+    // Exactly LANES points
+    void perlinBlock(const float* x, const float* y, float* out) const;
+};
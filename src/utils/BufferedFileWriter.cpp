@@ -0,0 +1,86 @@
+#include "BufferedFileWriter.h"
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+
+BufferedFileWriter::BufferedFileWriter(size_t bufferSize)
+    : m_buffer(std::max<size_t>(bufferSize, 256)) {
+}
+
+BufferedFileWriter::~BufferedFileWriter() {
+    close();
+}
+
+bool BufferedFileWriter::open(const std::string& path) {
+    close();
+
+    m_file = std::fopen(path.c_str(), "wb");
+    m_used = 0;
+    m_bytesWritten = 0;
+    m_error = (m_file == nullptr);
+    return m_file != nullptr;
+}
+
+bool BufferedFileWriter::close() {
+    if (!m_file) return false;
+
+    flush();
+    if (std::fclose(m_file) != 0) {
+        m_error = true;
+    }
+    m_file = nullptr;
+    return !m_error;
+}
+
+void BufferedFileWriter::flush() {
+    if (m_used == 0 || !m_file) return;
+
+    if (!m_error && std::fwrite(m_buffer.data(), 1, m_used, m_file) != m_used) {
+        m_error = true;
+    }
+    m_used = 0;
+}
+
+void BufferedFileWriter::write(std::string_view text) {
+    if (!good()) return;
+
+    m_bytesWritten += text.size();
+
+    while (!text.empty()) {
+        if (m_used == m_buffer.size()) {
+            flush();
+        }
+        size_t chunk = std::min(text.size(), m_buffer.size() - m_used);
+        std::memcpy(m_buffer.data() + m_used, text.data(), chunk);
+        m_used += chunk;
+        text.remove_prefix(chunk);
+    }
+}
+
+void BufferedFileWriter::put(char c) {
+    if (!good()) return;
+
+    if (m_used == m_buffer.size()) {
+        flush();
+    }
+    m_buffer[m_used++] = c;
+    m_bytesWritten++;
+}
+
+void BufferedFileWriter::writeInt(int64_t value) {
+    char text[32];
+    int len = std::snprintf(text, sizeof(text), "%" PRId64, value);
+    write(std::string_view(text, static_cast<size_t>(len)));
+}
+
+void BufferedFileWriter::writeUInt(uint64_t value) {
+    char text[32];
+    int len = std::snprintf(text, sizeof(text), "%" PRIu64, value);
+    write(std::string_view(text, static_cast<size_t>(len)));
+}
+
+void BufferedFileWriter::writeFloat(double value) {
+    char text[32];
+    int len = std::snprintf(text, sizeof(text), "%g", value);
+    write(std::string_view(text, static_cast<size_t>(len)));
+}
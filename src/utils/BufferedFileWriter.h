@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class BufferedFileWriter
+ * @brief Fixed-buffer text sink for large exports.
+ *
+ * Appends into a single reusable buffer and flushes it to disk when full,
+ * so exporters can stream arbitrarily large output with constant memory.
+ * Number formatting matches std::ostream defaults (%g for floats) so files
+ * stay byte-compatible with the older ofstream-based writers.
+ *
+ * Errors are sticky: once a write fails, good() returns false and further
+ * writes are dropped. close() reports the final status.
+ */
+class BufferedFileWriter {
+public:
+    explicit BufferedFileWriter(size_t bufferSize = 64 * 1024);
+    ~BufferedFileWriter();
+
+    BufferedFileWriter(const BufferedFileWriter&) = delete;
+    BufferedFileWriter& operator=(const BufferedFileWriter&) = delete;
+
+    bool open(const std::string& path);
+    // Flushes and closes. Returns true if every write succeeded.
+    bool close();
+
+    bool isOpen() const { return m_file != nullptr; }
+    bool good() const { return m_file != nullptr && !m_error; }
+
+    void write(std::string_view text);
+    void put(char c);
+    void writeInt(int64_t value);
+    void writeUInt(uint64_t value);
+    void writeFloat(double value);
+
+    // Bytes written since open() (including buffered, unflushed bytes)
+    uint64_t bytesWritten() const { return m_bytesWritten; }
+
+private:
+    FILE* m_file = nullptr;
+    std::vector<char> m_buffer;
+    size_t m_used = 0;
+    uint64_t m_bytesWritten = 0;
+    bool m_error = false;
+
+    void flush();
+};
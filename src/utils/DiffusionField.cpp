@@ -0,0 +1,144 @@
+#include "DiffusionField.h"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DIFFUSION_FIELD_SSE2 1
+#endif
+
+namespace {
+
+inline float stepCell(float left, float centre, float right, float up, float down,
+                      float diffusion, float keep, float loss, float cutoff) {
+    float mean = 0.25f * ((left + right) + (up + down));
+    float value = (centre + diffusion * (mean - centre)) * keep - loss;
+    return value < cutoff ? 0.0f : value;
+}
+
+} // namespace
+
+DiffusionField::DiffusionField(float worldSize, int cellsPerSide) {
+    resize(worldSize, cellsPerSide);
+}
+
+void DiffusionField::resize(float worldSize, int cellsPerSide) {
+    m_cells = std::max(1, cellsPerSide);
+    m_cellSize = worldSize / static_cast<float>(m_cells);
+    m_invCellSize = 1.0f / m_cellSize;
+    m_halfWorld = worldSize * 0.5f;
+    m_front.assign(static_cast<size_t>(m_cells) * m_cells, 0.0f);
+    m_back.assign(m_front.size(), 0.0f);
+    m_active = false;
+}
+
+void DiffusionField::clear() {
+    std::fill(m_front.begin(), m_front.end(), 0.0f);
+    m_active = false;
+}
+
+int DiffusionField::cellX(float worldX) const {
+    return std::clamp(static_cast<int>((worldX + m_halfWorld) * m_invCellSize), 0, m_cells - 1);
+}
+
+int DiffusionField::cellZ(float worldZ) const {
+    return std::clamp(static_cast<int>((worldZ + m_halfWorld) * m_invCellSize), 0, m_cells - 1);
+}
+
+void DiffusionField::deposit(float worldX, float worldZ, float amount, float maxValue) {
+    if (m_front.empty()) return;
+    float& cell = m_front[static_cast<size_t>(cellZ(worldZ)) * m_cells + cellX(worldX)];
+    cell = std::min(maxValue, cell + amount);
+    m_active = m_active || cell > 0.0f;
+}
+
+float DiffusionField::sample(float worldX, float worldZ) const {
+    if (!m_active) return 0.0f;
+    return at(cellX(worldX), cellZ(worldZ));
+}
+
+void DiffusionField::gradient(float worldX, float worldZ, int stepCells, float& outX, float& outZ) const {
+    outX = 0.0f;
+    outZ = 0.0f;
+    if (!m_active) return;
+
+    const int x = cellX(worldX);
+    const int z = cellZ(worldZ);
+    const int x0 = std::max(x - stepCells, 0);
+    const int x1 = std::min(x + stepCells, m_cells - 1);
+    const int z0 = std::max(z - stepCells, 0);
+    const int z1 = std::min(z + stepCells, m_cells - 1);
+
+    outX = at(x1, z) - at(x0, z);
+    outZ = at(x, z1) - at(x, z0);
+}
+
+// ============================================================================
+// Diffusion / decay
+// ============================================================================
+
+bool DiffusionField::stepRow(const float* up, const float* row, const float* down, float* out,
+                             float diffusion, float keep, float loss, float cutoff) const {
+    const int last = m_cells - 1;
+    bool any = false;
+
+    // Edge cells reflect: the missing neighbour is the cell itself
+    out[0] = stepCell(row[0], row[0], row[std::min(1, last)], up[0], down[0],
+                      diffusion, keep, loss, cutoff);
+    any = any || out[0] > 0.0f;
+    if (last == 0) return any;
+
+    int x = 1;
+
+#if defined(DIFFUSION_FIELD_SSE2)
+    const __m128 quarter = _mm_set1_ps(0.25f);
+    const __m128 rate = _mm_set1_ps(diffusion);
+    const __m128 keepV = _mm_set1_ps(keep);
+    const __m128 lossV = _mm_set1_ps(loss);
+    const __m128 cutoffV = _mm_set1_ps(cutoff);
+    const __m128 zero = _mm_setzero_ps();
+    __m128 nonzero = zero;
+
+    for (; x + 4 <= last; x += 4) {
+        __m128 centre = _mm_loadu_ps(row + x);
+        __m128 horizontal = _mm_add_ps(_mm_loadu_ps(row + x - 1), _mm_loadu_ps(row + x + 1));
+        __m128 vertical = _mm_add_ps(_mm_loadu_ps(up + x), _mm_loadu_ps(down + x));
+        __m128 mean = _mm_mul_ps(quarter, _mm_add_ps(horizontal, vertical));
+        __m128 value = _mm_add_ps(centre, _mm_mul_ps(rate, _mm_sub_ps(mean, centre)));
+        value = _mm_sub_ps(_mm_mul_ps(value, keepV), lossV);
+        value = _mm_and_ps(_mm_cmpge_ps(value, cutoffV), value);
+        nonzero = _mm_or_ps(nonzero, _mm_cmpgt_ps(value, zero));
+        _mm_storeu_ps(out + x, value);
+    }
+    any = any || _mm_movemask_ps(nonzero) != 0;
+#endif
+
+    for (; x < last; ++x) {
+        out[x] = stepCell(row[x - 1], row[x], row[x + 1], up[x], down[x],
+                          diffusion, keep, loss, cutoff);
+        any = any || out[x] > 0.0f;
+    }
+
+    out[last] = stepCell(row[last - 1], row[last], row[last], up[last], down[last],
+                         diffusion, keep, loss, cutoff);
+    return any || out[last] > 0.0f;
+}
+
+void DiffusionField::step(float diffusion, float keep, float loss, float cutoff) {
+    if (!m_active) return;
+
+    diffusion = std::clamp(diffusion, 0.0f, 1.0f);
+    const size_t stride = static_cast<size_t>(m_cells);
+    const float* src = m_front.data();
+    float* dst = m_back.data();
+    bool any = false;
+
+    for (int z = 0; z < m_cells; ++z) {
+        const float* row = src + z * stride;
+        const float* up = src + std::max(z - 1, 0) * stride;
+        const float* down = src + std::min(z + 1, m_cells - 1) * stride;
+        any = stepRow(up, row, down, dst + z * stride, diffusion, keep, loss, cutoff) || any;
+    }
+
+    m_front.swap(m_back);
+    m_active = any;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class DiffusionField
+ * @brief Dense 2D concentration grid with a double-buffered diffuse/decay step.
+ *
+ * One float per cell, row-major, covering a square world area centred on the
+ * origin. step() diffuses every cell toward the mean of its four neighbours
+ * (edges reflect, so diffusion alone conserves the total) and then applies
+ * multiplicative and linear decay, writing into a back buffer that is
+ * swapped in afterwards. The row kernel runs four cells at a time on SSE2.
+ *
+ * Cost depends only on the grid size, not on how many agents deposit into
+ * it; a field that has fully decayed to zero skips step() entirely.
+ */
+class DiffusionField {
+public:
+    DiffusionField() = default;
+    DiffusionField(float worldSize, int cellsPerSide);
+
+    void resize(float worldSize, int cellsPerSide);
+    void clear();
+
+    int getCellsPerSide() const { return m_cells; }
+    float getCellSize() const { return m_cellSize; }
+    bool isActive() const { return m_active; }
+    const float* data() const { return m_front.data(); }
+
+    // Cell containing a world position, clamped to the grid
+    int cellX(float worldX) const;
+    int cellZ(float worldZ) const;
+    float cellCenterX(int x) const { return (x + 0.5f) * m_cellSize - m_halfWorld; }
+    float cellCenterZ(int z) const { return (z + 0.5f) * m_cellSize - m_halfWorld; }
+
+    float at(int x, int z) const { return m_front[static_cast<size_t>(z) * m_cells + x]; }
+
+    // Add amount to the cell at a world position, capped at maxValue
+    void deposit(float worldX, float worldZ, float amount, float maxValue);
+
+    // Nearest-cell value at a world position
+    float sample(float worldX, float worldZ) const;
+
+    // Central differences between the cells stepCells away on each axis
+    // (clamped at the edges); not divided by the spacing
+    void gradient(float worldX, float worldZ, int stepCells, float& outX, float& outZ) const;
+
+    // c' = (c + diffusion * (mean4 - c)) * keep - loss, then values below
+    // cutoff become zero. diffusion is clamped to [0, 1] to stay stable.
+    void step(float diffusion, float keep, float loss, float cutoff);
+
+private:
+    std::vector<float> m_front;
+    std::vector<float> m_back;
+    int m_cells = 0;
+    float m_cellSize = 1.0f;
+    float m_invCellSize = 1.0f;
+    float m_halfWorld = 0.0f;
+    bool m_active = false;      // Any nonzero cell in m_front
+
+    // One row of step(); returns true if any output cell is nonzero
+    bool stepRow(const float* up, const float* row, const float* down, float* out,
+                 float diffusion, float keep, float loss, float cutoff) const;
+};
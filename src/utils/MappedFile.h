@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a file on disk.
+ *
+ * Thin RAII wrapper over CreateFileMapping/MapViewOfFile on Windows and
+ * mmap elsewhere. Used by systems that spill cold, immutable data to disk
+ * and want to keep reading it without holding it in the process heap.
+ *
+ * The mapping is released on close() or destruction. Move-only.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // Map an existing file read-only. Returns false (and stays closed) on failure.
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return m_data != nullptr; }
+    const uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    const std::string& path() const { return m_path; }
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    std::string m_path;
+
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+#else
+    int m_fd = -1;
+#endif
+};
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of worker threads for fan-out simulation work.
+ *
+ * Two entry points:
+ * - submit(): queue a single task, get a std::future for its result.
+ * - parallelFor(): split [0, count) into chunks and block until every chunk
+ *   has run. The calling thread works through chunks too, so parallelFor is
+ *   safe to call from inside a pool task (it degrades to running inline
+ *   when every worker is busy) and never deadlocks on a saturated pool.
+ *
+ * Chunk boundaries depend only on count and grainSize, never on timing, so
+ * callers that key their per-chunk state (RNG seeds, output slots) off the
+ * chunk range get identical results regardless of thread count.
+ */
+class ThreadPool {
+public:
+    // threadCount == 0 picks hardware_concurrency() - 1 (at least 1)
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Process-wide pool shared by simulation systems
+    static ThreadPool& shared();
+
+    size_t getThreadCount() const { return m_workers.size(); }
+
+    template <typename Fn>
+    auto submit(Fn&& fn) -> std::future<std::invoke_result_t<std::decay_t<Fn>>>;
+
+    /**
+     * @brief Runs fn(begin, end) over [0, count) in chunks of grainSize.
+     *
+     * Blocks until every chunk has finished. The first exception thrown by
+     * any chunk is rethrown on the calling thread.
+     */
+    template <typename Fn>
+    void parallelFor(size_t count, size_t grainSize, Fn&& fn);
+
+private:
+    std::vector<std::thread> m_workers;
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_stopping = false;
+
+    void enqueue(std::function<void()> task);
+    void workerLoop();
+};
+
+// ============================================================================
+// Template implementations
+// ============================================================================
+
+template <typename Fn>
+auto ThreadPool::submit(Fn&& fn) -> std::future<std::invoke_result_t<std::decay_t<Fn>>> {
+    using Result = std::invoke_result_t<std::decay_t<Fn>>;
+
+    auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Fn>(fn));
+    std::future<Result> result = task->get_future();
+    enqueue([task]() { (*task)(); });
+    return result;
+}
+
+template <typename Fn>
+void ThreadPool::parallelFor(size_t count, size_t grainSize, Fn&& fn) {
+    if (count == 0) return;
+
+    grainSize = std::max<size_t>(grainSize, 1);
+    const size_t chunkCount = (count + grainSize - 1) / grainSize;
+
+    if (chunkCount == 1 || m_workers.empty()) {
+        fn(size_t(0), count);
+        return;
+    }
+
+    // Shared so helpers that only get scheduled after the loop finished can
+    // still safely observe that there is nothing left to do.
+    struct State {
+        std::atomic<size_t> nextChunk{0};
+        size_t completedChunks = 0;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+    auto state = std::make_shared<State>();
+
+    // Helpers may outlive this frame only while nextChunk < chunkCount, which
+    // can't happen after we return, so capturing fn by pointer is safe.
+    auto* body = &fn;
+    auto runChunks = [state, body, count, grainSize, chunkCount]() {
+        for (;;) {
+            size_t chunk = state->nextChunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= chunkCount) return;
+
+            size_t begin = chunk * grainSize;
+            size_t end = std::min(begin + grainSize, count);
+            std::exception_ptr error;
+            try {
+                (*body)(begin, end);
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (error && !state->error) state->error = error;
+            if (++state->completedChunks == chunkCount) {
+                state->done.notify_all();
+            }
+        }
+    };
+
+    const size_t helpers = std::min(m_workers.size(), chunkCount - 1);
+    for (size_t i = 0; i < helpers; i++) {
+        enqueue(runChunks);
+    }
+    runChunks();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&]() { return state->completedChunks == chunkCount; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
@@ -0,0 +1,607 @@
+// test_archipelago.cpp - Unit tests for the multi-island archipelago
+// Tests per-island simulation clocks, the determinism of the inter-island
+// migration queues, creature records and a distributed run over sockets
+
+#include "core/MultiIslandManager.h"
+#include "core/CoarseIslandModel.h"
+#include "core/DistributedArchipelago.h"
+#include "entities/behaviors/InterIslandMigration.h"
+#include "environment/ArchipelagoGenerator.h"
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <filesystem>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace Forge;
+
+// Helper function for float comparison
+bool approxEqual(float a, float b, float epsilon = 0.001f) {
+    return std::abs(a - b) < epsilon;
+}
+
+// Small, fully generated archipelago
+std::unique_ptr<MultiIslandManager> makeArchipelago(int islandCount, uint32_t seed) {
+    ArchipelagoGenerator archipelago;
+    archipelago.generateWithSeed(islandCount, ArchipelagoGenerator::DEFAULT_SPACING, seed);
+
+    auto islands = std::make_unique<MultiIslandManager>();
+    islands->setTerrainSize(64);
+    islands->init(archipelago);
+    islands->generateAll(seed);
+    return islands;
+}
+
+bool sameVec(const glm::vec3& a, const glm::vec3& b) {
+    return approxEqual(a.x, b.x) && approxEqual(a.y, b.y) && approxEqual(a.z, b.z);
+}
+
+// ============================================================================
+// Island Clock Tests
+// ============================================================================
+
+void testIslandClocksAreIndependent() {
+    std::cout << "Testing per-island clocks..." << std::endl;
+
+    // Every inactive island keeps its own clock, so the step pattern must not
+    // depend on how many other islands share the archipelago
+    for (int islandCount : {2, 4}) {
+        auto islands = makeArchipelago(islandCount, 777);
+        islands->setActiveIsland(0);
+
+        // Inactive islands step once their clock passes 0.1s: at 0.12, then
+        // carry 0.08 towards the next step
+        for (int i = 0; i < 5; i++) {
+            islands->update(0.04f);
+        }
+        assert(approxEqual(islands->getIsland(0)->detailedTime, 0.2f));
+        assert(approxEqual(islands->getIsland(0)->accumulatedTime, 0.0f));
+        for (uint32_t i = 1; i < islands->getIslandCount(); i++) {
+            const Island* island = islands->getIsland(i);
+            assert(approxEqual(island->detailedTime, 0.12f));
+            assert(approxEqual(island->accumulatedTime, 0.08f));
+        }
+
+        // Switching the camera: island 1 steps every tick, island 0 starts
+        // its own clock from zero
+        islands->setActiveIsland(1);
+        islands->update(0.04f);
+        islands->update(0.04f);
+        assert(approxEqual(islands->getIsland(1)->detailedTime, 0.2f));
+        assert(approxEqual(islands->getIsland(1)->accumulatedTime, 0.08f));
+        assert(approxEqual(islands->getIsland(0)->detailedTime, 0.2f));
+        assert(approxEqual(islands->getIsland(0)->accumulatedTime, 0.08f));
+
+        // The remaining islands took their second step at 0.12 more
+        for (uint32_t i = 2; i < islands->getIslandCount(); i++) {
+            const Island* island = islands->getIsland(i);
+            assert(approxEqual(island->detailedTime, 0.24f));
+            assert(approxEqual(island->accumulatedTime, 0.04f));
+        }
+    }
+
+    std::cout << "  Per-island clock test passed!" << std::endl;
+}
+
+// ============================================================================
+// Migration Queue Tests
+// ============================================================================
+
+// Departures from one tick with every creature rolling a migration
+std::vector<MigrationEvent> rollDepartures(uint32_t seed) {
+    auto islands = makeArchipelago(4, 4242);
+
+    MigrationConfig config;
+    config.baseMigrationChance = 1.0f;
+
+    InterIslandMigration migration;
+    migration.setConfig(config);
+    migration.setSeed(seed);
+
+    // No time passes, so nobody arrives or dies in transit
+    migration.update(0.0f, *islands);
+    return migration.getActiveMigrations();
+}
+
+void testMigrationQueueDeterminism() {
+    std::cout << "Testing migration queue determinism..." << std::endl;
+
+    std::vector<MigrationEvent> first = rollDepartures(99);
+    std::vector<MigrationEvent> second = rollDepartures(99);
+
+    assert(!first.empty());
+    assert(first.size() == second.size());
+
+    // Per-island streams drain in island order whatever the task schedule.
+    // Survival chance and genome come from the shared Random engine, so
+    // only the decisions taken from the island streams are compared.
+    for (size_t i = 0; i < first.size(); i++) {
+        const MigrationEvent& a = first[i];
+        const MigrationEvent& b = second[i];
+        assert(a.sourceIsland == b.sourceIsland);
+        assert(a.targetIsland == b.targetIsland);
+        assert(a.type == b.type);
+        assert(a.creatureType == b.creatureType);
+        assert(sameVec(a.startPosition, b.startPosition));
+        assert(sameVec(a.targetPosition, b.targetPosition));
+        assert(a.sourceIsland != a.targetIsland);
+
+        if (i > 0) {
+            assert(first[i - 1].sourceIsland <= a.sourceIsland);
+        }
+    }
+
+    // A different seed rolls a different set of departures
+    std::vector<MigrationEvent> other = rollDepartures(100);
+    bool differs = other.size() != first.size();
+    for (size_t i = 0; !differs && i < first.size(); i++) {
+        differs = other[i].targetIsland != first[i].targetIsland ||
+                  other[i].type != first[i].type ||
+                  !sameVec(other[i].targetPosition, first[i].targetPosition);
+    }
+    assert(differs);
+
+    std::cout << "  Migration queue determinism test passed!" << std::endl;
+}
+
+// ============================================================================
+// Coarse Simulation Tests
+// ============================================================================
+
+std::map<CreatureType, int> countByType(CreatureManager& creatures) {
+    std::map<CreatureType, int> counts;
+    creatures.forEach([&](Creature& creature, size_t) {
+        if (creature.isAlive()) counts[creature.getType()]++;
+    });
+    return counts;
+}
+
+void testSleepWakeRoundTrip() {
+    std::cout << "Testing island sleep/wake round trip..." << std::endl;
+
+    auto islands = makeArchipelago(2, 555);
+    islands->setCoarseSimulationEnabled(true);
+    islands->setSleepAfter(0.2f);
+    islands->setActiveIsland(0);
+
+    Island* island = islands->getIsland(1);
+    const std::map<CreatureType, int> before = countByType(*island->creatures);
+    int total = 0;
+    for (const auto& [type, count] : before) total += count;
+    assert(total > 0);
+
+    // Give every brain on the island the same grown topology, so a brain
+    // that survives the trip is distinguishable from a freshly spawned one
+    ai::NEATGenome evolved;
+    island->creatures->forEach([&](Creature& creature, size_t) {
+        if (evolved.getNodes().empty() && creature.hasNEATBrain()) evolved = creature.getNEATGenome();
+    });
+    assert(!evolved.getNodes().empty());
+    std::mt19937 brainRng(9);
+    evolved.mutateAddNode(brainRng);
+    evolved.mutateAddNode(brainRng);
+    const int evolvedHidden = evolved.getHiddenCount();
+    const size_t evolvedConnections = evolved.getConnections().size();
+    island->creatures->forEach([&](Creature& creature, size_t) {
+        if (creature.isAlive()) creature.initializeNEATBrain(evolved);
+    });
+    auto hasEvolvedBrain = [&](const ai::NEATGenome& brain) {
+        return brain.getHiddenCount() == evolvedHidden && brain.getConnections().size() == evolvedConnections;
+    };
+
+    // Asleep, the creatures become one pool per species
+    islands->sleepIsland(1);
+    assert(island->isSleeping());
+    assert(countByType(*island->creatures).empty());
+    assert(island->coarse->getPopulation() == total);
+    assert(island->stats.totalCreatures == total);
+    for (const CoarseIslandModel::Species& pool : island->coarse->getSpecies()) {
+        assert(pool.brains.size() == pool.genomes.size());
+        for (const ai::NEATGenome& brain : pool.brains) assert(hasEvolvedBrain(brain));
+    }
+
+    // Looking at it again respawns every pool with its own type. Placement
+    // can give up on a few creatures, never add any.
+    islands->setActiveIsland(1);
+    assert(!island->isSleeping());
+    assert(approxEqual(island->detailedTime, 0.0f));
+    const std::map<CreatureType, int> after = countByType(*island->creatures);
+    for (const auto& [type, count] : after) {
+        assert(before.count(type) == 1);
+        assert(count <= before.at(type));
+        assert(count >= before.at(type) * 9 / 10);
+    }
+
+    // ...and with the brains the island had evolved
+    island->creatures->forEach([&](Creature& creature, size_t) {
+        if (!creature.isAlive()) return;
+        assert(creature.hasNEATBrain());
+        assert(hasEvolvedBrain(creature.getNEATGenome()));
+    });
+
+    // Sleeping twice in a row, or waking an awake island, changes nothing
+    islands->sleepIsland(0);
+    const CoarseIslandModel* model = islands->getIsland(0)->coarse.get();
+    islands->sleepIsland(0);
+    assert(islands->getIsland(0)->coarse.get() == model);
+    islands->wakeIsland(1);
+    assert(countByType(*island->creatures) == after);
+
+    // Left unobserved past sleepAfter, an island falls asleep by itself
+    islands->setActiveIsland(0);
+    assert(!islands->getIsland(0)->isSleeping());
+    for (int i = 0; i < 3; i++) {
+        islands->update(0.1f);
+    }
+    assert(island->isSleeping());
+    assert(!islands->getIsland(0)->isSleeping());
+
+    std::cout << "  Sleep/wake round trip test passed!" << std::endl;
+}
+
+void testCoarseModelDynamics() {
+    std::cout << "Testing coarse model population dynamics..." << std::endl;
+
+    auto islands = makeArchipelago(1, 808);
+    CreatureManager& creatures = *islands->getIsland(0)->creatures;
+
+    // No turnover: pools hold their size
+    CoarseIslandModel still;
+    still.capture(creatures, 0.0f, 0.0f, 2048.0f, 1);
+    const int captured = still.getPopulation();
+    assert(captured > 0);
+    for (int i = 0; i < 100; i++) still.advance(1.0f);
+    assert(still.getPopulation() == captured);
+    assert(still.getBirths() == 0 && still.getDeaths() == 0);
+
+    // Pure deaths: every pool decays exponentially, small ones die out
+    CoarseIslandModel decaying;
+    decaying.capture(creatures, 0.0f, 0.05f, 2048.0f, 2);
+    std::vector<double> initial;
+    for (const auto& pool : decaying.getSpecies()) initial.push_back(pool.population);
+    for (int i = 0; i < 100; i++) decaying.advance(0.1f);
+    double lost = 0.0;
+    for (size_t i = 0; i < initial.size(); i++) {
+        double expected = initial[i] * std::exp(-0.5);
+        if (expected < 0.5) expected = 0.0;
+        assert(std::abs(decaying.getSpecies()[i].population - expected) < 0.01);
+        lost += initial[i] - expected;
+    }
+    assert(std::abs(decaying.getDeaths() - lost) <= lost * 0.05 + 1.0);
+
+    // Births against a capacity: logistic growth levels off at the limit
+    const float capacity = static_cast<float>(captured * 2);
+    CoarseIslandModel growing;
+    growing.capture(creatures, 0.5f, 0.0f, capacity, 3);
+    std::vector<std::vector<float>> weightsBefore;
+    for (const auto& pool : growing.getSpecies()) {
+        for (const Genome& genome : pool.genomes) weightsBefore.push_back(genome.neuralWeights);
+    }
+    for (int i = 0; i < 200; i++) growing.advance(0.5f);
+    assert(growing.getPopulation() >= static_cast<int>(capacity * 0.95f));
+    assert(growing.getPopulation() <= static_cast<int>(capacity) + 1);
+    assert(growing.getBirths() > 0 && growing.getDeaths() == 0);
+
+    // Births fold into the genome reservoir as mutated copies
+    bool evolved = false;
+    size_t g = 0;
+    for (const auto& pool : growing.getSpecies()) {
+        for (const Genome& genome : pool.genomes) evolved |= genome.neuralWeights != weightsBefore[g++];
+    }
+    assert(evolved);
+
+    // Heavy deaths wipe the island out
+    CoarseIslandModel dying;
+    dying.capture(creatures, 0.0f, 5.0f, 2048.0f, 4);
+    for (int i = 0; i < 10; i++) dying.advance(1.0f);
+    assert(dying.getPopulation() == 0);
+    assert(dying.getLivingSpeciesCount() == 0);
+
+    // A restored model carries on exactly like the original
+    CoarseIslandModel copy;
+    copy.restore(decaying.getSpecies(), decaying.getCapacity(), decaying.getBirthTotal(),
+                 decaying.getDeathTotal(), 9);
+    decaying.advance(1.0f);
+    copy.advance(1.0f);
+    assert(copy.getPopulation() == decaying.getPopulation());
+    assert(copy.getDeaths() == decaying.getDeaths());
+
+    std::cout << "  Coarse model dynamics test passed!" << std::endl;
+}
+
+// ============================================================================
+// Distributed Archipelago Tests
+// ============================================================================
+
+void testCreatureRecordRoundTrip() {
+    std::cout << "Testing creature record round trip..." << std::endl;
+
+    std::mt19937 rng(5);
+    MigrationEvent event;
+    event.creatureId = 17;
+    event.sourceIsland = 1;
+    event.targetIsland = 3;
+    event.type = MigrationType::FLYING;
+    event.creatureType = CreatureType::CARNIVORE;
+    event.currentEnergy = 42.5f;
+    event.timeElapsed = 3.0f;
+    event.targetPosition = glm::vec3(10.0f, 2.0f, -7.0f);
+    event.genome.size = 1.3f;
+    event.genome.neuralWeights = {0.25f, -0.5f, 0.75f};
+    event.hasBrain = true;
+    event.brainGenome.createMinimal(6, 3, rng);
+    event.brainGenome.mutateAddNode(rng);
+    event.brainGenome.mutateAddNode(rng);
+
+    // A brainless creature follows, so records must chain
+    MigrationEvent plain;
+    plain.creatureId = 18;
+    plain.genome.neuralWeights = {1.0f};
+
+    std::vector<uint8_t> data;
+    writeCreatureRecord(event, data);
+    writeCreatureRecord(plain, data);
+
+    CreatureRecordHeader header;
+    assert(peekCreatureRecord(data, 0, header));
+    assert(header.brainNodeCount == event.brainGenome.getNodes().size());
+    assert(header.brainConnectionCount == event.brainGenome.getConnections().size());
+
+    size_t offset = 0;
+    MigrationEvent read;
+    assert(readCreatureRecord(data, offset, read));
+    assert(read.creatureId == 17 && read.targetIsland == 3);
+    assert(read.type == MigrationType::FLYING && read.creatureType == CreatureType::CARNIVORE);
+    assert(approxEqual(read.currentEnergy, 42.5f) && approxEqual(read.timeElapsed, 3.0f));
+    assert(sameVec(read.targetPosition, event.targetPosition));
+    assert(approxEqual(read.genome.size, 1.3f));
+    assert(read.genome.neuralWeights == event.genome.neuralWeights);
+
+    // The brain comes back gene for gene
+    assert(read.hasBrain);
+    const auto& nodes = event.brainGenome.getNodes();
+    const auto& readNodes = read.brainGenome.getNodes();
+    assert(readNodes.size() == nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        assert(readNodes[i].id == nodes[i].id && readNodes[i].type == nodes[i].type);
+        assert(readNodes[i].activation == nodes[i].activation && readNodes[i].bias == nodes[i].bias);
+    }
+    const auto& connections = event.brainGenome.getConnections();
+    const auto& readConnections = read.brainGenome.getConnections();
+    assert(readConnections.size() == connections.size());
+    for (size_t i = 0; i < connections.size(); i++) {
+        assert(readConnections[i].innovation == connections[i].innovation);
+        assert(readConnections[i].fromNode == connections[i].fromNode);
+        assert(readConnections[i].toNode == connections[i].toNode);
+        assert(readConnections[i].weight == connections[i].weight);
+        assert(readConnections[i].enabled == connections[i].enabled);
+    }
+    assert(read.brainGenome.getInputCount() == 6 && read.brainGenome.getOutputCount() == 3);
+    assert(read.brainGenome.getHiddenCount() == event.brainGenome.getHiddenCount());
+
+    MigrationEvent readPlain;
+    assert(readCreatureRecord(data, offset, readPlain));
+    assert(readPlain.creatureId == 18 && !readPlain.hasBrain);
+    assert(offset == data.size());
+
+    // Truncated records are rejected
+    data.resize(data.size() - 1);
+    offset = header.recordSize;
+    assert(!readCreatureRecord(data, offset, readPlain));
+
+    std::cout << "  Creature record round trip test passed!" << std::endl;
+}
+
+#ifndef _WIN32
+constexpr uint32_t SOCKET_WORKERS = 2;
+constexpr uint32_t SOCKET_ISLANDS = 4;
+constexpr uint32_t SOCKET_BARRIERS = 8;
+constexpr uint32_t CHECKPOINT_TICK = 3;
+constexpr float SOCKET_TICK_SECONDS = 0.5f;
+
+struct SocketWorkerReport {
+    uint32_t workerIndex;
+    uint32_t ticks;
+    int32_t received;
+    int32_t inFlightAtCheckpoint;
+    int32_t sleepingAtCheckpoint;
+};
+
+// Fast, survivable crossings that take a couple of ticks, so migrants both
+// reach remote islands and are still at sea at the checkpoint
+MigrationConfig fastCrossings() {
+    MigrationConfig config;
+    config.baseMigrationChance = 0.01f;
+    config.swimSpeed = config.flyingSpeed = config.raftingSpeed = 200.0f;
+    config.baseSwimSurvival = config.baseFlyingSurvival = config.baseRaftingSurvival = 1.0f;
+    config.swimEnergyPerUnit = config.flyingEnergyPerUnit = config.raftingEnergyPerUnit = 0.0f;
+    return config;
+}
+
+// One worker's share of the archipelago, attached before generation.
+// Unwatched islands fall asleep after two ticks, so shards hold both
+// detailed and coarse islands.
+void buildWorkerArchipelago(ArchipelagoWorker& worker, MultiIslandManager& islands,
+                            InterIslandMigration& migration, uint32_t workerIndex) {
+    ArchipelagoGenerator archipelago;
+    archipelago.generateWithSeed(SOCKET_ISLANDS, ArchipelagoGenerator::DEFAULT_SPACING, 2024);
+
+    islands.setTerrainSize(64);
+    islands.setCoarseSimulationEnabled(true);
+    islands.setSleepAfter(2.0f * SOCKET_TICK_SECONDS);
+    islands.init(archipelago);
+    migration.setConfig(fastCrossings());
+    migration.setSeed(31 + workerIndex);
+    worker.attach(islands, migration);
+    islands.generateAll(2024);
+}
+
+int countSleeping(const MultiIslandManager& islands) {
+    int sleeping = 0;
+    for (uint32_t i = 0; i < islands.getIslandCount(); i++) {
+        sleeping += islands.getIsland(i)->isSleeping() ? 1 : 0;
+    }
+    return sleeping;
+}
+
+// Body of a forked worker process; reports through the pipe and exits
+[[noreturn]] void runSocketWorker(const std::string& socketPath, uint32_t workerIndex, int reportFd) {
+    LocalSocketTransport transport;
+    if (!transport.connect(socketPath)) ::_exit(2);
+
+    MultiIslandManager islands;
+    InterIslandMigration migration;
+    ArchipelagoWorker worker(transport, workerIndex, SOCKET_WORKERS);
+    buildWorkerArchipelago(worker, islands, migration, workerIndex);
+    if (!worker.sendHello()) ::_exit(3);
+
+    SocketWorkerReport report{workerIndex, 0, 0, -1, -1};
+    while (worker.step(SOCKET_TICK_SECONDS)) {
+        // The shard for the checkpoint barrier was written inside that step
+        if (worker.getTick() == CHECKPOINT_TICK + 1) {
+            report.inFlightAtCheckpoint = migration.getActiveMigrationCount();
+            report.sleepingAtCheckpoint = countSleeping(islands);
+        }
+    }
+    report.ticks = worker.getTick();
+    report.received = worker.getMigrantsReceived();
+
+    bool written = ::write(reportFd, &report, sizeof(report)) == static_cast<ssize_t>(sizeof(report));
+    ::_exit(written ? 0 : 4);
+}
+#endif
+
+void testDistributedRunOverSockets() {
+    std::cout << "Testing coordinator and workers over sockets..." << std::endl;
+
+#ifdef _WIN32
+    std::cout << "  Skipped: local socket transport is not available on Windows" << std::endl;
+#else
+    const std::string tag = std::to_string(::getpid());
+    const std::string socketPath = "/tmp/forge_archipelago_" + tag + ".sock";
+    const std::string checkpointDir = (std::filesystem::temp_directory_path() / ("forge_archipelago_" + tag)).string();
+
+    int reportPipe[2];
+    assert(::pipe(reportPipe) == 0);
+
+    // Workers are separate processes, as in a real run. This test forks
+    // before anything in the parent has started the shared thread pool.
+    std::vector<pid_t> children;
+    for (uint32_t k = 0; k < SOCKET_WORKERS; k++) {
+        pid_t pid = ::fork();
+        assert(pid >= 0);
+        if (pid == 0) {
+            ::close(reportPipe[0]);
+            runSocketWorker(socketPath, k, reportPipe[1]);
+        }
+        children.push_back(pid);
+    }
+    ::close(reportPipe[1]);
+
+    LocalSocketTransport transport;
+    assert(transport.listen(socketPath, SOCKET_WORKERS));
+
+    ArchipelagoCoordinator coordinator(transport, SOCKET_ISLANDS);
+    assert(coordinator.waitForWorkers());
+
+    for (uint32_t tick = 0; tick < SOCKET_BARRIERS; tick++) {
+        if (tick == CHECKPOINT_TICK) {
+            coordinator.requestCheckpoint(checkpointDir);
+        }
+        assert(coordinator.runTick());
+        assert(coordinator.getTick() == tick + 1);
+
+        // Every island's stats reach the coordinator at every barrier
+        int total = 0;
+        for (const IslandStats& stats : coordinator.getIslandStats()) {
+            assert(stats.totalCreatures > 0);
+            total += stats.totalCreatures;
+        }
+        assert(coordinator.getGlobalStats().totalCreatures == total);
+    }
+    coordinator.shutdown();
+
+    for (pid_t child : children) {
+        int status = 0;
+        assert(::waitpid(child, &status, 0) == child);
+        assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    }
+
+    std::vector<SocketWorkerReport> reports(SOCKET_WORKERS);
+    for (uint32_t k = 0; k < SOCKET_WORKERS; k++) {
+        SocketWorkerReport report;
+        assert(::read(reportPipe[0], &report, sizeof(report)) == static_cast<ssize_t>(sizeof(report)));
+        assert(report.workerIndex < SOCKET_WORKERS);
+        reports[report.workerIndex] = report;
+    }
+    ::close(reportPipe[0]);
+
+    // Workers left the loop together, and every routed migrant landed
+    int received = 0;
+    for (const SocketWorkerReport& report : reports) {
+        assert(report.ticks == SOCKET_BARRIERS);
+        received += report.received;
+    }
+    assert(coordinator.getMigrantsRouted() > 0);
+    assert(received == coordinator.getMigrantsRouted());
+
+    // The checkpoint is complete and each worker resumes with its crossings
+    // and with its sleeping islands still asleep
+    assert(coordinator.getLastCheckpointTick() == CHECKPOINT_TICK);
+    assert(std::filesystem::exists(ArchipelagoCoordinator::manifestPath(checkpointDir)));
+    for (uint32_t k = 0; k < SOCKET_WORKERS; k++) {
+        LocalSocketTransport idle;
+        MultiIslandManager islands;
+        InterIslandMigration migration;
+        ArchipelagoWorker worker(idle, k, SOCKET_WORKERS);
+        buildWorkerArchipelago(worker, islands, migration, k);
+
+        assert(worker.restoreCheckpoint(checkpointDir));
+        assert(worker.getTick() == CHECKPOINT_TICK + 1);
+        assert(migration.getActiveMigrationCount() == reports[k].inFlightAtCheckpoint);
+        assert(countSleeping(islands) == reports[k].sleepingAtCheckpoint);
+        for (uint32_t i = 0; i < islands.getIslandCount(); i++) {
+            const Island* island = islands.getIsland(i);
+            if (!island->isSleeping()) continue;
+            // Reservoir brains come back from the shard with their genomes
+            for (const CoarseIslandModel::Species& pool : island->coarse->getSpecies()) {
+                assert(pool.brains.size() == pool.genomes.size());
+                for (const ai::NEATGenome& brain : pool.brains) assert(!brain.getNodes().empty());
+            }
+        }
+        for (const MigrationEvent& event : migration.getActiveMigrations()) {
+            assert(ArchipelagoWorker::ownsIsland(event.sourceIsland, k, SOCKET_WORKERS));
+            assert(event.estimatedDuration > 0.0f);
+        }
+    }
+
+    std::filesystem::remove_all(checkpointDir);
+#endif
+
+    std::cout << "  Socket run test passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Archipelago Unit Tests ===" << std::endl;
+
+    // Forks worker processes, so it runs before any test starts threads
+    testDistributedRunOverSockets();
+
+    testIslandClocksAreIndependent();
+    testMigrationQueueDeterminism();
+    testSleepWakeRoundTrip();
+    testCoarseModelDynamics();
+    testCreatureRecordRoundTrip();
+
+    std::cout << "\n=== All Archipelago tests passed! ===" << std::endl;
+    return 0;
+}
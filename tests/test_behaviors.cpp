@@ -0,0 +1,828 @@
+// test_behaviors.cpp - Unit tests for creature behavior subsystems
+// Tests social group formation by connected components, the territory
+// index (including territories dropped through the creature death path) and
+// its update slices, pack hunt planning, the coordinator's subsystem
+// scheduler and event history, and disease transmission
+
+#include "core/CreatureManager.h"
+#include "core/FoodChainManager.h"
+#include "entities/Creature.h"
+#include "entities/behaviors/BehaviorCoordinator.h"
+#include "entities/behaviors/PackHunting.h"
+#include "entities/behaviors/SocialGroups.h"
+#include "entities/behaviors/TerritorialBehavior.h"
+#include "environment/DisasterSystem.h"
+#include "environment/disasters/Disease.h"
+#include "environment/Terrain.h"
+#include <cassert>
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <numeric>
+#include <set>
+#include <cmath>
+
+using namespace Forge;
+
+// Helper function for float comparison
+bool approxEqual(float a, float b, float epsilon = 0.001f) {
+    return std::abs(a - b) < epsilon;
+}
+
+bool sameVec(const glm::vec3& a, const glm::vec3& b) {
+    return approxEqual(a.x, b.x) && approxEqual(a.y, b.y) && approxEqual(a.z, b.z);
+}
+
+// Flat, ungenerated terrain: every land creature stands at height 0
+struct BehaviorWorld {
+    Terrain terrain{64, 64, 8.0f};
+    CreatureManager creatures;
+
+    BehaviorWorld() { creatures.init(&terrain, nullptr, 1); }
+
+    CreatureHandle spawnHandle(CreatureType type, float x, float z) {
+        CreatureHandle handle = creatures.spawn(type, glm::vec3(x, 0.0f, z));
+        assert(handle.isValid());
+        return handle;
+    }
+
+    uint32_t spawn(CreatureType type, float x, float z) {
+        return static_cast<uint32_t>(creatures.get(spawnHandle(type, x, z))->getID());
+    }
+};
+
+// Group IDs of creatures, in the order given
+std::vector<uint32_t> groupsOf(const SocialGroupManager& social, const std::vector<uint32_t>& ids) {
+    std::vector<uint32_t> groups;
+    for (uint32_t id : ids) groups.push_back(social.getGroupID(id));
+    return groups;
+}
+
+// ============================================================================
+// Social Group Tests
+// ============================================================================
+
+void testGroupFormationLinksChains() {
+    std::cout << "Testing group formation along chains..." << std::endl;
+
+    BehaviorWorld world;
+    SocialGroupManager social;
+
+    // Neighbours 20 apart link (form distance 25) even though the ends are 80 apart
+    std::vector<uint32_t> chain;
+    for (int i = 0; i < 5; i++) {
+        chain.push_back(world.spawn(CreatureType::GRAZER, -100.0f + 20.0f * i, 0.0f));
+    }
+
+    // Interleaved predators link only to each other
+    std::vector<uint32_t> pack = {
+        world.spawn(CreatureType::SMALL_PREDATOR, -90.0f, 5.0f),
+        world.spawn(CreatureType::SMALL_PREDATOR, -70.0f, 5.0f),
+    };
+
+    // Out of reach of everyone, and solitary types never group
+    const uint32_t loner = world.spawn(CreatureType::GRAZER, 150.0f, 150.0f);
+    const uint32_t scavenger = world.spawn(CreatureType::SCAVENGER, -80.0f, 0.0f);
+
+    social.update(0.1f, world.creatures);
+
+    assert(social.getGroupCount() == 2);
+    std::vector<uint32_t> chainGroups = groupsOf(social, chain);
+    assert(chainGroups[0] != 0);
+    assert(std::all_of(chainGroups.begin(), chainGroups.end(),
+                       [&](uint32_t g) { return g == chainGroups[0]; }));
+    assert(social.getCreatureGroup(chain[0])->members.size() == 5);
+    assert(social.getCreatureGroup(chain[0])->creatureType == CreatureType::GRAZER);
+
+    std::vector<uint32_t> packGroups = groupsOf(social, pack);
+    assert(packGroups[0] != 0 && packGroups[0] == packGroups[1]);
+    assert(packGroups[0] != chainGroups[0]);
+    assert(social.getCreatureGroup(pack[0])->groupType == SocialGroupManager::GroupType::PACK);
+
+    assert(social.getGroupID(loner) == 0);
+    assert(social.getGroupID(scavenger) == 0);
+
+    // A second pass keeps the groups: everyone is already grouped
+    social.update(0.1f, world.creatures);
+    assert(social.getGroupCount() == 2);
+    assert(social.getGroupID(chain[4]) == chainGroups[0]);
+
+    std::cout << "  Chain formation test passed!" << std::endl;
+}
+
+void testGroupFormationSplitsLargeClusters() {
+    std::cout << "Testing oversized cluster splitting..." << std::endl;
+
+    BehaviorWorld world;
+    SocialGroupManager social;
+
+    // 45 grazers all within reach of each other; at most 20 per group gives
+    // three strips of 15 cut along X
+    std::vector<uint32_t> herd;
+    for (int i = 0; i < 45; i++) {
+        herd.push_back(world.spawn(CreatureType::GRAZER, 0.5f * i, 2.0f * (i % 3)));
+    }
+
+    social.update(0.1f, world.creatures);
+
+    assert(social.getGroupCount() == 3);
+    assert(social.getLargestGroupSize() == 15);
+    assert(social.getAverageGroupSize() == 15);
+
+    // Spawned in order of X, so each strip is a run of consecutive creatures
+    std::vector<uint32_t> groups = groupsOf(social, herd);
+    for (int strip = 0; strip < 3; strip++) {
+        for (int i = 1; i < 15; i++) {
+            assert(groups[strip * 15 + i] == groups[strip * 15]);
+        }
+    }
+    assert(groups[0] != groups[15] && groups[15] != groups[30] && groups[0] != groups[30]);
+
+    // Strips over the size limit never merge back together
+    social.update(0.1f, world.creatures);
+    assert(social.getGroupCount() == 3);
+
+    std::cout << "  Cluster splitting test passed!" << std::endl;
+}
+
+void testGroupFormationMatchesComponents() {
+    std::cout << "Testing group formation vs brute-force components..." << std::endl;
+
+    BehaviorWorld world;
+    SocialGroupManager social;
+    social.getConfig().maxGroupSize = 1000;
+    const float formDistance = social.getConfig().groupFormDistance;
+
+    std::mt19937 rng(29);
+    std::uniform_real_distribution<float> posDist(-240.0f, 240.0f);
+    const CreatureType types[] = {CreatureType::GRAZER, CreatureType::BROWSER, CreatureType::SMALL_PREDATOR};
+
+    std::vector<uint32_t> ids;
+    std::vector<glm::vec3> positions;
+    std::vector<CreatureType> spawnedTypes;
+    for (int i = 0; i < 400; i++) {
+        const CreatureType type = types[i % 3];
+        const glm::vec3 position(posDist(rng), 0.0f, posDist(rng));
+        ids.push_back(world.spawn(type, position.x, position.z));
+        positions.push_back(position);
+        spawnedTypes.push_back(type);
+    }
+
+    // Brute-force connected components over same-type pairs in reach
+    const size_t count = ids.size();
+    std::vector<size_t> component(count);
+    std::iota(component.begin(), component.end(), 0);
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t i = 0; i < count; i++) {
+            for (size_t j = i + 1; j < count; j++) {
+                if (spawnedTypes[i] != spawnedTypes[j]) continue;
+                const float dx = positions[i].x - positions[j].x;
+                const float dz = positions[i].z - positions[j].z;
+                if (dx * dx + dz * dz > formDistance * formDistance) continue;
+                const size_t low = std::min(component[i], component[j]);
+                if (component[i] != low || component[j] != low) {
+                    component[i] = component[j] = low;
+                    changed = true;
+                }
+            }
+        }
+    }
+    std::vector<size_t> componentSize(count, 0);
+    for (size_t c : component) componentSize[c]++;
+
+    social.update(0.1f, world.creatures);
+
+    // Every linked component lands whole in one group of its own type, and
+    // unlinked creatures stay alone. Merging may join whole components.
+    std::vector<uint32_t> groupOfComponent(count, 0);
+    size_t linked = 0;
+    for (size_t i = 0; i < count; i++) {
+        const uint32_t group = social.getGroupID(ids[i]);
+        if (componentSize[component[i]] < 2) {
+            assert(group == 0);
+            continue;
+        }
+        assert(group != 0);
+        assert(social.getCreatureGroup(ids[i])->creatureType == spawnedTypes[i]);
+        if (groupOfComponent[component[i]] == 0) groupOfComponent[component[i]] = group;
+        assert(groupOfComponent[component[i]] == group);
+        linked++;
+    }
+    assert(linked > 0);
+
+    size_t grouped = 0;
+    for (const auto& [id, group] : social.getGroups()) grouped += group.members.size();
+    assert(grouped == linked);
+
+    std::cout << "  Component formation test passed!" << std::endl;
+}
+
+// ============================================================================
+// Territory Tests
+// ============================================================================
+
+// Owners of every territory containing position, by brute force
+std::set<uint32_t> territoriesAt(const TerritorialBehavior& territories, const glm::vec3& position) {
+    std::set<uint32_t> owners;
+    for (const auto& [ownerID, territory] : territories.getTerritories()) {
+        if (glm::distance(position, territory.center) < territory.radius) owners.insert(ownerID);
+    }
+    return owners;
+}
+
+void checkTerritoryQueries(const TerritorialBehavior& territories, std::mt19937& rng) {
+    std::uniform_real_distribution<float> posDist(-230.0f, 230.0f);
+    for (int q = 0; q < 500; q++) {
+        const glm::vec3 position(posDist(rng), 0.0f, posDist(rng));
+        const std::set<uint32_t> expected = territoriesAt(territories, position);
+
+        const uint32_t found = territories.isInTerritory(position);
+        assert((found != 0) == !expected.empty());
+        assert(found == 0 || expected.count(found) == 1);
+
+        // Excluding the one found reports another containing territory, if any
+        if (found != 0) {
+            const uint32_t other = territories.isInTerritory(position, found);
+            assert((other != 0) == (expected.size() > 1));
+            assert(other != found);
+        }
+    }
+}
+
+void testTerritoryClaimsAreIndexedAtOnce() {
+    std::cout << "Testing territory index..." << std::endl;
+
+    BehaviorWorld world;
+    TerritorialBehavior territories;
+    std::mt19937 rng(41);
+    std::uniform_real_distribution<float> posDist(-200.0f, 200.0f);
+
+    // Claims are found by point queries straight away, before any update
+    std::vector<uint32_t> owners;
+    for (int i = 0; i < 150; i++) {
+        Creature* creature = world.creatures.get(
+            world.spawnHandle(CreatureType::GRAZER, posDist(rng), posDist(rng)));
+        creature->setEnergy(150.0f);
+        assert(territories.tryEstablishTerritory(creature));
+        assert(territories.isInTerritory(creature->getPosition()) != 0);
+        owners.push_back(static_cast<uint32_t>(creature->getID()));
+    }
+    assert(territories.getTerritoryCount() == 150);
+    checkTerritoryQueries(territories, rng);
+
+    // Dropped territories leave the index at once too
+    for (size_t i = 0; i < owners.size(); i += 2) {
+        if (i % 4 == 0) {
+            territories.onOwnerDeath(owners[i]);
+        } else {
+            territories.abandonTerritory(owners[i]);
+        }
+        assert(!territories.hasTerritory(owners[i]));
+    }
+    assert(territories.getTerritoryCount() == 75);
+    checkTerritoryQueries(territories, rng);
+
+    // A larger base radius changes the cell size; everything is re-filed
+    territories.getConfig().baseRadius = 40.0f;
+    territories.update(0.1f, world.creatures, *world.creatures.getGlobalGrid());
+    checkTerritoryQueries(territories, rng);
+
+    std::cout << "  Territory index test passed!" << std::endl;
+}
+
+void testDeathDropsTerritory() {
+    std::cout << "Testing territory removal on death..." << std::endl;
+
+    BehaviorWorld world;
+    BehaviorCoordinator behaviors;
+    behaviors.init(&world.creatures, world.creatures.getGlobalGrid(), nullptr, nullptr, nullptr, &world.terrain);
+    world.creatures.setBehaviorCoordinator(&behaviors);
+
+    const CreatureHandle owner = world.spawnHandle(CreatureType::GRAZER, 30.0f, -20.0f);
+    const CreatureHandle neighbour = world.spawnHandle(CreatureType::GRAZER, -60.0f, 40.0f);
+    Creature* ownerCreature = world.creatures.get(owner);
+    const uint32_t ownerID = static_cast<uint32_t>(ownerCreature->getID());
+    const glm::vec3 ownerPos = ownerCreature->getPosition();
+
+    assert(behaviors.tryEstablishTerritory(ownerCreature));
+    assert(behaviors.tryEstablishTerritory(world.creatures.get(neighbour)));
+
+    const TerritorialBehavior& territories = behaviors.getTerritorialBehavior();
+    assert(territories.isInTerritory(ownerPos) == ownerID);
+
+    // Processing the death tells the coordinator, which drops the territory
+    world.creatures.kill(owner, "test");
+    world.creatures.update(0.0f);
+    assert(!territories.hasTerritory(ownerID));
+    assert(territories.isInTerritory(ownerPos) == 0);
+    assert(territories.getTerritoryCount() == 1);
+
+    std::cout << "  Territory death test passed!" << std::endl;
+}
+
+void testTerritorySlices() {
+    std::cout << "Testing territory update slices..." << std::endl;
+
+    BehaviorWorld world;
+    TerritorialBehavior territories;
+    territories.getConfig().updateSlices = 4;
+    const SpatialGrid& grid = *world.creatures.getGlobalGrid();
+    const float gainRate = territories.getConfig().strengthGainRate;
+    std::mt19937 rng(43);
+
+    // Owners stand at their centers, so each visit strengthens the territory
+    std::vector<uint32_t> owners;
+    for (int i = 0; i < 12; i++) {
+        Creature* creature = world.creatures.get(
+            world.spawnHandle(CreatureType::GRAZER, -200.0f + i * 35.0f, 0.0f));
+        creature->setEnergy(150.0f);
+        assert(territories.tryEstablishTerritory(creature));
+        owners.push_back(static_cast<uint32_t>(creature->getID()));
+    }
+
+    // Call k visits the owners with ID k mod 4, handing them all the time
+    // since the claims
+    const float dt = 0.5f;
+    for (uint32_t visit = 0; visit < 4; visit++) {
+        territories.update(dt, world.creatures, grid);
+        for (uint32_t id : owners) {
+            const float strength = territories.getTerritory(id)->strength;
+            if (id % 4 <= visit) {
+                assert(approxEqual(strength, 0.1f + gainRate * dt * static_cast<float>(id % 4 + 1)));
+            } else {
+                assert(approxEqual(strength, 0.1f));
+            }
+        }
+    }
+
+    // An owner that dies unreported loses its territory when its slice comes up
+    const uint32_t victim = owners[5];
+    world.creatures.getCreatureByID(victim)->takeDamage(1000.0f);
+    for (uint32_t visit = 0; visit < 4; visit++) {
+        territories.update(dt, world.creatures, grid);
+        assert(territories.hasTerritory(victim) == (visit < victim % 4));
+    }
+    assert(territories.getTerritoryCount() == 11);
+    checkTerritoryQueries(territories, rng);
+
+    std::cout << "  Territory slice test passed!" << std::endl;
+}
+
+// ============================================================================
+// Pack Hunting Tests
+// ============================================================================
+
+void testPredictIntercept() {
+    std::cout << "Testing hunt intercept prediction..." << std::endl;
+
+    PackHuntingBehavior hunting;
+    const float horizon = hunting.getConfig().maxInterceptTime;
+    const glm::vec3 pack(0.0f);
+    const glm::vec3 prey(20.0f, 0.0f, 0.0f);
+
+    // Catchable: crossing at 5 with the pack at 10 meets where 400 + 25t^2 = 100t^2
+    float t = std::sqrt(400.0f / 75.0f);
+    glm::vec3 intercept = hunting.predictIntercept(prey, glm::vec3(0.0f, 0.0f, 5.0f), pack, 10.0f);
+    assert(sameVec(intercept, glm::vec3(20.0f, 0.0f, 5.0f * t)));
+    assert(approxEqual(glm::length(intercept - pack), 10.0f * t));
+
+    // Faster prey running into the pack is met at the first crossing (t = 4/3)
+    intercept = hunting.predictIntercept(prey, glm::vec3(-10.0f, 0.0f, 0.0f), pack, 5.0f);
+    assert(sameVec(intercept, glm::vec3(20.0f - 40.0f / 3.0f, 0.0f, 0.0f)));
+
+    // Uncatchable, fleeing or out-running sideways: led by the full horizon
+    intercept = hunting.predictIntercept(prey, glm::vec3(10.0f, 0.0f, 0.0f), pack, 5.0f);
+    assert(sameVec(intercept, prey + glm::vec3(10.0f, 0.0f, 0.0f) * horizon));
+    intercept = hunting.predictIntercept(prey, glm::vec3(0.0f, 0.0f, 10.0f), pack, 5.0f);
+    assert(sameVec(intercept, prey + glm::vec3(0.0f, 0.0f, 10.0f) * horizon));
+
+    // Catchable only after the horizon (t = 6): capped
+    intercept = hunting.predictIntercept(glm::vec3(30.0f, 0.0f, 0.0f), glm::vec3(5.0f, 0.0f, 0.0f), pack, 10.0f);
+    assert(sameVec(intercept, glm::vec3(30.0f + 5.0f * horizon, 0.0f, 0.0f)));
+
+    // Equal speeds (a = 0): linear solve when the prey closes, horizon otherwise
+    intercept = hunting.predictIntercept(prey, glm::vec3(-5.0f, 0.0f, 0.0f), pack, 5.0f);
+    assert(sameVec(intercept, glm::vec3(10.0f, 0.0f, 0.0f)));
+    intercept = hunting.predictIntercept(prey, glm::vec3(5.0f, 0.0f, 0.0f), pack, 5.0f);
+    assert(sameVec(intercept, prey + glm::vec3(5.0f, 0.0f, 0.0f) * horizon));
+    intercept = hunting.predictIntercept(prey, glm::vec3(0.0f, 0.0f, 5.0f), pack, 5.0f);
+    assert(sameVec(intercept, prey + glm::vec3(0.0f, 0.0f, 5.0f) * horizon));
+
+    // Prey at rest stays put
+    assert(sameVec(hunting.predictIntercept(prey, glm::vec3(0.0f), pack, 0.0f), prey));
+
+    std::cout << "  Intercept prediction test passed!" << std::endl;
+}
+
+void testHuntPlanningCadence() {
+    std::cout << "Testing hunt planning cadence..." << std::endl;
+
+    BehaviorWorld world;
+    SocialGroupManager social;
+    PackHuntingBehavior hunting;
+    FoodChainManager foodChain;
+
+    const std::vector<uint32_t> pack = {
+        world.spawn(CreatureType::APEX_PREDATOR, -10.0f, -4.0f),
+        world.spawn(CreatureType::APEX_PREDATOR, -10.0f, 4.0f),
+        world.spawn(CreatureType::APEX_PREDATOR, -14.0f, 0.0f),
+    };
+    const uint32_t prey = world.spawn(CreatureType::GRAZER, 10.0f, 0.0f);
+    const glm::vec3 preyPos = world.creatures.getCreatureByID(prey)->getPosition();
+
+    world.creatures.rebuildSpatialGrids();
+    const SpatialGrid& grid = *world.creatures.getGlobalGrid();
+    social.update(0.1f, world.creatures);
+    assert(social.getGroupID(pack[0]) != 0);
+
+    // Exact in binary: four steps make one plan interval
+    const float dt = 0.125f;
+    assert(approxEqual(hunting.getConfig().planInterval, 4.0f * dt));
+    auto step = [&]() { hunting.update(dt, world.creatures, social, grid, foodChain); };
+
+    // New hunts are only looked for on plan ticks
+    for (int i = 0; i < 3; i++) {
+        step();
+        assert(hunting.getActiveHuntCount() == 0);
+    }
+    step();
+    assert(hunting.getActiveHuntCount() == 1);
+    assert(hunting.isBeingHunted(prey));
+
+    const PackHuntingBehavior::Hunt* hunt = hunting.getHunt(pack[0]);
+    assert(hunt && hunt->targetID == prey && hunt->hunters.size() == 3);
+    assert(approxEqual(hunt->track.sampleTime, 0.5f));
+    assert(sameVec(hunt->track.intercept, preyPos));
+
+    // Role positions start where each hunter stands
+    for (const auto& hunter : hunt->hunters) {
+        const glm::vec3& position = world.creatures.getCreatureByID(hunter.creatureID)->getPosition();
+        assert(sameVec(hunter.planFrom, position));
+        assert(sameVec(hunter.assignedPosition, position));
+        assert(!sameVec(hunter.planTo, position));
+    }
+
+    // Between plans the track is left alone and assigned positions move
+    // linearly toward the planned role positions
+    for (int i = 1; i <= 3; i++) {
+        step();
+        hunt = hunting.getHunt(pack[0]);
+        assert(approxEqual(hunt->track.sampleTime, 0.5f));
+        for (const auto& hunter : hunt->hunters) {
+            assert(sameVec(hunter.assignedPosition, glm::mix(hunter.planFrom, hunter.planTo, 0.25f * i)));
+        }
+    }
+
+    // The next plan tick samples the prey again; the new leg starts where
+    // the last one arrived
+    std::vector<glm::vec3> arrived;
+    for (const auto& hunter : hunt->hunters) arrived.push_back(hunter.planTo);
+    step();
+    hunt = hunting.getHunt(pack[0]);
+    assert(approxEqual(hunt->track.sampleTime, 1.0f));
+    for (size_t i = 0; i < hunt->hunters.size(); i++) {
+        assert(sameVec(hunt->hunters[i].planFrom, arrived[i]));
+        assert(sameVec(hunt->hunters[i].assignedPosition, arrived[i]));
+        assert(hunting.getRole(hunt->hunters[i].creatureID) == hunt->hunters[i].role);
+    }
+
+    std::cout << "  Hunt planning cadence test passed!" << std::endl;
+}
+
+// ============================================================================
+// Scheduler Tests
+// ============================================================================
+
+// Coordinator over an empty world; hunting stays off without a food chain
+void initScheduler(BehaviorCoordinator& behaviors, BehaviorWorld& world) {
+    behaviors.init(&world.creatures, world.creatures.getGlobalGrid(), nullptr, nullptr, nullptr, &world.terrain);
+}
+
+float pendingOf(const BehaviorCoordinator& behaviors, BehaviorSubsystem subsystem) {
+    return behaviors.getSchedule(subsystem).pending;
+}
+
+void testSchedulerSelection() {
+    std::cout << "Testing scheduler selection..." << std::endl;
+
+    BehaviorWorld world;
+    BehaviorCoordinator behaviors;
+    initScheduler(behaviors, world);
+    behaviors.setFrameBudget(1000.0f);
+
+    // The slice count reaches the territories when the schedule is set, and
+    // survives a reset
+    assert(behaviors.getTerritorialBehavior().getConfig().updateSlices == 8);
+    behaviors.setSchedule(BehaviorSubsystem::TERRITORIAL, 0.0f, 0.25f, 2);
+    assert(behaviors.getTerritorialBehavior().getConfig().updateSlices == 2);
+    behaviors.reset();
+    assert(behaviors.getTerritorialBehavior().getConfig().updateSlices == 2);
+
+    // Exact in binary: social is due every second tick, migration every fourth
+    const float dt = 0.125f;
+    behaviors.setSchedule(BehaviorSubsystem::SOCIAL, 0.25f, 0.5f);
+    behaviors.setSchedule(BehaviorSubsystem::MIGRATION, 0.5f, 0.25f);
+    behaviors.setSchedule(BehaviorSubsystem::PARENTAL, 0.25f, 0.25f);
+    behaviors.setParentalEnabled(false);
+
+    for (int tick = 1; tick <= 8; tick++) {
+        behaviors.update(dt);
+        assert(pendingOf(behaviors, BehaviorSubsystem::TERRITORIAL) == 0.0f);
+        assert(pendingOf(behaviors, BehaviorSubsystem::VARIETY) == 0.0f);
+        assert(pendingOf(behaviors, BehaviorSubsystem::SOCIAL) == (tick % 2 == 0 ? 0.0f : dt));
+        assert(pendingOf(behaviors, BehaviorSubsystem::MIGRATION) == static_cast<float>(tick % 4) * dt);
+
+        // Disabled subsystems bank no time
+        assert(pendingOf(behaviors, BehaviorSubsystem::HUNTING) == 0.0f);
+        assert(pendingOf(behaviors, BehaviorSubsystem::PARENTAL) == 0.0f);
+    }
+
+    // Re-enabled, parental starts a fresh interval
+    behaviors.setParentalEnabled(true);
+    behaviors.update(dt);
+    assert(pendingOf(behaviors, BehaviorSubsystem::PARENTAL) == dt);
+    behaviors.update(dt);
+    assert(pendingOf(behaviors, BehaviorSubsystem::PARENTAL) == 0.0f);
+
+    for (size_t i = 0; i < static_cast<size_t>(BehaviorSubsystem::COUNT); i++) {
+        assert(behaviors.getSchedule(static_cast<BehaviorSubsystem>(i)).deferrals == 0);
+    }
+
+    std::cout << "  Scheduler selection test passed!" << std::endl;
+}
+
+void testSchedulerDeferral() {
+    std::cout << "Testing scheduler deferral..." << std::endl;
+
+    using S = BehaviorSubsystem;
+    const std::vector<S> enabled = {S::TERRITORIAL, S::SOCIAL, S::MIGRATION, S::PARENTAL, S::VARIETY};
+    const float dt = 0.125f;
+
+    // Enabled subsystems that ran on the last tick; all are due every tick,
+    // so any that did not run is holding time
+    auto ranLastTick = [&](const BehaviorCoordinator& behaviors) {
+        std::vector<S> ran;
+        for (S subsystem : enabled) {
+            if (pendingOf(behaviors, subsystem) == 0.0f) ran.push_back(subsystem);
+        }
+        return ran;
+    };
+
+    // Budgets far above the measured cost of an empty world, two per frame.
+    // Each tick starts from the first subsystem deferred on the last.
+    {
+        BehaviorWorld world;
+        BehaviorCoordinator behaviors;
+        initScheduler(behaviors, world);
+        behaviors.setFrameBudget(25.0f);
+        for (S subsystem : enabled) behaviors.setSchedule(subsystem, 0.0f, 10.0f);
+
+        const std::vector<std::vector<S>> expected = {
+            {S::TERRITORIAL, S::SOCIAL},
+            {S::MIGRATION, S::PARENTAL},
+            {S::TERRITORIAL, S::VARIETY},
+            {S::SOCIAL, S::MIGRATION},
+        };
+        for (const auto& ran : expected) {
+            behaviors.update(dt);
+            assert(ranLastTick(behaviors) == ran);
+        }
+
+        // Waiting subsystems keep the time they were not handed
+        assert(pendingOf(behaviors, S::PARENTAL) == 2.0f * dt);
+        assert(pendingOf(behaviors, S::VARIETY) == dt);
+        assert(pendingOf(behaviors, S::TERRITORIAL) == dt);
+
+        const int deferrals[] = {2, 2, 0, 2, 3, 3};
+        for (size_t i = 0; i < static_cast<size_t>(S::COUNT); i++) {
+            assert(behaviors.getSchedule(static_cast<S>(i)).deferrals == deferrals[i]);
+        }
+    }
+
+    // With a budget below any one subsystem, the first due still runs and
+    // the rest take turns
+    {
+        BehaviorWorld world;
+        BehaviorCoordinator behaviors;
+        initScheduler(behaviors, world);
+        behaviors.setFrameBudget(1.0f);
+        for (S subsystem : enabled) behaviors.setSchedule(subsystem, 0.0f, 10.0f);
+
+        for (int round = 0; round < 2; round++) {
+            for (S subsystem : enabled) {
+                behaviors.update(dt);
+                assert(ranLastTick(behaviors) == std::vector<S>{subsystem});
+            }
+        }
+    }
+
+    std::cout << "  Scheduler deferral test passed!" << std::endl;
+}
+
+void testEventHistoryOverwrite() {
+    std::cout << "Testing event history overwrite order..." << std::endl;
+
+    BehaviorCoordinator behaviors;
+    const size_t capacity = BehaviorCoordinator::MAX_EVENT_HISTORY;
+    auto emit = [&](uint32_t id) {
+        BehaviorEvent event{};
+        event.type = BehaviorEventType::PLAY_BEHAVIOR;
+        event.creatureID = id;
+        behaviors.emitEvent(event);
+    };
+
+    // Oldest first while filling
+    for (uint32_t id = 0; id < 40; id++) emit(id);
+    const auto& events = behaviors.getRecentEvents();
+    assert(events.size() == 40);
+    for (size_t i = 0; i < events.size(); i++) assert(events[i].creatureID == i);
+
+    // Once full, each event replaces the oldest and order is kept across
+    // the wrap
+    for (uint32_t id = 40; id < capacity + 30; id++) emit(id);
+    assert(events.size() == capacity);
+    for (size_t i = 0; i < capacity; i++) assert(events[i].creatureID == 30 + i);
+    assert(events.front().creatureID == 30);
+    assert(events.back().creatureID == capacity + 29);
+    assert(behaviors.getDebugStats().playBehaviors == static_cast<int>(capacity + 30));
+
+    behaviors.clearEventHistory();
+    assert(events.isEmpty());
+    emit(7);
+    assert(events.size() == 1 && events.front().creatureID == 7);
+
+    std::cout << "  Event history test passed!" << std::endl;
+}
+
+// ============================================================================
+// Disease Tests
+// ============================================================================
+
+// Outbreak on a flat world; transmission is off until a test turns it on
+disasters::DiseaseOutbreak seededOutbreak(uint32_t seed) {
+    disasters::DiseaseOutbreak outbreak;
+    outbreak.trigger(glm::vec3(0.0f), DisasterSeverity::CATASTROPHIC);
+    outbreak.setSeed(seed);
+    outbreak.setTransmissionRate(0.0f);
+    return outbreak;
+}
+
+// Step an outbreak until a creature shows symptoms
+void stepUntilSymptomatic(disasters::DiseaseOutbreak& outbreak, CreatureManager& creatures,
+                          ActiveDisaster& disaster, uint32_t id) {
+    for (int i = 0; i < 40 && outbreak.getInfectionState(id) != disasters::InfectionState::SYMPTOMATIC; i++) {
+        outbreak.update(0.5f, creatures, disaster);
+    }
+    assert(outbreak.getInfectionState(id) == disasters::InfectionState::SYMPTOMATIC);
+}
+
+void testDiseaseThreadCountIndependence() {
+    std::cout << "Testing disease transmission across thread counts..." << std::endl;
+
+    // Over two transmission chunks, so the parallel outbreak splits the work
+    BehaviorWorld world;
+    std::vector<Creature*> herd;
+    for (int z = 0; z < 50; z++) {
+        for (int x = 0; x < 50; x++) {
+            herd.push_back(world.creatures.get(world.spawnHandle(CreatureType::GRAZER, -75.0f + x * 3.0f, -75.0f + z * 3.0f)));
+        }
+    }
+
+    disasters::DiseaseOutbreak outbreaks[2] = {seededOutbreak(5), seededOutbreak(5)};
+    outbreaks[0].setParallelTransmission(false);
+    assert(outbreaks[1].isParallelTransmission());
+
+    ActiveDisaster disasters[2] = {};
+    for (auto& outbreak : outbreaks) {
+        outbreak.setTransmissionRate(0.5f);
+        for (size_t i = 0; i < herd.size(); i += 250) {
+            outbreak.infectPatientZero(herd[i]);
+        }
+    }
+
+    // Both outbreaks share the world, so each step starts both from the same
+    // energies; symptoms drain them. Twelve steps stop short of the first
+    // death from the disease, which could not be undone for the second.
+    std::vector<float> energies(herd.size());
+    std::vector<float> serialEnergies(herd.size());
+    for (int step = 0; step < 12; step++) {
+        for (size_t i = 0; i < herd.size(); i++) energies[i] = herd[i]->getEnergy();
+        outbreaks[0].update(0.5f, world.creatures, disasters[0]);
+        for (size_t i = 0; i < herd.size(); i++) serialEnergies[i] = herd[i]->getEnergy();
+
+        for (size_t i = 0; i < herd.size(); i++) herd[i]->setEnergy(energies[i]);
+        outbreaks[1].update(0.5f, world.creatures, disasters[1]);
+
+        std::vector<uint32_t> infected[2] = {outbreaks[0].getInfectedCreatures(), outbreaks[1].getInfectedCreatures()};
+        std::sort(infected[0].begin(), infected[0].end());
+        std::sort(infected[1].begin(), infected[1].end());
+        assert(infected[0] == infected[1]);
+        assert(outbreaks[0].getStats().totalCases == outbreaks[1].getStats().totalCases);
+        for (size_t i = 0; i < herd.size(); i++) {
+            assert(herd[i]->isAlive());
+            assert(herd[i]->getEnergy() == serialEnergies[i]);
+        }
+    }
+
+    // The outbreak actually spread
+    assert(outbreaks[0].getStats().totalCases > 20);
+
+    std::cout << "  Disease thread count test passed!" << std::endl;
+}
+
+void testDiseaseSkipsDeadSources() {
+    std::cout << "Testing disease sources killed mid-frame..." << std::endl;
+
+    BehaviorWorld world;
+    const uint32_t source = world.spawn(CreatureType::GRAZER, 0.0f, 0.0f);
+    const std::vector<uint32_t> neighbours = {
+        world.spawn(CreatureType::GRAZER, 1.0f, 0.0f),
+        world.spawn(CreatureType::GRAZER, -1.0f, 0.0f),
+        world.spawn(CreatureType::GRAZER, 0.0f, 1.0f),
+        world.spawn(CreatureType::GRAZER, 0.0f, -1.0f),
+    };
+    Creature* sourceCreature = world.creatures.getCreatureByID(source);
+
+    disasters::DiseaseOutbreak outbreak = seededOutbreak(9);
+    ActiveDisaster disaster{};
+    outbreak.infectPatientZero(sourceCreature);
+    stepUntilSymptomatic(outbreak, world.creatures, disaster, source);
+
+    // The next symptom drain kills the source before the transmission round,
+    // which would otherwise infect every neighbour
+    sourceCreature->setEnergy(0.01f);
+    outbreak.setTransmissionRate(1000.0f);
+    outbreak.update(0.5f, world.creatures, disaster);
+    assert(!sourceCreature->isAlive());
+    for (uint32_t id : neighbours) {
+        assert(!outbreak.isInfected(id));
+    }
+    assert(outbreak.getStats().totalCases == 1);
+
+    std::cout << "  Dead source test passed!" << std::endl;
+}
+
+void testDiseaseSlotReuse() {
+    std::cout << "Testing disease state on reused creature slots..." << std::endl;
+
+    BehaviorWorld world;
+    const CreatureHandle first = world.spawnHandle(CreatureType::GRAZER, 0.0f, 0.0f);
+    const uint32_t firstID = static_cast<uint32_t>(world.creatures.get(first)->getID());
+    const uint32_t carrier = world.spawn(CreatureType::GRAZER, 2.0f, 0.0f);
+
+    disasters::DiseaseOutbreak outbreak = seededOutbreak(13);
+    ActiveDisaster disaster{};
+    outbreak.infectPatientZero(world.creatures.get(first));
+    outbreak.infectPatientZero(world.creatures.getCreatureByID(carrier));
+    outbreak.update(0.5f, world.creatures, disaster);
+    assert(outbreak.isInfected(firstID));
+
+    // The first creature dies of something else and a newcomer takes its slot
+    world.creatures.kill(first, "test");
+    world.creatures.update(0.0f);
+    const CreatureHandle second = world.spawnHandle(CreatureType::GRAZER, 0.0f, 0.0f);
+    assert(second.index == first.index);
+    const uint32_t secondID = static_cast<uint32_t>(world.creatures.get(second)->getID());
+    assert(secondID != firstID);
+
+    // The slot's infection went with its old owner
+    outbreak.update(0.5f, world.creatures, disaster);
+    assert(outbreak.getInfectionState(firstID) == disasters::InfectionState::HEALTHY);
+    assert(outbreak.getInfectionState(secondID) == disasters::InfectionState::HEALTHY);
+    assert(outbreak.getInfectedCreatures() == std::vector<uint32_t>{carrier});
+
+    // The newcomer is susceptible: a contagious neighbour infects it
+    stepUntilSymptomatic(outbreak, world.creatures, disaster, carrier);
+    assert(!outbreak.isInfected(secondID));
+    outbreak.setTransmissionRate(1000.0f);
+    outbreak.update(0.5f, world.creatures, disaster);
+    assert(outbreak.isInfected(secondID));
+    assert(outbreak.getStats().totalCases == 3);
+
+    std::cout << "  Disease slot reuse test passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Behavior Unit Tests ===" << std::endl;
+
+    testGroupFormationLinksChains();
+    testGroupFormationSplitsLargeClusters();
+    testGroupFormationMatchesComponents();
+    testTerritoryClaimsAreIndexedAtOnce();
+    testDeathDropsTerritory();
+    testTerritorySlices();
+    testPredictIntercept();
+    testHuntPlanningCadence();
+    testSchedulerSelection();
+    testSchedulerDeferral();
+    testEventHistoryOverwrite();
+    testDiseaseThreadCountIndependence();
+    testDiseaseSkipsDeadSources();
+    testDiseaseSlotReuse();
+
+    std::cout << "\n=== All Behavior tests passed! ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,213 @@
+// test_ecosystem.cpp - Unit tests for ecosystem subsystems
+// Tests the decomposer's pooled corpse store, its spatial index and the
+// decomposition timer wheel
+
+#include "environment/DecomposerSystem.h"
+#include <cassert>
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cmath>
+
+// Helper function for float comparison
+bool approxEqual(float a, float b, float epsilon = 0.001f) {
+    return std::abs(a - b) < epsilon;
+}
+
+// Dense corpse and position arrays must stay parallel through swap-removes
+bool corpseArraysParallel(const DecomposerSystem& decomposers) {
+    const auto& corpses = decomposers.getCorpses();
+    const auto& positions = decomposers.getCorpsePositions();
+    if (corpses.size() != positions.size()) return false;
+    for (size_t i = 0; i < corpses.size(); i++) {
+        if (corpses[i].position != positions[i]) return false;
+    }
+    return true;
+}
+
+// Advance the decomposer in whole wheel ticks
+void advance(DecomposerSystem& decomposers, int ticks) {
+    for (int i = 0; i < ticks; i++) {
+        decomposers.update(0.25f, nullptr);
+    }
+}
+
+// ============================================================================
+// Decomposer Tests
+// ============================================================================
+
+void testCorpsePool() {
+    std::cout << "Testing corpse pool..." << std::endl;
+
+    DecomposerSystem decomposers(nullptr);
+
+    // Too little energy leaves no corpse
+    decomposers.addCorpse(glm::vec3(0.0f), CreatureType::GRAZER, 1.0f, 5.0f);
+    assert(decomposers.getCorpseCount() == 0);
+
+    decomposers.addCorpse(glm::vec3(1.0f, 0.0f, 1.0f), CreatureType::GRAZER, 1.0f, 20.0f);
+    decomposers.addCorpse(glm::vec3(3.0f, 0.0f, 3.0f), CreatureType::GRAZER, 1.0f, 40.0f);
+    decomposers.addCorpse(glm::vec3(50.0f, 0.0f, 50.0f), CreatureType::GRAZER, 1.0f, 60.0f);
+    assert(decomposers.getCorpseCount() == 3);
+    assert(approxEqual(decomposers.getTotalBiomass(), 60.0f));  // Half of the energy
+    assert(corpseArraysParallel(decomposers));
+
+    // Picking the nearest corpse clean removes it at once and returns 3 energy per biomass
+    float energy = decomposers.scavengeCorpse(glm::vec3(1.0f, 0.0f, 1.0f), 100.0f);
+    assert(approxEqual(energy, 30.0f));
+    assert(decomposers.getCorpseCount() == 2);
+    assert(corpseArraysParallel(decomposers));
+    assert(decomposers.findNearestCorpse(glm::vec3(1.0f, 0.0f, 1.0f), 1.0f) == nullptr);
+
+    // The swapped-in corpse is still reachable through the index
+    Corpse* far = decomposers.findNearestCorpse(glm::vec3(50.0f, 0.0f, 50.0f), 1.0f);
+    assert(far != nullptr);
+    assert(approxEqual(far->biomass, 30.0f));
+
+    // Partial scavenging leaves the corpse in place
+    energy = decomposers.scavengeCorpse(glm::vec3(3.0f, 0.0f, 3.0f), 5.0f);
+    assert(approxEqual(energy, 15.0f));
+    assert(decomposers.getCorpseCount() == 2);
+    assert(approxEqual(decomposers.getTotalBiomass(), 45.0f));
+
+    std::cout << "  Corpse pool test passed!" << std::endl;
+}
+
+void testCorpseIndexQueries() {
+    std::cout << "Testing corpse index queries..." << std::endl;
+
+    DecomposerSystem decomposers(nullptr);
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> posDist(-300.0f, 300.0f);
+    std::uniform_real_distribution<float> radiusDist(0.5f, 60.0f);
+
+    for (int i = 0; i < 2000; i++) {
+        decomposers.addCorpse(glm::vec3(posDist(rng), 0.0f, posDist(rng)), CreatureType::GRAZER, 1.0f, 50.0f);
+    }
+    // Remove some so the index has been through swap-removes
+    for (int i = 0; i < 300; i++) {
+        decomposers.scavengeCorpse(glm::vec3(posDist(rng), 0.0f, posDist(rng)), 1000.0f);
+    }
+    assert(corpseArraysParallel(decomposers));
+
+    // Small, medium and map-wide radii cover both the bucket and the scan paths
+    for (int q = 0; q < 300; q++) {
+        glm::vec3 center(posDist(rng), 5.0f, posDist(rng));
+        float radius = q % 50 == 0 ? 1000.0f : radiusDist(rng);
+
+        std::vector<const Corpse*> expected;
+        for (const Corpse& corpse : decomposers.getCorpses()) {
+            float dx = corpse.position.x - center.x;
+            float dz = corpse.position.z - center.z;
+            if (dx * dx + dz * dz <= radius * radius) expected.push_back(&corpse);
+        }
+
+        std::vector<const Corpse*> found = decomposers.queryCorpses(center, radius);
+        std::sort(expected.begin(), expected.end());
+        std::sort(found.begin(), found.end());
+        assert(found == expected);
+    }
+
+    std::cout << "  Corpse index query test passed!" << std::endl;
+}
+
+void testDecompositionTimerWheel() {
+    std::cout << "Testing decomposition timer wheel..." << std::endl;
+
+    // Biomass 10, size 1, no soil: 2 biomass per second of elapsed time.
+    // Slot 0 takes its first step one tick in, then one step per second.
+    DecomposerSystem decomposers(nullptr);
+    decomposers.addCorpse(glm::vec3(0.0f), CreatureType::GRAZER, 1.0f, 20.0f);
+
+    // Nothing happens between wheel ticks
+    decomposers.update(0.2f, nullptr);
+    assert(approxEqual(decomposers.getTotalBiomass(), 10.0f));
+
+    decomposers.update(0.05f, nullptr);                             // t = 0.25
+    assert(approxEqual(decomposers.getTotalBiomass(), 9.5f));
+    assert(approxEqual(decomposers.getCorpses()[0].age, 0.25f));
+
+    advance(decomposers, 3);                                        // t = 1.0
+    assert(approxEqual(decomposers.getTotalBiomass(), 9.5f));
+    advance(decomposers, 1);                                        // t = 1.25
+    assert(approxEqual(decomposers.getTotalBiomass(), 7.5f));
+
+    // Steps at 2.25, 3.25 and 4.25 leave 1.5; the step at 5.25 finishes it
+    advance(decomposers, 15);                                       // t = 5.0
+    assert(decomposers.getCorpseCount() == 1);
+    assert(approxEqual(decomposers.getTotalBiomass(), 1.5f));
+    advance(decomposers, 1);                                        // t = 5.25
+    assert(decomposers.getCorpseCount() == 0);
+
+    // First steps of a burst are staggered over four wheel slots
+    for (int i = 0; i < 8; i++) {
+        decomposers.addCorpse(glm::vec3(static_cast<float>(i) * 40.0f, 0.0f, 0.0f), CreatureType::GRAZER, 1.0f, 20.0f);
+    }
+    int steppedPerTick[4] = {0, 0, 0, 0};
+    for (int tick = 0; tick < 4; tick++) {
+        advance(decomposers, 1);
+        for (const Corpse& corpse : decomposers.getCorpses()) {
+            if (approxEqual(corpse.age, 0.25f * (tick + 1))) steppedPerTick[tick]++;
+        }
+    }
+    for (int count : steppedPerTick) {
+        assert(count == 2);
+    }
+
+    std::cout << "  Timer wheel test passed!" << std::endl;
+}
+
+void testCorpseSlotReuse() {
+    std::cout << "Testing corpse slot reuse..." << std::endl;
+
+    DecomposerSystem decomposers(nullptr);
+    const glm::vec3 spot(10.0f, 0.0f, 10.0f);
+
+    // A takes its first step at 0.25 and is rescheduled for 1.25
+    decomposers.addCorpse(spot, CreatureType::GRAZER, 1.0f, 20.0f);
+    assert(decomposers.getCorpses()[0].poolSlot == 0);
+    advance(decomposers, 1);
+    assert(approxEqual(decomposers.getTotalBiomass(), 9.5f));
+
+    // Scavenged away, then C reuses its slot at 0.5 (first step at 0.75)
+    decomposers.scavengeCorpse(spot, 100.0f);
+    assert(decomposers.getCorpseCount() == 0);
+    advance(decomposers, 1);
+    decomposers.addCorpse(spot, CreatureType::GRAZER, 1.0f, 20.0f);
+    assert(decomposers.getCorpseCount() == 1);
+    assert(decomposers.getCorpses()[0].poolSlot == 0);
+
+    advance(decomposers, 1);                                        // t = 0.75
+    assert(approxEqual(decomposers.getTotalBiomass(), 9.5f));
+
+    // A's stale entry comes due at 1.25 and must not step C
+    advance(decomposers, 2);                                        // t = 1.25
+    assert(approxEqual(decomposers.getTotalBiomass(), 9.5f));
+    advance(decomposers, 2);                                        // t = 1.75
+    assert(approxEqual(decomposers.getTotalBiomass(), 7.5f));
+
+    // Freed slots are reused before new ones are grown
+    decomposers.addCorpse(glm::vec3(100.0f, 0.0f, 0.0f), CreatureType::GRAZER, 1.0f, 20.0f);
+    decomposers.scavengeCorpse(spot, 100.0f);
+    decomposers.addCorpse(glm::vec3(200.0f, 0.0f, 0.0f), CreatureType::GRAZER, 1.0f, 20.0f);
+    std::vector<uint32_t> slots;
+    for (const Corpse& corpse : decomposers.getCorpses()) slots.push_back(corpse.poolSlot);
+    std::sort(slots.begin(), slots.end());
+    assert((slots == std::vector<uint32_t>{0, 1}));
+    assert(corpseArraysParallel(decomposers));
+
+    std::cout << "  Corpse slot reuse test passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Ecosystem Unit Tests ===" << std::endl;
+
+    testCorpsePool();
+    testCorpseIndexQueries();
+    testDecompositionTimerWheel();
+    testCorpseSlotReuse();
+
+    std::cout << "\n=== All Ecosystem tests passed! ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,464 @@
+// test_evolution_history.cpp - Unit tests for evolutionary history storage
+// Tests lineage ancestry queries, branch coalescing, column spilling and
+// phylogeny export output
+
+#include "entities/genetics/LineageStore.h"
+#include "entities/genetics/PhylogenyExport.h"
+#include "utils/BufferedFileWriter.h"
+#include <cassert>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <map>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstdio>
+
+using namespace genetics;
+
+// Random forest of lineages: IDs 1..count, parents[id] is the parent ID (0 for roots)
+std::vector<LineageId> buildRandomForest(LineageStore& store, int count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<LineageId> parents(count + 1, 0);
+    for (int i = 1; i <= count; i++) {
+        LineageId parent = 0;
+        if (i > 3) {
+            // Mostly random earlier parents, with runs of deep chains
+            parent = (rng() % 8 == 0) ? static_cast<LineageId>(i - 1)
+                                      : static_cast<LineageId>(rng() % (i - 1) + 1);
+        }
+        parents[i] = parent;
+        LineageIndex index = store.append(i, parent, i / 10, 1, nullptr);
+        assert(index == static_cast<LineageIndex>(i - 1));
+    }
+    return parents;
+}
+
+// MRCA by walking parent links, 0 if none
+LineageId naiveMRCA(const std::vector<LineageId>& parents, LineageId a, LineageId b) {
+    std::vector<char> seen(parents.size(), 0);
+    for (LineageId x = a; x != 0; x = parents[x]) seen[x] = 1;
+    for (LineageId x = b; x != 0; x = parents[x]) {
+        if (seen[x]) return x;
+    }
+    return 0;
+}
+
+LineageId storeMRCA(const LineageStore& store, LineageId a, LineageId b) {
+    LineageIndex mrca = store.getMostRecentCommonAncestor(store.indexOf(a), store.indexOf(b));
+    return mrca == INVALID_LINEAGE_INDEX ? 0 : store.getId(mrca);
+}
+
+// Test MRCA and ancestor lookups against a parent walk
+void testMostRecentCommonAncestor() {
+    std::cout << "Testing lineage MRCA queries..." << std::endl;
+
+    // Small hand-built tree: 1 -> {2, 3}, 2 -> 4 -> 5, 3 -> 6; 7 is a second root
+    LineageStore small;
+    small.append(1, 0, 0, 1, nullptr);
+    small.append(2, 1, 1, 1, nullptr);
+    small.append(3, 1, 1, 1, nullptr);
+    small.append(4, 2, 2, 1, nullptr);
+    small.append(5, 4, 3, 1, nullptr);
+    small.append(6, 3, 2, 1, nullptr);
+    small.append(7, 0, 2, 2, nullptr);
+
+    assert(storeMRCA(small, 5, 6) == 1);
+    assert(storeMRCA(small, 4, 5) == 4);
+    assert(storeMRCA(small, 5, 5) == 5);
+    assert(storeMRCA(small, 5, 7) == 0);
+    assert(small.getDepth(small.indexOf(5)) == 3);
+    assert(small.getId(small.getAncestorAtDepth(small.indexOf(5), 1)) == 2);
+
+    // IDs must arrive in increasing order
+    assert(small.append(7, 1, 3, 1, nullptr) == INVALID_LINEAGE_INDEX);
+    assert(small.size() == 7);
+
+    LineageStore store;
+    const int count = 5000;
+    std::vector<LineageId> parents = buildRandomForest(store, count, 11);
+
+    std::mt19937 rng(12);
+    for (int t = 0; t < 20000; t++) {
+        LineageId a = rng() % count + 1;
+        LineageId b = rng() % count + 1;
+        assert(storeMRCA(store, a, b) == naiveMRCA(parents, a, b));
+    }
+
+    std::cout << "  MRCA test passed!" << std::endl;
+}
+
+// Test that dead side branches fold into their surviving ancestors
+void testCoalesceExtinctBranches() {
+    std::cout << "Testing extinct branch coalescing..." << std::endl;
+
+    // 1 -> {2, 3}, 2 -> 4, 3 -> 5 -> 6
+    LineageStore store;
+    store.append(1, 0, 0, 1, nullptr);
+    store.append(2, 1, 1, 1, nullptr);
+    store.append(3, 1, 1, 1, nullptr);
+    store.append(4, 2, 2, 1, nullptr);
+    store.append(5, 3, 2, 1, nullptr);
+    store.append(6, 5, 3, 1, nullptr);
+    store.recordBirth(store.indexOf(6), 3);
+    store.recordBirth(store.indexOf(6), 3);
+    assert(store.getTotalDescendants(store.indexOf(6)) == 3);
+
+    // The 3 -> 5 -> 6 branch dies out early; 2 dies later but 4 survives
+    store.recordDeath(store.indexOf(3), 2);
+    store.recordDeath(store.indexOf(5), 3);
+    for (int i = 0; i < 3; i++) {
+        store.recordDeath(store.indexOf(6), 4);
+    }
+    store.recordDeath(store.indexOf(2), 6);
+    assert(!store.isExtant(store.indexOf(6)));
+    assert(store.getExtinctionGeneration(store.indexOf(6)) == 4);
+
+    size_t removed = store.coalesceExtinctBranches(5);
+    assert(removed == 3);
+    assert(store.size() == 3);
+    assert(store.indexOf(3) == INVALID_LINEAGE_INDEX);
+    assert(store.indexOf(5) == INVALID_LINEAGE_INDEX);
+    assert(store.indexOf(6) == INVALID_LINEAGE_INDEX);
+
+    // Removed totals (1 + 1 + 3) fold into the root
+    LineageIndex root = store.indexOf(1);
+    assert(store.getTotalDescendants(root) == 6);
+
+    // Extinct 2 stays as the ancestor of extant 4
+    LineageIndex two = store.indexOf(2);
+    LineageIndex four = store.indexOf(4);
+    assert(two != INVALID_LINEAGE_INDEX);
+    assert(store.getParent(four) == two);
+    assert(store.getDepth(four) == 2);
+    assert(store.getMostRecentCommonAncestor(four, root) == root);
+
+    // Nothing left to remove
+    assert(store.coalesceExtinctBranches(5) == 0);
+
+    // Random forest: every surviving pair still resolves like the parent walk
+    LineageStore forest;
+    const int count = 4000;
+    std::vector<LineageId> parents = buildRandomForest(forest, count, 21);
+    for (int i = 1; i <= count; i++) {
+        if (i % 7 != 0) forest.recordDeath(forest.indexOf(i), 5);
+    }
+    assert(forest.coalesceExtinctBranches(100) > 0);
+
+    std::mt19937 rng(22);
+    for (int t = 0; t < 5000; t++) {
+        LineageId a = (rng() % (count / 7) + 1) * 7;
+        LineageId b = (rng() % (count / 7) + 1) * 7;
+        assert(forest.indexOf(a) != INVALID_LINEAGE_INDEX);
+        assert(storeMRCA(forest, a, b) == naiveMRCA(parents, a, b));
+    }
+
+    std::cout << "  Coalesce test passed!" << std::endl;
+}
+
+// Test that queries read the same through a spill file and after it is folded back
+void testSpillRoundTrip() {
+    std::cout << "Testing lineage store spill round-trip..." << std::endl;
+
+    const char* spillFile = "test_lineage_spill.bin";
+
+    LineageStore store;
+    const int count = 3000;
+    std::vector<LineageId> parents = buildRandomForest(store, count, 31);
+    assert(store.getUnspilledCount() == static_cast<size_t>(count));
+
+    std::mt19937 rng(32);
+    std::vector<std::pair<LineageId, LineageId>> pairs;
+    std::vector<LineageId> expected;
+    for (int t = 0; t < 2000; t++) {
+        LineageId a = rng() % count + 1;
+        LineageId b = rng() % count + 1;
+        pairs.emplace_back(a, b);
+        expected.push_back(storeMRCA(store, a, b));
+        assert(expected.back() == naiveMRCA(parents, a, b));
+    }
+    std::vector<Generation> founded;
+    for (int i = 1; i <= count; i++) {
+        founded.push_back(store.getFoundingGeneration(store.indexOf(i)));
+    }
+
+    // Columns now read through the mapping
+    assert(store.spillToFile(spillFile));
+    assert(store.isSpilled());
+    assert(store.getUnspilledCount() == 0);
+    for (size_t t = 0; t < pairs.size(); t++) {
+        assert(storeMRCA(store, pairs[t].first, pairs[t].second) == expected[t]);
+    }
+    for (int i = 1; i <= count; i++) {
+        assert(store.getFoundingGeneration(store.indexOf(i)) == founded[i - 1]);
+    }
+
+    // Lineages appended after a spill live in the heap tail and link into the mapped part
+    for (int i = count + 1; i <= count + 100; i++) {
+        LineageId parent = rng() % (i - 1) + 1;
+        parents.push_back(parent);
+        assert(store.append(i, parent, 500, 1, nullptr) != INVALID_LINEAGE_INDEX);
+    }
+    assert(store.getUnspilledCount() == 100);
+    for (int t = 0; t < 2000; t++) {
+        LineageId a = rng() % (count + 100) + 1;
+        LineageId b = count + 1 + rng() % 100;
+        assert(storeMRCA(store, a, b) == naiveMRCA(parents, a, b));
+    }
+
+    // Re-spilling over the live mapping keeps everything
+    assert(store.spillToFile(spillFile));
+    assert(store.getUnspilledCount() == 0);
+    for (size_t t = 0; t < pairs.size(); t++) {
+        assert(storeMRCA(store, pairs[t].first, pairs[t].second) == expected[t]);
+    }
+
+    // Coalescing reads the mapped columns back into memory
+    store.recordDeath(store.indexOf(count + 100), 600);
+    assert(store.coalesceExtinctBranches(1000) == 1);
+    assert(!store.isSpilled());
+    for (size_t t = 0; t < pairs.size(); t++) {
+        assert(storeMRCA(store, pairs[t].first, pairs[t].second) == expected[t]);
+    }
+    for (int i = 1; i <= count; i++) {
+        assert(store.getFoundingGeneration(store.indexOf(i)) == founded[i - 1]);
+    }
+
+    std::remove(spillFile);
+
+    std::cout << "  Spill round-trip test passed!" << std::endl;
+}
+
+std::string readFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+// Test Newick output for small forests
+void testNewickForest() {
+    std::cout << "Testing Newick forest writer..." << std::endl;
+
+    // 1 -> {2, 3}, 2 -> 4; 5 is a second root
+    std::map<int, std::vector<int>> children = {{1, {2, 3}}, {2, {4}}};
+    auto childrenOf = [&children](int id) {
+        auto it = children.find(id);
+        return it == children.end() ? std::span<const int>() : std::span<const int>(it->second);
+    };
+    auto label = [](StringExportSink& sink, int id) {
+        sink.put('S');
+        sink.writeInt(id);
+        if (id == 4) {
+            sink.put(':');
+            sink.writeFloat(2.5);
+        }
+    };
+
+    std::string single;
+    StringExportSink singleSink(single);
+    const std::vector<int> oneRoot = {1};
+    writeNewickForest<int>(singleSink, std::span<const int>(oneRoot), childrenOf, label);
+    assert(single == "((S4:2.5)S2,S3)S1;");
+
+    std::string forest;
+    StringExportSink forestSink(forest);
+    const std::vector<int> twoRoots = {1, 5};
+    writeNewickForest<int>(forestSink, std::span<const int>(twoRoots), childrenOf, label);
+    assert(forest == "(((S4:2.5)S2,S3)S1,S5);");
+
+    std::string empty;
+    StringExportSink emptySink(empty);
+    writeNewickForest<int>(emptySink, std::span<const int>(), childrenOf, label);
+    assert(empty == ";");
+
+    // A chain far deeper than the call stack would allow with recursion
+    const int depth = 200000;
+    std::vector<int> next(depth);
+    for (int i = 0; i < depth; i++) next[i] = i + 1;
+    auto chainChildren = [&next](int id) {
+        return id + 1 < depth ? std::span<const int>(&next[id], 1) : std::span<const int>();
+    };
+    auto chainLabel = [](StringExportSink& sink, int) { sink.put('x'); };
+
+    std::string chain;
+    StringExportSink chainSink(chain);
+    const std::vector<int> chainRoot = {0};
+    writeNewickForest<int>(chainSink, std::span<const int>(chainRoot), chainChildren, chainLabel);
+    assert(chain.size() == static_cast<size_t>(3 * depth - 2 + 1));
+    assert(std::count(chain.begin(), chain.end(), '(') == depth - 1);
+    assert(chain.compare(0, 3, "(((") == 0);
+    assert(chain.compare(chain.size() - 4, 4, "x)x;") == 0);
+
+    std::cout << "  Newick forest test passed!" << std::endl;
+}
+
+// Snapshot with species 1 -> {2, 3} and one row in every other table
+HistoryExportSnapshot buildSnapshot() {
+    HistoryExportSnapshot snapshot;
+    snapshot.generation = 40;
+    snapshot.names = "AlphaGamma";
+
+    SpeciesExportRow alpha;
+    alpha.speciesId = 1;
+    alpha.foundingGeneration = 0;
+    alpha.founderPopulationSize = 20;
+    alpha.peakPopulation = 80;
+    alpha.descendantCount = 2;
+    alpha.nameOffset = 0;
+    alpha.nameLength = 5;
+    alpha.firstDaughter = 0;
+    alpha.daughterCount = 2;
+
+    SpeciesExportRow beta;
+    beta.speciesId = 2;
+    beta.parentSpeciesId = 1;
+    beta.foundingGeneration = 10;
+    beta.extinctionGeneration = 30;
+    beta.extinctionCause = 3;
+    beta.branchLength = 3.5f;
+
+    SpeciesExportRow gamma;
+    gamma.speciesId = 3;
+    gamma.parentSpeciesId = 1;
+    gamma.foundingGeneration = 12;
+    gamma.branchLength = 12.0f;
+    gamma.nameOffset = 5;
+    gamma.nameLength = 5;
+
+    snapshot.species = {alpha, beta, gamma};
+    snapshot.daughters = {2, 3};
+
+    LineageExportRow lineage;
+    lineage.lineageId = 7;
+    lineage.ancestorId = 3;
+    lineage.foundingGeneration = 5;
+    lineage.peakPopulation = 9;
+    lineage.totalDescendants = 14;
+    lineage.survivingDescendants = 4;
+    lineage.averageFitness = 0.125f;
+    snapshot.lineages.push_back(lineage);
+
+    TraitExportRow trait;
+    trait.generation = 22;
+    trait.speciesId = 3;
+    trait.traitType = 1;
+    trait.oldValue = 1.5f;
+    trait.newValue = 1.75f;
+    trait.changeType = 2;
+    trait.selectionPressure = 4;
+    snapshot.traits.push_back(trait);
+
+    DiversityExportRow diversity;
+    diversity.generation = 40;
+    diversity.overallHeterozygosity = 0.25f;
+    diversity.nucleotideDiversity = 0.0625f;
+    diversity.numberOfAlleles = 12;
+    diversity.effectivePopulationSize = 150.0f;
+    snapshot.diversity.push_back(diversity);
+
+    return snapshot;
+}
+
+// Test the files written from an export snapshot
+void testSnapshotExport() {
+    std::cout << "Testing snapshot Newick/CSV export..." << std::endl;
+
+    HistoryExportSnapshot snapshot = buildSnapshot();
+    assert(snapshot.findSpecies(2) != nullptr);
+    assert(snapshot.findSpecies(4) == nullptr);
+    assert(snapshot.getDaughters(1).size() == 2);
+    assert(snapshot.getDaughters(3).empty());
+
+    const std::string newick = "(Species_2:3.5,Gamma:12)Alpha;\n";
+    const std::string lineages =
+        "LineageId,AncestorId,FoundingGeneration,ExtinctionGeneration,"
+        "PeakPopulation,TotalDescendants,SurvivingDescendants,AverageFitness\n"
+        "7,3,5,-1,9,14,4,0.125\n";
+    const std::string species =
+        "SpeciesId,ParentSpeciesId,FoundingGeneration,ExtinctionGeneration,"
+        "FounderPopulation,PeakPopulation,DescendantCount,ExtinctionCause\n"
+        "1,0,0,-1,20,80,2,0\n"
+        "2,1,10,30,0,0,0,3\n"
+        "3,1,12,-1,0,0,0,0\n";
+    const std::string traits =
+        "Generation,SpeciesId,TraitType,OldValue,NewValue,ChangeType,SelectionPressure\n"
+        "22,3,1,1.5,1.75,2,4\n";
+    const std::string diversity =
+        "Generation,OverallHeterozygosity,NucleotideDiversity,"
+        "NumberOfAlleles,EffectivePopulationSize\n"
+        "40,0.25,0.0625,12,150\n";
+
+    assert(exportSnapshotNewick(snapshot, "test_export_sync.nwk"));
+    assert(readFile("test_export_sync.nwk") == newick);
+    assert(exportSnapshotCSV(snapshot, "test_export_sync.csv", "species"));
+    assert(readFile("test_export_sync.csv") == species);
+    assert(!exportSnapshotCSV(snapshot, "test_export_bad.csv", "genomes"));
+    std::remove("test_export_sync.nwk");
+    std::remove("test_export_sync.csv");
+
+    // Background export writes all five files from a shared snapshot
+    auto shared = std::make_shared<const HistoryExportSnapshot>(std::move(snapshot));
+    std::future<bool> done = exportSnapshotAsync(shared, "test_export_async");
+    shared.reset();
+    assert(done.get());
+
+    assert(readFile("test_export_async.nwk") == newick);
+    assert(readFile("test_export_async_lineages.csv") == lineages);
+    assert(readFile("test_export_async_species.csv") == species);
+    assert(readFile("test_export_async_traits.csv") == traits);
+    assert(readFile("test_export_async_diversity.csv") == diversity);
+
+    for (const char* suffix : {".nwk", "_lineages.csv", "_species.csv", "_traits.csv", "_diversity.csv"}) {
+        std::remove((std::string("test_export_async") + suffix).c_str());
+    }
+
+    std::cout << "  Snapshot export test passed!" << std::endl;
+}
+
+// Test that a small buffer streams the same bytes as a single write
+void testBufferedFileWriter() {
+    std::cout << "Testing BufferedFileWriter streaming..." << std::endl;
+
+    const char* path = "test_buffered_writer.txt";
+    std::string expected;
+
+    BufferedFileWriter out(16);
+    assert(out.open(path));
+    for (int i = 0; i < 1000; i++) {
+        out.writeInt(-i);
+        out.put(',');
+        out.writeUInt(static_cast<uint64_t>(i) * 1000003ULL);
+        out.put(',');
+        out.writeFloat(i * 0.1);
+        out.write(" row\n");
+
+        char text[32];
+        std::snprintf(text, sizeof(text), "%g", i * 0.1);
+        expected += std::to_string(-i) + "," + std::to_string(static_cast<uint64_t>(i) * 1000003ULL) +
+                    "," + text + " row\n";
+    }
+    assert(out.bytesWritten() == expected.size());
+    assert(out.close());
+    assert(readFile(path) == expected);
+
+    std::remove(path);
+
+    std::cout << "  BufferedFileWriter test passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Evolutionary History Unit Tests ===" << std::endl;
+
+    testMostRecentCommonAncestor();
+    testCoalesceExtinctBranches();
+    testSpillRoundTrip();
+    testNewickForest();
+    testSnapshotExport();
+    testBufferedFileWriter();
+
+    std::cout << "\n=== All Evolutionary History tests passed! ===" << std::endl;
+    return 0;
+}
@@ -4,6 +4,8 @@
 #include "entities/Creature.h"
 #include "entities/Genome.h"
 #include "entities/CreatureType.h"
+#include "entities/genetics/DiploidGenome.h"
+#include "ai/CreatureBrainInterface.h"
 #include "utils/SpatialGrid.h"
 #include "core/Serializer.h"
 #include <glm/glm.hpp>
@@ -271,7 +273,7 @@ void testGenomeEvolution() {
         for (size_t i = 0; i < population.size(); i += 2) {
             if (i + 1 < population.size()) {
                 Genome child(population[i], population[i + 1]);
-                child.mutate(0.1f);
+                child.mutate(0.1f, 0.2f);
                 nextGen.push_back(child);
             }
         }
@@ -349,6 +351,62 @@ void testDiploidGenome() {
     std::cout << "  Diploid genome test passed!" << std::endl;
 }
 
+// Test that the copy and move constructors build the same creature
+void testConstructorDelegation() {
+    std::cout << "Testing constructor delegation..." << std::endl;
+
+    Genome genome;
+    genome.randomize();
+
+    Creature copied(glm::vec3(0.0f), genome, CreatureType::GRAZER);
+    Genome moved = genome;
+    Creature fromMove(glm::vec3(0.0f), std::move(moved), CreatureType::GRAZER, Creature::BrainBuffers{});
+
+    assert(approxEqual(copied.getGenome().speed, fromMove.getGenome().speed, 1e-6f));
+    assert(approxEqual(copied.getGenome().visionRange, fromMove.getGenome().visionRange, 1e-6f));
+    assert(copied.getNEATBrain() != nullptr && fromMove.getNEATBrain() != nullptr);
+    assert(copied.getID() != fromMove.getID());
+    assert(!copied.getSpeciesDisplayName().empty());
+
+    genetics::DiploidGenome diploid;
+    Creature diploidCopied(glm::vec3(0.0f), diploid, CreatureType::GRAZER);
+    Creature diploidMoved(glm::vec3(0.0f), genetics::DiploidGenome(diploid), CreatureType::GRAZER);
+    assert(approxEqual(diploidCopied.getFitnessModifier(), diploidMoved.getFitnessModifier(), 1e-6f));
+    assert(approxEqual(diploidCopied.getGenome().speed,
+                       diploid.getTrait(genetics::GeneType::SPEED), 1e-6f));
+
+    std::cout << "  Constructor delegation test passed!" << std::endl;
+}
+
+// Test that recycled brains are reused and come back with a clean genome
+void testRecycledBrainReuse() {
+    std::cout << "Testing recycled brain reuse..." << std::endl;
+
+    Genome genome;
+    genome.randomize();
+
+    Creature dead(glm::vec3(0.0f), genome, CreatureType::GRAZER);
+    ai::NEATGenome& oldGenome = dead.getNEATBrain()->getGenome();
+    oldGenome.setFitness(42.0f);
+    oldGenome.setAdjustedFitness(7.0f);
+    oldGenome.setSpeciesId(3);
+
+    const ai::CreatureBrainInterface* oldBrain = dead.getNEATBrain();
+    Creature::BrainBuffers buffers = dead.releaseBrainBuffers();
+    Genome recycledGenome = dead.releaseGenome();
+    recycledGenome = genome;
+
+    Creature child(glm::vec3(0.0f), std::move(recycledGenome), CreatureType::GRAZER, std::move(buffers));
+    assert(child.getNEATBrain() == oldBrain);
+
+    const ai::NEATGenome& fresh = child.getNEATBrain()->getGenome();
+    assert(fresh.getFitness() == 0.0f);
+    assert(fresh.getAdjustedFitness() == 0.0f);
+    assert(fresh.getSpeciesId() == -1);
+
+    std::cout << "  Recycled brain reuse test passed!" << std::endl;
+}
+
 int main() {
     std::cout << "=== Integration Tests ===" << std::endl;
 
@@ -362,6 +420,8 @@ int main() {
     testGenomeEvolution();
     testNeuralBehaviorIntegration();
     testDiploidGenome();
+    testConstructorDelegation();
+    testRecycledBrainReuse();
 
     std::cout << "\n=== All Integration tests passed! ===" << std::endl;
     return 0;
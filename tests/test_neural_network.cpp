@@ -2,11 +2,15 @@
 // Tests forward pass, activation functions, and weight mutation
 
 #include "entities/NeuralNetwork.h"
+#include "ai/NEATGenome.h"
 #include <cassert>
 #include <iostream>
 #include <cmath>
 #include <vector>
 #include <numeric>
+#include <random>
+#include <set>
+#include <unordered_map>
 
 // Helper function for float comparison
 bool approxEqual(float a, float b, float epsilon = 0.01f) {
@@ -257,6 +261,88 @@ void testBehaviorModulation() {
     std::cout << "  Behavior modulation test passed!" << std::endl;
 }
 
+// Set-based compatibility distance the merge walk replaced; kept as the reference
+float referenceCompatibilityDistance(const ai::NEATGenome& a, const ai::NEATGenome& b,
+                                     float c1, float c2, float c3) {
+    std::set<int> aInnovs, bInnovs;
+    std::unordered_map<int, float> aWeights, bWeights;
+    for (const auto& conn : a.getConnections()) {
+        aInnovs.insert(conn.innovation);
+        aWeights[conn.innovation] = conn.weight;
+    }
+    for (const auto& conn : b.getConnections()) {
+        bInnovs.insert(conn.innovation);
+        bWeights[conn.innovation] = conn.weight;
+    }
+
+    int aMax = aInnovs.empty() ? 0 : *aInnovs.rbegin();
+    int bMax = bInnovs.empty() ? 0 : *bInnovs.rbegin();
+    int minMax = std::min(aMax, bMax);
+
+    int excess = 0, disjoint = 0, matching = 0;
+    float weightDiffSum = 0.0f;
+    for (int i = 0; i <= std::max(aMax, bMax); i++) {
+        bool inA = aInnovs.count(i) > 0;
+        bool inB = bInnovs.count(i) > 0;
+        if (inA && inB) {
+            weightDiffSum += std::abs(aWeights[i] - bWeights[i]);
+            matching++;
+        } else if (inA || inB) {
+            (i > minMax ? excess : disjoint)++;
+        }
+    }
+
+    float avgWeightDiff = matching > 0 ? weightDiffSum / matching : 0.0f;
+    int N = static_cast<int>(std::max(a.getConnections().size(), b.getConnections().size()));
+    if (N < 20) N = 1;
+    return (c1 * excess / N) + (c2 * disjoint / N) + (c3 * avgWeightDiff);
+}
+
+// Innovation-sorted gene list where roughly one gene in four repeats its predecessor
+ai::NEATGenome makeGenomeWithDuplicates(std::mt19937& rng, int geneCount) {
+    std::uniform_int_distribution<int> step(0, 3);
+    std::uniform_real_distribution<float> weight(-2.0f, 2.0f);
+
+    ai::NEATGenome genome;
+    auto& genes = genome.getConnections();
+    int innovation = 0;
+    for (int i = 0; i < geneCount; i++) {
+        innovation += step(rng);  // step 0 duplicates the previous innovation
+        genes.emplace_back(innovation, 0, 1, weight(rng));
+    }
+    return genome;
+}
+
+// Test NEAT compatibility distance with duplicate innovation markers
+void testNEATCompatibilityDuplicates() {
+    std::cout << "Testing NEAT compatibility distance with duplicate innovations..." << std::endl;
+
+    // Hand-checked: {1, 2, 2, 3} vs {1, 2, 4} has 2 matching, 1 disjoint (3), 1 excess (4)
+    ai::NEATGenome a;
+    a.getConnections() = {{1, 0, 1, 0.5f}, {2, 0, 1, 1.0f}, {2, 0, 1, 3.0f}, {3, 0, 1, 0.0f}};
+    ai::NEATGenome b;
+    b.getConnections() = {{1, 0, 1, 0.5f}, {2, 0, 1, 2.0f}, {4, 0, 1, 0.0f}};
+
+    // Average weight difference uses the last gene of each duplicate run: (0 + 1) / 2
+    assert(approxEqual(a.compatibilityDistance(b, 1.0f, 1.0f, 1.0f), 2.5f, 1e-5f));
+    assert(approxEqual(a.compatibilityDistance(b, 1.0f, 0.0f, 0.0f), 1.0f, 1e-5f));
+    assert(approxEqual(a.compatibilityDistance(b, 0.0f, 1.0f, 0.0f), 1.0f, 1e-5f));
+
+    // Randomized genomes against the set-based reference, including N >= 20
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> sizeDist(0, 40);
+    for (int trial = 0; trial < 500; trial++) {
+        ai::NEATGenome x = makeGenomeWithDuplicates(rng, sizeDist(rng));
+        ai::NEATGenome y = makeGenomeWithDuplicates(rng, sizeDist(rng));
+        float merged = x.compatibilityDistance(y, 1.0f, 1.0f, 0.4f);
+        float reference = referenceCompatibilityDistance(x, y, 1.0f, 1.0f, 0.4f);
+        assert(approxEqual(merged, reference, 1e-4f));
+        assert(approxEqual(merged, y.compatibilityDistance(x, 1.0f, 1.0f, 0.4f), 1e-4f));
+    }
+
+    std::cout << "  NEAT compatibility duplicates test passed!" << std::endl;
+}
+
 int main() {
     std::cout << "=== NeuralNetwork Unit Tests ===" << std::endl;
 
@@ -270,6 +356,7 @@ int main() {
     testWeightVariations();
     testProcessMethod();
     testBehaviorModulation();
+    testNEATCompatibilityDuplicates();
 
     std::cout << "\n=== All NeuralNetwork tests passed! ===" << std::endl;
     return 0;
@@ -1,16 +1,21 @@
 // test_spatial_grid.cpp - Unit tests for SpatialGrid class
-// Tests insertion, querying, and spatial partitioning
+// Tests insertion, querying, and spatial partitioning, plus the flock
+// neighbour grid used by FlockingBehavior
 
 #include "utils/SpatialGrid.h"
 #include "entities/Creature.h"
 #include "entities/CreatureType.h"
 #include "entities/Genome.h"
+#include "entities/flying/FlockingBehavior.h"
 #include <glm/glm.hpp>
 #include <cassert>
 #include <iostream>
 #include <cmath>
 #include <vector>
 #include <memory>
+#include <random>
+#include <algorithm>
+#include <utility>
 
 // Helper function for float comparison
 bool approxEqual(float a, float b, float epsilon = 0.01f) {
@@ -327,6 +332,176 @@ void testGridStatistics() {
     std::cout << "  Grid statistics test passed!" << std::endl;
 }
 
+// ============================================================================
+// Flock Neighbour Grid Tests
+// ============================================================================
+
+// Members spread over negative and positive cells, with a dense knot so
+// several members share cells and buckets
+std::vector<glm::vec3> makeFlockPositions(int count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> wide(-60.0f, 60.0f);
+    std::uniform_real_distribution<float> knot(-3.0f, 3.0f);
+    std::uniform_real_distribution<float> height(20.0f, 80.0f);
+
+    std::vector<glm::vec3> positions;
+    for (int i = 0; i < count; i++) {
+        if (i % 4 == 0) {
+            positions.push_back(glm::vec3(knot(rng) + 10.0f, knot(rng) + 40.0f, knot(rng) - 10.0f));
+        } else {
+            positions.push_back(glm::vec3(wide(rng), height(rng), wide(rng)));
+        }
+    }
+    return positions;
+}
+
+// Test that grid-accumulated boids rules match a scan of the whole flock
+void testFlockBoidsNeighborsMatchBruteForce() {
+    std::cout << "Testing flock boids neighbours against brute force..." << std::endl;
+
+    FlockingConfig config;
+    config.separationRadius = 2.5f;
+    config.alignmentRadius = 6.0f;
+    config.cohesionRadius = 9.0f;
+    config.goalStrength = 0.0f;
+    config.minSpeed = 0.0f;             // Keep limitVelocity out of the comparison
+    config.maxSpeed = 1.0e6f;
+
+    FlockingBehavior flocking;
+    uint32_t flockId = flocking.createFlock(FlockType::BOIDS, config);
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> velDist(-5.0f, 5.0f);
+    std::vector<glm::vec3> positions = makeFlockPositions(600, 3);
+    std::vector<glm::vec3> velocities;
+    for (size_t i = 0; i < positions.size(); i++) {
+        velocities.push_back(glm::vec3(velDist(rng), velDist(rng), velDist(rng)));
+        flocking.addMember(flockId, static_cast<uint32_t>(i + 1), positions[i], velocities[i]);
+    }
+
+    flocking.update(0.016f);
+
+    int withNeighbors = 0;
+    for (size_t i = 0; i < positions.size(); i++) {
+        glm::vec3 separation(0.0f), averageVelocity(0.0f), centerOfMass(0.0f);
+        int separationCount = 0, alignmentCount = 0, cohesionCount = 0;
+        for (size_t j = 0; j < positions.size(); j++) {
+            if (j == i) continue;
+            float distance = glm::length(positions[j] - positions[i]);
+            if (distance < config.separationRadius && distance > 0.001f) {
+                separation += glm::normalize(positions[i] - positions[j]) / distance;
+                separationCount++;
+            }
+            if (distance < config.alignmentRadius) {
+                averageVelocity += velocities[j];
+                alignmentCount++;
+            }
+            if (distance < config.cohesionRadius) {
+                centerOfMass += positions[j];
+                cohesionCount++;
+            }
+        }
+
+        glm::vec3 expected = velocities[i];
+        if (separationCount > 0) {
+            expected += separation / static_cast<float>(separationCount) * config.separationWeight;
+        }
+        if (alignmentCount > 0) {
+            expected += (averageVelocity / static_cast<float>(alignmentCount) - velocities[i]) * 0.1f *
+                        config.alignmentWeight;
+        }
+        if (cohesionCount > 0) {
+            expected += glm::normalize(centerOfMass / static_cast<float>(cohesionCount) - positions[i]) * 0.5f *
+                        config.cohesionWeight;
+            withNeighbors++;
+        }
+
+        glm::vec3 actual = flocking.getTargetVelocity(flockId, static_cast<uint32_t>(i + 1));
+        assert(glm::length(actual - expected) < 1e-3f * std::max(1.0f, glm::length(expected)));
+    }
+    assert(withNeighbors > 100);  // The layout actually exercises neighbour lookups
+
+    std::cout << "  Flock boids neighbour test passed!" << std::endl;
+}
+
+// k nearest member IDs by brute force, nearest first
+std::vector<uint32_t> bruteForceNearest(const std::vector<glm::vec3>& positions, size_t self, size_t k) {
+    std::vector<std::pair<float, uint32_t>> candidates;
+    for (size_t j = 0; j < positions.size(); j++) {
+        if (j == self) continue;
+        candidates.push_back({glm::length(positions[j] - positions[self]), static_cast<uint32_t>(j + 1)});
+    }
+    std::sort(candidates.begin(), candidates.end());
+    std::vector<uint32_t> ids;
+    for (size_t n = 0; n < std::min(k, candidates.size()); n++) {
+        ids.push_back(candidates[n].second);
+    }
+    return ids;
+}
+
+// Test murmuration topological neighbours (grid ring search, scan fallback
+// and round-robin refresh) against a brute-force k-nearest search
+void testFlockTopologicalNeighborsMatchBruteForce() {
+    std::cout << "Testing murmuration topological neighbours against brute force..." << std::endl;
+
+    FlockingConfig config = FlockPresets::starlingMurmuration();
+    const size_t k = static_cast<size_t>(config.topologicalNeighbors);
+
+    FlockingBehavior flocking;
+    uint32_t flockId = flocking.createFlock(FlockType::MURMURATION, config);
+
+    // Far outliers force rings out to the edge of the occupied cells
+    std::vector<glm::vec3> positions = makeFlockPositions(400, 9);
+    positions.push_back(glm::vec3(-500.0f, 30.0f, 400.0f));
+    positions.push_back(glm::vec3(450.0f, 90.0f, -350.0f));
+    for (size_t i = 0; i < positions.size(); i++) {
+        flocking.addMember(flockId, static_cast<uint32_t>(i + 1), positions[i], glm::vec3(1.0f, 0.0f, 0.0f));
+    }
+
+    // New members get their lists on the first update
+    flocking.update(0.016f);
+    for (size_t i = 0; i < positions.size(); i++) {
+        const FlockMember* member = flocking.getMember(flockId, static_cast<uint32_t>(i + 1));
+        assert(member != nullptr);
+        assert(member->topologicalNeighbors == bruteForceNearest(positions, i, k));
+    }
+
+    // Move everyone, then run a little over one refresh interval: every
+    // list is rebuilt against the new layout
+    std::mt19937 rng(21);
+    std::uniform_real_distribution<float> jitter(-8.0f, 8.0f);
+    for (size_t i = 0; i < positions.size(); i++) {
+        positions[i] += glm::vec3(jitter(rng), jitter(rng), jitter(rng));
+        flocking.getMember(flockId, static_cast<uint32_t>(i + 1))->position = positions[i];
+    }
+    for (int step = 0; step < 6; step++) {
+        flocking.update(0.1f);
+    }
+    for (size_t i = 0; i < positions.size(); i++) {
+        const FlockMember* member = flocking.getMember(flockId, static_cast<uint32_t>(i + 1));
+        assert(member->topologicalNeighbors == bruteForceNearest(positions, i, k));
+    }
+
+    // A flock smaller than k lists everyone else
+    FlockingBehavior small;
+    uint32_t smallId = small.createFlock(FlockType::MURMURATION, config);
+    std::vector<glm::vec3> few = {
+        glm::vec3(0.0f, 30.0f, 0.0f), glm::vec3(1.0f, 30.0f, 0.0f), glm::vec3(-4.0f, 32.0f, 2.0f),
+        glm::vec3(20.0f, 40.0f, -3.0f)
+    };
+    for (size_t i = 0; i < few.size(); i++) {
+        small.addMember(smallId, static_cast<uint32_t>(i + 1), few[i], glm::vec3(1.0f, 0.0f, 0.0f));
+    }
+    small.update(0.016f);
+    for (size_t i = 0; i < few.size(); i++) {
+        const FlockMember* member = small.getMember(smallId, static_cast<uint32_t>(i + 1));
+        assert(member->topologicalNeighbors.size() == few.size() - 1);
+        assert(member->topologicalNeighbors == bruteForceNearest(few, i, k));
+    }
+
+    std::cout << "  Murmuration neighbour test passed!" << std::endl;
+}
+
 int main() {
     std::cout << "=== SpatialGrid Unit Tests ===" << std::endl;
 
@@ -341,6 +516,8 @@ int main() {
     testFindNearest();
     testPerformance();
     testGridStatistics();
+    testFlockBoidsNeighborsMatchBruteForce();
+    testFlockTopologicalNeighborsMatchBruteForce();
 
     std::cout << "\n=== All SpatialGrid tests passed! ===" << std::endl;
     return 0;
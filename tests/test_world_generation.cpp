@@ -0,0 +1,382 @@
+// test_world_generation.cpp - Unit tests for world generation
+// Tests the biome distance-to-water field, hydraulic erosion determinism,
+// world generation cancellation and the on-disk world cache
+
+#include "environment/BiomeSystem.h"
+#include "environment/TerrainErosion.h"
+#include "environment/ProceduralWorld.h"
+#include "environment/WorldGenContext.h"
+#include "environment/WorldCache.h"
+#include <cassert>
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+// Helper function for float comparison
+bool approxEqual(float a, float b, float epsilon = 0.01f) {
+    return std::abs(a - b) < epsilon;
+}
+
+// Brute-force normalized distance to the nearest cell below waterLevel
+std::vector<float> bruteForceDistanceToWater(const std::vector<float>& heightmap,
+                                             int width, int height, float waterLevel) {
+    const float maxSearchDist = 50.0f;
+    std::vector<float> result(heightmap.size(), 1.0f);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            float best = maxSearchDist;
+            for (int wy = 0; wy < height; wy++) {
+                for (int wx = 0; wx < width; wx++) {
+                    if (heightmap[wy * width + wx] >= waterLevel) continue;
+                    float dx = static_cast<float>(wx - x);
+                    float dy = static_cast<float>(wy - y);
+                    best = std::min(best, std::sqrt(dx * dx + dy * dy));
+                }
+            }
+            result[y * width + x] = best / maxSearchDist;
+        }
+    }
+    return result;
+}
+
+// Test the distance transform against brute force on scattered lakes
+void testDistanceToWaterMatchesBruteForce() {
+    std::cout << "Testing distance-to-water against brute force..." << std::endl;
+
+    // Non-square, wider than the 50-cell cap so both capped and exact cells occur
+    const int width = 97;
+    const int height = 61;
+    const float waterLevel = 0.35f;  // BiomeSystem default
+
+    std::mt19937 rng(31);
+    std::uniform_real_distribution<float> land(0.4f, 1.0f);
+    std::vector<float> heightmap(width * height);
+    for (float& h : heightmap) h = land(rng);
+
+    // A few isolated water cells and one lake
+    heightmap[5 * width + 3] = 0.1f;
+    heightmap[40 * width + 70] = 0.1f;
+    for (int y = 20; y < 26; y++) {
+        for (int x = 10; x < 18; x++) {
+            heightmap[y * width + x] = 0.2f;
+        }
+    }
+
+    BiomeSystem biomes;
+    biomes.generateBiomeMap(heightmap, width, height, 7u);
+    const std::vector<float>& dist = biomes.getDistanceToWaterMap();
+    std::vector<float> expected = bruteForceDistanceToWater(heightmap, width, height, waterLevel);
+
+    assert(dist.size() == expected.size());
+    for (size_t i = 0; i < dist.size(); i++) {
+        assert(approxEqual(dist[i], expected[i], 1e-5f));
+    }
+    assert(dist[5 * width + 3] == 0.0f);
+    assert(dist[(height - 1) * width + (width - 1)] > 0.0f);
+
+    std::cout << "  Distance-to-water brute force test passed!" << std::endl;
+}
+
+// Test that a map without water saturates at the cap
+void testDistanceToWaterWithoutWater() {
+    std::cout << "Testing distance-to-water with no water..." << std::endl;
+
+    const int width = 32;
+    const int height = 16;
+    std::vector<float> heightmap(width * height, 0.6f);
+
+    BiomeSystem biomes;
+    biomes.generateBiomeMap(heightmap, width, height, 1u);
+    for (float d : biomes.getDistanceToWaterMap()) {
+        assert(d == 1.0f);
+    }
+
+    std::cout << "  No-water distance test passed!" << std::endl;
+}
+
+// Rolling noise terrain so droplets actually move and carve
+Heightmap makeErosionTestHeightmap(int width, int depth) {
+    Heightmap heightmap(width, depth);
+    for (int z = 0; z < depth; z++) {
+        for (int x = 0; x < width; x++) {
+            float h = 0.5f + 0.25f * std::sin(x * 0.07f) * std::cos(z * 0.05f) +
+                      0.1f * std::sin((x + z) * 0.21f);
+            heightmap.set(x, z, h);
+        }
+    }
+    return heightmap;
+}
+
+// Test that hydraulic erosion depends only on the seed, not the thread count
+void testErosionDeterminism() {
+    std::cout << "Testing hydraulic erosion determinism..." << std::endl;
+
+    // Short droplet lifetime keeps tiles small, so the map spans many tiles
+    HydraulicErosionParams params;
+    params.numIterations = 20000;
+    params.maxDropletLifetime = 16;
+
+    auto erode = [&](bool parallel, unsigned int seed) {
+        Heightmap heightmap = makeErosionTestHeightmap(256, 192);
+        TerrainErosion erosion;
+        erosion.setSeed(seed);
+        HydraulicErosionParams runParams = params;
+        runParams.parallel = parallel;
+        erosion.simulateHydraulicErosion(heightmap, runParams);
+        return heightmap.getData();
+    };
+
+    std::vector<float> serial = erode(false, 42u);
+    std::vector<float> pooled = erode(true, 42u);
+    std::vector<float> pooledAgain = erode(true, 42u);
+    assert(serial == pooled);
+    assert(pooled == pooledAgain);
+
+    // Erosion actually changed the terrain, and a different seed changes it differently
+    assert(serial != makeErosionTestHeightmap(256, 192).getData());
+    assert(erode(true, 43u) != serial);
+
+    std::cout << "  Erosion determinism test passed!" << std::endl;
+}
+
+// Small world config so full generation runs quickly
+WorldGenConfig makeSmallWorldConfig(uint32_t seed) {
+    WorldGenConfig config;
+    config.seed = seed;
+    config.heightmapResolution = 128;
+    return config;
+}
+
+// Test that cancelling a run keeps the previous world and its derived state
+void testCancelKeepsPreviousWorld() {
+    std::cout << "Testing world generation cancellation..." << std::endl;
+
+    ProceduralWorld procWorld;
+    procWorld.generate(makeSmallWorldConfig(11u));
+    const GeneratedWorld* previous = procWorld.getCurrentWorld();
+    assert(previous != nullptr);
+    std::vector<uint8_t> previousBiomeMap = procWorld.getBiomeMapRGBA();
+    assert(!previousBiomeMap.empty());
+
+    // Cancel from the progress callback at several points in the pipeline,
+    // including after the biome map texture has been built
+    for (float cancelAt : {0.2f, 0.5f, 0.74f, 0.79f}) {
+        bool cancelled = false;
+        procWorld.setProgressCallback([&](float progress, const char*) {
+            if (progress >= cancelAt) procWorld.requestCancel();
+        });
+        try {
+            procWorld.generate(makeSmallWorldConfig(22u));
+        } catch (const WorldGenCancelled&) {
+            cancelled = true;
+        }
+        assert(cancelled);
+        assert(!procWorld.isCancelRequested());
+        assert(procWorld.getCurrentWorld() == previous);
+        assert(procWorld.getCurrentWorld()->planetSeed.masterSeed == 11u);
+        assert(procWorld.getLastSeed() == 11u);
+        assert(procWorld.getLastConfig().seed == 11u);
+        assert(procWorld.getBiomeMapRGBA() == previousBiomeMap);
+    }
+    procWorld.setProgressCallback(nullptr);
+
+    // A cancel requested before the run starts is honoured, then cleared
+    procWorld.requestCancel();
+    bool cancelled = false;
+    try {
+        procWorld.generate(makeSmallWorldConfig(33u));
+    } catch (const WorldGenCancelled&) {
+        cancelled = true;
+    }
+    assert(cancelled);
+    assert(procWorld.getLastSeed() == 11u);
+
+    procWorld.generate(makeSmallWorldConfig(33u));
+    assert(procWorld.getLastSeed() == 33u);
+    assert(procWorld.getCurrentWorld()->planetSeed.masterSeed == 33u);
+
+    std::cout << "  World generation cancellation test passed!" << std::endl;
+}
+
+// Fresh, empty cache directory under the system temp path
+std::string makeCacheTestDirectory(const char* name) {
+    std::filesystem::path dir = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(dir);
+    return dir.string();
+}
+
+std::string cacheEntryPath(const std::string& dir, uint64_t key) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.world", static_cast<unsigned long long>(key));
+    return (std::filesystem::path(dir) / name).string();
+}
+
+// Island-only world with recognizable contents
+GeneratedWorld makeCacheTestWorld(int size) {
+    GeneratedWorld world;
+    IslandData& island = world.islandData;
+    island.width = size;
+    island.height = size;
+    for (int i = 0; i < size * size; i++) {
+        island.heightmap.push_back(i * 0.25f);
+        island.underwaterHeightmap.push_back(-static_cast<float>(i));
+        island.coastalTypeMap.push_back(static_cast<uint8_t>(i % 5));
+    }
+    island.params.seed = 1234;
+    return world;
+}
+
+// Test that the cache key depends on the resolved seed and config, nothing else
+void testWorldCacheKeyStability() {
+    std::cout << "Testing world cache key stability..." << std::endl;
+
+    WorldGenConfig config;
+    const uint64_t key = WorldCache::computeKey(config, 42u);
+
+    // Same inputs, separately constructed config: same key
+    WorldGenConfig copy = config;
+    assert(WorldCache::computeKey(copy, 42u) == key);
+    assert(WorldCache::computeKey(WorldGenConfig(), 42u) == key);
+
+    // config.seed is superseded by the resolved seed
+    copy.seed = 999u;
+    assert(WorldCache::computeKey(copy, 42u) == key);
+
+    // Seed and generation-affecting fields change the key
+    assert(WorldCache::computeKey(config, 43u) != key);
+    WorldGenConfig changed = config;
+    changed.islandSize += 0.01f;
+    assert(WorldCache::computeKey(changed, 42u) != key);
+    changed = config;
+    changed.heightmapResolution = config.heightmapResolution / 2;
+    assert(WorldCache::computeKey(changed, 42u) != key);
+    changed = config;
+    changed.generateRivers = !config.generateRivers;
+    assert(WorldCache::computeKey(changed, 42u) != key);
+
+    std::cout << "  World cache key stability test passed!" << std::endl;
+}
+
+// Test that damaged, truncated and mismatched entries are discarded as misses
+void testWorldCacheCorruptionDetection() {
+    std::cout << "Testing world cache corruption detection..." << std::endl;
+
+    const std::string dir = makeCacheTestDirectory("organism_world_cache_corrupt");
+    WorldCache cache(dir);
+    GeneratedWorld world = makeCacheTestWorld(32);
+    const uint64_t key = 0x1111;
+    const std::string path = cacheEntryPath(dir, key);
+
+    // Round trip first
+    assert(cache.storeWorld(key, world));
+    {
+        WorldCache::Entry entry;
+        assert(cache.loadWorld(key, entry));
+        IslandData restored;
+        assert(WorldCache::restoreIslandData(entry, restored));
+        assert(restored.heightmap == world.islandData.heightmap);
+        assert(restored.coastalTypeMap == world.islandData.coastalTypeMap);
+        assert(restored.params.seed == 1234);
+    }
+
+    // Flipped payload byte fails the checksum and the file is removed
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(600);
+        char byte = 0;
+        file.read(&byte, 1);
+        file.seekp(600);
+        file.put(static_cast<char>(byte ^ 0x5A));
+    }
+    WorldCache::Entry entry;
+    assert(!cache.loadWorld(key, entry));
+    assert(!entry.isOpen());
+    assert(!std::filesystem::exists(path));
+    assert(cache.getStats().corruptEntries == 1);
+
+    // Truncated file
+    assert(cache.storeWorld(key, world));
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 16);
+    assert(!cache.loadWorld(key, entry));
+    assert(!std::filesystem::exists(path));
+    assert(cache.getStats().corruptEntries == 2);
+
+    // A valid file under the wrong key name is stale, not a hit
+    assert(cache.storeWorld(key, world));
+    const uint64_t otherKey = 0x2222;
+    std::filesystem::rename(path, cacheEntryPath(dir, otherKey));
+    assert(!cache.loadWorld(otherKey, entry));
+    assert(cache.getStats().corruptEntries == 3);
+
+    // Plain miss is not counted as corruption
+    assert(!cache.loadWorld(0x3333, entry));
+    assert(cache.getStats().corruptEntries == 3);
+
+    std::filesystem::remove_all(dir);
+    std::cout << "  World cache corruption detection test passed!" << std::endl;
+}
+
+// Test that the size cap evicts least recently used entries first
+void testWorldCacheLRUEviction() {
+    std::cout << "Testing world cache LRU eviction..." << std::endl;
+
+    const std::string dir = makeCacheTestDirectory("organism_world_cache_lru");
+    WorldCache cache(dir);
+    GeneratedWorld world = makeCacheTestWorld(32);
+
+    const uint64_t keyA = 0xA, keyB = 0xB, keyC = 0xC, keyD = 0xD;
+    assert(cache.storeWorld(keyA, world));
+    assert(cache.storeWorld(keyB, world));
+    assert(cache.storeWorld(keyC, world));
+    const uint64_t entryBytes = std::filesystem::file_size(cacheEntryPath(dir, keyA));
+
+    // Pin distinct ages (oldest first: A, B, C) so timestamp granularity
+    // can't reorder them, then touch A with a hit
+    auto now = std::filesystem::file_time_type::clock::now();
+    std::filesystem::last_write_time(cacheEntryPath(dir, keyA), now - std::chrono::hours(3));
+    std::filesystem::last_write_time(cacheEntryPath(dir, keyB), now - std::chrono::hours(2));
+    std::filesystem::last_write_time(cacheEntryPath(dir, keyC), now - std::chrono::hours(1));
+    {
+        WorldCache::Entry entry;
+        assert(cache.loadWorld(keyA, entry));
+    }
+
+    // Room for two entries: B is now the least recently used
+    cache.setMaxBytes(entryBytes * 2 + entryBytes / 2);
+    assert(cache.getStats().evictions == 1);
+    assert(std::filesystem::exists(cacheEntryPath(dir, keyA)));
+    assert(!std::filesystem::exists(cacheEntryPath(dir, keyB)));
+    assert(std::filesystem::exists(cacheEntryPath(dir, keyC)));
+
+    // Storing D evicts C (older than A's hit) and never the entry just written
+    assert(cache.storeWorld(keyD, world));
+    assert(cache.getStats().evictions == 2);
+    assert(std::filesystem::exists(cacheEntryPath(dir, keyA)));
+    assert(!std::filesystem::exists(cacheEntryPath(dir, keyC)));
+    assert(std::filesystem::exists(cacheEntryPath(dir, keyD)));
+
+    std::filesystem::remove_all(dir);
+    std::cout << "  World cache LRU eviction test passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "=== World Generation Unit Tests ===" << std::endl;
+
+    testDistanceToWaterMatchesBruteForce();
+    testDistanceToWaterWithoutWater();
+    testErosionDeterminism();
+    testCancelKeepsPreviousWorld();
+    testWorldCacheKeyStability();
+    testWorldCacheCorruptionDetection();
+    testWorldCacheLRUEviction();
+
+    std::cout << "\n=== All World Generation tests passed! ===" << std::endl;
+    return 0;
+}